@@ -0,0 +1,176 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 - 2025, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include <VSCP.h>           // VSCP framework
+#include <VSCPMcp2515.h>    // Interrupt driven MCP2515 CAN transport
+
+// Create an instance of the VSCP framework
+VSCP        vscp;
+
+// Create an instance of the MCP2515 CAN transport
+VSCPMcp2515 canTransport;
+
+// Node is in active state or not
+static bool isActive = false;
+
+// Lend a received message from the transport layer, e.g. the CAN bus.
+// The messages are received in the background by the MCP2515 interrupt.
+// If no message is received return NULL.
+vscp_RxMessage const * transportBorrow(void) {
+  return canTransport.borrow();
+}
+
+// Give a lent message back to the transport layer.
+void transportRelease(vscp_RxMessage const * const rxMsg) {
+  canTransport.release(rxMsg);
+}
+
+// Read a message from the transport layer, e.g. the CAN bus
+// If no message is received return false, otherwise true.
+bool transportRead(vscp_RxMessage * const rxMsg) {
+  return canTransport.read(rxMsg);
+}
+
+// Write a message to the transport layer, e.g. the CAN bus
+// If it fails to send the message return false, otherwise true.
+// Don't wait here, the VSCP framework queues the message and retries later.
+bool transportWrite(vscp_TxMessage const * const txMsg) {
+  return canTransport.write(txMsg);
+}
+
+// Configure the acceptance filters of the CAN controller.
+// Only used, if VSCP_CONFIG_RX_FILTER is enabled.
+void transportSetFilter(vscp_AcceptanceFilter const * const filters, uint8_t num) {
+  canTransport.setFilter(filters, num);
+}
+
+// Execute a action which was triggered by the decision matrix
+void actionExecute(unsigned char action, unsigned char par, vscp_RxMessage const * const msg) {
+
+    if (NULL == msg) {
+        return;
+    }
+
+    switch(action)
+    {
+    // Implement your code here ...
+    
+    default:
+        break;
+    }
+
+    return;
+}
+
+void setup() {
+
+  // Set the baudrate of the serial connection to the PC
+  Serial.begin(115200);
+  Serial.println("VSCP node starts up ...");
+  
+  // Initialize the CAN controller with 125 kbit/s (VSCP default bitrate)
+  if (false == canTransport.begin(
+    9,                          // CS (chip select) pin, note if you use a CAN BUS shield prior to V1.1 use pin 10!
+    2,                          // INT (interrupt) pin
+    VSCPMcp2515::CLOCK_16MHZ    // MCP2515 oscillator frequency
+  )) {
+  
+    Serial.println("Failed to initialize CAN controller!");
+    
+  } else {
+  
+    Serial.println("CAN controller initialized successful.");
+  
+    // Node GUID - Used to unique identify nodes
+    VSCPGuid  nodeGuid = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 };
+      
+    // Setup VSCP framework
+    vscp.setup(
+      8,              // Status lamp pin
+      7,              // Init button pin
+      nodeGuid,       // Node GUID,
+      255,            // Node zone (255 = all zones)
+      255,            // Node sub-zone (255 = all sub-zones)
+      transportRead,  // VSCP framework calls it to read a message
+      transportWrite, // VSCP framework calls it to write a message
+      actionExecute   // VSCP framework calls it to execute action
+    );
+    
+    // Process the received messages in place, without copying them
+    vscp.setTransportBorrowed(transportBorrow, transportRelease);
+    
+    // Let the CAN controller drop not relevant messages
+    vscp.setTransportFilter(transportSetFilter);
+  }
+  
+}
+
+void loop() {
+
+  // Process the VSCP framework
+  vscp.process();
+
+  // Send and receive VSCP messages only in active state
+  if (true == vscp.isActive()) {
+  
+    vscp_RxMessage  rxMsg;  // Receive message
+    
+    // If the node enters active state, it will be shown to the user
+    if (false == isActive) {
+    
+      Serial.println("Active state entered.");
+      isActive = true;
+    }
+    
+    // Any VSCP message received?
+    if (true == vscp.read(rxMsg)) {
+    
+        // Implement your code here ...
+        
+    }
+    
+    // Send a VSCP message here ...
+    
+    // Report lost messages
+    if (0 < canTransport.getRxOverflows()) {
+      Serial.println("Receive queue overflow!");
+    }
+    
+    if (0 < canTransport.getHwRxOverflows()) {
+      Serial.println("CAN controller receive overflow!");
+    }
+    
+  } else {
+  
+    // If the node leaves active state, it will be shown to the user
+    if (true == isActive) {
+      Serial.println("Active state left.");
+      isActive = false;
+    }
+  
+  }
+  
+}
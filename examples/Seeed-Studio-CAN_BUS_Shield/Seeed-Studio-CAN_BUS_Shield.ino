@@ -52,11 +52,7 @@ bool transportRead(vscp_RxMessage * const rxMsg) {
     
     if (CAN_OK == canCom.readMsgBuf(&canMsgId, &rxMsg->dataSize, rxMsg->data)) {
     
-        rxMsg->vscpClass  = (uint16_t)((canMsgId >> 16) & 0x01ff);
-        rxMsg->vscpType   = (uint8_t)((canMsgId >> 8) & 0x00ff);
-        rxMsg->oAddr      = (uint8_t)((canMsgId >> 0) & 0x00ff);
-        rxMsg->hardCoded  = (uint8_t)((canMsgId >> 25) & 0x0001);
-        rxMsg->priority   = (VSCP_PRIORITY)((canMsgId >> 26) & 0x0007);
+        vscp_can_id_decode(canMsgId, rxMsg);
             
         status = true;
     }
@@ -67,38 +63,18 @@ bool transportRead(vscp_RxMessage * const rxMsg) {
 
 // Write a message to the transport layer, e.g. the CAN bus
 // If it fails to send the message return false, otherwise true.
+// Don't wait here, the VSCP framework queues the message and retries later.
 bool transportWrite(vscp_TxMessage const * const txMsg) {
   
   bool          status    = false;
   unsigned long canMsgId  = 0;
-  unsigned char retryCnt  = 0;
   
-  canMsgId = (((uint32_t)txMsg->priority)  << 26) |
-             (((uint32_t)txMsg->hardCoded) << 25) |
-             (((uint32_t)txMsg->vscpClass) << 16) |
-             (((uint32_t)txMsg->vscpType)  <<  8) |
-             txMsg->oAddr;
+  canMsgId = vscp_can_id_encode(txMsg);
   
-  do {
-    
-    // Before any retry, wait some time
-    if (0 < retryCnt)
-    {
-      delay(100);
-    }
-    
-    // Send CAN message
-    if (CAN_OK != canCom.sendMsgBuf(canMsgId, 1, txMsg->dataSize, (unsigned char*)txMsg->data)) {
-      
-      // CAN message couldn't be sent, try again.
-      ++retryCnt;
-    }
-    // Successl sent
-    else {
-      status = true;
-    }
-  
-  } while((false == status) && (0 < retryCnt));
+  // Send CAN message
+  if (CAN_OK == canCom.sendMsgBuf(canMsgId, 1, txMsg->dataSize, (unsigned char*)txMsg->data)) {
+    status = true;
+  }
   
   return status;
 }
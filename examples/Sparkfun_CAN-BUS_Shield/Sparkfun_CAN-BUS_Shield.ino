@@ -54,11 +54,7 @@ bool transportRead(vscp_RxMessage * const rxMsg) {
     
       unsigned char index = 0;
     
-      rxMsg->vscpClass  = (uint16_t)((canMsg.can_id >> 16) & 0x01ff);
-      rxMsg->vscpType   = (uint8_t)((canMsg.can_id >> 8) & 0x00ff);
-      rxMsg->oAddr      = (uint8_t)((canMsg.can_id >> 0) & 0x00ff);
-      rxMsg->hardCoded  = (uint8_t)((canMsg.can_id >> 25) & 0x0001);
-      rxMsg->priority   = (VSCP_PRIORITY)((canMsg.can_id >> 26) & 0x0007);
+      vscp_can_id_decode(canMsg.can_id, rxMsg);
       rxMsg->dataSize   = canMsg.can_dlc;
       
       // Protect against a buffer out of bounce access
@@ -82,21 +78,15 @@ bool transportRead(vscp_RxMessage * const rxMsg) {
 
 // Write a message to the transport layer, e.g. the CAN bus
 // If it fails to send the message return false, otherwise true.
+// Don't wait here, the VSCP framework queues the message and retries later.
 bool transportWrite(vscp_TxMessage const * const txMsg) {
   
   bool              status    = false;
   struct can_frame  canMsg;
   unsigned char     index     = 0;
-  unsigned char     retryCnt  = 0;
     
-  canMsg.can_id = (1 << 31) | // Extended 29 bit
-                  (0 << 30) | // No RTR
-                  (0 << 29) | // No error message frame
-                  (((uint32_t)txMsg->priority)  << 26) |
-                  (((uint32_t)txMsg->hardCoded) << 25) |
-                  (((uint32_t)txMsg->vscpClass) << 16) |
-                  (((uint32_t)txMsg->vscpType)  <<  8) |
-                  txMsg->oAddr;
+  canMsg.can_id = (1UL << 31) | // Extended 29 bit, no RTR, no error message frame
+                  vscp_can_id_encode(txMsg);
 
   canMsg.can_dlc = txMsg->dataSize;
   
@@ -105,26 +95,10 @@ bool transportWrite(vscp_TxMessage const * const txMsg) {
     canMsg.data[index] = txMsg->data[index];
   }
   
-  do {
-    
-    // Before any retry, wait some time
-    if (0 < retryCnt)
-    {
-      delay(100);
-    }
-    
-    // Send CAN message
-    if (MCP2515::ERROR_OK == mcp2515.sendMessage(&canMsg)) {
-      
-      // CAN message couldn't be sent, try again.
-      ++retryCnt;
-    }
-    // Successl sent
-    else {
-      status = true;
-    }
-  
-  } while((false == status) && (0 < retryCnt));
+  // Send CAN message
+  if (MCP2515::ERROR_OK == mcp2515.sendMessage(&canMsg)) {
+    status = true;
+  }
 
   return status;
 }
@@ -0,0 +1,275 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Arduino core stub for the host
+@file   Arduino.cpp
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see Arduino.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "Arduino.h"
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static uint64_t arduino_getTimeUs(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Start time in us, which is the reference for millis() and micros(). */
+static uint64_t arduino_startTimeUs = 0;
+
+/** Simulated digital pin levels */
+static uint8_t  arduino_pinLevel[ARDUINO_HOST_PIN_NUM];
+
+/** Are the interrupts enabled or not */
+static bool             arduino_isInterruptEnabled  = true;
+
+/** Number of interrupts() calls */
+static unsigned long    arduino_interruptEnables    = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/** Serial interface */
+HardwareSerial Serial;
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+extern "C" unsigned long millis(void)
+{
+    return (unsigned long)(arduino_getTimeUs() / 1000U);
+}
+
+extern "C" unsigned long micros(void)
+{
+    return (unsigned long)arduino_getTimeUs();
+}
+
+extern "C" void delay(unsigned long ms)
+{
+    struct timespec ts;
+
+    ts.tv_sec   = ms / 1000U;
+    ts.tv_nsec  = (long)(ms % 1000U) * 1000000L;
+
+    (void)nanosleep(&ts, NULL);
+
+    return;
+}
+
+extern "C" void delayMicroseconds(unsigned int us)
+{
+    struct timespec ts;
+
+    ts.tv_sec   = us / 1000000U;
+    ts.tv_nsec  = (long)(us % 1000000U) * 1000L;
+
+    (void)nanosleep(&ts, NULL);
+
+    return;
+}
+
+extern "C" void noInterrupts(void)
+{
+    arduino_isInterruptEnabled = false;
+
+    return;
+}
+
+extern "C" void interrupts(void)
+{
+    arduino_isInterruptEnabled = true;
+    ++arduino_interruptEnables;
+
+    return;
+}
+
+extern "C" void attachInterrupt(uint8_t interrupt, arduino_Isr isr, int mode)
+{
+    (void)interrupt;
+    (void)isr;
+    (void)mode;
+
+    return;
+}
+
+extern "C" void detachInterrupt(uint8_t interrupt)
+{
+    (void)interrupt;
+
+    return;
+}
+
+extern "C" bool arduino_host_isInterruptEnabled(void)
+{
+    return arduino_isInterruptEnabled;
+}
+
+extern "C" unsigned long arduino_host_getInterruptEnables(void)
+{
+    return arduino_interruptEnables;
+}
+
+extern "C" void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (ARDUINO_HOST_PIN_NUM > pin)
+    {
+        /* A input with pull-up is high, as long as nobody pulls it down. */
+        if (INPUT_PULLUP == mode)
+        {
+            arduino_pinLevel[pin] = HIGH;
+        }
+    }
+
+    return;
+}
+
+extern "C" void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if (ARDUINO_HOST_PIN_NUM > pin)
+    {
+        arduino_pinLevel[pin] = (LOW == value) ? LOW : HIGH;
+    }
+
+    return;
+}
+
+extern "C" int digitalRead(uint8_t pin)
+{
+    int level = LOW;
+
+    if (ARDUINO_HOST_PIN_NUM > pin)
+    {
+        level = arduino_pinLevel[pin];
+    }
+
+    return level;
+}
+
+void HardwareSerial::print(const char* str)
+{
+    if ((true == mIsEnabled) &&
+        (NULL != str))
+    {
+        (void)fputs(str, stdout);
+    }
+
+    return;
+}
+
+void HardwareSerial::print(long value, int base)
+{
+    if (true == mIsEnabled)
+    {
+        (void)printf((HEX == base) ? "%lX" : "%ld", value);
+    }
+
+    return;
+}
+
+void HardwareSerial::println(void)
+{
+    print("\n");
+
+    return;
+}
+
+void HardwareSerial::println(const char* str)
+{
+    print(str);
+    println();
+
+    return;
+}
+
+void HardwareSerial::println(long value, int base)
+{
+    print(value, base);
+    println();
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Get the time in us since the first call.
+ *
+ * @return Time in us
+ */
+static uint64_t arduino_getTimeUs(void)
+{
+    struct timespec ts;
+    uint64_t        now = 0;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    now = ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+
+    if (0 == arduino_startTimeUs)
+    {
+        arduino_startTimeUs = now;
+    }
+
+    return now - arduino_startTimeUs;
+}
@@ -0,0 +1,296 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Arduino core stub for the host
+@file   Arduino.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This header file provides the small part of the Arduino core, which is used by
+the VSCP framework. It allows to build the framework on a host (Linux) system.
+
+- millis() and micros() are based on the monotonic system clock.
+- The digital pins are simulated in RAM. Writing to a input pin sets its level,
+  which is the way to simulate e.g. a pressed button.
+- The serial output is written to stdout, if enabled.
+- There are no interrupts, a attached interrupt service routine is never
+  called. Only the state of the interrupt enable is kept and how often they
+  were enabled.
+
+*******************************************************************************/
+/** @defgroup arduino_host Arduino core stub for the host
+ * This module provides the Arduino core functions, used by the VSCP framework.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __ARDUINO_H__
+#define __ARDUINO_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Pin level low */
+#define LOW             0x0
+
+/** Pin level high */
+#define HIGH            0x1
+
+/** Pin mode input */
+#define INPUT           0x0
+
+/** Pin mode output */
+#define OUTPUT          0x1
+
+/** Pin mode input with pull-up */
+#define INPUT_PULLUP    0x2
+
+/** Interrupt mode: Falling edge */
+#define FALLING         0x2
+
+/** Bit order: Most significant bit first */
+#define MSBFIRST        0x1
+
+/** Number base: decimal */
+#define DEC             10
+
+/** Number base: hexadecimal */
+#define HEX             16
+
+/** Number of simulated digital pins */
+#define ARDUINO_HOST_PIN_NUM    64
+
+/** Program memory is the same as the RAM on the host. */
+#define PROGMEM
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** On the host every digital pin is its own interrupt. */
+#define digitalPinToInterrupt(__pin)    (__pin)
+
+/** Read a byte from the program memory. */
+#define pgm_read_byte(__addr)   (*(const uint8_t*)(__addr))
+
+/** Copy from the program memory. */
+#define memcpy_P(__dst, __src, __size)  memcpy((__dst), (__src), (__size))
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Interrupt service routine */
+typedef void (*arduino_Isr)(void);
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Get the number of milliseconds since the program started.
+ *
+ * @return Milliseconds
+ */
+extern unsigned long millis(void);
+
+/**
+ * Get the number of microseconds since the program started.
+ *
+ * @return Microseconds
+ */
+extern unsigned long micros(void);
+
+/**
+ * Wait the given number of milliseconds.
+ *
+ * @param[in]   ms  Milliseconds
+ */
+extern void delay(unsigned long ms);
+
+/**
+ * Wait the given number of microseconds.
+ *
+ * @param[in]   us  Microseconds
+ */
+extern void delayMicroseconds(unsigned int us);
+
+/**
+ * Disable the interrupts. On the host it only marks them as disabled.
+ */
+extern void noInterrupts(void);
+
+/**
+ * Enable the interrupts. On the host it only marks them as enabled.
+ */
+extern void interrupts(void);
+
+/**
+ * Attach a interrupt service routine to a interrupt.
+ *
+ * @param[in]   interrupt   Interrupt number
+ * @param[in]   isr         Interrupt service routine
+ * @param[in]   mode        Interrupt mode, e.g. FALLING
+ */
+extern void attachInterrupt(uint8_t interrupt, arduino_Isr isr, int mode);
+
+/**
+ * Detach the interrupt service routine from a interrupt.
+ *
+ * @param[in]   interrupt   Interrupt number
+ */
+extern void detachInterrupt(uint8_t interrupt);
+
+/**
+ * Get whether the interrupts are enabled.
+ *
+ * @return If the interrupts are enabled, it will return true otherwise false.
+ */
+extern bool arduino_host_isInterruptEnabled(void);
+
+/**
+ * Get how often the interrupts were enabled with interrupts(). It allows to
+ * find out, whether the interrupts were enabled in between.
+ *
+ * @return Number of interrupts() calls
+ */
+extern unsigned long arduino_host_getInterruptEnables(void);
+
+/**
+ * Configure a digital pin.
+ *
+ * @param[in]   pin     Pin number
+ * @param[in]   mode    INPUT, OUTPUT or INPUT_PULLUP
+ */
+extern void pinMode(uint8_t pin, uint8_t mode);
+
+/**
+ * Set the level of a digital pin.
+ *
+ * @param[in]   pin     Pin number
+ * @param[in]   value   LOW or HIGH
+ */
+extern void digitalWrite(uint8_t pin, uint8_t value);
+
+/**
+ * Get the level of a digital pin.
+ *
+ * @param[in]   pin     Pin number
+ * @return LOW or HIGH
+ */
+extern int digitalRead(uint8_t pin);
+
+#ifdef __cplusplus
+}
+
+/** Serial interface stub, which writes to stdout. */
+class HardwareSerial
+{
+public:
+
+    /**
+     * Create the serial interface stub.
+     */
+    HardwareSerial() :
+        mIsEnabled(false)
+    {
+    }
+
+    /**
+     * Destroy the serial interface stub.
+     */
+    ~HardwareSerial()
+    {
+    }
+
+    /**
+     * Begin the serial communication. On the host it enables the output.
+     *
+     * @param[in]   baudrate    Baudrate (not used)
+     */
+    void begin(unsigned long baudrate)
+    {
+        (void)baudrate;
+        mIsEnabled = true;
+    }
+
+    /**
+     * Stop the serial communication and disable the output.
+     */
+    void end(void)
+    {
+        mIsEnabled = false;
+    }
+
+    void print(const char* str);
+    void print(long value, int base = DEC);
+    void println(void);
+    void println(const char* str);
+    void println(long value, int base = DEC);
+
+private:
+
+    bool    mIsEnabled; /**< Is output enabled or not */
+};
+
+/** Serial interface */
+extern HardwareSerial Serial;
+
+#endif  /* __cplusplus */
+
+#endif  /* __ARDUINO_H__ */
+
+/** @} */
@@ -0,0 +1,141 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Arduino SPI library stub for the host
+@file   SPI.cpp
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see SPI.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "SPI.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Simulated SPI device */
+static spi_host_Transfer    spi_host_device     = NULL;
+
+/** Next byte is the first one of the transaction */
+static bool                 spi_host_isFirst    = false;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/** SPI bus */
+SPIClass SPI;
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+void SPIClass::begin(void)
+{
+    return;
+}
+
+void SPIClass::beginTransaction(SPISettings const & settings)
+{
+    (void)settings;
+
+    spi_host_isFirst = true;
+
+    return;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    uint8_t received    = 0xFF;
+
+    if (NULL != spi_host_device)
+    {
+        received = spi_host_device(data, spi_host_isFirst);
+    }
+
+    spi_host_isFirst = false;
+
+    return received;
+}
+
+void SPIClass::transfer(void* buf, size_t count)
+{
+    uint8_t*    data    = (uint8_t*)buf;
+    size_t      index   = 0;
+
+    for(index = 0; index < count; ++index)
+    {
+        data[index] = transfer(data[index]);
+    }
+
+    return;
+}
+
+void SPIClass::endTransaction(void)
+{
+    return;
+}
+
+extern void spi_host_setDevice(spi_host_Transfer func)
+{
+    spi_host_device = func;
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
@@ -0,0 +1,172 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Arduino SPI library stub for the host
+@file   SPI.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This header file provides the part of the Arduino SPI library, which is used by
+the MCP2515 transport. Every transferred byte is passed to a simulated SPI
+device, which returns the received byte. Without a device 0xFF is received.
+
+Like a SPI library without SPI_HAS_NOTUSINGINTERRUPT, the interrupts are not
+masked during a transaction.
+
+*******************************************************************************/
+/** @defgroup spi_host Arduino SPI library stub for the host
+ * This module provides the Arduino SPI library functions, used by the MCP2515
+ * transport.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __SPI_H__
+#define __SPI_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "Arduino.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** SPI mode 0: Clock idle low, sample on the rising edge */
+#define SPI_MODE0       0x00
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/**
+ * Simulated SPI device, which gets a transmitted byte and returns the
+ * received byte.
+ *
+ * @param[in]   data    Transmitted byte
+ * @param[in]   isFirst First byte of the transaction
+ * @return Received byte
+ */
+typedef uint8_t (*spi_host_Transfer)(uint8_t data, bool isFirst);
+
+/** SPI settings stub, the settings are not used. */
+class SPISettings
+{
+public:
+
+    /**
+     * Create the SPI settings.
+     *
+     * @param[in]   clock       SPI clock in Hz
+     * @param[in]   bitOrder    Bit order, e.g. MSBFIRST
+     * @param[in]   dataMode    SPI mode, e.g. SPI_MODE0
+     */
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+    {
+        (void)clock;
+        (void)bitOrder;
+        (void)dataMode;
+    }
+};
+
+/** SPI stub, which transfers to the simulated SPI device. */
+class SPIClass
+{
+public:
+
+    /**
+     * Initialize the SPI bus.
+     */
+    static void begin(void);
+
+    /**
+     * Start a transaction.
+     *
+     * @param[in]   settings    SPI settings
+     */
+    static void beginTransaction(SPISettings const & settings);
+
+    /**
+     * Transfer a single byte.
+     *
+     * @param[in]   data    Transmitted byte
+     * @return Received byte
+     */
+    static uint8_t transfer(uint8_t data);
+
+    /**
+     * Transfer a buffer. The transmitted bytes are replaced by the received
+     * bytes.
+     *
+     * @param[in,out]   buf     Buffer
+     * @param[in]       count   Number of bytes
+     */
+    static void transfer(void* buf, size_t count);
+
+    /**
+     * Stop a transaction.
+     */
+    static void endTransaction(void);
+};
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/** SPI bus */
+extern SPIClass SPI;
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Set the simulated SPI device.
+ *
+ * @param[in]   func    Transfer function of the device or NULL
+ */
+extern void spi_host_setDevice(spi_host_Transfer func);
+
+#endif  /* __SPI_H__ */
+
+/** @} */
@@ -0,0 +1,150 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  EEPROM stub for the host
+@file   eeprom.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This header file provides the EEPROM access of the avr-libc on a host system.
+The EEPROM is simulated in RAM and mirrored to a file, which survives a
+restart of the node. Without a file, the EEPROM starts erased (0xFF).
+
+*******************************************************************************/
+/** @defgroup eeprom_host EEPROM stub for the host
+ * This module provides the EEPROM access with a file backend.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __EEPROM_H__
+#define __EEPROM_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Last EEPROM address */
+#define E2END   0x0FFF
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Use the given file as EEPROM backend. If the file exists, its content is
+ * loaded, otherwise it is created with an erased EEPROM.
+ *
+ * @param[in]   fileName    Name of the EEPROM file
+ * @return If successful, it will return true otherwise false.
+ */
+extern bool eeprom_host_open(char const * fileName);
+
+/**
+ * Close the EEPROM file. The EEPROM keeps working in RAM only.
+ */
+extern void eeprom_host_close(void);
+
+/**
+ * Get the number of bytes, which were read from the EEPROM so far.
+ *
+ * @return Number of read bytes
+ */
+extern uint32_t eeprom_host_getReadCount(void);
+
+/**
+ * Get the number of bytes, which were written to the EEPROM so far.
+ *
+ * @return Number of written bytes
+ */
+extern uint32_t eeprom_host_getWriteCount(void);
+
+/**
+ * Read a single byte from the EEPROM.
+ *
+ * @param[in]   addr    Address
+ * @return Value
+ */
+extern uint8_t eeprom_read_byte(const uint8_t* addr);
+
+/**
+ * Write a single byte to the EEPROM.
+ *
+ * @param[in]   addr    Address
+ * @param[in]   value   Value
+ */
+extern void eeprom_write_byte(uint8_t* addr, uint8_t value);
+
+/**
+ * Write a single byte to the EEPROM, only if it differs.
+ *
+ * @param[in]   addr    Address
+ * @param[in]   value   Value
+ */
+extern void eeprom_update_byte(uint8_t* addr, uint8_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __EEPROM_H__ */
+
+/** @} */
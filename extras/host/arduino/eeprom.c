@@ -0,0 +1,261 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  EEPROM stub for the host
+@file   eeprom.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see eeprom.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "avr/eeprom.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** EEPROM size in byte */
+#define EEPROM_SIZE         (E2END + 1)
+
+/** Value of a erased EEPROM cell */
+#define EEPROM_ERASED_VALUE 0xFF
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** EEPROM content */
+static uint8_t  eeprom_image[EEPROM_SIZE];
+
+/** Is EEPROM content initialized or not */
+static bool     eeprom_isInitialized    = false;
+
+/** File descriptor of the EEPROM file */
+static int      eeprom_fd               = -1;
+
+/** Number of read bytes */
+static uint32_t eeprom_readCnt          = 0;
+
+/** Number of written bytes */
+static uint32_t eeprom_writeCnt         = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Use the given file as EEPROM backend. If the file exists, its content is
+ * loaded, otherwise it is created with an erased EEPROM.
+ *
+ * @param[in]   fileName    Name of the EEPROM file
+ * @return If successful, it will return true otherwise false.
+ */
+extern bool eeprom_host_open(char const * fileName)
+{
+    bool    status  = false;
+
+    eeprom_host_close();
+
+    memset(eeprom_image, EEPROM_ERASED_VALUE, sizeof(eeprom_image));
+    eeprom_isInitialized = true;
+
+    if (NULL != fileName)
+    {
+        eeprom_fd = open(fileName, O_RDWR | O_CREAT, 0644);
+
+        if (0 <= eeprom_fd)
+        {
+            ssize_t size = pread(eeprom_fd, eeprom_image, sizeof(eeprom_image), 0);
+
+            /* New file or shorter than the EEPROM? Complete it with erased cells. */
+            if (0 > size)
+            {
+                size = 0;
+            }
+
+            if (sizeof(eeprom_image) > (size_t)size)
+            {
+                memset(&eeprom_image[size], EEPROM_ERASED_VALUE, sizeof(eeprom_image) - (size_t)size);
+
+                if ((ssize_t)sizeof(eeprom_image) == pwrite(eeprom_fd, eeprom_image, sizeof(eeprom_image), 0))
+                {
+                    status = true;
+                }
+            }
+            else
+            {
+                status = true;
+            }
+
+            if (false == status)
+            {
+                eeprom_host_close();
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Close the EEPROM file. The EEPROM keeps working in RAM only.
+ */
+extern void eeprom_host_close(void)
+{
+    if (0 <= eeprom_fd)
+    {
+        (void)close(eeprom_fd);
+        eeprom_fd = -1;
+    }
+
+    return;
+}
+
+/**
+ * Get the number of bytes, which were read from the EEPROM so far.
+ *
+ * @return Number of read bytes
+ */
+extern uint32_t eeprom_host_getReadCount(void)
+{
+    return eeprom_readCnt;
+}
+
+/**
+ * Get the number of bytes, which were written to the EEPROM so far.
+ *
+ * @return Number of written bytes
+ */
+extern uint32_t eeprom_host_getWriteCount(void)
+{
+    return eeprom_writeCnt;
+}
+
+/**
+ * Read a single byte from the EEPROM.
+ *
+ * @param[in]   addr    Address
+ * @return Value
+ */
+extern uint8_t eeprom_read_byte(const uint8_t* addr)
+{
+    uintptr_t   index   = (uintptr_t)addr;
+    uint8_t     value   = EEPROM_ERASED_VALUE;
+
+    ++eeprom_readCnt;
+
+    if ((true == eeprom_isInitialized) &&
+        (EEPROM_SIZE > index))
+    {
+        value = eeprom_image[index];
+    }
+
+    return value;
+}
+
+/**
+ * Write a single byte to the EEPROM.
+ *
+ * @param[in]   addr    Address
+ * @param[in]   value   Value
+ */
+extern void eeprom_write_byte(uint8_t* addr, uint8_t value)
+{
+    uintptr_t   index   = (uintptr_t)addr;
+
+    ++eeprom_writeCnt;
+
+    if (false == eeprom_isInitialized)
+    {
+        memset(eeprom_image, EEPROM_ERASED_VALUE, sizeof(eeprom_image));
+        eeprom_isInitialized = true;
+    }
+
+    if (EEPROM_SIZE > index)
+    {
+        eeprom_image[index] = value;
+
+        /* Write through, like the real EEPROM. */
+        if (0 <= eeprom_fd)
+        {
+            (void)pwrite(eeprom_fd, &value, 1, (off_t)index);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Write a single byte to the EEPROM, only if it differs.
+ *
+ * @param[in]   addr    Address
+ * @param[in]   value   Value
+ */
+extern void eeprom_update_byte(uint8_t* addr, uint8_t value)
+{
+    if (value != eeprom_read_byte(addr))
+    {
+        eeprom_write_byte(addr, value);
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
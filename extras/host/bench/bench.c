@@ -0,0 +1,156 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Microbenchmark harness
+@file   bench.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see bench.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "bench.h"
+#include <stdio.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Number of bytes, copied by the benchmark environment. */
+static uint32_t bench_bytes = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Show the table header of the benchmark results.
+ */
+extern void bench_showHeader(void)
+{
+    printf("%-32s %10s %12s %12s\n", "Benchmark", "Iterations", bench_platform_getTimeUnit(), "bytes/event");
+
+    return;
+}
+
+/**
+ * Run a benchmark and show the result. The function is called once before
+ * the measurement, to warm up e.g. caches.
+ *
+ * @param[in]   name        Benchmark name
+ * @param[in]   func        Function, which handles a single event
+ * @param[in]   iterations  Number of iterations
+ */
+extern void bench_run(char const * name, bench_Func func, uint32_t iterations)
+{
+    uint32_t    index       = 0;
+    uint32_t    bytesBegin  = 0;
+    uint32_t    bytes       = 0;
+    uint64_t    timeBegin   = 0;
+    uint64_t    duration    = 0;
+
+    if ((NULL == name) ||
+        (NULL == func) ||
+        (0 == iterations))
+    {
+        return;
+    }
+
+    /* Warm up */
+    func();
+
+    bytesBegin  = bench_bytes + bench_platform_getBytes();
+    timeBegin   = bench_platform_getTime();
+
+    for(index = 0; index < iterations; ++index)
+    {
+        func();
+    }
+
+    duration    = bench_platform_getTime() - timeBegin;
+    bytes       = bench_bytes + bench_platform_getBytes() - bytesBegin;
+
+    /* Show the time per event with one decimal place. */
+    duration = (duration * 10U) / iterations;
+
+    printf("%-32s %10lu %10lu.%01u %12lu\n",
+        name,
+        (unsigned long)iterations,
+        (unsigned long)(duration / 10U),
+        (unsigned int)(duration % 10U),
+        (unsigned long)(bytes / iterations));
+
+    return;
+}
+
+/**
+ * Count bytes, which were copied by the benchmark environment, e.g. in the
+ * transport layer functions.
+ *
+ * @param[in]   size    Number of copied bytes
+ */
+extern void bench_countBytes(uint32_t size)
+{
+    bench_bytes += size;
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
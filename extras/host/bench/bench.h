@@ -0,0 +1,169 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Microbenchmark harness
+@file   bench.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a small benchmark harness, which runs on the host and on
+the AVR. It measures a function, which handles a single event, a number of
+times and reports the time and the copied bytes per event.
+
+The platform provides the time base and the byte counter:
+- Host: Time in ns. Copied bytes are the bytes read from and written to the
+  persistent memory and the messages copied via the transport layer.
+- AVR: Time in CPU cycles. Copied bytes are the messages copied via the
+  transport layer.
+
+*******************************************************************************/
+/** @defgroup bench Microbenchmark harness
+ * This module provides the microbenchmark harness.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+#if defined(__AVR__)
+
+/** The AVR is much slower, therefore all iterations are divided by it. */
+#define BENCH_ITERATION_DIVIDER 1000U
+
+#else   /* !defined(__AVR__) */
+
+/** The AVR is much slower, therefore all iterations are divided by it. */
+#define BENCH_ITERATION_DIVIDER 1U
+
+#endif  /* !defined(__AVR__) */
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Get the number of iterations on the current platform. */
+#define BENCH_ITERATIONS(__hostIterations)  \
+    ((BENCH_ITERATION_DIVIDER > (__hostIterations)) ? 1U : ((__hostIterations) / BENCH_ITERATION_DIVIDER))
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Function, which handles a single event. */
+typedef void (*bench_Func)(void);
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Show the table header of the benchmark results.
+ */
+extern void bench_showHeader(void);
+
+/**
+ * Run a benchmark and show the result. The function is called once before
+ * the measurement, to warm up e.g. caches.
+ *
+ * @param[in]   name        Benchmark name
+ * @param[in]   func        Function, which handles a single event
+ * @param[in]   iterations  Number of iterations
+ */
+extern void bench_run(char const * name, bench_Func func, uint32_t iterations);
+
+/**
+ * Count bytes, which were copied by the benchmark environment, e.g. in the
+ * transport layer functions.
+ *
+ * @param[in]   size    Number of copied bytes
+ */
+extern void bench_countBytes(uint32_t size);
+
+/**
+ * Platform specific: Get the current time.
+ *
+ * @return Time in ns (host) or CPU cycles (AVR)
+ */
+extern uint64_t bench_platform_getTime(void);
+
+/**
+ * Platform specific: Get the unit of the time.
+ *
+ * @return Unit of the time
+ */
+extern char const * bench_platform_getTimeUnit(void);
+
+/**
+ * Platform specific: Get the number of bytes, which were copied by the
+ * platform, e.g. from the persistent memory.
+ *
+ * @return Number of copied bytes
+ */
+extern uint32_t bench_platform_getBytes(void);
+
+/**
+ * Run all benchmark cases.
+ */
+extern void bench_cases_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __BENCH_H__ */
+
+/** @} */
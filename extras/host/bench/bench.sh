@@ -0,0 +1,41 @@
+#!/bin/sh
+# Build and run the microbenchmark for several framework configurations.
+#
+# Usage:
+#   bench/bench.sh          Run it from the extras/host directory
+#
+# Every configuration uses its own build directory. The decision matrix next
+# generation is moved to page 3, because 64 decision matrix rows need page 1
+# and 2.
+#
+# The bridge configuration adds the forwarding cases. The forwarded frames per
+# second are 1e9 divided by the ns per event.
+#
+# The multi instance configuration runs two framework instances in the same
+# process and adds a case, where one instance sends to the other.
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+COMMON="-DVSCP_CONFIG_ENABLE_LOOPBACK=VSCP_CONFIG_BASE_ENABLED \
+-DVSCP_CONFIG_ENABLE_DM_NEXT_GENERATION=VSCP_CONFIG_BASE_ENABLED \
+-DVSCP_CONFIG_DM_NG_PAGE=3 \
+-DVSCP_CONFIG_DM_NG_RULE_SET_SIZE=241"
+
+for ROWS in 10 32 64
+do
+    echo "=== Decision matrix rows: ${ROWS}"
+    make -s bench BUILD_DIR="build/bench_${ROWS}" VSCP_CONFIG="${COMMON} -DVSCP_CONFIG_DM_ROWS=${ROWS}"
+    "build/bench_${ROWS}/vscp_bench"
+    echo
+done
+
+echo "=== Bridge"
+make -s bench BUILD_DIR="build/bench_bridge" VSCP_CONFIG="${COMMON} -DVSCP_CONFIG_BRIDGE=VSCP_CONFIG_BASE_ENABLED"
+"build/bench_bridge/vscp_bench"
+echo
+
+echo "=== Multi instance"
+make -s bench BUILD_DIR="build/bench_multi" VSCP_CONFIG="${COMMON} -DVSCP_CONFIG_MULTI_INSTANCE=VSCP_CONFIG_BASE_ENABLED"
+"build/bench_multi/vscp_bench"
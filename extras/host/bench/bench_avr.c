@@ -0,0 +1,233 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Microbenchmark on the AVR
+@file   bench_avr.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+The AVR platform measures the time in CPU cycles with the 16-bit timer 1,
+which runs with the CPU clock and is extended to 32-bit by its overflow
+interrupt. The milliseconds for the VSCP timers are derived from it too, which
+limits a benchmark run to 2^32 cycles (268 s at 16 MHz).
+The results are written to the UART 0, which is e.g. shown by simavr:
+
+    simavr -m atmega2560 -f 16000000 build_avr/vscp_bench.elf
+
+The copied bytes contain only the messages, which were copied by the
+transport layer, because the EEPROM access of the avr-libc is not
+instrumented.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "bench.h"
+#include <stdio.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <avr/sleep.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static int bench_avr_putChar(char c, FILE* stream);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Number of timer 1 overflows */
+static volatile uint16_t    bench_avr_overflows = 0;
+
+/** Standard output stream via the UART */
+static FILE bench_avr_stdout = FDEV_SETUP_STREAM(bench_avr_putChar, NULL, _FDEV_SETUP_WRITE);
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Timer 1 overflow interrupt.
+ */
+ISR(TIMER1_OVF_vect)
+{
+    ++bench_avr_overflows;
+}
+
+/**
+ * Platform specific: Get the current time.
+ *
+ * @return Time in CPU cycles
+ */
+extern uint64_t bench_platform_getTime(void)
+{
+    uint16_t    overflows   = 0;
+    uint16_t    counter     = 0;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        overflows   = bench_avr_overflows;
+        counter     = TCNT1;
+
+        /* Overflow occurred, but not handled yet? */
+        if ((0 != (TIFR1 & _BV(TOV1))) &&
+            (0x8000U > counter))
+        {
+            ++overflows;
+        }
+    }
+
+    return (((uint64_t)overflows) << 16) | counter;
+}
+
+/**
+ * Platform specific: Get the unit of the time.
+ *
+ * @return Unit of the time
+ */
+extern char const * bench_platform_getTimeUnit(void)
+{
+    return "cycles/event";
+}
+
+/**
+ * Platform specific: Get the number of bytes, which were copied by the
+ * platform, e.g. from the persistent memory.
+ *
+ * @return Number of copied bytes
+ */
+extern uint32_t bench_platform_getBytes(void)
+{
+    return 0;
+}
+
+/**
+ * Get the milliseconds since start, which are used by the VSCP timers.
+ *
+ * @return Milliseconds
+ */
+unsigned long millis(void)
+{
+    return ((uint32_t)bench_platform_getTime()) / (F_CPU / 1000UL);
+}
+
+/**
+ * Get the microseconds since start.
+ *
+ * @return Microseconds
+ */
+unsigned long micros(void)
+{
+    return ((uint32_t)bench_platform_getTime()) / (F_CPU / 1000000UL);
+}
+
+/**
+ * Main entry point.
+ *
+ * @return Exit status
+ */
+int main(void)
+{
+    /* UART 0: 115200 baud, 8N1 */
+    UBRR0H  = 0;
+    UBRR0L  = (uint8_t)((F_CPU / (8UL * 115200UL)) - 1UL);
+    UCSR0A  = _BV(U2X0);
+    UCSR0B  = _BV(TXEN0);
+    UCSR0C  = _BV(UCSZ01) | _BV(UCSZ00);
+    stdout  = &bench_avr_stdout;
+
+    /* Timer 1: Normal mode, no prescaler */
+    TCCR1A  = 0;
+    TCCR1B  = _BV(CS10);
+    TIMSK1  = _BV(TOIE1);
+    sei();
+
+    bench_cases_run();
+
+    /* Stop the simulation: simavr terminates on sleep with disabled interrupts. */
+    cli();
+    sleep_enable();
+    for(;;)
+    {
+        sleep_cpu();
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Write a single character to the UART.
+ *
+ * @param[in]   c       Character
+ * @param[in]   stream  Stream
+ * @return Always 0
+ */
+static int bench_avr_putChar(char c, FILE* stream)
+{
+    (void)stream;
+
+    if ('\n' == c)
+    {
+        (void)bench_avr_putChar('\r', stream);
+    }
+
+    loop_until_bit_is_set(UCSR0A, UDRE0);
+    UDR0 = c;
+
+    return 0;
+}
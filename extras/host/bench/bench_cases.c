@@ -0,0 +1,1045 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Microbenchmark cases
+@file   bench_cases.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the benchmark cases of the VSCP framework hot paths:
+- Decision matrix with all configured rows, only the last one matches.
+- Decision matrix next generation with several rule set sizes, only the last
+  rule matches.
+- Data coding in both directions.
+- Event builders.
+- Complete round trip through the core with the loopback transport.
+- Register access: A page read of the VSCP specific registers and a who is
+  there request, including all response events.
+- Message buffers: The cyclic buffer compared with the ring buffer, with
+  single and bulk copies and with in-place access.
+- Bridge: A frame received on port 1 is forwarded to port 0, once via a
+  route and once flooded to all ports and the node with changing nicknames.
+- Multi instance: Two framework instances in the same process. Instance 0
+  sends a event, which instance 1 receives.
+
+The decision matrices are written directly to the persistent memory, because
+the register interface of the standard decision matrix is limited to a
+single page.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include "vscp_core.h"
+#include "vscp_config.h"
+#include "vscp_ps.h"
+#include "vscp_dm.h"
+#include "vscp_dm_ng.h"
+#include "vscp_data_coding.h"
+#include "vscp_class_l1.h"
+#include "vscp_type_information.h"
+#include "vscp_type_measurement.h"
+#include "vscp_tp_adapter.h"
+#include "vscp_action.h"
+#include "vscp_portable.h"
+#include "vscp_evt_information.h"
+#include "vscp_evt_measurement.h"
+#include "vscp_util.h"
+#include "vscp_bridge.h"
+#include "vscp_segment.h"
+#include "vscp_type_display.h"
+#include "vscp_type_protocol.h"
+#include "vscp_instance.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Default number of iterations on the host. */
+#define BENCH_CASES_ITERATIONS          100000UL
+
+/** Nickname id of the node under test. */
+#define BENCH_CASES_NICKNAME            1
+
+/** Nickname id of the remote node, which sends the events. */
+#define BENCH_CASES_REMOTE_NICKNAME     2
+
+/** Max. number of process cycles until the node shall be active. */
+#define BENCH_CASES_STARTUP_CYCLES      10000UL
+
+/** Action id, which is used by all matching rows and rules. */
+#define BENCH_CASES_ACTION              1
+
+/** Size of a decision matrix next generation rule "class == x AND type == y". */
+#define BENCH_CASES_DM_NG_RULE_SIZE     10
+
+/** Max. number of decision matrix next generation rules. */
+#define BENCH_CASES_DM_NG_RULES_MAX     ((VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 1) / BENCH_CASES_DM_NG_RULE_SIZE)
+
+/** Number of messages in the storage of the message buffers. */
+#define BENCH_CASES_BUFFER_NUM          8
+
+/** Number of messages, which are copied at once by the bulk cases. */
+#define BENCH_CASES_BULK_NUM            4
+
+/** Payload size of a multi-frame stream, which needs 3 display events. */
+#define BENCH_CASES_SEGMENT_SIZE        15
+
+/** Number of different nicknames of the flooded frames, more than the bridge decision cache holds. */
+#define BENCH_CASES_BRIDGE_NICKNAMES    32
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL bench_cases_read(vscp_RxMessage * const msg);
+static BOOL bench_cases_write(vscp_TxMessage const * const msg);
+static void bench_cases_execute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg);
+static BOOL bench_cases_startNode(uint8_t nickname);
+static void bench_cases_drain(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+static void bench_cases_programDM(void);
+static void bench_cases_dm(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+static void bench_cases_programDMNG(uint8_t rules);
+static void bench_cases_dmNg(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+static void bench_cases_encode(void);
+static void bench_cases_decode(void);
+static void bench_cases_sendOn(void);
+static void bench_cases_sendTemperature(void);
+static void bench_cases_segmentSend(void);
+static void bench_cases_segmentReceive(void);
+static void bench_cases_pageRead(void);
+static void bench_cases_whoIsThere(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+static void bench_cases_roundTrip(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+static void bench_cases_cyclicBuffer(void);
+static void bench_cases_cyclicBufferBulk(void);
+static void bench_cases_ring(void);
+static void bench_cases_ringBulk(void);
+static void bench_cases_ringPeek(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+static BOOL bench_cases_bridgeRead(vscp_RxMessage * const msg);
+static BOOL bench_cases_bridgeWrite(vscp_TxMessage const * const msg);
+static void bench_cases_bridgeRoute(void);
+static void bench_cases_bridgeFlood(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+static BOOL bench_cases_linkRead(vscp_RxMessage * const msg);
+static BOOL bench_cases_linkWrite(vscp_TxMessage const * const msg);
+static void bench_cases_multiInstance(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Received event, which is used for the decision matrix cases. */
+static vscp_RxMessage   bench_cases_rxMsg;
+
+/** Event, which is received once by the transport layer or NULL. */
+static vscp_RxMessage const *   bench_cases_pendingMsg  = NULL;
+
+/** Number of executed actions */
+static volatile uint32_t    bench_cases_actionCnt   = 0;
+
+/** Value, which changes every iteration, to avoid constant folding. */
+static volatile int32_t     bench_cases_value       = 0;
+
+/** Coded data, used by the data coding cases. */
+static uint8_t  bench_cases_codedData[VSCP_L1_DATA_SIZE];
+
+/** Cyclic buffer, used by the message buffer cases. */
+static vscp_util_CyclicBuffer   bench_cases_cyclicBuf;
+
+/** Ring buffer, used by the message buffer cases. */
+static vscp_util_Ring           bench_cases_ringBuf;
+
+/** Storage of the message buffer under test. */
+static vscp_Message             bench_cases_bufStorage[BENCH_CASES_BUFFER_NUM];
+
+/** Messages, which are written to and read from the message buffers. */
+static vscp_Message             bench_cases_bufMsgs[BENCH_CASES_BULK_NUM];
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/** Is a frame on bridge port 1 pending? */
+static BOOL                     bench_cases_bridgeIsPending = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Frame on the link from instance 0 to instance 1 */
+static vscp_Message             bench_cases_linkMsg;
+
+/** Is a frame on the link pending? */
+static BOOL                     bench_cases_linkIsPending   = FALSE;
+
+/** Number of events, which instance 1 received. */
+static uint32_t                 bench_cases_linkRxCnt       = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Run all benchmark cases.
+ */
+extern void bench_cases_run(void)
+{
+    char    name[40];
+
+    vscp_tp_adapter_set(bench_cases_read, bench_cases_write);
+    vscp_action_set(bench_cases_execute);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+    bench_cases_programDM();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    bench_cases_programDMNG(1);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    if (FALSE == bench_cases_startNode(BENCH_CASES_NICKNAME))
+    {
+        printf("Node is not active.\n");
+        return;
+    }
+
+    /* Event from a remote node: CLASS1.INFORMATION ON */
+    memset(&bench_cases_rxMsg, 0, sizeof(bench_cases_rxMsg));
+    bench_cases_rxMsg.priority  = VSCP_PRIORITY_3_NORMAL;
+    bench_cases_rxMsg.vscpClass = VSCP_CLASS_L1_INFORMATION;
+    bench_cases_rxMsg.vscpType  = VSCP_TYPE_INFORMATION_ON;
+    bench_cases_rxMsg.oAddr     = BENCH_CASES_REMOTE_NICKNAME;
+    bench_cases_rxMsg.hardCoded = FALSE;
+    bench_cases_rxMsg.dataSize  = 3;
+    bench_cases_rxMsg.data[0]   = 0;    /* Index */
+    bench_cases_rxMsg.data[1]   = 255;  /* Zone */
+    bench_cases_rxMsg.data[2]   = 255;  /* Sub-zone */
+
+    bench_showHeader();
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    snprintf(name, sizeof(name), "dm_executeActions/%u rows", vscp_dm_getMatrixRows());
+    bench_run(name, bench_cases_dm, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+    {
+        uint8_t const   rules[] = { 1, BENCH_CASES_DM_NG_RULES_MAX / 2, BENCH_CASES_DM_NG_RULES_MAX };
+        uint8_t         index   = 0;
+
+        for(index = 0; index < (sizeof(rules) / sizeof(rules[0])); ++index)
+        {
+            /* Skip duplicates of small rule sets. */
+            if ((0 == rules[index]) ||
+                ((0 < index) && (rules[index - 1] == rules[index])))
+            {
+                continue;
+            }
+
+            bench_cases_programDMNG(rules[index]);
+
+            snprintf(name, sizeof(name), "dm_ng_executeActions/%u rules", rules[index]);
+            bench_run(name, bench_cases_dmNg, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+        }
+    }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    bench_run("data_coding_int32ToNormInt", bench_cases_encode, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+    bench_run("data_coding_normIntToInt32", bench_cases_decode, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+    bench_run("evt_information_sendOn", bench_cases_sendOn, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+    bench_run("evt_measurement_sendTemp", bench_cases_sendTemperature, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+    bench_run("segment_send/15 bytes", bench_cases_segmentSend, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+    bench_run("segment_receive/15 bytes", bench_cases_segmentReceive, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+    bench_run("core_process/page read 128 regs", bench_cases_pageRead, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS / 10U));
+    bench_run("core_process/who is there", bench_cases_whoIsThere, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS / 10U));
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+    bench_cases_drain();
+    bench_run("core_process/loopback", bench_cases_roundTrip, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+    /* Message buffers, all with the same storage. */
+    memset(bench_cases_bufMsgs, 0, sizeof(bench_cases_bufMsgs));
+
+    vscp_util_cyclicBufferInit(&bench_cases_cyclicBuf, bench_cases_bufStorage, sizeof(bench_cases_bufStorage), sizeof(bench_cases_bufStorage[0]));
+    bench_run("util_cyclicBuffer/1 msg", bench_cases_cyclicBuffer, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+    bench_run("util_cyclicBuffer/4 msgs", bench_cases_cyclicBufferBulk, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+    vscp_util_ringInit(&bench_cases_ringBuf, bench_cases_bufStorage, sizeof(bench_cases_bufStorage), sizeof(bench_cases_bufStorage[0]));
+    bench_run("util_ring/1 msg", bench_cases_ring, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+    bench_run("util_ring/4 msgs", bench_cases_ringBulk, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+    bench_run("util_ring/1 msg in-place", bench_cases_ringPeek, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+    {
+        uint32_t    forwarded   = 0;
+
+        bench_cases_drain();
+        vscp_bridge_setPort(1, bench_cases_bridgeRead, bench_cases_bridgeWrite);
+
+        /* Without any route, the frames are flooded. */
+        bench_run("bridge_process/flood", bench_cases_bridgeFlood, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+        /* Route 0: All frames from port 1 to port 0 */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 1, 0x00);    /* Class filter */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 2, 0x00);    /* Class mask */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 3, 0x00);    /* Type filter */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 4, 0x00);    /* Type mask */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 5, 0xFF);    /* Any nickname */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 6, 0x02);    /* Source: port 1 */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 7, 0x01);    /* Destination: port 0 */
+        (void)vscp_bridge_writeRegister(VSCP_CONFIG_BRIDGE_PAGE, 0, 0x80);    /* Enable */
+
+        forwarded = vscp_bridge_getForwarded();
+        bench_run("bridge_process/route", bench_cases_bridgeRoute, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+        forwarded = vscp_bridge_getForwarded() - forwarded;
+
+        printf("Bridge forwarded frames: %lu, drops on port 0: %u\n",
+            (unsigned long)forwarded,
+            vscp_bridge_getTxDrops(0));
+
+        vscp_bridge_restoreFactoryDefaultSettings();
+    }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+    /* Instance 1 is the remote node, which receives the events of instance 0. */
+    vscp_instance_select(1);
+    vscp_tp_adapter_set(bench_cases_linkRead, bench_cases_write);
+    vscp_action_set(bench_cases_execute);
+
+    if (FALSE == bench_cases_startNode(BENCH_CASES_REMOTE_NICKNAME))
+    {
+        printf("Instance 1 is not active.\n");
+    }
+    else
+    {
+        vscp_instance_select(0);
+        bench_cases_drain();
+        vscp_tp_adapter_set(bench_cases_read, bench_cases_linkWrite);
+
+        bench_run("core_process/2 instances", bench_cases_multiInstance, BENCH_ITERATIONS(BENCH_CASES_ITERATIONS));
+
+        vscp_instance_select(0);
+        printf("Instance 1 received events: %lu, nickname ids: %u, ",
+            (unsigned long)bench_cases_linkRxCnt,
+            vscp_core_readNicknameId());
+
+        vscp_instance_select(1);
+        printf("%u\n", vscp_core_readNicknameId());
+    }
+
+    vscp_instance_select(0);
+    vscp_tp_adapter_set(bench_cases_read, bench_cases_write);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+    printf("Executed actions: %lu\n", (unsigned long)bench_cases_actionCnt);
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Transport layer read function. There is no remote node on the bus.
+ *
+ * @param[out]  msg Message
+ * @return Always FALSE, because no message is received.
+ */
+static BOOL bench_cases_read(vscp_RxMessage * const msg)
+{
+    if (NULL == bench_cases_pendingMsg)
+    {
+        return FALSE;
+    }
+
+    *msg = *bench_cases_pendingMsg;
+    bench_cases_pendingMsg = NULL;
+
+    return TRUE;
+}
+
+/**
+ * Transport layer write function. The message is only counted.
+ *
+ * @param[in]   msg Message
+ * @return Always TRUE
+ */
+static BOOL bench_cases_write(vscp_TxMessage const * const msg)
+{
+    (void)msg;
+
+    bench_countBytes(sizeof(vscp_TxMessage));
+
+    return TRUE;
+}
+
+/**
+ * Action execution function. The actions are only counted.
+ *
+ * @param[in]   action  Action
+ * @param[in]   par     Action parameter
+ * @param[in]   msg     Received message, which triggered the action
+ */
+static void bench_cases_execute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg)
+{
+    (void)action;
+    (void)par;
+    (void)msg;
+
+    ++bench_cases_actionCnt;
+
+    return;
+}
+
+/**
+ * Start the node of the selected instance with a fixed nickname id and
+ * process it, until it is active.
+ *
+ * @param[in]   nickname    Nickname id
+ * @return If the node is active, it will return TRUE otherwise FALSE.
+ */
+static BOOL bench_cases_startNode(uint8_t nickname)
+{
+    uint32_t    cycles  = 0;
+
+    (void)vscp_core_init();
+
+    /* Skip the node discovery */
+    vscp_ps_writeNicknameId(nickname);
+    (void)vscp_core_init();
+
+    while((FALSE == vscp_core_isActive()) &&
+          (BENCH_CASES_STARTUP_CYCLES > cycles))
+    {
+        (void)vscp_core_process();
+        ++cycles;
+    }
+
+    bench_cases_drain();
+
+    return vscp_core_isActive();
+}
+
+/**
+ * Process all pending events, e.g. in the loopback, and throw the received
+ * events away.
+ */
+static void bench_cases_drain(void)
+{
+    vscp_RxMessage  rxMsg;
+
+    while(FALSE != vscp_core_process())
+    {
+        ;
+    }
+
+    while(FALSE != vscp_portable_read(&rxMsg))
+    {
+        ;
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+/**
+ * Program all decision matrix rows. Only the last row matches
+ * CLASS1.INFORMATION ON, all others CLASS1.CONTROL.
+ */
+static void bench_cases_programDM(void)
+{
+    uint8_t rows    = vscp_dm_getMatrixRows();
+    uint8_t row     = 0;
+
+    for(row = 0; row < rows; ++row)
+    {
+        uint8_t rowData[VSCP_DM_ROW_SIZE];
+
+        rowData[0] = 0;                                                         /* Originating address */
+        rowData[1] = VSCP_DM_FLAG_ENABLE;                                       /* Flags */
+        rowData[2] = 0xff;                                                      /* Class mask */
+        rowData[3] = ((rows - 1) == row) ? VSCP_CLASS_L1_INFORMATION : VSCP_CLASS_L1_CONTROL;  /* Class filter */
+        rowData[4] = 0xff;                                                      /* Type mask */
+        rowData[5] = VSCP_TYPE_INFORMATION_ON;                                  /* Type filter */
+        rowData[6] = BENCH_CASES_ACTION;                                        /* Action */
+        rowData[7] = row;                                                       /* Action parameter */
+
+        vscp_ps_writeDMMultiple(((uint16_t)row) * VSCP_DM_ROW_SIZE, rowData, VSCP_DM_ROW_SIZE);
+    }
+
+    /* Invalidate any cached decision matrix data. */
+    vscp_dm_init();
+
+    return;
+}
+
+/**
+ * Benchmark: Decision matrix with a received event.
+ */
+static void bench_cases_dm(void)
+{
+    vscp_dm_executeActions(&bench_cases_rxMsg);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+/**
+ * Program the decision matrix next generation rule set. Only the last rule
+ * matches CLASS1.INFORMATION ON, all others CLASS1.CONTROL.
+ *
+ * @param[in]   rules   Number of rules
+ */
+static void bench_cases_programDMNG(uint8_t rules)
+{
+    uint16_t    index   = 0;
+    uint8_t     rule    = 0;
+
+    if (BENCH_CASES_DM_NG_RULES_MAX < rules)
+    {
+        rules = BENCH_CASES_DM_NG_RULES_MAX;
+    }
+
+    vscp_ps_writeDMNextGeneration(index++, rules);
+
+    for(rule = 0; rule < rules; ++rule)
+    {
+        uint8_t ruleData[BENCH_CASES_DM_NG_RULE_SIZE];
+        uint8_t pos         = 0;
+
+        ruleData[0] = BENCH_CASES_DM_NG_RULE_SIZE;                                  /* Rule size */
+        ruleData[1] = BENCH_CASES_ACTION;                                           /* Action */
+        ruleData[2] = rule;                                                         /* Action parameter */
+        ruleData[3] = VSCP_DM_NG_LOGIC_OP_AND | VSCP_DM_NG_BASIC_OP_EQUAL;          /* Condition: Operator */
+        ruleData[4] = VSCP_DM_NG_EVENT_PAR_ID_CLASS;                                /* Condition: Event parameter */
+        ruleData[5] = 0;                                                            /* Condition: Class MSB */
+        ruleData[6] = ((rules - 1) == rule) ? VSCP_CLASS_L1_INFORMATION : VSCP_CLASS_L1_CONTROL;   /* Condition: Class LSB */
+        ruleData[7] = VSCP_DM_NG_LOGIC_OP_LAST | VSCP_DM_NG_BASIC_OP_EQUAL;         /* Condition: Operator */
+        ruleData[8] = VSCP_DM_NG_EVENT_PAR_ID_TYPE;                                 /* Condition: Event parameter */
+        ruleData[9] = VSCP_TYPE_INFORMATION_ON;                                     /* Condition: Type */
+
+        for(pos = 0; pos < BENCH_CASES_DM_NG_RULE_SIZE; ++pos)
+        {
+            vscp_ps_writeDMNextGeneration(index++, ruleData[pos]);
+        }
+    }
+
+    /* Invalidate any cached rules. */
+    vscp_dm_ng_init();
+
+    return;
+}
+
+/**
+ * Benchmark: Decision matrix next generation with a received event.
+ */
+static void bench_cases_dmNg(void)
+{
+    vscp_dm_ng_executeActions(&bench_cases_rxMsg);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+/**
+ * Benchmark: Encode a value to the normalized integer format.
+ */
+static void bench_cases_encode(void)
+{
+    ++bench_cases_value;
+
+    (void)vscp_data_coding_int32ToNormalizedInteger(bench_cases_value, -2, bench_cases_codedData, sizeof(bench_cases_codedData));
+
+    return;
+}
+
+/**
+ * Benchmark: Decode a value from the normalized integer format.
+ */
+static void bench_cases_decode(void)
+{
+    int32_t value   = 0;
+    int8_t  exp     = 0;
+
+    vscp_data_coding_normalizedIntegerToInt32(bench_cases_codedData, 5, &value, &exp);
+    bench_cases_value = value;
+
+    return;
+}
+
+/**
+ * Benchmark: Build and send CLASS1.INFORMATION ON.
+ */
+static void bench_cases_sendOn(void)
+{
+    (void)vscp_evt_information_sendOn(0, 255, 255);
+
+    return;
+}
+
+/**
+ * Benchmark: Build and send CLASS1.MEASUREMENT TEMPERATURE.
+ */
+static void bench_cases_sendTemperature(void)
+{
+    ++bench_cases_value;
+
+    (void)vscp_evt_measurement_sendTemperature(0, 1, bench_cases_value, -2);
+
+    return;
+}
+
+/**
+ * Benchmark: Queue a display text of 15 bytes and send its 3 events.
+ */
+static void bench_cases_segmentSend(void)
+{
+    static const uint8_t    text[BENCH_CASES_SEGMENT_SIZE]  = "Hello VSCP node";
+    vscp_TxMessage          header;
+
+    vscp_core_prepareTxMessage(&header, VSCP_CLASS_L1_DISPLAY, VSCP_TYPE_DISPLAY_WRITE_DISPLAY, VSCP_PRIORITY_3_NORMAL);
+    header.data[0]  = 0;    /* Index */
+    header.data[1]  = 0;    /* Zone */
+    header.data[2]  = 0;    /* Sub-zone */
+    header.dataSize = 3;
+
+    (void)vscp_segment_send(&header, 0, FALSE, text, sizeof(text));
+    (void)vscp_segment_process();
+
+    return;
+}
+
+/**
+ * Benchmark: Reassemble a display text of 15 bytes from its 3 events.
+ */
+static void bench_cases_segmentReceive(void)
+{
+    uint8_t         index       = 0;
+    uint8_t const * data        = NULL;
+    uint8_t         dataSize    = 0;
+
+    bench_cases_rxMsg.vscpClass = VSCP_CLASS_L1_DISPLAY;
+    bench_cases_rxMsg.vscpType  = VSCP_TYPE_DISPLAY_WRITE_DISPLAY;
+    bench_cases_rxMsg.priority  = VSCP_PRIORITY_3_NORMAL;
+    bench_cases_rxMsg.oAddr     = BENCH_CASES_REMOTE_NICKNAME;
+    bench_cases_rxMsg.hardCoded = FALSE;
+    bench_cases_rxMsg.dataSize  = VSCP_L1_DATA_SIZE;
+    bench_cases_rxMsg.data[1]   = 0;    /* Zone */
+    bench_cases_rxMsg.data[2]   = 0;    /* Sub-zone */
+
+    for(index = 0; index < 3; ++index)
+    {
+        bench_cases_rxMsg.data[0] = index;
+
+        if (VSCP_SEGMENT_RX_COMPLETE == vscp_segment_receive(&bench_cases_rxMsg, 3, 0, BENCH_CASES_SEGMENT_SIZE, &data, &dataSize))
+        {
+            bench_cases_value += dataSize;
+        }
+    }
+
+    return;
+}
+
+/**
+ * Benchmark: Handle a page read of the VSCP specific registers (page 0,
+ * 0x80 - 0xFF) and send all response events.
+ */
+static void bench_cases_pageRead(void)
+{
+    vscp_RxMessage  rxMsg;
+
+    memset(&rxMsg, 0, sizeof(rxMsg));
+    rxMsg.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    rxMsg.vscpType  = VSCP_TYPE_PROTOCOL_PAGE_READ;
+    rxMsg.priority  = VSCP_PRIORITY_3_NORMAL;
+    rxMsg.oAddr     = BENCH_CASES_REMOTE_NICKNAME;
+    rxMsg.dataSize  = 3;
+    rxMsg.data[0]   = BENCH_CASES_NICKNAME;
+    rxMsg.data[1]   = VSCP_REGISTER_VSCP_START_ADDR;
+    rxMsg.data[2]   = 128;
+
+    bench_cases_pendingMsg = &rxMsg;
+    bench_cases_drain();
+
+    return;
+}
+
+/**
+ * Benchmark: Handle a who is there request and send all response events.
+ */
+static void bench_cases_whoIsThere(void)
+{
+    vscp_RxMessage  rxMsg;
+
+    memset(&rxMsg, 0, sizeof(rxMsg));
+    rxMsg.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    rxMsg.vscpType  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE;
+    rxMsg.priority  = VSCP_PRIORITY_3_NORMAL;
+    rxMsg.oAddr     = BENCH_CASES_REMOTE_NICKNAME;
+    rxMsg.dataSize  = 1;
+    rxMsg.data[0]   = BENCH_CASES_NICKNAME;
+
+    bench_cases_pendingMsg = &rxMsg;
+    bench_cases_drain();
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+/**
+ * Benchmark: Send an event, process it in the core via the loopback and read
+ * it by the application.
+ */
+static void bench_cases_roundTrip(void)
+{
+    vscp_TxMessage  txMsg;
+    vscp_RxMessage  rxMsg;
+
+    vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ON, VSCP_PRIORITY_3_NORMAL);
+    txMsg.dataSize  = 3;
+    txMsg.data[0]   = 0;    /* Index */
+    txMsg.data[1]   = 255;  /* Zone */
+    txMsg.data[2]   = 255;  /* Sub-zone */
+
+    (void)vscp_core_sendEvent(&txMsg);
+    (void)vscp_core_process();
+    (void)vscp_portable_read(&rxMsg);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+/**
+ * Benchmark: Write a message to the cyclic buffer and read it back.
+ * The copied bytes are counted.
+ */
+static void bench_cases_cyclicBuffer(void)
+{
+    uint8_t num = 0;
+
+    ++bench_cases_bufMsgs[0].data[0];
+
+    num  = vscp_util_cyclicBufferWrite(&bench_cases_cyclicBuf, bench_cases_bufMsgs, 1);
+    num += vscp_util_cyclicBufferRead(&bench_cases_cyclicBuf, bench_cases_bufMsgs, 1);
+
+    bench_countBytes(num * sizeof(vscp_Message));
+
+    return;
+}
+
+/**
+ * Benchmark: Write several messages at once to the cyclic buffer and read
+ * them back. The copied bytes are counted.
+ */
+static void bench_cases_cyclicBufferBulk(void)
+{
+    uint8_t num = 0;
+
+    ++bench_cases_bufMsgs[0].data[0];
+
+    num  = vscp_util_cyclicBufferWrite(&bench_cases_cyclicBuf, bench_cases_bufMsgs, BENCH_CASES_BULK_NUM);
+    num += vscp_util_cyclicBufferRead(&bench_cases_cyclicBuf, bench_cases_bufMsgs, BENCH_CASES_BULK_NUM);
+
+    bench_countBytes(num * sizeof(vscp_Message));
+
+    return;
+}
+
+/**
+ * Benchmark: Write a message to the ring buffer and read it back.
+ * The copied bytes are counted.
+ */
+static void bench_cases_ring(void)
+{
+    uint8_t num = 0;
+
+    ++bench_cases_bufMsgs[0].data[0];
+
+    num  = vscp_util_ringWrite(&bench_cases_ringBuf, bench_cases_bufMsgs, 1);
+    num += vscp_util_ringRead(&bench_cases_ringBuf, bench_cases_bufMsgs, 1);
+
+    bench_countBytes(num * sizeof(vscp_Message));
+
+    return;
+}
+
+/**
+ * Benchmark: Write several messages at once to the ring buffer and read
+ * them back. The copied bytes are counted.
+ */
+static void bench_cases_ringBulk(void)
+{
+    uint8_t num = 0;
+
+    ++bench_cases_bufMsgs[0].data[0];
+
+    num  = vscp_util_ringWrite(&bench_cases_ringBuf, bench_cases_bufMsgs, BENCH_CASES_BULK_NUM);
+    num += vscp_util_ringRead(&bench_cases_ringBuf, bench_cases_bufMsgs, BENCH_CASES_BULK_NUM);
+
+    bench_countBytes(num * sizeof(vscp_Message));
+
+    return;
+}
+
+/**
+ * Benchmark: Build a message in place in the ring buffer and evaluate it in
+ * place, without copying it.
+ */
+static void bench_cases_ringPeek(void)
+{
+    void *  elem    = NULL;
+
+    if (0 < vscp_util_ringPeekWrite(&bench_cases_ringBuf, &elem))
+    {
+        vscp_Message *  msg = (vscp_Message*)elem;
+
+        msg->vscpClass  = VSCP_CLASS_L1_INFORMATION;
+        msg->vscpType   = VSCP_TYPE_INFORMATION_ON;
+        msg->dataSize   = 1;
+        msg->data[0]    = (uint8_t)bench_cases_value;
+
+        vscp_util_ringCommitWrite(&bench_cases_ringBuf, 1);
+    }
+
+    if (0 < vscp_util_ringPeekRead(&bench_cases_ringBuf, &elem))
+    {
+        bench_cases_value += ((vscp_Message const *)elem)->data[0] + 1;
+
+        vscp_util_ringCommitRead(&bench_cases_ringBuf, 1);
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/**
+ * Transport layer read function of bridge port 1. It receives the benchmark
+ * event once per pending request.
+ *
+ * @param[out]  msg Message
+ * @return If a message is pending, it will return TRUE otherwise FALSE.
+ */
+static BOOL bench_cases_bridgeRead(vscp_RxMessage * const msg)
+{
+    BOOL    status  = bench_cases_bridgeIsPending;
+
+    if (FALSE != status)
+    {
+        *msg = bench_cases_rxMsg;
+        bench_cases_bridgeIsPending = FALSE;
+    }
+
+    return status;
+}
+
+/**
+ * Transport layer write function of bridge port 1. The message is only counted.
+ *
+ * @param[in]   msg Message
+ * @return Always TRUE
+ */
+static BOOL bench_cases_bridgeWrite(vscp_TxMessage const * const msg)
+{
+    (void)msg;
+
+    bench_countBytes(sizeof(vscp_TxMessage));
+
+    return TRUE;
+}
+
+/**
+ * Benchmark: Receive a frame on port 1 and forward it via route to port 0.
+ * The frame is always the same, therefore the decision is cached.
+ */
+static void bench_cases_bridgeRoute(void)
+{
+    bench_cases_bridgeIsPending = TRUE;
+    vscp_bridge_process();
+
+    return;
+}
+
+/**
+ * Benchmark: Receive a frame on port 1 and flood it to port 0 and the node,
+ * which takes it. The nickname changes with every frame, therefore the
+ * decision is not cached.
+ */
+static void bench_cases_bridgeFlood(void)
+{
+    vscp_RxMessage const *  rxMsg   = NULL;
+
+    bench_cases_rxMsg.oAddr = (bench_cases_rxMsg.oAddr + 1) % BENCH_CASES_BRIDGE_NICKNAMES;
+
+    bench_cases_bridgeIsPending = TRUE;
+    vscp_bridge_process();
+
+    rxMsg = vscp_bridge_borrowMessage(NULL);
+    vscp_bridge_releaseMessage(rxMsg);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/**
+ * Transport layer read function of instance 1. It receives the frame, which
+ * instance 0 sent.
+ *
+ * @param[out]  msg Message
+ * @return If a message is received, it will return TRUE otherwise FALSE.
+ */
+static BOOL bench_cases_linkRead(vscp_RxMessage * const msg)
+{
+    if (FALSE == bench_cases_linkIsPending)
+    {
+        return FALSE;
+    }
+
+    *msg = bench_cases_linkMsg;
+    bench_cases_linkIsPending = FALSE;
+
+    return TRUE;
+}
+
+/**
+ * Transport layer write function of instance 0. The message is sent to
+ * instance 1 and counted.
+ *
+ * @param[in]   msg Message
+ * @return If the link is free, it will return TRUE otherwise FALSE.
+ */
+static BOOL bench_cases_linkWrite(vscp_TxMessage const * const msg)
+{
+    if (TRUE == bench_cases_linkIsPending)
+    {
+        return FALSE;
+    }
+
+    bench_cases_linkMsg         = *msg;
+    bench_cases_linkIsPending   = TRUE;
+
+    bench_countBytes(sizeof(vscp_TxMessage));
+
+    return TRUE;
+}
+
+/**
+ * Benchmark: Instance 0 sends a CLASS1.INFORMATION ON event, instance 1
+ * receives it and the application of instance 1 reads it.
+ */
+static void bench_cases_multiInstance(void)
+{
+    vscp_RxMessage  rxMsg;
+
+    vscp_instance_select(0);
+    (void)vscp_evt_information_sendOn(0, 255, 255);
+    (void)vscp_core_process();
+    (void)vscp_portable_read(&rxMsg);
+
+    vscp_instance_select(1);
+    (void)vscp_core_process();
+
+    if (FALSE != vscp_portable_read(&rxMsg))
+    {
+        ++bench_cases_linkRxCnt;
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
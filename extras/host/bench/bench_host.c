@@ -0,0 +1,134 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Microbenchmark on the host
+@file   bench_host.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+The host platform measures the time in ns with the monotonic clock. The
+copied bytes contain the bytes, which were read from and written to the
+simulated EEPROM.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "bench.h"
+#include <stdio.h>
+#include <time.h>
+#include "avr/eeprom.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Platform specific: Get the current time.
+ *
+ * @return Time in ns
+ */
+extern uint64_t bench_platform_getTime(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec) * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Platform specific: Get the unit of the time.
+ *
+ * @return Unit of the time
+ */
+extern char const * bench_platform_getTimeUnit(void)
+{
+    return "ns/event";
+}
+
+/**
+ * Platform specific: Get the number of bytes, which were copied by the
+ * platform, e.g. from the persistent memory.
+ *
+ * @return Number of copied bytes
+ */
+extern uint32_t bench_platform_getBytes(void)
+{
+    return eeprom_host_getReadCount() + eeprom_host_getWriteCount();
+}
+
+/**
+ * Main entry point.
+ *
+ * @return Exit status
+ */
+int main(void)
+{
+    /* Start every run with an erased EEPROM in RAM only. */
+    (void)eeprom_host_open(NULL);
+
+    bench_cases_run();
+
+    return 0;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
@@ -0,0 +1,275 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Flash memory for the host
+@file   flash.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see flash.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "flash.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Value of a erased flash cell */
+#define FLASH_ERASED_VALUE  0xFF
+
+/** Number of calls, a block program is busy. */
+#define FLASH_BUSY_CALLS    2
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Flash content */
+static uint8_t*     flash_image         = NULL;
+
+/** Flash size in byte */
+static uint32_t     flash_size          = 0;
+
+/** Block size in byte */
+static uint16_t     flash_blockSize     = 0;
+
+/** File descriptor of the flash file */
+static int          flash_fd            = -1;
+
+/** Number of calls, the current block program is still busy */
+static uint8_t      flash_busyCnt       = 0;
+
+/** Number of programmed blocks */
+static uint32_t     flash_programCnt    = 0;
+
+/** Is the programmed firmware activated or not */
+static BOOL         flash_isActivated   = FALSE;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Use the given file as flash backend. The flash is erased.
+ *
+ * @param[in]   fileName    Name of the flash file or NULL for RAM only
+ * @param[in]   blockSize   Block size in byte
+ * @param[in]   blockNum    Number of blocks
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL flash_host_open(char const * fileName, uint16_t blockSize, uint32_t blockNum)
+{
+    BOOL    status  = FALSE;
+
+    flash_host_close();
+
+    if ((0 == blockSize) ||
+        (0 == blockNum))
+    {
+        return FALSE;
+    }
+
+    flash_size  = (uint32_t)blockSize * blockNum;
+    flash_image = (uint8_t*)malloc(flash_size);
+
+    if (NULL == flash_image)
+    {
+        flash_size = 0;
+        return FALSE;
+    }
+
+    memset(flash_image, FLASH_ERASED_VALUE, flash_size);
+    flash_blockSize     = blockSize;
+    flash_busyCnt       = FLASH_BUSY_CALLS;
+    flash_programCnt    = 0;
+    flash_isActivated   = FALSE;
+    status              = TRUE;
+
+    if (NULL != fileName)
+    {
+        flash_fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if ((0 > flash_fd) ||
+            ((ssize_t)flash_size != pwrite(flash_fd, flash_image, flash_size, 0)))
+        {
+            status = FALSE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Close the flash file and release the flash.
+ */
+extern void flash_host_close(void)
+{
+    if (0 <= flash_fd)
+    {
+        (void)close(flash_fd);
+        flash_fd = -1;
+    }
+
+    free(flash_image);
+    flash_image = NULL;
+    flash_size  = 0;
+
+    return;
+}
+
+/**
+ * Program a block. It can be used as firmware program function.
+ *
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block size in byte
+ * @return Status
+ */
+extern VSCP_FW_ACCESS_RET flash_host_program(uint32_t block, uint8_t const * const data, uint16_t size)
+{
+    uint32_t    addr    = block * flash_blockSize;
+
+    if ((NULL == flash_image) ||
+        (NULL == data) ||
+        (flash_blockSize < size) ||
+        (flash_size <= addr))
+    {
+        return VSCP_FW_ACCESS_RET_ERROR;
+    }
+
+    /* Programming takes some time. */
+    if (0 < flash_busyCnt)
+    {
+        --flash_busyCnt;
+        return VSCP_FW_ACCESS_RET_BUSY;
+    }
+
+    flash_busyCnt = FLASH_BUSY_CALLS;
+
+    memcpy(&flash_image[addr], data, size);
+    ++flash_programCnt;
+
+    if (0 <= flash_fd)
+    {
+        (void)pwrite(flash_fd, data, size, (off_t)addr);
+    }
+
+    return VSCP_FW_ACCESS_RET_OK;
+}
+
+/**
+ * Activate the programmed firmware. It can be used as firmware activation
+ * function.
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL flash_host_activate(void)
+{
+    if (NULL == flash_image)
+    {
+        return FALSE;
+    }
+
+    flash_isActivated = TRUE;
+
+    return TRUE;
+}
+
+/**
+ * Get whether the programmed firmware was activated.
+ *
+ * @return If activated, it will return TRUE otherwise FALSE.
+ */
+extern BOOL flash_host_isActivated(void)
+{
+    return flash_isActivated;
+}
+
+/**
+ * Get the number of programmed blocks so far.
+ *
+ * @return Number of programmed blocks
+ */
+extern uint32_t flash_host_getProgramCount(void)
+{
+    return flash_programCnt;
+}
+
+/**
+ * Read a byte from the flash.
+ *
+ * @param[in]   addr    Address
+ * @return Value
+ */
+extern uint8_t flash_host_read(uint32_t addr)
+{
+    uint8_t value   = FLASH_ERASED_VALUE;
+
+    if ((NULL != flash_image) &&
+        (flash_size > addr))
+    {
+        value = flash_image[addr];
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
@@ -0,0 +1,153 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Flash memory for the host
+@file   flash.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a flash memory for the firmware update on the host. The
+flash content is kept in RAM and mirrored to a file per node, like the EEPROM.
+
+The functions can be used directly as firmware access functions of the VSCP
+class. Programming a block takes a few calls, which are answered with busy,
+like a real flash, which programs in the background.
+
+*******************************************************************************/
+/** @defgroup flash Flash memory
+ * This module provides a flash memory for simulated VSCP nodes.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __FLASH_H__
+#define __FLASH_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_fw_access.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Use the given file as flash backend. The flash is erased.
+ *
+ * @param[in]   fileName    Name of the flash file or NULL for RAM only
+ * @param[in]   blockSize   Block size in byte
+ * @param[in]   blockNum    Number of blocks
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL flash_host_open(char const * fileName, uint16_t blockSize, uint32_t blockNum);
+
+/**
+ * Close the flash file and release the flash.
+ */
+extern void flash_host_close(void);
+
+/**
+ * Program a block. It can be used as firmware program function.
+ *
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block size in byte
+ * @return Status
+ */
+extern VSCP_FW_ACCESS_RET flash_host_program(uint32_t block, uint8_t const * const data, uint16_t size);
+
+/**
+ * Activate the programmed firmware. It can be used as firmware activation
+ * function.
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL flash_host_activate(void);
+
+/**
+ * Get whether the programmed firmware was activated.
+ *
+ * @return If activated, it will return TRUE otherwise FALSE.
+ */
+extern BOOL flash_host_isActivated(void);
+
+/**
+ * Get the number of programmed blocks so far.
+ *
+ * @return Number of programmed blocks
+ */
+extern uint32_t flash_host_getProgramCount(void);
+
+/**
+ * Read a byte from the flash.
+ *
+ * @param[in]   addr    Address
+ * @return Value
+ */
+extern uint8_t flash_host_read(uint32_t addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __FLASH_H__ */
+
+/** @} */
@@ -0,0 +1,229 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  SocketCAN transport
+@file   socketcan.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see socketcan.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "socketcan.h"
+#include "vscp_can_id.h"
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** CAN raw socket */
+static int  socketcan_fd    = -1;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Open the SocketCAN interface with the given name, e.g. "vcan0".
+ *
+ * @param[in]   ifName  Interface name
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL socketcan_open(char const * ifName)
+{
+    BOOL                status  = FALSE;
+    struct ifreq        ifr;
+    struct sockaddr_can addr;
+
+    socketcan_close();
+
+    if ((NULL != ifName) &&
+        (IFNAMSIZ > strlen(ifName)))
+    {
+        socketcan_fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    }
+
+    if (0 <= socketcan_fd)
+    {
+        memset(&ifr, 0, sizeof(ifr));
+        strncpy(ifr.ifr_name, ifName, IFNAMSIZ - 1);
+
+        memset(&addr, 0, sizeof(addr));
+        addr.can_family = AF_CAN;
+
+        if (0 == ioctl(socketcan_fd, SIOCGIFINDEX, &ifr))
+        {
+            addr.can_ifindex = ifr.ifr_ifindex;
+
+            if ((0 == bind(socketcan_fd, (struct sockaddr*)&addr, sizeof(addr))) &&
+                (0 == fcntl(socketcan_fd, F_SETFL, O_NONBLOCK)))
+            {
+                status = TRUE;
+            }
+        }
+
+        if (FALSE == status)
+        {
+            socketcan_close();
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Close the SocketCAN interface.
+ */
+extern void socketcan_close(void)
+{
+    if (0 <= socketcan_fd)
+    {
+        (void)close(socketcan_fd);
+        socketcan_fd = -1;
+    }
+
+    return;
+}
+
+/**
+ * Read a frame from the SocketCAN interface, without blocking.
+ * It can be used as transport read function.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL socketcan_read(vscp_RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    while((0 <= socketcan_fd) &&
+          (NULL != msg) &&
+          (FALSE == status))
+    {
+        struct can_frame    frame;
+        ssize_t             size    = read(socketcan_fd, &frame, sizeof(frame));
+
+        if ((ssize_t)sizeof(frame) != size)
+        {
+            break;
+        }
+
+        /* Only data frames with 29-bit identifier are VSCP events. */
+        if ((0 != (frame.can_id & CAN_EFF_FLAG)) &&
+            (0 == (frame.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG))) &&
+            (VSCP_L1_DATA_SIZE >= frame.can_dlc))
+        {
+            vscp_can_id_decode(frame.can_id & CAN_EFF_MASK, msg);
+
+            msg->dataSize   = frame.can_dlc;
+            memcpy(msg->data, frame.data, frame.can_dlc);
+
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Write a frame to the SocketCAN interface.
+ * It can be used as transport write function.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL socketcan_write(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((0 <= socketcan_fd) &&
+        (NULL != msg) &&
+        (VSCP_L1_DATA_SIZE >= msg->dataSize))
+    {
+        struct can_frame    frame;
+
+        memset(&frame, 0, sizeof(frame));
+
+        frame.can_id    = vscp_can_id_encode(msg) | CAN_EFF_FLAG;
+        frame.can_dlc   = msg->dataSize;
+        memcpy(frame.data, msg->data, msg->dataSize);
+
+        if ((ssize_t)sizeof(frame) == write(socketcan_fd, &frame, sizeof(frame)))
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
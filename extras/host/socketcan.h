@@ -0,0 +1,140 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  SocketCAN transport
+@file   socketcan.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module connects a simulated node to a Linux SocketCAN interface, e.g. a
+virtual vcan interface, which needs no hardware:
+
+    sudo modprobe vcan
+    sudo ip link add dev vcan0 type vcan
+    sudo ip link set up vcan0
+
+The VSCP event is mapped to a CAN frame with 29-bit identifier, like in the
+Arduino examples:
+
+| Bit 28 - 26 | Bit 25     | Bit 24 - 16 | Bit 15 - 8 | Bit 7 - 0             |
+| ----------- | ---------- | ----------- | ---------- | --------------------- |
+| Priority    | Hard coded | Class       | Type       | Originating address   |
+
+*******************************************************************************/
+/** @defgroup socketcan SocketCAN transport
+ * This module provides the transport functions for a SocketCAN interface.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __SOCKETCAN_H__
+#define __SOCKETCAN_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Open the SocketCAN interface with the given name, e.g. "vcan0".
+ *
+ * @param[in]   ifName  Interface name
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL socketcan_open(char const * ifName);
+
+/**
+ * Close the SocketCAN interface.
+ */
+extern void socketcan_close(void);
+
+/**
+ * Read a frame from the SocketCAN interface, without blocking.
+ * It can be used as transport read function.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL socketcan_read(vscp_RxMessage * const msg);
+
+/**
+ * Write a frame to the SocketCAN interface.
+ * It can be used as transport write function.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL socketcan_write(vscp_TxMessage const * const msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __SOCKETCAN_H__ */
+
+/** @} */
@@ -0,0 +1,549 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP class tests
+@file   vscp_test.cpp
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This program tests the VSCP class and the MCP2515 transport on the host
+system. Every test case uses its own VSCP instance, which is connected to a
+bus, where nothing is received and every sent frame is accepted. The MCP2515
+is simulated behind the SPI stub, with its registers and SPI instructions.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "VSCP.h"
+#include "VSCPMcp2515.h"
+#include <SPI.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Status lamp pin */
+#define TEST_STATUS_LAMP_PIN    8
+
+/** Init button pin */
+#define TEST_INIT_BUTTON_PIN    7
+
+/** MCP2515 chip select pin */
+#define TEST_MCP2515_CS_PIN     10
+
+/** MCP2515 interrupt pin */
+#define TEST_MCP2515_INT_PIN    2
+
+/** MCP2515 register: Filter 0 */
+#define TEST_MCP2515_RXF0SIDH   0x00
+
+/** MCP2515 register: Status */
+#define TEST_MCP2515_CANSTAT    0x0E
+
+/** MCP2515 register: Control */
+#define TEST_MCP2515_CANCTRL    0x0F
+
+/** MCP2515 register: Mask 0 */
+#define TEST_MCP2515_RXM0SIDH   0x20
+
+/** MCP2515 operation mode mask */
+#define TEST_MCP2515_MODE_MASK  0xE0
+
+/** MCP2515 operation mode: Normal */
+#define TEST_MCP2515_MODE_NORMAL    0x00
+
+/** MCP2515 operation mode: Configuration */
+#define TEST_MCP2515_MODE_CONFIG    0x80
+
+/** Number of MCP2515 registers */
+#define TEST_MCP2515_REG_NUM    0x80
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Test case */
+typedef struct
+{
+    char const *    name;           /**< Name of the test case */
+    bool            (*run)(void);   /**< Test function, returns true if passed */
+
+} test_Case;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static bool transportRead(vscp_RxMessage * const rxMsg);
+static bool transportWrite(vscp_TxMessage const * const txMsg);
+static void actionExecute(unsigned char action, unsigned char par, vscp_RxMessage const * const msg);
+static void setupNode(VSCP& vscp);
+static void oneShotTask(uint8_t taskId);
+static bool testOneShotTaskReAdd(void);
+static uint8_t mcp2515Transfer(uint8_t data, bool isFirst);
+static bool isMcp2515Id(uint8_t addr, uint32_t id);
+static bool testMcp2515SetFilter(void);
+static bool testMcp2515SetFilterStuck(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** VSCP instance under test, used by the task functions. */
+static VSCP*        gVscp       = NULL;
+
+/** Number of task runs */
+static unsigned int gTaskRuns   = 0;
+
+/** Registers of the simulated MCP2515 */
+static uint8_t      gMcp2515Regs[TEST_MCP2515_REG_NUM];
+
+/** The simulated MCP2515 doesn't change its operation mode. */
+static bool         gMcp2515IsStuck     = false;
+
+/** Current SPI instruction of the simulated MCP2515 */
+static uint8_t      gMcp2515Instr       = 0;
+
+/** Number of received bytes after the SPI instruction */
+static uint8_t      gMcp2515Pos         = 0;
+
+/** Current register address of the simulated MCP2515 */
+static uint8_t      gMcp2515Addr        = 0;
+
+/** Mask of the current bit modify instruction */
+static uint8_t      gMcp2515Mask        = 0;
+
+/** Number of interrupts() calls at the last SPI transaction */
+static unsigned long    gMcp2515IntEnables  = 0;
+
+/** Number of SPI transactions in a row, without enabled interrupts in between */
+static unsigned int     gMcp2515LockedCnt   = 0;
+
+/** Max. number of SPI transactions in a row, without enabled interrupts in between */
+static unsigned int     gMcp2515LockedMax   = 0;
+
+/** All test cases */
+static const test_Case  gTestCases[] =
+{
+    { "One-shot task, which adds itself again", testOneShotTaskReAdd },
+    { "MCP2515 acceptance filter", testMcp2515SetFilter },
+    { "MCP2515 acceptance filter, without configuration mode", testMcp2515SetFilterStuck }
+};
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Run all test cases.
+ *
+ * @return Exit code: 0 if all test cases passed, otherwise 1.
+ */
+int main(void)
+{
+    unsigned int    index   = 0;
+    unsigned int    failed  = 0;
+
+    for(index = 0; index < (sizeof(gTestCases) / sizeof(gTestCases[0])); ++index)
+    {
+        bool    isPassed    = gTestCases[index].run();
+
+        printf("%s: %s\n", (true == isPassed) ? "PASS" : "FAIL", gTestCases[index].name);
+
+        if (false == isPassed)
+        {
+            ++failed;
+        }
+    }
+
+    printf("%u of %u test cases failed.\n", failed, index);
+
+    return (0 == failed) ? 0 : 1;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Transport read function, nothing is received.
+ *
+ * @param[in]   rxMsg   Received message
+ * @return Always false
+ */
+static bool transportRead(vscp_RxMessage * const rxMsg)
+{
+    (void)rxMsg;
+
+    return false;
+}
+
+/**
+ * Transport write function, every message is accepted.
+ *
+ * @param[in]   txMsg   Message to send
+ * @return Always true
+ */
+static bool transportWrite(vscp_TxMessage const * const txMsg)
+{
+    (void)txMsg;
+
+    return true;
+}
+
+/**
+ * Action execution function, which does nothing.
+ *
+ * @param[in]   action  Action id
+ * @param[in]   par     Action parameter
+ * @param[in]   msg     Received message, which triggered the action
+ */
+static void actionExecute(unsigned char action, unsigned char par, vscp_RxMessage const * const msg)
+{
+    (void)action;
+    (void)par;
+    (void)msg;
+
+    return;
+}
+
+/**
+ * Setup a node and reset the task statistics.
+ *
+ * @param[in]   vscp    VSCP instance
+ */
+static void setupNode(VSCP& vscp)
+{
+    VSCPGuid    guid;
+
+    memset(guid, 0, sizeof(guid));
+    guid[VSCP_GUID_SIZE - 1] = 1;
+
+    vscp.setup(
+        TEST_STATUS_LAMP_PIN,
+        TEST_INIT_BUTTON_PIN,
+        guid,
+        255,
+        255,
+        transportRead,
+        transportWrite,
+        actionExecute);
+
+    gVscp       = &vscp;
+    gTaskRuns   = 0;
+
+    return;
+}
+
+/**
+ * One-shot task, which adds itself again with phase 0.
+ *
+ * @param[in]   taskId  Task id
+ */
+static void oneShotTask(uint8_t taskId)
+{
+    (void)taskId;
+
+    ++gTaskRuns;
+
+    (void)gVscp->addTask(oneShotTask, 0);
+
+    return;
+}
+
+/**
+ * A one-shot task, which adds itself again, shall run only once per process
+ * call. Otherwise process() would never return without a task budget.
+ *
+ * @return If the test case passed, it will return true otherwise false.
+ */
+static bool testOneShotTaskReAdd(void)
+{
+    VSCP    vscp;
+    bool    isPassed    = true;
+
+    setupNode(vscp);
+
+    if (VSCP::TASK_ID_INVALID == vscp.addTask(oneShotTask, 0))
+    {
+        return false;
+    }
+
+    vscp.process();
+
+    if (1 != gTaskRuns)
+    {
+        isPassed = false;
+    }
+
+    vscp.process();
+
+    if (2 != gTaskRuns)
+    {
+        isPassed = false;
+    }
+
+    (void)vscp.process(1, 0, NULL);
+
+    if (3 != gTaskRuns)
+    {
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+/**
+ * Simulated MCP2515, which supports the SPI instructions reset, read, write,
+ * bit modify and read status. The operation mode follows the requested one
+ * immediately, except it is stuck.
+ *
+ * @param[in]   data    Transmitted byte
+ * @param[in]   isFirst First byte of the transaction
+ * @return Received byte
+ */
+static uint8_t mcp2515Transfer(uint8_t data, bool isFirst)
+{
+    uint8_t received    = 0xFF;
+
+    if (true == isFirst)
+    {
+        gMcp2515Instr   = data;
+        gMcp2515Pos     = 0;
+
+        /* Interrupts disabled since the last transaction? */
+        if ((false == arduino_host_isInterruptEnabled()) &&
+            (arduino_host_getInterruptEnables() == gMcp2515IntEnables))
+        {
+            ++gMcp2515LockedCnt;
+
+            if (gMcp2515LockedMax < gMcp2515LockedCnt)
+            {
+                gMcp2515LockedMax = gMcp2515LockedCnt;
+            }
+        }
+        else
+        {
+            gMcp2515LockedCnt = 0;
+        }
+
+        gMcp2515IntEnables = arduino_host_getInterruptEnables();
+
+        /* Reset? */
+        if (0xC0 == gMcp2515Instr)
+        {
+            memset(gMcp2515Regs, 0, sizeof(gMcp2515Regs));
+            gMcp2515Regs[TEST_MCP2515_CANSTAT] = TEST_MCP2515_MODE_CONFIG;
+            gMcp2515Regs[TEST_MCP2515_CANCTRL] = TEST_MCP2515_MODE_CONFIG | 0x07;
+        }
+
+        return received;
+    }
+
+    switch(gMcp2515Instr)
+    {
+    /* Read */
+    case 0x03:
+        if (0 == gMcp2515Pos)
+        {
+            gMcp2515Addr = data;
+        }
+        else
+        {
+            received = gMcp2515Regs[gMcp2515Addr % TEST_MCP2515_REG_NUM];
+            ++gMcp2515Addr;
+        }
+        break;
+
+    /* Write */
+    case 0x02:
+        if (0 == gMcp2515Pos)
+        {
+            gMcp2515Addr = data;
+        }
+        else
+        {
+            gMcp2515Regs[gMcp2515Addr % TEST_MCP2515_REG_NUM] = data;
+            ++gMcp2515Addr;
+        }
+        break;
+
+    /* Bit modify */
+    case 0x05:
+        if (0 == gMcp2515Pos)
+        {
+            gMcp2515Addr = data % TEST_MCP2515_REG_NUM;
+        }
+        else if (1 == gMcp2515Pos)
+        {
+            gMcp2515Mask = data;
+        }
+        else if (2 == gMcp2515Pos)
+        {
+            gMcp2515Regs[gMcp2515Addr] = (gMcp2515Regs[gMcp2515Addr] & ~gMcp2515Mask) | (data & gMcp2515Mask);
+
+            /* Enter the requested operation mode. */
+            if ((TEST_MCP2515_CANCTRL == gMcp2515Addr) &&
+                (false == gMcp2515IsStuck))
+            {
+                gMcp2515Regs[TEST_MCP2515_CANSTAT] &= ~TEST_MCP2515_MODE_MASK;
+                gMcp2515Regs[TEST_MCP2515_CANSTAT] |= gMcp2515Regs[TEST_MCP2515_CANCTRL] & TEST_MCP2515_MODE_MASK;
+            }
+        }
+        break;
+
+    /* Read status */
+    case 0xA0:
+        received = 0x00;
+        break;
+
+    default:
+        break;
+    }
+
+    ++gMcp2515Pos;
+
+    return received;
+}
+
+/**
+ * Check whether the identifier registers of the simulated MCP2515 contain
+ * the given extended identifier.
+ *
+ * @param[in]   addr    Address of the first identifier register
+ * @param[in]   id      29-bit identifier
+ * @return If the identifier matches, it will return true otherwise false.
+ */
+static bool isMcp2515Id(uint8_t addr, uint32_t id)
+{
+    uint8_t const   expected[] =
+    {
+        (uint8_t)(id >> 21),
+        (uint8_t)(((id >> 13) & 0xE0) | 0x08 | ((id >> 16) & 0x03)),
+        (uint8_t)(id >> 8),
+        (uint8_t)id
+    };
+
+    return (0 == memcmp(&gMcp2515Regs[addr], expected, sizeof(expected)));
+}
+
+/**
+ * The acceptance filter shall be written in configuration mode and the
+ * controller shall return to the normal mode afterwards.
+ *
+ * @return If the test case passed, it will return true otherwise false.
+ */
+static bool testMcp2515SetFilter(void)
+{
+    VSCPMcp2515                 mcp2515;
+    vscp_AcceptanceFilter const filter      = { 0x01FFFF00UL, 0x0001E300UL };
+    bool                        isPassed    = true;
+
+    gMcp2515IsStuck = false;
+    spi_host_setDevice(mcp2515Transfer);
+
+    if (false == mcp2515.begin(TEST_MCP2515_CS_PIN, TEST_MCP2515_INT_PIN, VSCPMcp2515::CLOCK_16MHZ))
+    {
+        isPassed = false;
+    }
+    else
+    {
+        mcp2515.setFilter(&filter, 1);
+
+        if ((false == isMcp2515Id(TEST_MCP2515_RXM0SIDH, filter.mask)) ||
+            (false == isMcp2515Id(TEST_MCP2515_RXF0SIDH, filter.filter)) ||
+            (TEST_MCP2515_MODE_NORMAL != (gMcp2515Regs[TEST_MCP2515_CANSTAT] & TEST_MCP2515_MODE_MASK)) ||
+            (false == arduino_host_isInterruptEnabled()))
+        {
+            isPassed = false;
+        }
+    }
+
+    spi_host_setDevice(NULL);
+
+    return isPassed;
+}
+
+/**
+ * If the controller doesn't enter the configuration mode, the acceptance
+ * filter shall not be written. The interrupts shall be enabled between the
+ * polls of the operation mode.
+ *
+ * @return If the test case passed, it will return true otherwise false.
+ */
+static bool testMcp2515SetFilterStuck(void)
+{
+    VSCPMcp2515                 mcp2515;
+    vscp_AcceptanceFilter const filter      = { 0x01FFFF00UL, 0x0001E300UL };
+    bool                        isPassed    = true;
+
+    gMcp2515IsStuck = false;
+    spi_host_setDevice(mcp2515Transfer);
+
+    if (false == mcp2515.begin(TEST_MCP2515_CS_PIN, TEST_MCP2515_INT_PIN, VSCPMcp2515::CLOCK_16MHZ))
+    {
+        isPassed = false;
+    }
+    else
+    {
+        gMcp2515IsStuck     = true;
+        gMcp2515LockedMax   = 0;
+
+        mcp2515.setFilter(&filter, 1);
+
+        if ((true == isMcp2515Id(TEST_MCP2515_RXM0SIDH, filter.mask)) ||
+            (0 < gMcp2515LockedMax) ||
+            (TEST_MCP2515_MODE_NORMAL != (gMcp2515Regs[TEST_MCP2515_CANSTAT] & TEST_MCP2515_MODE_MASK)) ||
+            (false == arduino_host_isInterruptEnabled()))
+        {
+            isPassed = false;
+        }
+    }
+
+    spi_host_setDevice(NULL);
+
+    return isPassed;
+}
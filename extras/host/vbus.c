@@ -0,0 +1,281 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Virtual bus
+@file   vbus.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vbus.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vbus.h"
+#include <string.h>
+#include <sys/mman.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Mask to get the slot index from a sequence number */
+#define VBUS_LOG_MASK   (VBUS_LOG_SIZE - 1U)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** A single frame slot of the bus log. */
+typedef struct
+{
+    uint32_t        seq;    /**< Sequence number + 1 of the frame in the slot, 0 while written */
+    uint16_t        sender; /**< Node id of the sender */
+    vscp_Message    msg;    /**< Frame */
+
+} vbus_Slot;
+
+/** The virtual bus, located in shared memory. */
+typedef struct
+{
+    uint32_t    head;                   /**< Sequence number of the next frame */
+    vbus_Slot   slot[VBUS_LOG_SIZE];    /**< Bus log */
+
+} vbus_Bus;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** The virtual bus */
+static vbus_Bus*    vbus_bus        = NULL;
+
+/** Node id of this process */
+static uint16_t     vbus_nodeId     = 0;
+
+/** Sequence number of the next frame, this node will read. */
+static uint32_t     vbus_cursor     = 0;
+
+/** Number of frames, this node lost. */
+static uint32_t     vbus_overruns   = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Create the virtual bus in shared memory. Call it once in the parent process,
+ * before the node processes are created.
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vbus_create(void)
+{
+    BOOL    status  = FALSE;
+    void*   mem     = mmap(NULL, sizeof(vbus_Bus), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED != mem)
+    {
+        vbus_bus = (vbus_Bus*)mem;
+        memset(vbus_bus, 0, sizeof(vbus_Bus));
+
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * Attach the calling node process to the virtual bus.
+ * Only frames, which are written after attaching, are received.
+ *
+ * @param[in]   nodeId  Unique node id
+ */
+extern void vbus_attach(uint16_t nodeId)
+{
+    vbus_nodeId     = nodeId;
+    vbus_overruns   = 0;
+
+    if (NULL != vbus_bus)
+    {
+        vbus_cursor = __atomic_load_n(&vbus_bus->head, __ATOMIC_ACQUIRE);
+    }
+
+    return;
+}
+
+/**
+ * Read a frame from the virtual bus. It can be used as transport read function.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vbus_read(vscp_RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    while((NULL != vbus_bus) &&
+          (NULL != msg) &&
+          (FALSE == status))
+    {
+        uint32_t    head    = __atomic_load_n(&vbus_bus->head, __ATOMIC_ACQUIRE);
+        vbus_Slot*  slot    = &vbus_bus->slot[vbus_cursor & VBUS_LOG_MASK];
+        uint32_t    seq     = 0;
+        uint16_t    sender  = 0;
+
+        /* Nothing new on the bus? */
+        if (head == vbus_cursor)
+        {
+            break;
+        }
+
+        /* Lost frames, because the writers overtook this node? */
+        if (VBUS_LOG_SIZE < (head - vbus_cursor))
+        {
+            vbus_overruns += (head - vbus_cursor) - (VBUS_LOG_SIZE / 2U);
+            vbus_cursor = head - (VBUS_LOG_SIZE / 2U);
+            continue;
+        }
+
+        seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+        /* Frame not completely written yet? */
+        if ((vbus_cursor + 1U) != seq)
+        {
+            break;
+        }
+
+        sender = slot->sender;
+        *msg = slot->msg;
+
+        /* Overwritten in the meantime? */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (seq != __atomic_load_n(&slot->seq, __ATOMIC_RELAXED))
+        {
+            continue;
+        }
+
+        ++vbus_cursor;
+
+        /* Like on CAN, a node doesn't receive its own frames. */
+        if (vbus_nodeId != sender)
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Write a frame to the virtual bus. It can be used as transport write function.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vbus_write(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != vbus_bus) &&
+        (NULL != msg) &&
+        (VSCP_L1_DATA_SIZE >= msg->dataSize))
+    {
+        uint32_t    seq     = __atomic_fetch_add(&vbus_bus->head, 1U, __ATOMIC_ACQ_REL);
+        vbus_Slot*  slot    = &vbus_bus->slot[seq & VBUS_LOG_MASK];
+
+        /* Mark the slot as invalid, while the frame is written. */
+        __atomic_store_n(&slot->seq, 0U, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        slot->sender    = vbus_nodeId;
+        slot->msg       = *msg;
+
+        __atomic_store_n(&slot->seq, seq + 1U, __ATOMIC_RELEASE);
+
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * Get the number of frames, which were written to the bus so far.
+ *
+ * @return Number of frames
+ */
+extern uint32_t vbus_getFrameCount(void)
+{
+    uint32_t    count   = 0;
+
+    if (NULL != vbus_bus)
+    {
+        count = __atomic_load_n(&vbus_bus->head, __ATOMIC_ACQUIRE);
+    }
+
+    return count;
+}
+
+/**
+ * Get the number of frames, which the calling node lost, because it didn't
+ * read fast enough.
+ *
+ * @return Number of lost frames
+ */
+extern uint32_t vbus_getOverruns(void)
+{
+    return vbus_overruns;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
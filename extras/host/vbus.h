@@ -0,0 +1,157 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Virtual bus
+@file   vbus.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a virtual CAN like bus on the host, which connects a
+number of simulated nodes without any hardware.
+
+The VSCP framework keeps its state in static variables, therefore every
+simulated node runs in its own process. The bus is located in shared memory,
+which is created by the parent process before it creates the nodes with fork().
+
+The bus works like a broadcast log: Every written frame is appended and every
+node reads all frames, except its own ones, like on a real CAN bus. A node
+which doesn't read fast enough loses the oldest frames, which is counted as
+overrun.
+
+*******************************************************************************/
+/** @defgroup vbus Virtual bus
+ * This module provides a virtual bus for simulated VSCP nodes.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VBUS_H__
+#define __VBUS_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Number of frames in the bus log. Must be a power of two. */
+#define VBUS_LOG_SIZE   8192
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Create the virtual bus in shared memory. Call it once in the parent process,
+ * before the node processes are created.
+ *
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vbus_create(void);
+
+/**
+ * Attach the calling node process to the virtual bus.
+ * Only frames, which are written after attaching, are received.
+ *
+ * @param[in]   nodeId  Unique node id
+ */
+extern void vbus_attach(uint16_t nodeId);
+
+/**
+ * Read a frame from the virtual bus. It can be used as transport read function.
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vbus_read(vscp_RxMessage * const msg);
+
+/**
+ * Write a frame to the virtual bus. It can be used as transport write function.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vbus_write(vscp_TxMessage const * const msg);
+
+/**
+ * Get the number of frames, which were written to the bus so far.
+ *
+ * @return Number of frames
+ */
+extern uint32_t vbus_getFrameCount(void);
+
+/**
+ * Get the number of frames, which the calling node lost, because it didn't
+ * read fast enough.
+ *
+ * @return Number of lost frames
+ */
+extern uint32_t vbus_getOverruns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VBUS_H__ */
+
+/** @} */
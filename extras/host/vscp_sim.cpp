@@ -0,0 +1,1197 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP segment simulation
+@file   vscp_sim.cpp
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This program simulates a VSCP segment with a number of nodes on a host system.
+Every node runs the complete VSCP framework with the VSCP class in its own
+process. The nodes are connected via the virtual bus or via a SocketCAN
+interface.
+
+Scenarios:
+- discovery: All nodes start without nickname and their init button is
+  pressed, at the same time or spread over a random delay. The framework
+  doesn't randomize the nickname discovery, therefore it completes only for
+  a few nodes, see SIM_DISCOVERY_NODES_MAX.
+- load: All nodes have a nickname and send CLASS1.INFORMATION ON events
+  periodically.
+- dm: Like load, but every node has a completely filled decision matrix,
+  where one row matches the sent events.
+- update: Node 0 updates the firmware of all other nodes at once, with the
+  multicast enter boot loader mode event and windowed block data. It needs
+  VSCP_CONFIG_FW_UPDATE.
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "VSCP.h"
+#include "framework/core/vscp_dm.h"
+#include "framework/core/vscp_ps.h"
+#include "framework/core/vscp_dev_data.h"
+#include "framework/core/vscp_util.h"
+#include "framework/core/vscp_fw_update.h"
+#include "framework/core/vscp_type_protocol.h"
+#include "vbus.h"
+#include "socketcan.h"
+#include "flash.h"
+#include "avr/eeprom.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. number of nodes in a segment */
+#define SIM_NODES_MAX           254
+
+/** Status lamp pin */
+#define SIM_STATUS_LAMP_PIN     8
+
+/** Init button pin */
+#define SIM_INIT_BUTTON_PIN     7
+
+/** Max. number of nodes, which complete the nickname discovery scenario
+ * reliably. The nodes, which wait for a probe acknowledge, all react on the
+ * same acknowledge and probe the next nickname at the same time. They take
+ * it together and restart the discovery, when they detect the duplicate.
+ * With a random delay (-j) up to 3 nodes complete it, without only 2.
+ */
+#define SIM_DISCOVERY_NODES_MAX 3
+
+/** Duration in ms, the init button is pressed. */
+#define SIM_BUTTON_PRESS_TIME   200
+
+/** Max. number of events, which are handled per process call. */
+#define SIM_EVENTS_PER_PROCESS  16
+
+/** Action id, which is triggered by the decision matrix. */
+#define SIM_ACTION_ID           1
+
+/** Timeout in ms, the update host waits for the responses of the nodes. */
+#define SIM_UPDATE_TIMEOUT      1000
+
+/** Max. number of retries of the update host, if a node doesn't respond. */
+#define SIM_UPDATE_RETRIES      5
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Simulation scenarios */
+typedef enum
+{
+    SCENARIO_DISCOVERY = 0, /**< Nickname discovery */
+    SCENARIO_LOAD,          /**< Segment load */
+    SCENARIO_DM,            /**< Decision matrix stress */
+    SCENARIO_UPDATE         /**< Firmware update of all nodes */
+
+} SCENARIO;
+
+/** Simulation options */
+typedef struct
+{
+    unsigned int    nodes;          /**< Number of nodes */
+    unsigned int    durationMs;     /**< Simulation duration in ms */
+    unsigned int    periodMs;       /**< Event period per node in ms */
+    unsigned int    idleUs;         /**< Sleep time in us, if a node is idle */
+    unsigned int    jitterMs;       /**< Max. random delay in ms, until the init button is pressed */
+    unsigned int    blocks;         /**< Number of firmware blocks */
+    unsigned int    window;         /**< Number of firmware blocks, which are sent before the program request */
+    SCENARIO        scenario;       /**< Scenario */
+    const char*     canIf;          /**< SocketCAN interface or NULL for the virtual bus */
+    const char*     eepromDir;      /**< Directory of the EEPROM files */
+    bool            keepEeprom;     /**< Keep EEPROM files of a previous run */
+    bool            verbose;        /**< Show the serial output and the node statistics */
+
+} sim_Options;
+
+/** Node statistics, located in shared memory. */
+typedef struct
+{
+    uint32_t    rxFrames;       /**< Number of received frames */
+    uint32_t    txFrames;       /**< Number of sent frames */
+    uint32_t    txErrors;       /**< Number of frames, which couldn't be sent */
+    uint32_t    events;         /**< Number of events, which the application read */
+    uint32_t    rxOverflows;    /**< Number of events, which were dropped by the receive queue */
+    uint32_t    actions;        /**< Number of executed actions */
+    uint32_t    overruns;       /**< Number of frames lost on the virtual bus */
+    uint32_t    programmed;     /**< Number of programmed firmware blocks */
+    uint32_t    rewinds;        /**< Update host: Number of times the block transfer was repeated */
+    uint32_t    updateMs;       /**< Update host: Duration of the firmware update in ms */
+    uint8_t     nickname;       /**< Nickname at the end of the simulation */
+    uint8_t     isActive;       /**< Node is active at the end of the simulation */
+    uint8_t     isUpdated;      /**< Node runs the new firmware at the end of the simulation */
+
+} sim_NodeStat;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static bool transportRead(vscp_RxMessage * const rxMsg);
+static bool transportWrite(vscp_TxMessage const * const txMsg);
+static void actionExecute(unsigned char action, unsigned char par, vscp_RxMessage const * const msg);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+static void programDecisionMatrix(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+static void runNode(unsigned int nodeId, sim_Options const & options);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+static uint8_t getImageByte(uint32_t addr);
+static bool isImageProgrammed(sim_Options const & options);
+static void runUpdateHost(sim_Options const & options);
+static void sendUpdateEvent(uint8_t vscpType, uint8_t const * data, uint8_t dataSize);
+static void sendBlock(uint32_t block);
+static uint32_t waitForUpdateRsp(sim_Options const & options, uint8_t ackType, uint8_t nackType, uint32_t block, uint32_t * const confirmed);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+static void showStatistics(sim_Options const & options, unsigned long durationMs);
+static void showUsage(const char* progName);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** VSCP framework of the node */
+static VSCP             gVscp;
+
+/** Statistics of all nodes */
+static sim_NodeStat*    gNodeStats  = NULL;
+
+/** Statistics of this node */
+static sim_NodeStat*    gNodeStat   = NULL;
+
+/** Use SocketCAN or the virtual bus */
+static bool             gUseSocketCan   = false;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+int main(int argc, char** argv)
+{
+    sim_Options     options;
+    int             opt         = 0;
+    unsigned int    index       = 0;
+    unsigned long   startTime   = 0;
+    void*           mem         = NULL;
+
+    options.nodes       = 16;
+    options.durationMs  = 10000;
+    options.periodMs    = 100;
+    options.idleUs      = 200;
+    options.jitterMs    = 0;
+    options.blocks      = 64;
+    options.window      = 8;
+    options.scenario    = SCENARIO_DISCOVERY;
+    options.canIf       = NULL;
+    options.eepromDir   = "/tmp/vscp_sim";
+    options.keepEeprom  = false;
+    options.verbose     = false;
+
+    while(-1 != (opt = getopt(argc, argv, "n:d:p:y:j:b:w:s:c:e:kvh")))
+    {
+        switch(opt)
+        {
+        case 'n':
+            options.nodes = (unsigned int)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'd':
+            options.durationMs = (unsigned int)(strtod(optarg, NULL) * 1000.0);
+            break;
+
+        case 'p':
+            options.periodMs = (unsigned int)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'y':
+            options.idleUs = (unsigned int)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'j':
+            options.jitterMs = (unsigned int)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'b':
+            options.blocks = (unsigned int)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'w':
+            options.window = (unsigned int)strtoul(optarg, NULL, 0);
+            break;
+
+        case 's':
+            if (0 == strcmp(optarg, "discovery"))
+            {
+                options.scenario = SCENARIO_DISCOVERY;
+            }
+            else if (0 == strcmp(optarg, "load"))
+            {
+                options.scenario = SCENARIO_LOAD;
+            }
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+            else if (0 == strcmp(optarg, "dm"))
+            {
+                options.scenario = SCENARIO_DM;
+            }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+            else if (0 == strcmp(optarg, "update"))
+            {
+                options.scenario = SCENARIO_UPDATE;
+            }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+            else
+            {
+                showUsage(argv[0]);
+                return 1;
+            }
+            break;
+
+        case 'c':
+            options.canIf = optarg;
+            break;
+
+        case 'e':
+            options.eepromDir = optarg;
+            break;
+
+        case 'k':
+            options.keepEeprom = true;
+            break;
+
+        case 'v':
+            options.verbose = true;
+            break;
+
+        default:
+            showUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((0 == options.nodes) ||
+        (SIM_NODES_MAX < options.nodes))
+    {
+        fprintf(stderr, "Number of nodes must be in the range 1 - %u.\n", SIM_NODES_MAX);
+        return 1;
+    }
+
+    if ((SCENARIO_UPDATE == options.scenario) &&
+        ((2 > options.nodes) ||
+         (0 == options.blocks) ||
+         (0 == options.window)))
+    {
+        fprintf(stderr, "The update scenario needs at least 2 nodes, 1 block and a window of 1 block.\n");
+        return 1;
+    }
+
+    if ((SCENARIO_DISCOVERY == options.scenario) &&
+        (SIM_DISCOVERY_NODES_MAX < options.nodes))
+    {
+        fprintf(stderr, "Note, the nickname discovery completes reliably only for up to %u nodes.\n", SIM_DISCOVERY_NODES_MAX);
+    }
+
+    gUseSocketCan = (NULL != options.canIf);
+
+    if ((false == gUseSocketCan) &&
+        (FALSE == vbus_create()))
+    {
+        fprintf(stderr, "Failed to create the virtual bus.\n");
+        return 1;
+    }
+
+    mem = mmap(NULL, options.nodes * sizeof(sim_NodeStat), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == mem)
+    {
+        fprintf(stderr, "Failed to create the node statistics.\n");
+        return 1;
+    }
+
+    gNodeStats = (sim_NodeStat*)mem;
+    memset(gNodeStats, 0, options.nodes * sizeof(sim_NodeStat));
+
+    (void)mkdir(options.eepromDir, 0755);
+
+    /* The output is buffered, therefore flush it before it is duplicated. */
+    fflush(stdout);
+
+    startTime = millis();
+
+    for(index = 0; index < options.nodes; ++index)
+    {
+        pid_t pid = fork();
+
+        if (0 == pid)
+        {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+            /* Node 0 is the update host, which doesn't run the framework. */
+            if ((SCENARIO_UPDATE == options.scenario) &&
+                (0 == index))
+            {
+                runUpdateHost(options);
+                exit(0);
+            }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+            runNode(index, options);
+            exit(0);
+        }
+        else if (0 > pid)
+        {
+            fprintf(stderr, "Failed to create node %u.\n", index);
+            break;
+        }
+    }
+
+    /* Wait until all nodes finished. */
+    while(0 < wait(NULL))
+    {
+        ;
+    }
+
+    showStatistics(options, millis() - startTime);
+
+    return 0;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Read a message from the transport layer.
+ *
+ * @param[out]  rxMsg   Received message
+ * @return If a message is received, it will return true otherwise false.
+ */
+static bool transportRead(vscp_RxMessage * const rxMsg)
+{
+    bool    status  = false;
+
+    if (true == gUseSocketCan)
+    {
+        status = socketcan_read(rxMsg);
+    }
+    else
+    {
+        status = vbus_read(rxMsg);
+    }
+
+    if (true == status)
+    {
+        ++gNodeStat->rxFrames;
+    }
+
+    return status;
+}
+
+/**
+ * Write a message to the transport layer.
+ *
+ * @param[in]   txMsg   Message to send
+ * @return If the message is sent, it will return true otherwise false.
+ */
+static bool transportWrite(vscp_TxMessage const * const txMsg)
+{
+    bool    status  = false;
+
+    if (true == gUseSocketCan)
+    {
+        status = socketcan_write(txMsg);
+    }
+    else
+    {
+        status = vbus_write(txMsg);
+    }
+
+    if (true == status)
+    {
+        ++gNodeStat->txFrames;
+    }
+    else
+    {
+        ++gNodeStat->txErrors;
+    }
+
+    return status;
+}
+
+/**
+ * Execute a action, which was triggered by the decision matrix.
+ *
+ * @param[in]   action  Action id
+ * @param[in]   par     Action parameter
+ * @param[in]   msg     Received message, which triggered the action
+ */
+static void actionExecute(unsigned char action, unsigned char par, vscp_RxMessage const * const msg)
+{
+    (void)par;
+    (void)msg;
+
+    if (SIM_ACTION_ID == action)
+    {
+        ++gNodeStat->actions;
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+/**
+ * Fill the whole decision matrix. The first row matches CLASS1.INFORMATION ON,
+ * all other rows match CLASS1.CONTROL events, which are never sent.
+ */
+static void programDecisionMatrix(void)
+{
+    uint16_t    page    = vscp_dm_getPage();
+    uint8_t     offset  = vscp_dm_getMatrixOffset();
+    uint8_t     rows    = vscp_dm_getMatrixRows();
+    uint8_t     row     = 0;
+
+    for(row = 0; row < rows; ++row)
+    {
+        uint8_t rowData[VSCP_DM_ROW_SIZE];
+        uint8_t index   = 0;
+
+        rowData[0] = 0;                                                         /* Originating address */
+        rowData[1] = VSCP_DM_FLAG_ENABLE;                                       /* Flags */
+        rowData[2] = 0xff;                                                      /* Class mask */
+        rowData[3] = (0 == row) ? VSCP_CLASS_L1_INFORMATION : VSCP_CLASS_L1_CONTROL;    /* Class filter */
+        rowData[4] = 0xff;                                                      /* Type mask */
+        rowData[5] = (0 == row) ? VSCP_TYPE_INFORMATION_ON : row;               /* Type filter */
+        rowData[6] = SIM_ACTION_ID;                                             /* Action */
+        rowData[7] = 0;                                                         /* Action parameter */
+
+        for(index = 0; index < VSCP_DM_ROW_SIZE; ++index)
+        {
+            (void)vscp_dm_writeRegister(page, offset + (row * VSCP_DM_ROW_SIZE) + index, rowData[index]);
+        }
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+/**
+ * Run a single node until the simulation duration elapsed.
+ *
+ * @param[in]   nodeId  Node id
+ * @param[in]   options Simulation options
+ */
+static void runNode(unsigned int nodeId, sim_Options const & options)
+{
+    char            fileName[256];
+    VSCPGuid        nodeGuid;
+    unsigned long   lastEventTime       = 0;
+    unsigned long   buttonPressTime     = 0;
+    bool            isButtonPressed     = false;
+    bool            isButtonReleased    = false;
+
+    gNodeStat = &gNodeStats[nodeId];
+
+    if (true == options.verbose)
+    {
+        Serial.begin(115200);
+    }
+
+    /* Every node has its own EEPROM file. */
+    snprintf(fileName, sizeof(fileName), "%s/node%03u.eep", options.eepromDir, nodeId);
+
+    if (false == options.keepEeprom)
+    {
+        (void)unlink(fileName);
+    }
+
+    if (false == eeprom_host_open(fileName))
+    {
+        fprintf(stderr, "Node %u: Failed to open %s, EEPROM works in RAM only.\n", nodeId, fileName);
+    }
+
+    /* Connect to the bus */
+    if (true == gUseSocketCan)
+    {
+        if (FALSE == socketcan_open(options.canIf))
+        {
+            fprintf(stderr, "Node %u: Failed to open %s.\n", nodeId, options.canIf);
+            return;
+        }
+    }
+    else
+    {
+        vbus_attach((uint16_t)nodeId);
+    }
+
+    memset(nodeGuid, 0, sizeof(nodeGuid));
+    nodeGuid[VSCP_GUID_SIZE - 2] = (unsigned char)((nodeId >> 8) & 0xff);
+    nodeGuid[VSCP_GUID_SIZE - 1] = (unsigned char)((nodeId >> 0) & 0xff);
+
+    gVscp.setup(
+        SIM_STATUS_LAMP_PIN,
+        SIM_INIT_BUTTON_PIN,
+        nodeGuid,
+        255,
+        255,
+        transportRead,
+        transportWrite,
+        actionExecute);
+
+    /* A new EEPROM is erased, which would be garbage for the framework. */
+    if (false == options.keepEeprom)
+    {
+        gVscp.restoreFactoryDefaultSettings();
+
+        /* Skip the nickname discovery, which is not part of the scenario. */
+        if (SCENARIO_DISCOVERY != options.scenario)
+        {
+            vscp_ps_writeNicknameId((uint8_t)(nodeId + 1));
+
+            /* Setup again, to take the nickname over. */
+            gVscp.setup(
+                SIM_STATUS_LAMP_PIN,
+                SIM_INIT_BUTTON_PIN,
+                nodeGuid,
+                255,
+                255,
+                transportRead,
+                transportWrite,
+                actionExecute);
+        }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+        if (SCENARIO_DM == options.scenario)
+        {
+            programDecisionMatrix();
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+    /* Every node has its own flash file, which receives the new firmware. */
+    if (SCENARIO_UPDATE == options.scenario)
+    {
+        snprintf(fileName, sizeof(fileName), "%s/node%03u.flash", options.eepromDir, nodeId);
+
+        if (FALSE == flash_host_open(fileName, VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE, options.blocks))
+        {
+            fprintf(stderr, "Node %u: Failed to open %s, flash works in RAM only.\n", nodeId, fileName);
+        }
+
+        gVscp.setFirmwareUpdate(flash_host_program, flash_host_activate, options.blocks);
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+    /* Press the init button of all nodes at the same time or spread over the jitter time. */
+    if ((SCENARIO_DISCOVERY == options.scenario) &&
+        (0 < options.jitterMs))
+    {
+        srand(nodeId + 1);
+        buttonPressTime = millis() + ((unsigned long)rand() % options.jitterMs);
+    }
+
+    while(options.durationMs > millis())
+    {
+        vscp_RxMessage  rxMsgs[SIM_EVENTS_PER_PROCESS];
+        uint8_t         handled = 0;
+        uint8_t         read    = 0;
+        uint8_t         loops   = 0;
+
+        /* Handle a burst of events, but read them before the receive queue overflows. */
+        do
+        {
+            handled = gVscp.process(1);
+            read    = gVscp.read(rxMsgs, SIM_EVENTS_PER_PROCESS);
+
+            gNodeStat->events += read;
+            ++loops;
+        }
+        while((0 < handled) && (SIM_EVENTS_PER_PROCESS > loops));
+
+        gNodeStat->rxOverflows += gVscp.getRxOverflows();
+
+        /* Press and release the init button */
+        if (SCENARIO_DISCOVERY == options.scenario)
+        {
+            unsigned long   now = millis();
+
+            if ((false == isButtonPressed) &&
+                (false == isButtonReleased) &&
+                (buttonPressTime <= now))
+            {
+                digitalWrite(SIM_INIT_BUTTON_PIN, LOW);
+                isButtonPressed = true;
+            }
+            else if ((true == isButtonPressed) &&
+                     ((buttonPressTime + SIM_BUTTON_PRESS_TIME) <= now))
+            {
+                digitalWrite(SIM_INIT_BUTTON_PIN, HIGH);
+                isButtonPressed     = false;
+                isButtonReleased    = true;
+            }
+        }
+
+        /* Generate load */
+        if ((SCENARIO_DISCOVERY != options.scenario) &&
+            (SCENARIO_UPDATE != options.scenario) &&
+            (true == gVscp.isActive()) &&
+            (options.periodMs <= (millis() - lastEventTime)))
+        {
+            vscp_TxMessage  txMsg;
+
+            gVscp.prepareTxMessage(txMsg, VSCP_CLASS_L1_INFORMATION, VSCP_TYPE_INFORMATION_ON, VSCP_PRIORITY_3_NORMAL);
+            txMsg.dataSize  = 3;
+            txMsg.data[0]   = 0;    /* Index */
+            txMsg.data[1]   = 255;  /* Zone */
+            txMsg.data[2]   = 255;  /* Sub-zone */
+
+            (void)gVscp.write(txMsg);
+
+            lastEventTime = millis();
+        }
+
+        gNodeStat->nickname = gVscp.readNicknameId();
+        gNodeStat->isActive = (true == gVscp.isActive()) ? 1 : 0;
+
+        /* Give the other nodes a chance, if nothing happened. */
+        if ((1 == loops) &&
+            (0 == handled) &&
+            (0 == read) &&
+            (0 < options.idleUs))
+        {
+            (void)usleep(options.idleUs);
+        }
+    }
+
+    if (false == gUseSocketCan)
+    {
+        gNodeStat->overruns = vbus_getOverruns();
+    }
+    else
+    {
+        socketcan_close();
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+    if (SCENARIO_UPDATE == options.scenario)
+    {
+        gNodeStat->programmed   = flash_host_getProgramCount();
+        gNodeStat->isUpdated    = ((TRUE == flash_host_isActivated()) && (true == isImageProgrammed(options))) ? 1 : 0;
+
+        flash_host_close();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+    eeprom_host_close();
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+/**
+ * Get a byte of the new firmware image.
+ *
+ * @param[in]   addr    Address
+ * @return Value
+ */
+static uint8_t getImageByte(uint32_t addr)
+{
+    return (uint8_t)((addr * 31U) ^ (addr >> 8));
+}
+
+/**
+ * Check whether the flash contains the new firmware image.
+ *
+ * @param[in]   options Simulation options
+ * @return If the whole image is programmed, it will return true otherwise false.
+ */
+static bool isImageProgrammed(sim_Options const & options)
+{
+    uint32_t    size    = (uint32_t)options.blocks * VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE;
+    uint32_t    addr    = 0;
+
+    for(addr = 0; addr < size; ++addr)
+    {
+        if (getImageByte(addr) != flash_host_read(addr))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Run the update host, which updates the firmware of all other nodes at once.
+ * The nodes are selected via the multicast enter boot loader mode event and
+ * the family code. The blocks are sent in windows, each closed by a program
+ * request. If a node reports a missing block or doesn't respond, the
+ * transfer is repeated from the first block, which one of the nodes misses.
+ *
+ * @param[in]   options Simulation options
+ */
+static void runUpdateHost(sim_Options const & options)
+{
+    uint32_t        confirmed[SIM_NODES_MAX];
+    uint8_t         data[VSCP_L1_DATA_SIZE];
+    unsigned long   startTime   = 0;
+    uint32_t        block       = 0;
+    uint32_t        pos         = 0;
+    uint16_t        crcSum      = 0;
+    uint32_t        responses   = 0;
+    unsigned int    retries     = 0;
+
+    gNodeStat = &gNodeStats[0];
+
+    if (true == gUseSocketCan)
+    {
+        if (FALSE == socketcan_open(options.canIf))
+        {
+            fprintf(stderr, "Update host: Failed to open %s.\n", options.canIf);
+            return;
+        }
+    }
+    else
+    {
+        vbus_attach(0);
+    }
+
+    /* Give the nodes time to start. */
+    delay(SIM_UPDATE_TIMEOUT);
+
+    startTime = millis();
+
+    for(block = 0; block < options.blocks; ++block)
+    {
+        uint8_t blockData[VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE];
+        uint16_t index  = 0;
+
+        for(index = 0; index < VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE; ++index)
+        {
+            blockData[index] = getImageByte(block * VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE + index);
+        }
+
+        crcSum += vscp_util_crc16(VSCP_UTIL_CRC16_INIT, blockData, VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+    }
+
+    /* Select all nodes of the family. */
+    data[0] = VSCP_FW_UPDATE_NICKNAME_MULTICAST;
+    data[1] = VSCP_FW_UPDATE_ALGORITHM;
+    data[2] = vscp_dev_data_getStdDevFamilyCode(3);
+    data[3] = vscp_dev_data_getStdDevFamilyCode(2);
+    data[4] = vscp_dev_data_getStdDevFamilyCode(1);
+    data[5] = vscp_dev_data_getStdDevFamilyCode(0);
+    data[6] = 0;
+    data[7] = 0;
+
+    do
+    {
+        memset(confirmed, 0, sizeof(confirmed));
+        sendUpdateEvent(VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER, data, 8);
+        responses = waitForUpdateRsp(options, VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER, VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER, 0, confirmed);
+        ++retries;
+    }
+    while(((options.nodes - 1) > responses) && (SIM_UPDATE_RETRIES > retries));
+
+    /* Transfer the blocks window by window. */
+    retries = 0;
+    while((options.blocks > pos) && (SIM_UPDATE_RETRIES > retries) && (options.durationMs > millis()))
+    {
+        uint32_t        end     = pos + options.window;
+        unsigned int    index   = 0;
+        uint32_t        nextPos = options.blocks;
+
+        if (options.blocks < end)
+        {
+            end = options.blocks;
+        }
+
+        for(block = pos; block < end; ++block)
+        {
+            sendBlock(block);
+        }
+
+        data[0] = (uint8_t)(((end - 1) >> 24) & 0xff);
+        data[1] = (uint8_t)(((end - 1) >> 16) & 0xff);
+        data[2] = (uint8_t)(((end - 1) >>  8) & 0xff);
+        data[3] = (uint8_t)(((end - 1) >>  0) & 0xff);
+        sendUpdateEvent(VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA, data, 4);
+
+        (void)waitForUpdateRsp(options, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK, end, confirmed);
+
+        /* Continue with the first block, which a node misses. */
+        for(index = 1; index < options.nodes; ++index)
+        {
+            if (nextPos > confirmed[index])
+            {
+                nextPos = confirmed[index];
+            }
+        }
+
+        if (end > nextPos)
+        {
+            ++gNodeStat->rewinds;
+        }
+
+        /* No progress at all? */
+        if (pos == nextPos)
+        {
+            ++retries;
+        }
+        else
+        {
+            retries = 0;
+        }
+
+        pos = nextPos;
+    }
+
+    /* Activate the new firmware. */
+    data[0] = VSCP_UTIL_WORD_MSB(crcSum);
+    data[1] = VSCP_UTIL_WORD_LSB(crcSum);
+    sendUpdateEvent(VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE, data, 2);
+    (void)waitForUpdateRsp(options, VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK, VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK, 0, confirmed);
+
+    gNodeStat->updateMs = millis() - startTime;
+
+    if (true == gUseSocketCan)
+    {
+        socketcan_close();
+    }
+
+    return;
+}
+
+/**
+ * Send a boot loader event of the update host.
+ *
+ * @param[in]   vscpType    Event type
+ * @param[in]   data        Event data
+ * @param[in]   dataSize    Event data size
+ */
+static void sendUpdateEvent(uint8_t vscpType, uint8_t const * data, uint8_t dataSize)
+{
+    vscp_TxMessage  txMsg;
+
+    txMsg.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    txMsg.vscpType  = vscpType;
+    txMsg.priority  = VSCP_PRIORITY_3_NORMAL;
+    txMsg.oAddr     = 0;
+    txMsg.hardCoded = FALSE;
+    txMsg.dataSize  = dataSize;
+
+    if (0 < dataSize)
+    {
+        memcpy(txMsg.data, data, dataSize);
+    }
+
+    (void)transportWrite(&txMsg);
+
+    return;
+}
+
+/**
+ * Send a firmware block with its CRC, which starts the windowed block data
+ * transfer.
+ *
+ * @param[in]   block   Block number
+ */
+static void sendBlock(uint32_t block)
+{
+    uint8_t     blockData[VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE];
+    uint8_t     data[VSCP_L1_DATA_SIZE];
+    uint16_t    index   = 0;
+    uint16_t    crc     = 0;
+    vscp_RxMessage  rxMsg;
+
+    for(index = 0; index < VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE; ++index)
+    {
+        blockData[index] = getImageByte(block * VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE + index);
+    }
+
+    crc = vscp_util_crc16(VSCP_UTIL_CRC16_INIT, blockData, VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+
+    data[0] = (uint8_t)((block >> 24) & 0xff);
+    data[1] = (uint8_t)((block >> 16) & 0xff);
+    data[2] = (uint8_t)((block >>  8) & 0xff);
+    data[3] = (uint8_t)((block >>  0) & 0xff);
+    data[4] = VSCP_FW_UPDATE_MEMORY_TYPE_FLASH;
+    data[5] = 0;
+    data[6] = VSCP_UTIL_WORD_MSB(crc);
+    data[7] = VSCP_UTIL_WORD_LSB(crc);
+    sendUpdateEvent(VSCP_TYPE_PROTOCOL_START_BLOCK, data, 8);
+
+    for(index = 0; index < VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE; index += VSCP_L1_DATA_SIZE)
+    {
+        sendUpdateEvent(VSCP_TYPE_PROTOCOL_BLOCK_DATA, &blockData[index], VSCP_L1_DATA_SIZE);
+    }
+
+    /* The responses are evaluated via the program request, therefore skip them. */
+    while(true == transportRead(&rxMsg))
+    {
+        ;
+    }
+
+    /* Give the nodes a chance to follow. */
+    (void)usleep(1000);
+
+    return;
+}
+
+/**
+ * Wait until all nodes responded to a boot loader event or the timeout
+ * elapsed. A node, which acknowledges a program request, confirms all blocks
+ * until the requested one. A node, which doesn't acknowledge it, confirms
+ * all blocks until the one it misses.
+ *
+ * @param[in]       options     Simulation options
+ * @param[in]       ackType     Event type of the acknowledge
+ * @param[in]       nackType    Event type of the negative acknowledge
+ * @param[in]       block       Number of confirmed blocks after a acknowledge
+ * @param[in,out]   confirmed   Number of confirmed blocks per node
+ * @return Number of nodes, which acknowledged
+ */
+static uint32_t waitForUpdateRsp(sim_Options const & options, uint8_t ackType, uint8_t nackType, uint32_t block, uint32_t * const confirmed)
+{
+    bool            responded[SIM_NODES_MAX];
+    unsigned long   startTime   = millis();
+    uint32_t        responses   = 0;
+    uint32_t        acks        = 0;
+
+    memset(responded, 0, sizeof(responded));
+
+    while(((options.nodes - 1) > responses) &&
+          (SIM_UPDATE_TIMEOUT > (millis() - startTime)))
+    {
+        vscp_RxMessage  rxMsg;
+        unsigned int    index   = 0;
+
+        if (false == transportRead(&rxMsg))
+        {
+            (void)usleep(options.idleUs);
+            continue;
+        }
+
+        /* The nodes have the nicknames 2 - n. */
+        if ((VSCP_CLASS_L1_PROTOCOL != rxMsg.vscpClass) ||
+            (2 > rxMsg.oAddr) ||
+            (options.nodes < rxMsg.oAddr))
+        {
+            continue;
+        }
+
+        index = rxMsg.oAddr - 1;
+
+        if (true == responded[index])
+        {
+            continue;
+        }
+
+        if (ackType == rxMsg.vscpType)
+        {
+            confirmed[index] = block;
+            ++acks;
+        }
+        else if ((nackType == rxMsg.vscpType) &&
+                 (5 == rxMsg.dataSize))
+        {
+            confirmed[index]  = ((uint32_t)rxMsg.data[1]) << 24;
+            confirmed[index] |= ((uint32_t)rxMsg.data[2]) << 16;
+            confirmed[index] |= ((uint32_t)rxMsg.data[3]) <<  8;
+            confirmed[index] |= ((uint32_t)rxMsg.data[4]) <<  0;
+        }
+        else if (nackType != rxMsg.vscpType)
+        {
+            continue;
+        }
+
+        responded[index] = true;
+        ++responses;
+    }
+
+    return acks;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+/**
+ * Show the statistics of the simulation.
+ *
+ * @param[in]   options     Simulation options
+ * @param[in]   durationMs  Real simulation duration in ms
+ */
+static void showStatistics(sim_Options const & options, unsigned long durationMs)
+{
+    unsigned int    index           = 0;
+    unsigned int    active          = 0;
+    unsigned int    duplicates      = 0;
+    uint32_t        rxFrames        = 0;
+    uint32_t        txFrames        = 0;
+    uint32_t        txErrors        = 0;
+    uint32_t        events          = 0;
+    uint32_t        rxOverflows     = 0;
+    uint32_t        actions         = 0;
+    uint32_t        overruns        = 0;
+    unsigned int    updated         = 0;
+    unsigned int    nicknameCnt[256];
+
+    memset(nicknameCnt, 0, sizeof(nicknameCnt));
+
+    for(index = 0; index < options.nodes; ++index)
+    {
+        sim_NodeStat const * stat = &gNodeStats[index];
+
+        if (true == options.verbose)
+        {
+            printf("Node %3u: nickname %3u %-8s rx %8u tx %8u tx errors %5u events %8u actions %8u overruns %6u\n",
+                index,
+                stat->nickname,
+                (0 != stat->isActive) ? "active" : "inactive",
+                stat->rxFrames,
+                stat->txFrames,
+                stat->txErrors,
+                stat->events,
+                stat->actions,
+                stat->overruns);
+        }
+
+        if (0 != stat->isUpdated)
+        {
+            ++updated;
+        }
+
+        if (0 != stat->isActive)
+        {
+            ++active;
+
+            if (1 < ++nicknameCnt[stat->nickname])
+            {
+                ++duplicates;
+            }
+        }
+
+        rxFrames    += stat->rxFrames;
+        txFrames    += stat->txFrames;
+        txErrors    += stat->txErrors;
+        events      += stat->events;
+        rxOverflows += stat->rxOverflows;
+        actions     += stat->actions;
+        overruns    += stat->overruns;
+    }
+
+    if (0 == durationMs)
+    {
+        durationMs = 1;
+    }
+
+    printf("Nodes              : %u\n", options.nodes);
+    printf("Duration           : %lu ms\n", durationMs);
+    printf("Active nodes       : %u\n", active);
+    printf("Duplicate nicknames: %u\n", duplicates);
+    printf("Frames sent        : %u (%lu frames/s)\n", txFrames, (unsigned long)txFrames * 1000U / durationMs);
+    printf("Frames received    : %u\n", rxFrames);
+    printf("Transmit errors    : %u\n", txErrors);
+    printf("Application events : %u\n", events);
+    printf("Receive overflows  : %u\n", rxOverflows);
+    printf("Executed actions   : %u\n", actions);
+    printf("Bus overruns       : %u\n", overruns);
+
+    if (SCENARIO_UPDATE == options.scenario)
+    {
+        printf("Updated nodes      : %u of %u\n", updated, options.nodes - 1);
+        printf("Update duration    : %u ms\n", gNodeStats[0].updateMs);
+        printf("Update rewinds     : %u\n", gNodeStats[0].rewinds);
+    }
+
+    return;
+}
+
+/**
+ * Show the program usage.
+ *
+ * @param[in]   progName    Program name
+ */
+static void showUsage(const char* progName)
+{
+    printf("Usage: %s [options]\n", progName);
+    printf("  -n <nodes>     Number of nodes (1 - %u, default 16)\n", SIM_NODES_MAX);
+    printf("  -d <seconds>   Simulation duration (default 10)\n");
+    printf("  -s <scenario>  discovery, load, dm or update (default discovery)\n");
+    printf("  -p <ms>        Event period per node in load and dm scenario (default 100)\n");
+    printf("  -y <us>        Sleep time of a idle node (default 200)\n");
+    printf("  -j <ms>        Max. random delay until the init button is pressed in discovery scenario (default 0)\n");
+    printf("  -b <blocks>    Number of firmware blocks in update scenario (default 64)\n");
+    printf("  -w <blocks>    Number of firmware blocks per program request in update scenario (default 8)\n");
+    printf("  -c <ifname>    Use the SocketCAN interface, e.g. vcan0 instead of the virtual bus\n");
+    printf("  -e <dir>       Directory of the EEPROM files (default /tmp/vscp_sim)\n");
+    printf("  -k             Keep the EEPROM files of a previous run\n");
+    printf("  -v             Show the serial output and the statistics of every node\n");
+
+    return;
+}
@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+# The MIT License (MIT)
+#
+# Copyright (c) 2014 - 2025 Andreas Merkle
+# http://www.blue-andi.de
+# vscp@blue-andi.de
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Compress a module description file (MDF) and embed it into the framework.
+
+The MDF is compressed with LZSS and written as C array to the header file,
+which is included by src/framework/user/vscp_mdf_access.c.
+
+Compressed stream:
+    Byte 0      Window size as power of two (4 - 8)
+    Byte 1-2    Size of the uncompressed MDF (MSB first)
+    Byte 3-n    Blocks of a flag byte, followed by 8 items. The flag bits
+                are processed LSB first:
+                1: Literal byte
+                0: Reference with 2 bytes: distance - 1, length - 3
+
+A reference copies "length" bytes, which start "distance" bytes before the
+current position in the uncompressed MDF. The decompressor keeps only the
+last "window size" bytes in RAM.
+
+Usage:
+    extras/mdf/mdf_embed.py mdf_template.xml
+    extras/mdf/mdf_embed.py -w 128 -o src/framework/user/vscp_mdf_data.h my_mdf.xml
+"""
+
+import argparse
+import os
+import sys
+
+MATCH_MIN = 3
+MATCH_MAX = MATCH_MIN + 255
+WINDOW_BITS_MIN = 4
+WINDOW_BITS_MAX = 8
+SIZE_MAX = 0xFFFF
+
+DEFAULT_OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "..", "..", "src", "framework", "user", "vscp_mdf_data.h")
+
+
+def find_match(data, pos, window):
+    """Find the longest match in the window before the position."""
+    best_len = 0
+    best_dist = 0
+    max_len = min(MATCH_MAX, len(data) - pos)
+
+    if MATCH_MIN > max_len:
+        return 0, 0
+
+    for dist in range(1, min(window, pos) + 1):
+        length = 0
+
+        # The match may overlap the current position.
+        while (length < max_len) and (data[pos - dist + length] == data[pos + length]):
+            length += 1
+
+        if length > best_len:
+            best_len = length
+            best_dist = dist
+
+            if max_len == best_len:
+                break
+
+    if MATCH_MIN > best_len:
+        return 0, 0
+
+    return best_len, best_dist
+
+
+def compress(data, window_bits):
+    """Compress the data and return the compressed stream incl. header."""
+    window = 1 << window_bits
+    out = bytearray([window_bits, (len(data) >> 8) & 0xFF, len(data) & 0xFF])
+    items = []
+    pos = 0
+
+    while pos < len(data):
+        length, dist = find_match(data, pos, window)
+
+        # Lazy matching: Prefer a literal, if the next position has a longer match.
+        if 0 < length:
+            next_length, _ = find_match(data, pos + 1, window)
+
+            if next_length > (length + 1):
+                length = 0
+
+        if 0 == length:
+            items.append(bytes([data[pos]]))
+            pos += 1
+        else:
+            items.append(bytes([dist - 1, length - MATCH_MIN]))
+            pos += length
+
+    for block in range(0, len(items), 8):
+        flags = 0
+        body = bytearray()
+
+        for bit, item in enumerate(items[block:block + 8]):
+            if 1 == len(item):
+                flags |= 1 << bit
+            body += item
+
+        out.append(flags)
+        out += body
+
+    return bytes(out)
+
+
+def decompress(stream):
+    """Decompress the stream, used to verify the compression."""
+    window = 1 << stream[0]
+    size = (stream[1] << 8) | stream[2]
+    out = bytearray()
+    pos = 3
+
+    while len(out) < size:
+        flags = stream[pos]
+        pos += 1
+
+        for bit in range(8):
+            if len(out) >= size:
+                break
+
+            if 0 != (flags & (1 << bit)):
+                out.append(stream[pos])
+                pos += 1
+            else:
+                dist = stream[pos] + 1
+                length = stream[pos + 1] + MATCH_MIN
+                pos += 2
+
+                if dist > window:
+                    raise ValueError("Reference out of window.")
+
+                for _ in range(length):
+                    out.append(out[-dist])
+
+    return bytes(out)
+
+
+def write_header(file_name, source_name, stream, size):
+    """Write the compressed stream as C header file."""
+    lines = []
+
+    # Take the license from this script.
+    with open(os.path.abspath(__file__), "r") as file:
+        license_lines = [line.rstrip("\n") for line in file if line.startswith("#")][1:24]
+
+    lines.append("/*" + license_lines[0][1:])
+
+    for line in license_lines[1:]:
+        lines.append(" *" + line[1:])
+
+    lines.append(" *")
+    lines.append(" */")
+    lines.append("")
+    lines.append("/*******************************************************************************")
+    lines.append("    DESCRIPTION")
+    lines.append("*******************************************************************************/")
+    lines.append("/**")
+    lines.append("@brief  Embedded module description file (MDF)")
+    lines.append("@file   vscp_mdf_data.h")
+    lines.append("@author Andreas Merkle, http://www.blue-andi.de")
+    lines.append("")
+    lines.append("@section desc Description")
+    lines.append("This file is generated by extras/mdf/mdf_embed.py. Don't edit it.")
+    lines.append("")
+    lines.append("Compressed MDF, generated from %s." % source_name)
+    lines.append("Uncompressed size: %u bytes, compressed size: %u bytes." % (size, len(stream)))
+    lines.append("")
+    lines.append("*******************************************************************************/")
+    lines.append("")
+    lines.append("#ifndef __VSCP_MDF_DATA_H__")
+    lines.append("#define __VSCP_MDF_DATA_H__")
+    lines.append("")
+    lines.append("/** Size of the compressed MDF in bytes */")
+    lines.append("#define VSCP_MDF_DATA_SIZE  %u" % len(stream))
+    lines.append("")
+    lines.append("/** Compressed MDF */")
+    lines.append("static const uint8_t vscp_mdf_data[VSCP_MDF_DATA_SIZE] PROGMEM =")
+    lines.append("{")
+
+    for index in range(0, len(stream), 16):
+        chunk = stream[index:index + 16]
+        line = "    " + ", ".join("0x%02X" % value for value in chunk)
+
+        if (index + 16) < len(stream):
+            line += ","
+
+        lines.append(line)
+
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif  /* __VSCP_MDF_DATA_H__ */")
+    lines.append("")
+
+    # The framework sources use CRLF line endings.
+    with open(file_name, "w", newline="\r\n") as file:
+        file.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress a MDF and embed it into the VSCP framework.")
+    parser.add_argument("mdf", help="Module description file")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="Generated header file")
+    parser.add_argument("-w", "--window", type=int, default=64,
+                        help="Window size in bytes, must not exceed VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE (default 64)")
+    args = parser.parse_args()
+
+    window_bits = args.window.bit_length() - 1
+
+    if ((1 << window_bits) != args.window) or \
+       (WINDOW_BITS_MIN > window_bits) or \
+       (WINDOW_BITS_MAX < window_bits):
+        print("Window size must be a power of two in the range 16 - 256.", file=sys.stderr)
+        return 1
+
+    with open(args.mdf, "rb") as file:
+        data = file.read()
+
+    if SIZE_MAX < len(data):
+        print("MDF is too large, max. %u bytes are supported." % SIZE_MAX, file=sys.stderr)
+        return 1
+
+    stream = compress(data, window_bits)
+
+    if data != decompress(stream):
+        print("Compression failed.", file=sys.stderr)
+        return 1
+
+    write_header(args.output, os.path.basename(args.mdf), stream, len(data))
+
+    print("%s: %u bytes compressed to %u bytes (window %u bytes)." %
+          (os.path.basename(args.mdf), len(data), len(stream), args.window))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -140,6 +140,34 @@ public:
         
         return mState;
     }
+
+    /**
+     * Returns the time until read() provides a changed state, which is
+     * already read from the pin, but still debounced. It doesn't read the
+     * pin itself.
+     *
+     * @return Time in ms, 0 if read() has to be called now or (unsigned long)-1 if the input is stable.
+     */
+    unsigned long getSettleTime(void) const
+    {
+        unsigned long   settleTime  = (unsigned long)-1;
+
+        if (mLastReadState != mState)
+        {
+            unsigned long   elapsed = millis() - mLastDebounceTime;
+
+            if (elapsed > mcDebounceDelay)
+            {
+                settleTime = 0;
+            }
+            else
+            {
+                settleTime = mcDebounceDelay - elapsed + 1;
+            }
+        }
+
+        return settleTime;
+    }
     
 private:
 
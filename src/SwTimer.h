@@ -146,6 +146,24 @@ public:
         return state;
     }
     
+    /**
+     * Returns the remaining time until the timer times out.
+     *
+     * @return Remaining time in ms
+     */
+    unsigned int getRemaining(void) const
+    {
+        unsigned long   diff        = millis() - mTimerTicksPrev;
+        unsigned int    remaining   = 0;
+
+        if (diff < mValue)
+        {
+            remaining = mValue - diff;
+        }
+
+        return remaining;
+    }
+
     /**
      * Restarts the timer.
      */
@@ -155,6 +173,26 @@ public:
         mTimerTicksPrev = millis();
     }
 
+    /**
+     * Advances the timer by the given time, e.g. after a sleep, in which
+     * millis() stood still.
+     *
+     * @param[in] elapsed   Elapsed time in ms
+     */
+    void advance(unsigned long elapsed)
+    {
+        if (elapsed < mValue)
+        {
+            mValue -= elapsed;
+        }
+        else
+        {
+            mValue = 0;
+        }
+
+        return;
+    }
+
     /**
      * Process the timer.
      */
@@ -41,12 +41,21 @@
     INCLUDES
 *******************************************************************************/
 #include "VSCP.h"
+#include <limits.h>
 #include "framework/core/vscp_core.h"
+#include "framework/core/vscp_instance.h"
 #include "framework/user/vscp_portable.h"
 #include "framework/user/vscp_timer.h"
 #include "framework/core/vscp_dev_data.h"
+#include "framework/core/vscp_ps.h"
+#include "framework/core/vscp_transport.h"
+#include "framework/core/vscp_bridge.h"
+#include "framework/core/vscp_l2.h"
+#include "framework/core/vscp_segment.h"
 #include "framework/user/vscp_tp_adapter.h"
 #include "framework/user/vscp_action.h"
+#include "framework/core/vscp_rx_filter.h"
+#include "framework/core/vscp_interest.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -72,6 +81,13 @@
     LOCAL VARIABLES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Number of framework instances, which are already used. */
+static uint16_t gInstanceCnt    = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -82,6 +98,7 @@
 
 VSCP::VSCP() :
     mIsInitialized(false),                  /* Call setup() later */
+    mInstance(0),                           /* Assigned by setup() */
     mStatusLampPin(0),                      /* Status Lamp pin */
     mInitButtonPin(0),                      /* Segment initialization button pin */
     mInitButton(),                          /* Default constructor init button debouncer */
@@ -91,7 +108,12 @@ VSCP::VSCP() :
     mStatusLampSlowPeriod(1000),            /* 1 s slow status lamp blinking period */
     mStatusLampTimer(),                     /* Status lamp timer for blinking */
     mVSCPTimerPeriod(250),                  /* 250 ms VSCP timer period */
-    mVSCPTimer()                            /* Timer instance used to handle the VSCP framework timers */
+    mVSCPTimerTimestamp(0),                 /* Set by setup() */
+    mIsVSCPTimerProcessed(false),           /* No VSCP timer processed yet */
+    mIsWakeUpRequested(false),              /* No wake up requested */
+    mTime(0),                               /* Sampled by process() */
+    mTasks(),                               /* No application task */
+    mTaskBudgetUs(0)                        /* No task time budget */
 {
     return;
 }
@@ -114,6 +136,25 @@ void VSCP::setup(
     unsigned char           index   = 0;
     vscp_dev_data_Container devData;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+    /* Every object uses its own framework instance. */
+    if (false == mIsInitialized)
+    {
+        if (VSCP_INSTANCE_NUM <= gInstanceCnt)
+        {
+            /* No framework instance available. */
+            return;
+        }
+
+        mInstance = gInstanceCnt;
+        ++gInstanceCnt;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+    vscp_instance_select(mInstance);
+
     /* Configure the hardware */
     pinMode(statusLampPin, OUTPUT);
     pinMode(initButtonPin, INPUT_PULLUP);
@@ -137,11 +178,20 @@ void VSCP::setup(
     /* Setup transport layer */
     vscp_tp_adapter_set(tpReadFunc, tpWriteFunc);
     
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
     /* Setup action */
     vscp_action_set(actionExecFunc);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    (void)actionExecFunc;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
     
     /* Start VSCP timer */
-    mVSCPTimer.start(mVSCPTimerPeriod, false);
+    mTime               = millis();
+    mVSCPTimerTimestamp = mTime;
     
     /* Framework is now ready */
     mIsInitialized = true;
@@ -149,8 +199,85 @@ void VSCP::setup(
     return;
 }
 
+void VSCP::setTransportBorrowed(TpBorrow tpBorrowFunc, TpRelease tpReleaseFunc)
+{
+    vscp_instance_select(mInstance);
+
+    vscp_tp_adapter_setBorrowed(tpBorrowFunc, tpReleaseFunc);
+    
+    return;
+}
+
+void VSCP::setTransportFilter(TpSetFilter tpSetFilterFunc)
+{
+    vscp_instance_select(mInstance);
+
+    vscp_tp_adapter_setFilterFunc(tpSetFilterFunc);
+
+    return;
+}
+
+void VSCP::setTransportL2(TpReadL2 tpReadL2Func, TpWriteL2 tpWriteL2Func)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+    vscp_tp_adapter_setL2(tpReadL2Func, tpWriteL2Func);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+    (void)tpReadL2Func;
+    (void)tpWriteL2Func;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+
+    return;
+}
+
+void VSCP::setL2EventHandler(L2Event l2EventFunc)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+    vscp_portable_setL2EventFunc(l2EventFunc);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+    (void)l2EventFunc;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+
+    return;
+}
+
+void VSCP::setFirmwareUpdate(FwProgram fwProgramFunc, FwActivate fwActivateFunc, uint32_t blockNum)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+    vscp_fw_access_set(fwProgramFunc, fwActivateFunc, blockNum);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
+    (void)fwProgramFunc;
+    (void)fwActivateFunc;
+    (void)blockNum;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+    return;
+}
+
+void VSCP::setBridgePort(uint8_t port, TpRead tpReadFunc, TpWrite tpWriteFunc)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+    vscp_bridge_setPort(port, tpReadFunc, tpWriteFunc);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+    (void)port;
+    (void)tpReadFunc;
+    (void)tpWriteFunc;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+
+    return;
+}
+
 void VSCP::restoreFactoryDefaultSettings(void)
 {
+    vscp_instance_select(mInstance);
+
     if (true == mIsInitialized)
     {
         vscp_core_restoreFactoryDefaultSettings();
@@ -161,40 +288,294 @@ void VSCP::restoreFactoryDefaultSettings(void)
 
 void VSCP::process(void)
 {
+    vscp_instance_select(mInstance);
+
+    mIsWakeUpRequested = false;
+
     if (true == mIsInitialized)
     {
+        startCycle();
+
         /* Process the whole framework */
         (void)vscp_core_process();
         
-        /* Process all member timers */
-        mStatusLampTimer.process();
-        mVSCPTimer.process();
-        
-        /* Process all VSCP framework timers */
-        if (true == mVSCPTimer.isTimeout())
+        processPeriphery();
+
+        /* Run the released application tasks */
+        runTasks(mTaskBudgetUs, micros());
+    }
+    
+    return;
+}
+
+uint8_t VSCP::process(uint8_t maxEvents, unsigned long maxTimeUs, bool* isBudgetExhausted)
+{
+    uint8_t         handledEvents   = 0;
+    bool            isExhausted     = false;
+    bool            isReceiving     = true;
+    unsigned long   startTimestamp  = micros();
+
+    vscp_instance_select(mInstance);
+
+    mIsWakeUpRequested = false;
+
+    if (true == mIsInitialized)
+    {
+        startCycle();
+
+        /* Process the whole framework, as long as events are received.
+         * The released application tasks run in between.
+         */
+        do
         {
-            vscp_timer_process(mVSCPTimerPeriod);
+            (void)vscp_core_process();
+
+            /* Stop draining, if no event was received in this cycle. */
+            if (FALSE == vscp_core_isEventReceived())
+            {
+                isReceiving = false;
+            }
+            else
+            {
+                if (255 > handledEvents)
+                {
+                    ++handledEvents;
+                }
+
+                (void)runTask();
+
+                /* Event budget exhausted? */
+                if ((0 < maxEvents) &&
+                    (maxEvents <= handledEvents))
+                {
+                    isExhausted = true;
+                }
+                /* Time budget exhausted? */
+                else if ((0 < maxTimeUs) &&
+                         (maxTimeUs <= (micros() - startTimestamp)))
+                {
+                    isExhausted = true;
+                }
+            }
         }
-            
-        /* Process the status lamp */
-        processStatusLamp();
-        
-        /* Handle segment initialization button */
-        if (LOW == mInitButton.read())
+        while((true == isReceiving) && (false == isExhausted));
+
+        processPeriphery();
+
+        /* Run the remaining released application tasks within the budget. */
+        if (false == isExhausted)
         {
-            if (HIGH == mLastInitButtonState)
+            runTasks(maxTimeUs, startTimestamp);
+        }
+    }
+
+    if (NULL != isBudgetExhausted)
+    {
+        *isBudgetExhausted = isExhausted;
+    }
+
+    return handledEvents;
+}
+
+unsigned long VSCP::nextDeadlineMs(void)
+{
+    unsigned long   deadline    = NO_DEADLINE;
+
+    vscp_instance_select(mInstance);
+
+    if ((true == mIsWakeUpRequested) ||
+        (false == mIsInitialized) ||
+        (true == mIsVSCPTimerProcessed))
+    {
+        deadline = 0;
+    }
+    else
+    {
+        uint32_t        timeToProcess   = vscp_core_getTimeToProcess();
+        unsigned long   settleTime      = mInitButton.getSettleTime();
+        unsigned long   now             = millis();
+        uint8_t         index           = 0;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+        if (VSCP_TIMER_NO_EXPIRY != timeToProcess)
+        {
+            deadline = timeToProcess;
+        }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+        /* The framework timers expire only with the VSCP timer period. */
+        if (0 == timeToProcess)
+        {
+            deadline = 0;
+        }
+        else if (VSCP_TIMER_NO_EXPIRY != timeToProcess)
+        {
+            unsigned long   elapsed     = now - mVSCPTimerTimestamp;
+            unsigned long   periods     = (timeToProcess + mVSCPTimerPeriod - 1) / mVSCPTimerPeriod;
+
+            if (mVSCPTimerPeriod <= elapsed)
             {
-                vscp_core_startNodeSegmentInit();
+                deadline = 0;
+            }
+            else
+            {
+                deadline = (mVSCPTimerPeriod - elapsed) + ((periods - 1) * mVSCPTimerPeriod);
             }
-            
-            mLastInitButtonState = LOW;
         }
-        else
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+        /* Status lamp */
+        if (vscp_portable_getLampState() != mStatusLampState)
+        {
+            deadline = 0;
+        }
+        else if (((VSCP_LAMP_STATE_BLINK_SLOW == mStatusLampState) ||
+                  (VSCP_LAMP_STATE_BLINK_FAST == mStatusLampState)) &&
+                 (mStatusLampTimer.getRemaining() < deadline))
         {
-            mLastInitButtonState = HIGH;
+            deadline = mStatusLampTimer.getRemaining();
+        }
+
+        /* Init button */
+        if (settleTime < deadline)
+        {
+            deadline = settleTime;
+        }
+
+        /* Application tasks */
+        for(index = 0; index < TASK_NUM; ++index)
+        {
+            if (NULL != mTasks[index].func)
+            {
+                unsigned long   timeToRelease   = mTasks[index].release - now;
+
+                if (0 >= (long)timeToRelease)
+                {
+                    deadline = 0;
+                }
+                else if (timeToRelease < deadline)
+                {
+                    deadline = timeToRelease;
+                }
+            }
         }
     }
-    
+
+    return deadline;
+}
+
+void VSCP::catchUp(unsigned long elapsedMs)
+{
+    uint8_t index   = 0;
+
+    vscp_instance_select(mInstance);
+
+    if (true == mIsInitialized)
+    {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+        vscp_timer_advance(elapsedMs);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+        /* The framework timers are advanced by the missed VSCP timer periods
+         * in the next cycle.
+         */
+        mVSCPTimerTimestamp -= elapsedMs;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+    }
+
+    mStatusLampTimer.advance(elapsedMs);
+
+    /* The missed task releases are handled in the next cycle. */
+    for(index = 0; index < TASK_NUM; ++index)
+    {
+        mTasks[index].release -= elapsedMs;
+    }
+
+    return;
+}
+
+void VSCP::wakeUp(void)
+{
+    mIsWakeUpRequested = true;
+
+    return;
+}
+
+unsigned long VSCP::getTime(void) const
+{
+    return mTime;
+}
+
+uint16_t VSCP::getInstance(void) const
+{
+    return mInstance;
+}
+
+uint8_t VSCP::addTask(TaskFunc func, unsigned long period, unsigned long phase, unsigned long deadline)
+{
+    uint8_t taskId  = TASK_ID_INVALID;
+    uint8_t index   = 0;
+
+    if (NULL != func)
+    {
+        /* Find a free task */
+        for(index = 0; (index < TASK_NUM) && (TASK_ID_INVALID == taskId); ++index)
+        {
+            if (NULL == mTasks[index].func)
+            {
+                taskId = index;
+            }
+        }
+
+        if (TASK_ID_INVALID != taskId)
+        {
+            Task&   task    = mTasks[taskId];
+
+            task.func       = func;
+            task.period     = period;
+            task.deadline   = (0 == deadline) ? period : deadline;
+            task.release    = millis() + phase;
+            task.overruns   = 0;
+            task.isAdded    = true;
+        }
+    }
+
+    return taskId;
+}
+
+void VSCP::removeTask(uint8_t taskId)
+{
+    if (TASK_NUM > taskId)
+    {
+        mTasks[taskId].func = NULL;
+    }
+
+    return;
+}
+
+uint16_t VSCP::getTaskOverruns(uint8_t taskId)
+{
+    uint16_t    overruns    = 0;
+
+    if (TASK_NUM > taskId)
+    {
+        overruns = mTasks[taskId].overruns;
+        mTasks[taskId].overruns = 0;
+    }
+
+    return overruns;
+}
+
+void VSCP::setTaskBudget(unsigned long maxTimeUs)
+{
+    mTaskBudgetUs = maxTimeUs;
+
     return;
 }
 
@@ -202,6 +583,8 @@ uint8_t VSCP::readNicknameId(void)
 {
     unsigned char   nicknameId  = VSCP_NICKNAME_NOT_INIT;
     
+    vscp_instance_select(mInstance);
+
     if (true == mIsInitialized)
     {
         nicknameId = vscp_core_readNicknameId();
@@ -212,6 +595,8 @@ uint8_t VSCP::readNicknameId(void)
 
 void VSCP::startNodeSegmentInit(void)
 {
+    vscp_instance_select(mInstance);
+
     if (true == mIsInitialized)
     {
         vscp_core_startNodeSegmentInit();
@@ -222,6 +607,8 @@ void VSCP::startNodeSegmentInit(void)
 
 void VSCP::setAlarm(unsigned char value)
 {
+    vscp_instance_select(mInstance);
+
     if (true == mIsInitialized)
     {
         vscp_core_setAlarm(value);
@@ -234,6 +621,8 @@ bool VSCP::isActive(void)
 {
     bool    status  = false;
 
+    vscp_instance_select(mInstance);
+
     if (TRUE == mIsInitialized)
     {
         if (FALSE != vscp_core_isActive())
@@ -245,8 +634,22 @@ bool VSCP::isActive(void)
     return status;
 }
 
+void VSCP::flushPersistentMemory(void)
+{
+    vscp_instance_select(mInstance);
+
+    if (true == mIsInitialized)
+    {
+        vscp_ps_flush();
+    }
+
+    return;
+}
+
 void VSCP::prepareTxMessage(vscp_TxMessage& txMessage, unsigned int vscpClass, unsigned char vscpType, VSCP_PRIORITY priority)
 {
+    vscp_instance_select(mInstance);
+
     vscp_core_prepareTxMessage(&txMessage, vscpClass, vscpType, priority);
     return;
 }
@@ -255,6 +658,8 @@ bool VSCP::write(const vscp_TxMessage& txMessage)
 {
     bool    status = false;
 
+    vscp_instance_select(mInstance);
+
     if (TRUE == mIsInitialized)
     {
         status = vscp_core_sendEvent(&txMessage);
@@ -263,10 +668,74 @@ bool VSCP::write(const vscp_TxMessage& txMessage)
     return status;
 }
 
+void VSCP::prepareL2Message(vscp_L2Message& txMessage, unsigned int vscpClass, unsigned int vscpType, VSCP_PRIORITY priority)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+    vscp_core_prepareL2Message(&txMessage, vscpClass, vscpType, priority);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+    (void)txMessage;
+    (void)vscpClass;
+    (void)vscpType;
+    (void)priority;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+
+    return;
+}
+
+bool VSCP::writeL2(const vscp_L2Message& txMessage)
+{
+    bool    status = false;
+
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+    if (TRUE == mIsInitialized)
+    {
+        status = vscp_core_sendL2Event(&txMessage);
+    }
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+    (void)txMessage;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_LEVEL2 ) */
+
+    return status;
+}
+
+bool VSCP::writeSegmented(const vscp_TxMessage& header, uint8_t indexPos, const uint8_t* data, uint8_t dataSize, bool fillUp)
+{
+    bool    status = false;
+
+    vscp_instance_select(mInstance);
+
+    if (TRUE == mIsInitialized)
+    {
+        status = vscp_segment_send(&header, indexPos, (true == fillUp) ? TRUE : FALSE, data, dataSize);
+    }
+
+    return status;
+}
+
+VSCP_SEGMENT_RX VSCP::reassemble(const vscp_RxMessage& msg, uint8_t headerSize, uint8_t indexPos, uint8_t size, const uint8_t*& data, uint8_t& dataSize)
+{
+    VSCP_SEGMENT_RX status = VSCP_SEGMENT_RX_DROPPED;
+
+    vscp_instance_select(mInstance);
+
+    if (TRUE == mIsInitialized)
+    {
+        status = vscp_segment_receive(&msg, headerSize, indexPos, size, &data, &dataSize);
+    }
+
+    return status;
+}
+
 bool VSCP::read(vscp_RxMessage& msg)
 {
     bool    status = false;
 
+    vscp_instance_select(mInstance);
+
     if (TRUE == mIsInitialized)
     {
         status = vscp_portable_read(&msg);
@@ -275,6 +744,105 @@ bool VSCP::read(vscp_RxMessage& msg)
     return status;
 }
 
+uint8_t VSCP::read(vscp_RxMessage* msgs, uint8_t max)
+{
+    uint8_t num = 0;
+
+    vscp_instance_select(mInstance);
+
+    if ((true == mIsInitialized) &&
+        (NULL != msgs))
+    {
+        num = vscp_portable_readMultiple(msgs, max);
+    }
+
+    return num;
+}
+
+void VSCP::setRxFilter(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    vscp_instance_select(mInstance);
+
+    vscp_portable_setRxFilter(classMask, classFilter, typeMask, typeFilter);
+
+    clearRxInterest();
+    (void)addRxInterest(classMask, classFilter, typeMask, typeFilter);
+
+    return;
+}
+
+bool VSCP::addRxInterest(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    bool    status  = true;
+
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+    if (FALSE == vscp_rx_filter_addInterest(classMask, classFilter, typeMask, typeFilter))
+    {
+        status = false;
+    }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+    if (FALSE == vscp_interest_add(classMask, classFilter, typeMask, typeFilter))
+    {
+        status = false;
+    }
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_RX_FILTER ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_EVENT_INTEREST )
+    (void)classMask;
+    (void)classFilter;
+    (void)typeMask;
+    (void)typeFilter;
+    status = false;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_RX_FILTER ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+    return status;
+}
+
+void VSCP::clearRxInterest(void)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+    vscp_rx_filter_clearInterest();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+    vscp_interest_clear();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+    return;
+}
+
+uint8_t VSCP::getRxOverflows(void)
+{
+    vscp_instance_select(mInstance);
+
+    return vscp_portable_getRxOverflows();
+}
+
+uint16_t VSCP::getTxDrops(VSCP_PRIORITY priority)
+{
+    vscp_instance_select(mInstance);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+    return vscp_transport_getTxDrops(priority);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
+    (void)priority;
+    return 0;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
+}
+
+uint16_t VSCP::getRegRspDrops(void)
+{
+    vscp_instance_select(mInstance);
+
+    return vscp_core_getRegRspDrops();
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -340,3 +908,158 @@ void VSCP::processStatusLamp(void)
     
     return;
 }
+
+void VSCP::startCycle(void)
+{
+    uint8_t index   = 0;
+
+    mTime = millis();
+
+    for(index = 0; index < TASK_NUM; ++index)
+    {
+        mTasks[index].isAdded = false;
+    }
+
+    return;
+}
+
+bool VSCP::runTask(void)
+{
+    uint8_t taskId  = TASK_ID_INVALID;
+    long    urgency = 0;
+    uint8_t index   = 0;
+
+    /* Find the released task with the earliest deadline. A task without
+     * deadline is considered after all others.
+     */
+    for(index = 0; index < TASK_NUM; ++index)
+    {
+        Task const &    task    = mTasks[index];
+
+        if ((NULL != task.func) &&
+            (false == task.isAdded) &&
+            (0 <= (long)(mTime - task.release)))
+        {
+            long    taskUrgency = (0 == task.deadline) ? LONG_MAX : (long)(task.release + task.deadline - mTime);
+
+            if ((TASK_ID_INVALID == taskId) ||
+                (taskUrgency < urgency))
+            {
+                taskId  = index;
+                urgency = taskUrgency;
+            }
+        }
+    }
+
+    if (TASK_ID_INVALID != taskId)
+    {
+        Task&           task        = mTasks[taskId];
+        TaskFunc        func        = task.func;
+        unsigned long   release     = task.release;
+        unsigned long   deadline    = task.deadline;
+
+        /* A one-shot task is removed before it runs, so it may add itself
+         * again. It is released not before the next cycle.
+         */
+        if (0 == task.period)
+        {
+            task.func = NULL;
+        }
+        else
+        {
+            /* Skip the periods, which were missed completely. */
+            unsigned long   missed  = (mTime - release) / task.period;
+
+            task.release = release + ((missed + 1) * task.period);
+
+            if ((0xFFFFUL - task.overruns) < missed)
+            {
+                task.overruns = 0xFFFF;
+            }
+            else
+            {
+                task.overruns += missed;
+            }
+        }
+
+        func(taskId);
+
+        /* Completed within its deadline? */
+        if ((NULL != task.func) &&
+            (0 < deadline) &&
+            (deadline < (millis() - release)) &&
+            (0xFFFF > task.overruns))
+        {
+            ++task.overruns;
+        }
+    }
+
+    return (TASK_ID_INVALID != taskId);
+}
+
+void VSCP::runTasks(unsigned long maxTimeUs, unsigned long startTimestamp)
+{
+    while(true == runTask())
+    {
+        /* Time budget exhausted? */
+        if ((0 < maxTimeUs) &&
+            (maxTimeUs <= (micros() - startTimestamp)))
+        {
+            break;
+        }
+    }
+
+    return;
+}
+
+void VSCP::processPeriphery(void)
+{
+    /* Process all member timers */
+    mStatusLampTimer.process();
+    
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+    /* The VSCP framework timers run on absolute deadlines. Only the timer
+     * callbacks and periodic timers need to be processed, as often as possible.
+     */
+    vscp_timer_process(0);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+    {
+        unsigned long   periods = (mTime - mVSCPTimerTimestamp) / mVSCPTimerPeriod;
+
+        /* Process all VSCP framework timers, for every elapsed period. If the
+         * process was delayed, e.g. by a sleep, the periods are caught up.
+         */
+        mIsVSCPTimerProcessed = (0 < periods);
+
+        if (true == mIsVSCPTimerProcessed)
+        {
+            vscp_timer_advance(periods * mVSCPTimerPeriod);
+            mVSCPTimerTimestamp += periods * mVSCPTimerPeriod;
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+        
+    /* Process the status lamp */
+    processStatusLamp();
+    
+    /* Handle segment initialization button */
+    if (LOW == mInitButton.read())
+    {
+        if (HIGH == mLastInitButtonState)
+        {
+            vscp_core_startNodeSegmentInit();
+        }
+        
+        mLastInitButtonState = LOW;
+    }
+    else
+    {
+        mLastInitButtonState = HIGH;
+    }
+    
+    return;
+}
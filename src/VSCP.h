@@ -62,6 +62,9 @@ This module provides a C++ wrapper for the VSCP framework.
 #include "SwTimer.h"
 #include "framework/user/vscp_platform.h"
 #include "framework/core/vscp_types.h"
+#include "framework/core/vscp_can_id.h"
+#include "framework/core/vscp_segment.h"
+#include "framework/user/vscp_fw_access.h"
 
 #include "framework/core/vscp_class_l1.h"
 #include "framework/core/vscp_class_l1_l2.h"
@@ -107,15 +110,51 @@ class VSCP
 {
 public:
 
+    /** No deadline, the node may sleep until it is woken up by a event. */
+    static const unsigned long NO_DEADLINE = 0xFFFFFFFFUL;
+
     /** This type defines the transport receive function. */
     typedef bool (*TpRead)(vscp_RxMessage * const rxMsg);
     
     /** This type defines the transport transmit function. */
     typedef bool (*TpWrite)(vscp_TxMessage const * const txMsg);
+
+    /** This type defines the transport function, which lends a received frame. */
+    typedef vscp_RxMessage const * (*TpBorrow)(void);
+
+    /** This type defines the transport function, which gives a lent frame back. */
+    typedef void (*TpRelease)(vscp_RxMessage const * const rxMsg);
+
+    /** This type defines the transport function, which configures the receive acceptance filters. */
+    typedef void (*TpSetFilter)(vscp_AcceptanceFilter const * const filters, uint8_t num);
     
     /** This type defines the action execution function. */
     typedef void (*ExecuteAction)(unsigned char action, unsigned char par, vscp_RxMessage const * const msg);
 
+    /** This type defines the firmware block program function. */
+    typedef VSCP_FW_ACCESS_RET (*FwProgram)(uint32_t block, uint8_t const * const data, uint16_t size);
+
+    /** This type defines the firmware activation function. */
+    typedef bool (*FwActivate)(void);
+
+    /** This type defines a application task function. */
+    typedef void (*TaskFunc)(uint8_t taskId);
+
+    /** This type defines the Level II transport receive function. */
+    typedef bool (*TpReadL2)(vscp_L2Message * const rxMsg);
+
+    /** This type defines the Level II transport transmit function. */
+    typedef bool (*TpWriteL2)(vscp_L2Message const * const txMsg);
+
+    /** This type defines the Level II event function. */
+    typedef void (*L2Event)(vscp_L2Message const * const msg);
+
+    /** Max. number of application tasks */
+    static const uint8_t    TASK_NUM        = 8;
+
+    /** Invalid task id */
+    static const uint8_t    TASK_ID_INVALID = 0xFF;
+
     /**
      * Create a VSCP framework instance.
      */
@@ -147,6 +186,80 @@ public:
         TpRead          tpReadFunc,
         TpWrite         tpWriteFunc,
         ExecuteAction   actionExecFunc);
+
+    /**
+     * Set a zero-copy receive path. Instead of copying a received frame via
+     * the transport read function, the driver lends its frame buffer to the
+     * framework and gets it back via the release function, after the
+     * event was processed. The transport read function is not used anymore.
+     * Call it after setup().
+     *
+     * @param[in]   tpBorrowFunc    Transport layer borrow function
+     * @param[in]   tpReleaseFunc   Transport layer release function
+     */
+    void setTransportBorrowed(TpBorrow tpBorrowFunc, TpRelease tpReleaseFunc);
+
+    /**
+     * Set the transport function, which configures the receive acceptance
+     * filters of the CAN controller. It is called in idle time, whenever the
+     * filters changed, e.g. after the decision matrix was written.
+     * It is only used, if VSCP_CONFIG_RX_FILTER is enabled.
+     * Call it after setup().
+     *
+     * @param[in]   tpSetFilterFunc Transport layer acceptance filter function
+     */
+    void setTransportFilter(TpSetFilter tpSetFilterFunc);
+
+    /**
+     * Set the Level II transport functions. The receive function gets a
+     * message, whose data is a block of the payload pool with
+     * VSCP_CONFIG_L2_BLOCK_SIZE bytes.
+     * It is only used, if VSCP_CONFIG_LEVEL2 is enabled.
+     * Call it after setup().
+     *
+     * @param[in]   tpReadL2Func    Level II transport layer read function
+     * @param[in]   tpWriteL2Func   Level II transport layer write function
+     */
+    void setTransportL2(TpReadL2 tpReadL2Func, TpWriteL2 tpWriteL2Func);
+
+    /**
+     * Set the function, which gets the received Level II events. Level II
+     * events, which are Level I events, are read with read() instead.
+     * The message and its data are only valid during the call.
+     * It is only used, if VSCP_CONFIG_LEVEL2 is enabled.
+     * Call it after setup().
+     *
+     * @param[in]   l2EventFunc     Level II event function
+     */
+    void setL2EventHandler(L2Event l2EventFunc);
+
+    /**
+     * Set the functions, which program the received firmware blocks and
+     * activate the new firmware. The firmware update runs in the application,
+     * block by block in the background of process(), while the node stays
+     * active. The program function may return VSCP_FW_ACCESS_RET_BUSY, if the
+     * flash is still busy, it will be called again in the next cycle.
+     * It is only used, if VSCP_CONFIG_FW_UPDATE is enabled.
+     * Call it after setup().
+     *
+     * @param[in]   fwProgramFunc   Firmware block program function
+     * @param[in]   fwActivateFunc  Firmware activation function
+     * @param[in]   blockNum        Number of firmware blocks, each with VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE bytes
+     */
+    void setFirmwareUpdate(FwProgram fwProgramFunc, FwActivate fwActivateFunc, uint32_t blockNum);
+
+    /**
+     * Set the transport functions of a further bridge port. The bridge
+     * forwards the received events between the transport of setup() (port 0)
+     * and the further ports, according to its routing table.
+     * It is only used, if VSCP_CONFIG_BRIDGE is enabled.
+     * Call it after setup().
+     *
+     * @param[in]   port            Bridge port [1; VSCP_CONFIG_BRIDGE_PORT_NUM - 1]
+     * @param[in]   tpReadFunc      Transport layer read function
+     * @param[in]   tpWriteFunc     Transport layer write function
+     */
+    void setBridgePort(uint8_t port, TpRead tpReadFunc, TpWrite tpWriteFunc);
     
     /**
      * This method restores VSCP default values for
@@ -164,6 +277,115 @@ public:
      */
     void process(void);
 
+    /**
+     * This method process the whole VSCP core stack like process(void), but
+     * handles a burst of received events per call. The core is processed
+     * as long as it receives events, until the event budget or the time budget
+     * is exhausted. Cycles, which only continue sending responses, don't
+     * count as handled events.
+     *
+     * @param[in]   maxEvents           Max. number of events to handle (0 = no limit)
+     * @param[in]   maxTimeUs           Max. time to spend in us (0 = no limit)
+     * @param[out]  isBudgetExhausted   Optional: Set to true, if the processing stopped because of the budget.
+     * @return Number of handled events
+     */
+    uint8_t process(uint8_t maxEvents, unsigned long maxTimeUs = 0, bool* isBudgetExhausted = NULL);
+
+    /**
+     * This method returns the time until process() has to be called again.
+     * Until then, the framework has nothing to do and the MCU may sleep.
+     * It considers the framework timers, the application tasks, the status
+     * lamp and the init button.
+     *
+     * A received event or a pressed init button needs to wake up the MCU,
+     * e.g. by the CAN controller or a pin change interrupt. To avoid missing
+     * a wake up, call it with interrupts disabled and sleep immediately.
+     *
+     * @return Time in ms, 0 if process() has to be called now or NO_DEADLINE
+     */
+    unsigned long nextDeadlineMs(void);
+
+    /**
+     * This method advances the framework timers, the status lamp timer and
+     * the application task releases by the given time. Call it after a sleep,
+     * in which millis() stood still, e.g. in power down mode.
+     * Missed periods of periodic timers, like the time since epoch, are
+     * caught up in the next process() call.
+     *
+     * @param[in]   elapsedMs   Slept time in ms
+     */
+    void catchUp(unsigned long elapsedMs);
+
+    /**
+     * This method requests the processing of the framework, independent of
+     * its timers. nextDeadlineMs() returns 0 until process() was called.
+     * It is safe to call it in a interrupt service routine, e.g. after a
+     * frame was received.
+     */
+    void wakeUp(void);
+
+    /**
+     * This method returns the time base, which is sampled once at the
+     * beginning of every process() call. All tasks of the same cycle see the
+     * same time.
+     *
+     * @return Time in ms
+     */
+    unsigned long getTime(void) const;
+
+    /**
+     * This method returns the framework instance, which is used by this
+     * object. It is assigned by setup() and is always 0, if
+     * VSCP_CONFIG_MULTI_INSTANCE is disabled. The transport and action
+     * callbacks can find out their node with vscp_instance_get().
+     *
+     * @return Framework instance
+     */
+    uint16_t getInstance(void) const;
+
+    /**
+     * This method adds a application task. The task is released the first
+     * time after the phase and then with every period. The released tasks
+     * run in process(), interleaved with the event handling, the one with
+     * the earliest deadline first. A task, which is not completed within its
+     * deadline after release, is counted as overrun. A task, which is added
+     * by a running task, is released not before the next process() call.
+     *
+     * @param[in]   func        Task function
+     * @param[in]   period      Period in ms (0 = one-shot task)
+     * @param[in]   phase       Time in ms until the first release
+     * @param[in]   deadline    Deadline in ms after release (0 = period, no deadline for one-shot tasks)
+     * @return Task id or TASK_ID_INVALID if no task is available
+     */
+    uint8_t addTask(TaskFunc func, unsigned long period, unsigned long phase = 0, unsigned long deadline = 0);
+
+    /**
+     * This method removes a application task. A one-shot task is removed
+     * automatically, before it runs.
+     *
+     * @param[in]   taskId  Task id
+     */
+    void removeTask(uint8_t taskId);
+
+    /**
+     * This method returns the number of overruns of a task. A overrun is a
+     * run, which completed after its deadline or a period, which was skipped,
+     * because the task was still late. Calling it clears the counter.
+     *
+     * @param[in]   taskId  Task id
+     * @return Number of overruns
+     */
+    uint16_t getTaskOverruns(uint8_t taskId);
+
+    /**
+     * This method sets the time budget of the tasks in process(void). The
+     * released tasks, which don't fit into the budget, run in the next
+     * cycle. At least one task runs per cycle.
+     *
+     * @param[in]   maxTimeUs   Max. time in us for the tasks per cycle (0 = no limit)
+     */
+    void setTaskBudget(unsigned long maxTimeUs);
+
     /**
      * This method reads the nickname id of the node.
      *
@@ -195,6 +417,13 @@ public:
      * @retval  true    In active state
      */
     bool isActive(void);
+
+    /**
+     * This method writes all cached data back to the persistent memory.
+     * The framework does it in idle time and after a timeout anyway, but call
+     * it e.g. before a reset or if a power loss is detected.
+     */
+    void flushPersistentMemory(void);
     
     /**
      * Prepares a transmit message, before it is used.
@@ -219,12 +448,72 @@ public:
      * message (@see vscp_core_prepareTxMessage) first and then modify for your needs,
      * before sending it!
      *
+     * If the transmit queue is enabled, the event is queued in case it can't be
+     * sent immediately.
+     *
      * @param[in]   txMessage   The event which will be sent.
      * @return Status
      * @retval FALSE    Failed to send the event.
-     * @retval TRUE     Event successful sent.
+     * @retval TRUE     Event successful sent or queued.
      */
     bool write(const vscp_TxMessage& txMessage);
+
+    /**
+     * This method prepares a Level II transmit message with the node GUID.
+     * The data isn't touched, set it to a buffer of the application or to a
+     * block of the payload pool (vscp_l2_alloc()).
+     * It is only used, if VSCP_CONFIG_LEVEL2 is enabled.
+     *
+     * @param[in,out]   txMessage   Transmit message which will be prepared.
+     * @param[in]       vscpClass   Transmit message VSCP class
+     * @param[in]       vscpType    Transmit message VSCP type
+     * @param[in]       priority    Transmit message priority
+     */
+    void prepareL2Message(vscp_L2Message& txMessage, unsigned int vscpClass, unsigned int vscpType, VSCP_PRIORITY priority);
+
+    /**
+     * Send a Level II event to the communication bus.
+     * It is only used, if VSCP_CONFIG_LEVEL2 is enabled.
+     *
+     * @param[in]   txMessage   The event which will be sent.
+     * @return Status
+     * @retval FALSE    Failed to send the event.
+     * @retval TRUE     Event successful sent.
+     */
+    bool writeL2(const vscp_L2Message& txMessage);
+
+    /**
+     * Send a payload, which doesn't fit into a single event, e.g. a display
+     * text. The header message contains the class, type, priority and the
+     * header bytes, which every event starts with. The index byte in the
+     * header is increased by one for every event. The payload is copied and
+     * the events are sent in the following process cycles.
+     *
+     * @param[in]   header      Header message, data size is the header size
+     * @param[in]   indexPos    Position of the index byte in the header
+     * @param[in]   data        Payload
+     * @param[in]   dataSize    Payload size in byte (max. VSCP_CONFIG_SEGMENT_TX_SIZE)
+     * @param[in]   fillUp      Fill up the last event with zeros
+     * @return Status
+     * @retval FALSE    Failed to queue the events.
+     * @retval TRUE     Events queued.
+     */
+    bool writeSegmented(const vscp_TxMessage& header, uint8_t indexPos, const uint8_t* data, uint8_t dataSize, bool fillUp = false);
+
+    /**
+     * Reassemble a payload, which was sent in several events, e.g. a display
+     * text. The events of several nodes are reassembled concurrently. The
+     * data of a complete payload is valid until the next call.
+     *
+     * @param[in]   msg         Received message
+     * @param[in]   headerSize  Header size in byte
+     * @param[in]   indexPos    Position of the index byte in the header
+     * @param[in]   size        Payload size or 0, if a event, which isn't full, completes it
+     * @param[out]  data        Complete payload
+     * @param[out]  dataSize    Complete payload size in byte
+     * @return Receive status
+     */
+    VSCP_SEGMENT_RX reassemble(const vscp_RxMessage& msg, uint8_t headerSize, uint8_t indexPos, uint8_t size, const uint8_t*& data, uint8_t& dataSize);
     
     /**
      * This method reads a VSCP message.
@@ -234,6 +523,85 @@ public:
      * @return Anything read or not
      */
     bool read(vscp_RxMessage& msg);
+
+    /**
+     * This method reads several VSCP messages at once.
+     *
+     * @param[out]  msgs    Buffer for the received messages
+     * @param[in]   max     Max. number of messages, which fit into the buffer
+     * @return Number of read messages
+     */
+    uint8_t read(vscp_RxMessage* msgs, uint8_t max);
+
+    /**
+     * This method sets the receive filter. Only received messages which pass
+     * the filter are queued for read(). A mask of 0 accepts every class
+     * respectively type, which is the default.
+     *
+     * A message passes, if (class & classMask) == classFilter and
+     * (type & typeMask) == typeFilter.
+     *
+     * If VSCP_CONFIG_RX_FILTER or VSCP_CONFIG_EVENT_INTEREST is enabled, it
+     * replaces the declared interest of the application, see addRxInterest().
+     *
+     * @param[in]   classMask   Class mask
+     * @param[in]   classFilter Class filter
+     * @param[in]   typeMask    Type mask
+     * @param[in]   typeFilter  Type filter
+     */
+    void setRxFilter(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+    /**
+     * This method declares the interest of the application in the given events.
+     * If VSCP_CONFIG_RX_FILTER is enabled, the CAN controller lets pass only
+     * the events of the decision matrix, the protocol events and the declared
+     * ones. If VSCP_CONFIG_EVENT_INTEREST is enabled, they are reported to
+     * gateways, which ask for the event interest of the node.
+     * It is only supported, if at least one of them is enabled.
+     *
+     * A event is of interest, if (class & classMask) == classFilter and
+     * (type & typeMask) == typeFilter.
+     *
+     * @param[in]   classMask   Class mask
+     * @param[in]   classFilter Class filter
+     * @param[in]   typeMask    Type mask
+     * @param[in]   typeFilter  Type filter
+     * @return If successful, it will return true otherwise false.
+     */
+    bool addRxInterest(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+    /**
+     * This method removes the whole declared interest of the application.
+     */
+    void clearRxInterest(void);
+
+    /**
+     * This method returns the number of received messages, which were dropped,
+     * because the receive queue was full. Calling it clears the counter.
+     *
+     * @return Number of dropped messages
+     */
+    uint8_t getRxOverflows(void);
+
+    /**
+     * This method returns the number of transmitted messages of the given
+     * priority, which were dropped, because the transmit queue was full or
+     * the message couldn't be sent after all retries. Calling it clears the
+     * counter of the priority.
+     *
+     * @param[in]   priority    Message priority
+     * @return Number of dropped messages
+     */
+    uint16_t getTxDrops(VSCP_PRIORITY priority);
+
+    /**
+     * This method returns the number of register responses, which were
+     * dropped, because the register response queue was full. Calling it
+     * clears the counter.
+     *
+     * @return Number of dropped register responses
+     */
+    uint16_t getRegRspDrops(void);
     
 private:
 
@@ -244,6 +612,7 @@ private:
     VSCP& operator=(const VSCP& vscp);
     
     bool                mIsInitialized;         /**< Is framework initialized or not */
+    uint16_t            mInstance;              /**< Framework instance */
     
     int                 mStatusLampPin;         /**< Status lamp pin */
     int                 mInitButtonPin;         /**< Segment initialization button pin */
@@ -256,12 +625,58 @@ private:
     SwTimer             mStatusLampTimer;       /**< Status lamp timer used for blinking */
     
     const unsigned int  mVSCPTimerPeriod;       /**< VSCP timer period in ms */
-    SwTimer             mVSCPTimer;             /**< VSCP timer */
+    unsigned long       mVSCPTimerTimestamp;    /**< Timestamp in ms of the last VSCP timer period */
+    bool                mIsVSCPTimerProcessed;  /**< VSCP timers were processed in the last cycle */
+
+    volatile bool       mIsWakeUpRequested;     /**< Wake up requested by wakeUp() */
+
+    /** Application task */
+    typedef struct
+    {
+        TaskFunc        func;       /**< Task function, NULL if the task is free */
+        unsigned long   period;     /**< Period in ms, 0 for a one-shot task */
+        unsigned long   deadline;   /**< Deadline in ms after release, 0 for no deadline */
+        unsigned long   release;    /**< Next release time in ms */
+        uint16_t        overruns;   /**< Number of overruns */
+        bool            isAdded;    /**< Added after the cycle started, released not before the next cycle */
+
+    } Task;
+
+    unsigned long       mTime;                  /**< Time base in ms, sampled once per cycle */
+    Task                mTasks[TASK_NUM];       /**< Application tasks */
+    unsigned long       mTaskBudgetUs;          /**< Time budget in us of the tasks in process(void) */
         
     /**
      * Process the status lamp.
      */
     void processStatusLamp(void);
+
+    /**
+     * Start a process cycle. The time base is sampled and the tasks, which
+     * were added since the last cycle, take part in the release.
+     */
+    void startCycle(void);
+
+    /**
+     * Run the released task with the earliest deadline.
+     *
+     * @return If a task was run, it will return true otherwise false.
+     */
+    bool runTask(void);
+
+    /**
+     * Run the released tasks in order of their deadlines, until the time
+     * budget is exhausted. At least one task is run.
+     *
+     * @param[in]   maxTimeUs       Max. time in us (0 = no limit)
+     * @param[in]   startTimestamp  Timestamp in us, the budget started
+     */
+    void runTasks(unsigned long maxTimeUs, unsigned long startTimestamp);
+
+    /**
+     * Process the timers, the status lamp and the init button.
+     */
+    void processPeriphery(void);
 };
 
 /*******************************************************************************
@@ -0,0 +1,833 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 - 2025, Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  MCP2515 CAN transport
+@file   VSCPMcp2515.cpp
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see VSCPMcp2515.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "VSCPMcp2515.h"
+#include <SPI.h>
+#include "framework/core/vscp_can_id.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** SPI clock of the MCP2515 in Hz */
+#define VSCP_MCP2515_SPI_CLOCK          10000000UL
+
+/** SPI instruction: Reset */
+#define VSCP_MCP2515_INSTR_RESET        0xC0
+
+/** SPI instruction: Read register */
+#define VSCP_MCP2515_INSTR_READ         0x03
+
+/** SPI instruction: Write register */
+#define VSCP_MCP2515_INSTR_WRITE        0x02
+
+/** SPI instruction: Modify bits of a register */
+#define VSCP_MCP2515_INSTR_BIT_MODIFY   0x05
+
+/** SPI instruction: Read status */
+#define VSCP_MCP2515_INSTR_READ_STATUS  0xA0
+
+/** SPI instruction: Read receive buffer 0, starting at the identifier. Add 4 for receive buffer 1. */
+#define VSCP_MCP2515_INSTR_READ_RX_BUF  0x90
+
+/** SPI instruction: Request to send, the lower bits select the transmit buffers */
+#define VSCP_MCP2515_INSTR_RTS          0x80
+
+/** Register: Filter 0, the filters 1 - 5 follow with a gap after filter 2 */
+#define VSCP_MCP2515_REG_RXF0SIDH       0x00
+
+/** Register: Filter 3 */
+#define VSCP_MCP2515_REG_RXF3SIDH       0x10
+
+/** Register: Mask 0 */
+#define VSCP_MCP2515_REG_RXM0SIDH       0x20
+
+/** Register: Mask 1 */
+#define VSCP_MCP2515_REG_RXM1SIDH       0x24
+
+/** Register: Status */
+#define VSCP_MCP2515_REG_CANSTAT        0x0E
+
+/** Register: Control */
+#define VSCP_MCP2515_REG_CANCTRL        0x0F
+
+/** Register: Transmit error counter, followed by the receive error counter */
+#define VSCP_MCP2515_REG_TEC            0x1C
+
+/** Register: Receive error counter */
+#define VSCP_MCP2515_REG_REC            0x1D
+
+/** Register: Bit timing 3, followed by bit timing 2 and 1 */
+#define VSCP_MCP2515_REG_CNF3           0x28
+
+/** Register: Interrupt enable, followed by the interrupt flags */
+#define VSCP_MCP2515_REG_CANINTE        0x2B
+
+/** Register: Interrupt flags */
+#define VSCP_MCP2515_REG_CANINTF        0x2C
+
+/** Register: Error flags */
+#define VSCP_MCP2515_REG_EFLG           0x2D
+
+/** Register: Transmit buffer 0 control, the transmit buffer follows. Add 0x10 for the next buffer. */
+#define VSCP_MCP2515_REG_TXB0CTRL       0x30
+
+/** Register: Receive buffer 0 control */
+#define VSCP_MCP2515_REG_RXB0CTRL       0x60
+
+/** Register: Receive buffer 1 control */
+#define VSCP_MCP2515_REG_RXB1CTRL       0x70
+
+/** Operation mode: Normal */
+#define VSCP_MCP2515_MODE_NORMAL        0x00
+
+/** Operation mode: Configuration */
+#define VSCP_MCP2515_MODE_CONFIG        0x80
+
+/** Mask of the operation mode in CANCTRL and CANSTAT */
+#define VSCP_MCP2515_MODE_MASK          0xE0
+
+/** Interrupt flag: Receive buffer 0 full */
+#define VSCP_MCP2515_INT_RX0            0x01
+
+/** Interrupt flag: Receive buffer 1 full */
+#define VSCP_MCP2515_INT_RX1            0x02
+
+/** Interrupt flag: Error flags changed */
+#define VSCP_MCP2515_INT_ERR            0x20
+
+/** Interrupt flag: Message error */
+#define VSCP_MCP2515_INT_MERR           0x80
+
+/** All used interrupts */
+#define VSCP_MCP2515_INT_ALL            (VSCP_MCP2515_INT_RX0 | VSCP_MCP2515_INT_RX1 | VSCP_MCP2515_INT_ERR | VSCP_MCP2515_INT_MERR)
+
+/** Error flag: Receive buffer 0 overflow */
+#define VSCP_MCP2515_EFLG_RX0OVR        0x40
+
+/** Error flag: Receive buffer 1 overflow */
+#define VSCP_MCP2515_EFLG_RX1OVR        0x80
+
+/** Receive buffer 0 control: Roll over into receive buffer 1, if receive buffer 0 is full */
+#define VSCP_MCP2515_RXB0CTRL_BUKT      0x04
+
+/** Identifier: Extended identifier flag in SIDL */
+#define VSCP_MCP2515_SIDL_EXIDE         0x08
+
+/** Data length: Remote transmission request flag */
+#define VSCP_MCP2515_DLC_RTR            0x40
+
+/** Data length: Mask of the data length code */
+#define VSCP_MCP2515_DLC_MASK           0x0F
+
+/** Read status: Transmit request of transmit buffer 0. Shift by 2 for the next buffer. */
+#define VSCP_MCP2515_STATUS_TXREQ0      0x04
+
+/** Number of identifier registers */
+#define VSCP_MCP2515_ID_SIZE            4
+
+/** Max. number of status polls, until a requested operation mode is entered */
+#define VSCP_MCP2515_MODE_POLLS         1000U
+
+/** Number of filters, which share the mask of receive buffer 1 */
+#define VSCP_MCP2515_RXB1_FILTER_NUM    4
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    CLASSES, TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Bit timing for 125 kbit/s (CNF3, CNF2, CNF1), indexed by the oscillator frequency. */
+static const uint8_t    gBitTiming[][3] =
+{
+    { 0x85, 0xB1, 0x01 },   /*  8 MHz: 16 time quanta, sample point at 62.5% */
+    { 0x86, 0xF0, 0x03 },   /* 16 MHz: 16 time quanta, sample point at 56.25% */
+    { 0x87, 0xFA, 0x03 }    /* 20 MHz: 20 time quanta, sample point at 60% */
+};
+
+/** SPI settings of the MCP2515 */
+static const SPISettings    gSpiSettings(VSCP_MCP2515_SPI_CLOCK, MSBFIRST, SPI_MODE0);
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+VSCPMcp2515* VSCPMcp2515::mInstance = NULL;
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+VSCPMcp2515::VSCPMcp2515() :
+    mCsPin(-1),         /* Set by begin() */
+    mIntPin(-1),        /* Set by begin() */
+    mRxQueue(),         /* Initialized by begin() */
+    mRxStorage(),       /* Empty receive queue */
+    mRxOverflows(0),    /* No frame dropped yet */
+    mHwRxOverflows(0),  /* No frame dropped yet */
+    mErrors(0),         /* No error yet */
+    mTxBusy(0),         /* No frame refused yet */
+    mTxPriority(),      /* No frame sent yet */
+    mRxHook(NULL)       /* No receive hook */
+{
+    vscp_util_ringInit(&mRxQueue, mRxStorage, sizeof(mRxStorage), sizeof(mRxStorage[0]));
+
+    return;
+}
+
+VSCPMcp2515::~VSCPMcp2515()
+{
+    if (this == mInstance)
+    {
+        detachInterrupt(digitalPinToInterrupt(mIntPin));
+        mInstance = NULL;
+    }
+
+    return;
+}
+
+bool VSCPMcp2515::begin(int csPin, int intPin, Clock clock)
+{
+    bool    status  = false;
+
+    if ((CLOCK_20MHZ >= clock) &&
+        ((NULL == mInstance) || (this == mInstance)))
+    {
+        uint8_t const   rxCtrl[]    = { VSCP_MCP2515_RXB0CTRL_BUKT };
+        uint8_t const   intCtrl[]   = { VSCP_MCP2515_INT_ALL, 0x00 };
+
+        mCsPin  = csPin;
+        mIntPin = intPin;
+
+        pinMode(mCsPin, OUTPUT);
+        digitalWrite(mCsPin, HIGH);
+        pinMode(mIntPin, INPUT);
+
+        SPI.begin();
+
+        /* Mask the interrupt during all SPI transactions of the main loop. */
+#if defined(SPI_HAS_NOTUSINGINTERRUPT)
+        SPI.usingInterrupt(digitalPinToInterrupt(mIntPin));
+#endif  /* defined(SPI_HAS_NOTUSINGINTERRUPT) */
+
+        /* After the reset the controller is in configuration mode. Wait
+         * until its oscillator is stable.
+         */
+        sendInstruction(VSCP_MCP2515_INSTR_RESET);
+        delay(10);
+
+        if (VSCP_MCP2515_MODE_CONFIG == (readRegister(VSCP_MCP2515_REG_CANSTAT) & VSCP_MCP2515_MODE_MASK))
+        {
+            vscp_util_ringInit(&mRxQueue, mRxStorage, sizeof(mRxStorage), sizeof(mRxStorage[0]));
+
+            writeRegisters(VSCP_MCP2515_REG_CNF3, gBitTiming[clock], sizeof(gBitTiming[clock]));
+            writeRegisters(VSCP_MCP2515_REG_RXB0CTRL, rxCtrl, sizeof(rxCtrl));
+            writeFilters(NULL, 0);
+            writeRegisters(VSCP_MCP2515_REG_CANINTE, intCtrl, sizeof(intCtrl));
+
+            mInstance = this;
+            attachInterrupt(digitalPinToInterrupt(mIntPin), isr, FALLING);
+
+            status = setMode(VSCP_MCP2515_MODE_NORMAL);
+        }
+    }
+
+    return status;
+}
+
+bool VSCPMcp2515::read(vscp_RxMessage * const rxMsg)
+{
+    bool    status  = false;
+
+    if (NULL != rxMsg)
+    {
+        status = (0 < vscp_util_ringRead(&mRxQueue, rxMsg, 1));
+    }
+
+    return status;
+}
+
+vscp_RxMessage const * VSCPMcp2515::borrow(void)
+{
+    void*   elem    = NULL;
+
+    if (0 == vscp_util_ringPeekRead(&mRxQueue, &elem))
+    {
+        elem = NULL;
+    }
+
+    return static_cast<vscp_RxMessage const *>(elem);
+}
+
+void VSCPMcp2515::release(vscp_RxMessage const * const rxMsg)
+{
+    if (NULL != rxMsg)
+    {
+        vscp_util_ringCommitRead(&mRxQueue, 1);
+    }
+
+    return;
+}
+
+bool VSCPMcp2515::write(vscp_TxMessage const * const txMsg)
+{
+    bool    status  = false;
+
+    if ((NULL != txMsg) &&
+        (VSCP_L1_DATA_SIZE >= txMsg->dataSize) &&
+        (this == mInstance))
+    {
+        /* VSCP priority 0 is the highest, transmit buffer priority 3 is the highest. */
+        uint8_t txPriority  = 3 - ((txMsg->priority & 0x07) >> 1);
+        uint8_t txStatus    = 0;
+        uint8_t freeIndex   = TX_BUFFER_NUM;
+        bool    isOrdered   = true;
+        uint8_t index       = 0;
+
+        lock();
+
+        txStatus = readStatus();
+
+        for(index = 0; index < TX_BUFFER_NUM; ++index)
+        {
+            if (0 == (txStatus & (VSCP_MCP2515_STATUS_TXREQ0 << (index * 2))))
+            {
+                if (TX_BUFFER_NUM == freeIndex)
+                {
+                    freeIndex = index;
+                }
+            }
+            /* The controller sends pending frames with the same priority
+             * by descending buffer index, not in the written order.
+             */
+            else if (txPriority == mTxPriority[index])
+            {
+                isOrdered = false;
+            }
+        }
+
+        if ((TX_BUFFER_NUM > freeIndex) &&
+            (true == isOrdered))
+        {
+            uint8_t txBuffer[1 + VSCP_MCP2515_ID_SIZE + 1 + VSCP_L1_DATA_SIZE];
+            uint8_t size        = 0;
+            uint8_t dataIndex   = 0;
+
+            txBuffer[size++] = txPriority;  /* TXBnCTRL */
+            encodeId(&txBuffer[size], vscp_can_id_encode(txMsg));
+            size += VSCP_MCP2515_ID_SIZE;
+            txBuffer[size++] = txMsg->dataSize;
+
+            for(dataIndex = 0; dataIndex < txMsg->dataSize; ++dataIndex)
+            {
+                txBuffer[size++] = txMsg->data[dataIndex];
+            }
+
+            writeRegisters(VSCP_MCP2515_REG_TXB0CTRL + (freeIndex * 0x10), txBuffer, size);
+
+            sendInstruction(VSCP_MCP2515_INSTR_RTS | (1 << freeIndex));
+
+            mTxPriority[freeIndex] = txPriority;
+            status = true;
+        }
+        else
+        {
+            ++mTxBusy;
+        }
+
+        unlock();
+    }
+
+    return status;
+}
+
+void VSCPMcp2515::setFilter(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    if (this == mInstance)
+    {
+        if (true == setMode(VSCP_MCP2515_MODE_CONFIG))
+        {
+            lock();
+            writeFilters(filters, num);
+            unlock();
+        }
+
+        (void)setMode(VSCP_MCP2515_MODE_NORMAL);
+    }
+
+    return;
+}
+
+void VSCPMcp2515::setRxHook(RxHook rxHook)
+{
+    noInterrupts();
+    mRxHook = rxHook;
+    interrupts();
+
+    return;
+}
+
+uint16_t VSCPMcp2515::getRxOverflows(void)
+{
+    return fetchCounter(mRxOverflows);
+}
+
+uint16_t VSCPMcp2515::getHwRxOverflows(void)
+{
+    return fetchCounter(mHwRxOverflows);
+}
+
+uint16_t VSCPMcp2515::getErrors(void)
+{
+    return fetchCounter(mErrors);
+}
+
+uint16_t VSCPMcp2515::getTxBusy(void)
+{
+    uint16_t    txBusy  = mTxBusy;
+
+    mTxBusy = 0;
+
+    return txBusy;
+}
+
+uint8_t VSCPMcp2515::readErrorFlags(void)
+{
+    uint8_t eflg    = 0;
+
+    lock();
+    eflg = readRegister(VSCP_MCP2515_REG_EFLG);
+    unlock();
+
+    return eflg;
+}
+
+void VSCPMcp2515::readErrorCounters(uint8_t& tec, uint8_t& rec)
+{
+    lock();
+    tec = readRegister(VSCP_MCP2515_REG_TEC);
+    rec = readRegister(VSCP_MCP2515_REG_REC);
+    unlock();
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+void VSCPMcp2515::isr(void)
+{
+    if (NULL != mInstance)
+    {
+        mInstance->handleInterrupt();
+    }
+
+    return;
+}
+
+void VSCPMcp2515::handleInterrupt(void)
+{
+    uint8_t flags   = readRegister(VSCP_MCP2515_REG_CANINTF);
+
+    /* The interrupt is edge triggered, therefore all flags must be handled,
+     * otherwise the interrupt pin stays low.
+     */
+    while(0 != (flags & VSCP_MCP2515_INT_ALL))
+    {
+        if (0 != (flags & VSCP_MCP2515_INT_RX0))
+        {
+            readRxBuffer(0);
+        }
+
+        if (0 != (flags & VSCP_MCP2515_INT_RX1))
+        {
+            readRxBuffer(1);
+        }
+
+        if (0 != (flags & (VSCP_MCP2515_INT_ERR | VSCP_MCP2515_INT_MERR)))
+        {
+            uint8_t eflg    = readRegister(VSCP_MCP2515_REG_EFLG);
+
+            if (0 != (eflg & VSCP_MCP2515_EFLG_RX0OVR))
+            {
+                ++mHwRxOverflows;
+            }
+
+            if (0 != (eflg & VSCP_MCP2515_EFLG_RX1OVR))
+            {
+                ++mHwRxOverflows;
+            }
+
+            /* A overflow is counted already, all other reasons are errors. */
+            if ((0 != (flags & VSCP_MCP2515_INT_MERR)) ||
+                (0 != (eflg & ~(VSCP_MCP2515_EFLG_RX0OVR | VSCP_MCP2515_EFLG_RX1OVR))))
+            {
+                ++mErrors;
+            }
+
+            modifyRegister(VSCP_MCP2515_REG_EFLG, VSCP_MCP2515_EFLG_RX0OVR | VSCP_MCP2515_EFLG_RX1OVR, 0x00);
+            modifyRegister(VSCP_MCP2515_REG_CANINTF, VSCP_MCP2515_INT_ERR | VSCP_MCP2515_INT_MERR, 0x00);
+        }
+
+        flags = readRegister(VSCP_MCP2515_REG_CANINTF);
+    }
+
+    return;
+}
+
+void VSCPMcp2515::readRxBuffer(uint8_t index)
+{
+    void*   elem    = NULL;
+
+    if (0 == vscp_util_ringPeekWrite(&mRxQueue, &elem))
+    {
+        /* Receive queue is full, drop the frame. */
+        modifyRegister(VSCP_MCP2515_REG_CANINTF, VSCP_MCP2515_INT_RX0 << index, 0x00);
+        ++mRxOverflows;
+    }
+    else
+    {
+        vscp_RxMessage* rxMsg   = static_cast<vscp_RxMessage*>(elem);
+        uint8_t         id[VSCP_MCP2515_ID_SIZE];
+        uint8_t         dlc     = 0;
+        uint8_t         size    = 0;
+        uint8_t         idIndex = 0;
+
+        SPI.beginTransaction(gSpiSettings);
+        digitalWrite(mCsPin, LOW);
+        SPI.transfer(VSCP_MCP2515_INSTR_READ_RX_BUF | (index << 2));
+
+        for(idIndex = 0; idIndex < VSCP_MCP2515_ID_SIZE; ++idIndex)
+        {
+            id[idIndex] = SPI.transfer(0x00);
+        }
+
+        dlc     = SPI.transfer(0x00);
+        size    = dlc & VSCP_MCP2515_DLC_MASK;
+
+        if (VSCP_L1_DATA_SIZE < size)
+        {
+            size = VSCP_L1_DATA_SIZE;
+        }
+
+        SPI.transfer(rxMsg->data, size);
+
+        /* Releasing the chip select clears the receive interrupt flag. */
+        digitalWrite(mCsPin, HIGH);
+        SPI.endTransaction();
+
+        /* Only data frames with a 29-bit identifier are VSCP events. */
+        if ((0 != (id[1] & VSCP_MCP2515_SIDL_EXIDE)) &&
+            (0 == (dlc & VSCP_MCP2515_DLC_RTR)))
+        {
+            uint32_t    canId   = (((uint32_t)id[0]) << 21) |
+                                  (((uint32_t)(id[1] & 0xE0)) << 13) |
+                                  (((uint32_t)(id[1] & 0x03)) << 16) |
+                                  (((uint32_t)id[2]) << 8) |
+                                  ((uint32_t)id[3]);
+
+            vscp_can_id_decode(canId, rxMsg);
+            rxMsg->dataSize = size;
+
+            vscp_util_ringCommitWrite(&mRxQueue, 1);
+
+            if (NULL != mRxHook)
+            {
+                mRxHook();
+            }
+        }
+    }
+
+    return;
+}
+
+uint16_t VSCPMcp2515::fetchCounter(volatile uint16_t& counter)
+{
+    uint16_t    value   = 0;
+
+    noInterrupts();
+    value   = counter;
+    counter = 0;
+    interrupts();
+
+    return value;
+}
+
+void VSCPMcp2515::lock(void)
+{
+#if !defined(SPI_HAS_NOTUSINGINTERRUPT)
+    noInterrupts();
+#endif  /* !defined(SPI_HAS_NOTUSINGINTERRUPT) */
+
+    return;
+}
+
+void VSCPMcp2515::unlock(void)
+{
+#if !defined(SPI_HAS_NOTUSINGINTERRUPT)
+    interrupts();
+#endif  /* !defined(SPI_HAS_NOTUSINGINTERRUPT) */
+
+    return;
+}
+
+void VSCPMcp2515::writeFilters(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    uint32_t    mask0   = 0;
+    uint32_t    filter0 = 0;
+    uint32_t    mask1   = 0;
+    uint32_t    filter1[VSCP_MCP2515_RXB1_FILTER_NUM];
+    uint8_t     regs[2 * VSCP_MCP2515_ID_SIZE];
+    uint8_t     index   = 0;
+
+    /* Without a filter, everything passes. */
+    if ((NULL == filters) ||
+        (0 == num))
+    {
+        num = 0;
+    }
+    else
+    {
+        mask0   = filters[0].mask & VSCP_CAN_ID_MASK;
+        filter0 = filters[0].filter;
+    }
+
+    /* Receive buffer 1 gets the frames, which roll over from receive buffer 0.
+     * Therefore it uses the first filter too, if there is no other.
+     */
+    if (1 >= num)
+    {
+        mask1 = mask0;
+    }
+    else
+    {
+        mask1 = VSCP_CAN_ID_MASK;
+
+        for(index = 1; index < num; ++index)
+        {
+            mask1 &= filters[index].mask;
+
+            /* The last filter takes all remaining ones, only the bits
+             * where they are equal are compared.
+             */
+            if (VSCP_MCP2515_RXB1_FILTER_NUM < index)
+            {
+                mask1 &= ~(filters[index].filter ^ filters[VSCP_MCP2515_RXB1_FILTER_NUM].filter);
+            }
+        }
+    }
+
+    for(index = 0; index < VSCP_MCP2515_RXB1_FILTER_NUM; ++index)
+    {
+        if ((1 + index) < num)
+        {
+            filter1[index] = filters[1 + index].filter & mask1;
+        }
+        /* Unused filters repeat the first one. */
+        else if (0 < index)
+        {
+            filter1[index] = filter1[0];
+        }
+        else
+        {
+            filter1[index] = filter0 & mask1;
+        }
+    }
+
+    filter0 &= mask0;
+
+    /* Mask 0 and mask 1 */
+    encodeId(&regs[0], mask0);
+    writeRegisters(VSCP_MCP2515_REG_RXM0SIDH, regs, VSCP_MCP2515_ID_SIZE);
+    encodeId(&regs[0], mask1);
+    writeRegisters(VSCP_MCP2515_REG_RXM1SIDH, regs, VSCP_MCP2515_ID_SIZE);
+
+    /* Filter 0 and 1 of receive buffer 0 */
+    encodeId(&regs[0], filter0);
+    encodeId(&regs[VSCP_MCP2515_ID_SIZE], filter0);
+    writeRegisters(VSCP_MCP2515_REG_RXF0SIDH, regs, sizeof(regs));
+
+    /* Filter 2 - 5 of receive buffer 1 */
+    encodeId(&regs[0], filter1[0]);
+    writeRegisters(VSCP_MCP2515_REG_RXF0SIDH + (2 * VSCP_MCP2515_ID_SIZE), regs, VSCP_MCP2515_ID_SIZE);
+    encodeId(&regs[0], filter1[1]);
+    encodeId(&regs[VSCP_MCP2515_ID_SIZE], filter1[2]);
+    writeRegisters(VSCP_MCP2515_REG_RXF3SIDH, regs, sizeof(regs));
+    encodeId(&regs[0], filter1[3]);
+    writeRegisters(VSCP_MCP2515_REG_RXF3SIDH + (2 * VSCP_MCP2515_ID_SIZE), regs, VSCP_MCP2515_ID_SIZE);
+
+    return;
+}
+
+void VSCPMcp2515::sendInstruction(uint8_t instr)
+{
+    SPI.beginTransaction(gSpiSettings);
+    digitalWrite(mCsPin, LOW);
+    SPI.transfer(instr);
+    digitalWrite(mCsPin, HIGH);
+    SPI.endTransaction();
+
+    return;
+}
+
+uint8_t VSCPMcp2515::readRegister(uint8_t addr)
+{
+    uint8_t value   = 0;
+
+    SPI.beginTransaction(gSpiSettings);
+    digitalWrite(mCsPin, LOW);
+    SPI.transfer(VSCP_MCP2515_INSTR_READ);
+    SPI.transfer(addr);
+    value = SPI.transfer(0x00);
+    digitalWrite(mCsPin, HIGH);
+    SPI.endTransaction();
+
+    return value;
+}
+
+void VSCPMcp2515::writeRegisters(uint8_t addr, uint8_t const * values, uint8_t num)
+{
+    SPI.beginTransaction(gSpiSettings);
+    digitalWrite(mCsPin, LOW);
+    SPI.transfer(VSCP_MCP2515_INSTR_WRITE);
+    SPI.transfer(addr);
+
+    while(0 < num)
+    {
+        SPI.transfer(*values);
+        ++values;
+        --num;
+    }
+
+    digitalWrite(mCsPin, HIGH);
+    SPI.endTransaction();
+
+    return;
+}
+
+void VSCPMcp2515::modifyRegister(uint8_t addr, uint8_t mask, uint8_t value)
+{
+    SPI.beginTransaction(gSpiSettings);
+    digitalWrite(mCsPin, LOW);
+    SPI.transfer(VSCP_MCP2515_INSTR_BIT_MODIFY);
+    SPI.transfer(addr);
+    SPI.transfer(mask);
+    SPI.transfer(value);
+    digitalWrite(mCsPin, HIGH);
+    SPI.endTransaction();
+
+    return;
+}
+
+uint8_t VSCPMcp2515::readStatus(void)
+{
+    uint8_t status  = 0;
+
+    SPI.beginTransaction(gSpiSettings);
+    digitalWrite(mCsPin, LOW);
+    SPI.transfer(VSCP_MCP2515_INSTR_READ_STATUS);
+    status = SPI.transfer(0x00);
+    digitalWrite(mCsPin, HIGH);
+    SPI.endTransaction();
+
+    return status;
+}
+
+bool VSCPMcp2515::setMode(uint8_t mode)
+{
+    bool        status  = false;
+    uint16_t    polls   = 0;
+
+    lock();
+    modifyRegister(VSCP_MCP2515_REG_CANCTRL, VSCP_MCP2515_MODE_MASK, mode);
+    unlock();
+
+    /* The controller enters the configuration mode only after a pending
+     * transmission, which may take a while. Therefore the interrupts are
+     * only disabled during a single poll and not for the whole wait.
+     */
+    for(polls = 0; (polls < VSCP_MCP2515_MODE_POLLS) && (false == status); ++polls)
+    {
+        uint8_t canStat = 0;
+
+        lock();
+        canStat = readRegister(VSCP_MCP2515_REG_CANSTAT);
+        unlock();
+
+        if (mode == (canStat & VSCP_MCP2515_MODE_MASK))
+        {
+            status = true;
+        }
+        else
+        {
+            delayMicroseconds(10);
+        }
+    }
+
+    return status;
+}
+
+void VSCPMcp2515::encodeId(uint8_t * const regs, uint32_t id)
+{
+    regs[0] = (uint8_t)(id >> 21);                                                          /* SIDH */
+    regs[1] = (uint8_t)(((id >> 13) & 0xE0) | VSCP_MCP2515_SIDL_EXIDE | ((id >> 16) & 0x03));   /* SIDL */
+    regs[2] = (uint8_t)(id >> 8);                                                           /* EID8 */
+    regs[3] = (uint8_t)id;                                                                  /* EID0 */
+
+    return;
+}
@@ -0,0 +1,396 @@
+/* The MIT License (MIT)
+ * 
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  MCP2515 CAN transport
+@file   VSCPMcp2515.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a interrupt driven transport for the MCP2515 CAN
+controller, which is connected via SPI.
+
+*******************************************************************************/
+/** @defgroup vscpMcp2515 MCP2515 CAN transport
+ * Interrupt driven transport for the MCP2515 CAN controller.
+ *
+ * Receive: The interrupt pin of the MCP2515 triggers a interrupt service
+ * routine, which drains both receive buffers of the controller into a
+ * receive queue. Therefore no frame gets lost in the controller, while the
+ * loop() is busy. Only data frames with a 29-bit identifier are queued.
+ *
+ * Transmit: A frame is written into one of the three transmit buffers and the
+ * controller sends it by itself. The VSCP priority is mapped onto the
+ * transmit buffer priority, so a high priority frame overtakes pending low
+ * priority frames. To keep the order of frames with the same priority, at
+ * most one frame per transmit buffer priority is pending. If no transmit
+ * buffer is available, write() returns false immediately and the framework
+ * retries it later.
+ *
+ * The CAN bitrate is 125 kbit/s, which is the VSCP default bitrate.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_MCP2515_H__
+#define __VSCP_MCP2515_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#if (100 <= ARDUINO)
+#include "Arduino.h"
+#else   /* (100 > ARDUINO) */
+#include "WProgram.h"
+#endif  /* (100 > ARDUINO) */
+
+#include "framework/core/vscp_types.h"
+#include "framework/core/vscp_util.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    CLASSES, TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** MCP2515 CAN transport */
+class VSCPMcp2515
+{
+public:
+
+    /** Frequency of the MCP2515 oscillator */
+    typedef enum
+    {
+        CLOCK_8MHZ = 0, /**< 8 MHz */
+        CLOCK_16MHZ,    /**< 16 MHz */
+        CLOCK_20MHZ     /**< 20 MHz */
+
+    } Clock;
+
+    /** This type defines the hook, which is called after a frame was received. */
+    typedef void (*RxHook)(void);
+
+    /** Number of received frames, which can be queued. It must be a power of two. */
+    static const uint8_t    RX_QUEUE_SIZE   = 8;
+
+    /** Number of transmit buffers */
+    static const uint8_t    TX_BUFFER_NUM   = 3;
+
+    /**
+     * Create a MCP2515 transport instance.
+     */
+    VSCPMcp2515();
+
+    /**
+     * Destroys a MCP2515 transport instance.
+     */
+    ~VSCPMcp2515();
+
+    /**
+     * Initializes the MCP2515 and starts to receive. Only one instance can be
+     * used, because the interrupt service routine handles a single controller.
+     * SPI.begin() is called inside.
+     *
+     * @param[in]   csPin   Pin of the SPI chip select
+     * @param[in]   intPin  Pin of the MCP2515 interrupt, must support external interrupts
+     * @param[in]   clock   Frequency of the MCP2515 oscillator
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin(int csPin, int intPin, Clock clock);
+
+    /**
+     * Read a received frame. It can be used as transport read function.
+     *
+     * @param[out]  rxMsg   Received message
+     * @return If a message was received, it will return true otherwise false.
+     */
+    bool read(vscp_RxMessage * const rxMsg);
+
+    /**
+     * Lend the oldest received frame in place, without copying it. It can be
+     * used as transport borrow function.
+     *
+     * @return Received message or NULL if no message is available
+     */
+    vscp_RxMessage const * borrow(void);
+
+    /**
+     * Give the lent frame back. It can be used as transport release function.
+     *
+     * @param[in]   rxMsg   Lent message
+     */
+    void release(vscp_RxMessage const * const rxMsg);
+
+    /**
+     * Write a frame to a free transmit buffer. It doesn't wait, if no
+     * transmit buffer is available. It can be used as transport write
+     * function.
+     *
+     * @param[in]   txMsg   Message to send
+     * @return If the message is sent, it will return true otherwise false.
+     */
+    bool write(vscp_TxMessage const * const txMsg);
+
+    /**
+     * Configure the receive acceptance filters. The first filter uses the
+     * mask of receive buffer 0. The further filters share the mask of
+     * receive buffer 1, which has four filters. If there are more than four,
+     * the last ones are merged. Therefore the controller may receive more
+     * frames, but never less. Without a filter, all frames with a 29-bit
+     * identifier are received. It can be used as transport acceptance filter
+     * function. The controller doesn't receive, while it is configured.
+     *
+     * @param[in]   filters Acceptance filters
+     * @param[in]   num     Number of acceptance filters
+     */
+    void setFilter(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+    /**
+     * Set a hook, which is called by the interrupt service routine after a
+     * received frame was queued. Use it e.g. to wake up the framework with
+     * VSCP::wakeUp(), while the MCU sleeps. Keep it short.
+     *
+     * @param[in]   rxHook  Receive hook (NULL to remove it)
+     */
+    void setRxHook(RxHook rxHook);
+
+    /**
+     * Get the number of received frames, which were dropped, because the
+     * receive queue was full. Calling it clears the counter.
+     *
+     * @return Number of dropped frames
+     */
+    uint16_t getRxOverflows(void);
+
+    /**
+     * Get the number of received frames, which were dropped by the
+     * controller, because both receive buffers were full. Calling it clears
+     * the counter.
+     *
+     * @return Number of dropped frames
+     */
+    uint16_t getHwRxOverflows(void);
+
+    /**
+     * Get the number of error interrupts, which the controller signalled,
+     * e.g. error warning, error passive, bus-off or a message error. Calling
+     * it clears the counter.
+     *
+     * @return Number of error interrupts
+     */
+    uint16_t getErrors(void);
+
+    /**
+     * Get the number of frames, which were not written, because no transmit
+     * buffer was available. Calling it clears the counter.
+     *
+     * @return Number of not written frames
+     */
+    uint16_t getTxBusy(void);
+
+    /**
+     * Read the error flags (EFLG register) of the controller, e.g. to detect
+     * bus-off.
+     *
+     * @return Error flags
+     */
+    uint8_t readErrorFlags(void);
+
+    /**
+     * Read the transmit and receive error counters of the controller.
+     *
+     * @param[out]  tec Transmit error counter
+     * @param[out]  rec Receive error counter
+     */
+    void readErrorCounters(uint8_t& tec, uint8_t& rec);
+
+private:
+
+    /* Never copy the MCP2515 transport */
+    VSCPMcp2515(const VSCPMcp2515& mcp2515);
+
+    /* Never copy the MCP2515 transport */
+    VSCPMcp2515& operator=(const VSCPMcp2515& mcp2515);
+
+    /** The instance, which is handled by the interrupt service routine. */
+    static VSCPMcp2515* mInstance;
+
+    int                 mCsPin;                         /**< SPI chip select pin */
+    int                 mIntPin;                        /**< Interrupt pin */
+    vscp_util_Ring      mRxQueue;                       /**< Receive queue, written by the interrupt service routine */
+    vscp_RxMessage      mRxStorage[RX_QUEUE_SIZE];      /**< Receive queue storage */
+    volatile uint16_t   mRxOverflows;                   /**< Number of frames dropped, because the receive queue was full */
+    volatile uint16_t   mHwRxOverflows;                 /**< Number of frames dropped by the controller */
+    volatile uint16_t   mErrors;                        /**< Number of error interrupts */
+    uint16_t            mTxBusy;                        /**< Number of frames not written, because no transmit buffer was available */
+    uint8_t             mTxPriority[TX_BUFFER_NUM];     /**< Priority of the last frame in every transmit buffer */
+    RxHook volatile     mRxHook;                        /**< Hook, called after a frame was received */
+
+    /**
+     * Interrupt service routine of the interrupt pin.
+     */
+    static void isr(void);
+
+    /**
+     * Handle all pending interrupts of the controller.
+     */
+    void handleInterrupt(void);
+
+    /**
+     * Read a receive buffer into the receive queue. Reading the buffer
+     * clears its interrupt flag.
+     *
+     * @param[in]   index   Receive buffer index (0 or 1)
+     */
+    void readRxBuffer(uint8_t index);
+
+    /**
+     * Get a counter and clear it, protected against the interrupt service
+     * routine.
+     *
+     * @param[in,out]   counter Counter
+     * @return Counter value
+     */
+    uint16_t fetchCounter(volatile uint16_t& counter);
+
+    /**
+     * Protect a access of the main loop against the interrupt service
+     * routine. If the SPI library supports it, the interrupt is masked
+     * during every SPI transaction anyway.
+     */
+    void lock(void);
+
+    /**
+     * Release the protection against the interrupt service routine.
+     */
+    void unlock(void);
+
+    /**
+     * Write the acceptance filters and masks. The controller must be in
+     * configuration mode.
+     *
+     * @param[in]   filters Acceptance filters
+     * @param[in]   num     Number of acceptance filters
+     */
+    void writeFilters(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+    /**
+     * Send a single byte SPI instruction.
+     *
+     * @param[in]   instr   Instruction
+     */
+    void sendInstruction(uint8_t instr);
+
+    /**
+     * Read a register.
+     *
+     * @param[in]   addr    Register address
+     * @return Register value
+     */
+    uint8_t readRegister(uint8_t addr);
+
+    /**
+     * Write consecutive registers.
+     *
+     * @param[in]   addr    Address of the first register
+     * @param[in]   values  Register values
+     * @param[in]   num     Number of registers
+     */
+    void writeRegisters(uint8_t addr, uint8_t const * values, uint8_t num);
+
+    /**
+     * Modify single bits of a register.
+     *
+     * @param[in]   addr    Register address
+     * @param[in]   mask    Bits, which are modified
+     * @param[in]   value   New value of the bits
+     */
+    void modifyRegister(uint8_t addr, uint8_t mask, uint8_t value);
+
+    /**
+     * Read the status of the receive and transmit buffers.
+     *
+     * @return Status
+     */
+    uint8_t readStatus(void);
+
+    /**
+     * Request a operation mode and wait until the controller entered it.
+     * The interrupt service routine is only masked during the single SPI
+     * accesses, not during the whole wait.
+     *
+     * @param[in]   mode    Operation mode
+     * @return If successful, it will return true otherwise false.
+     */
+    bool setMode(uint8_t mode);
+
+    /**
+     * Encode a 29-bit identifier into the identifier register layout of the
+     * controller. The extended identifier flag is always set.
+     *
+     * @param[out]  regs    Identifier registers (SIDH, SIDL, EID8, EID0)
+     * @param[in]   id      29-bit identifier
+     */
+    static void encodeId(uint8_t * const regs, uint32_t id);
+};
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_MCP2515_H__ */
+
+/** @} */
@@ -0,0 +1,1060 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP bridge
+@file   vscp_bridge.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_bridge.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_bridge.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+#include <string.h>
+#include "vscp_instance.h"
+#include "vscp_ps.h"
+#include "vscp_util.h"
+#include "vscp_class_l1.h"
+#include "../user/vscp_timer.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Max. number of frames, which are received from a port per process cycle. */
+#define VSCP_BRIDGE_PORT_BURST          4
+
+/** Route matches frames of any originating nickname. */
+#define VSCP_BRIDGE_NICKNAME_ANY        (0xFF)
+
+/** Marks a unused routing decision in the cache. */
+#define VSCP_BRIDGE_PORT_INVALID        (0xFF)
+
+/** Route control: Route enabled */
+#define VSCP_BRIDGE_CTRL_ENABLED        (0x80)
+
+/** Route control: Bit 8 of the class mask */
+#define VSCP_BRIDGE_CTRL_CLASS_MASK_8   (0x02)
+
+/** Route control: Bit 8 of the class filter */
+#define VSCP_BRIDGE_CTRL_CLASS_FILTER_8 (0x01)
+
+/** Register offset of the route control */
+#define VSCP_BRIDGE_REG_CTRL            0
+
+/** Register offset of the class filter */
+#define VSCP_BRIDGE_REG_CLASS_FILTER    1
+
+/** Register offset of the class mask */
+#define VSCP_BRIDGE_REG_CLASS_MASK      2
+
+/** Register offset of the type filter */
+#define VSCP_BRIDGE_REG_TYPE_FILTER     3
+
+/** Register offset of the type mask */
+#define VSCP_BRIDGE_REG_TYPE_MASK       4
+
+/** Register offset of the originating nickname */
+#define VSCP_BRIDGE_REG_NICKNAME        5
+
+/** Register offset of the source ports */
+#define VSCP_BRIDGE_REG_SRC_PORTS       6
+
+/** Register offset of the destination ports */
+#define VSCP_BRIDGE_REG_DST_PORTS       7
+
+/** All ports of the bridge, without the node */
+#define VSCP_BRIDGE_PORTS_ALL           ((uint8_t)((1U << VSCP_CONFIG_BRIDGE_PORT_NUM) - 1U))
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Get the port mask bit of a port. */
+#define VSCP_BRIDGE_PORT_BIT(__port)    ((uint8_t)(1U << (__port)))
+
+/** Data of the selected framework instance */
+#define VSCP_BRIDGE_INST                (vscp_bridge_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** A route, compiled from its registers. */
+typedef struct
+{
+    uint16_t    classFilter;    /**< Class filter */
+    uint16_t    classMask;      /**< Class mask */
+    uint8_t     typeFilter;     /**< Type filter */
+    uint8_t     typeMask;       /**< Type mask */
+    uint8_t     nickname;       /**< Originating nickname (0xFF: any) */
+    uint8_t     srcPorts;       /**< Source ports, 0 if the route is disabled */
+    uint8_t     dstPorts;       /**< Destination ports */
+
+} vscp_bridge_Route;
+
+/** A cached routing decision */
+typedef struct
+{
+    uint16_t    vscpClass;      /**< Class */
+    uint8_t     vscpType;       /**< Type */
+    uint8_t     oAddr;          /**< Originating nickname */
+    uint8_t     srcPort;        /**< Source port, VSCP_BRIDGE_PORT_INVALID if unused */
+    uint8_t     dstPorts;       /**< Destination ports */
+
+} vscp_bridge_Decision;
+
+/** A forwarded frame, which is remembered to detect its echo. */
+typedef struct
+{
+    vscp_Message    msg;        /**< Forwarded frame */
+    uint8_t         ports;      /**< Ports, where the echo is expected */
+    uint8_t         age;        /**< Age counter value, when the frame was forwarded */
+
+} vscp_bridge_Echo;
+
+/** A port of the bridge */
+typedef struct
+{
+    vscp_tp_adapter_Read    readFunc;                                       /**< Receive callback */
+    vscp_tp_adapter_Write   writeFunc;                                      /**< Transmit callback */
+    vscp_util_Ring          txRing;                                         /**< Transmit queue */
+    vscp_TxMessage          txStorage[VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM];     /**< Transmit queue storage */
+    uint16_t                txDropCnt;                                      /**< Number of dropped frames */
+
+} vscp_bridge_Port;
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Ports of the bridge */
+    vscp_bridge_Port        ports[VSCP_CONFIG_BRIDGE_PORT_NUM];
+
+    /** Ports with a transport, port 0 always */
+    uint8_t                 activePorts;
+
+    /** Routing table, compiled from the registers */
+    vscp_bridge_Route       routes[VSCP_CONFIG_BRIDGE_ROUTES];
+
+    /** Cached routing decisions */
+    vscp_bridge_Decision    cache[VSCP_CONFIG_BRIDGE_CACHE_NUM];
+
+    /** Last forwarded frames */
+    vscp_bridge_Echo        echoes[VSCP_CONFIG_BRIDGE_ECHO_NUM];
+
+    /** Index of the next echo entry, which is overwritten. */
+    uint8_t                 echoIndex;
+
+    /** Age counter of the echo entries, increased after every timeout. */
+    uint8_t                 echoAge;
+
+    /** Timer id of the echo timeout */
+    uint8_t                 echoTimerId;
+
+    /** Is the echo timeout running (TRUE) or not (FALSE)? */
+    BOOL                    isEchoTimerRunning;
+
+    /** Receive queue of the node */
+    vscp_util_Ring          rxRing;
+
+    /** Receive queue storage of the node */
+    vscp_RxMessage          rxStorage[VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM];
+
+    /** Frame of the receive queue, which is lent to the node. */
+    vscp_RxMessage const *  rxLent;
+
+    /** Number of forwarded frames */
+    uint32_t                forwardCnt;
+
+} vscp_bridge_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_bridge_loadRoute(uint8_t index);
+static void vscp_bridge_clearCache(void);
+static uint8_t vscp_bridge_getDstPorts(vscp_Message const * const msg, uint8_t srcPort);
+static uint8_t vscp_bridge_findRoute(vscp_Message const * const msg, uint8_t srcPort);
+static BOOL vscp_bridge_isSameFrame(vscp_Message const * const msg1, vscp_Message const * const msg2);
+static BOOL vscp_bridge_isEcho(vscp_Message const * const msg, uint8_t port);
+static void vscp_bridge_addEcho(vscp_Message const * const msg, uint8_t ports);
+static void vscp_bridge_expireEchoes(void);
+static BOOL vscp_bridge_isSpaceLeft(uint8_t srcPort);
+static BOOL vscp_bridge_readPort(uint8_t port, vscp_RxMessage * const msg);
+static BOOL vscp_bridge_writePort(uint8_t port, vscp_TxMessage const * const msg);
+static uint8_t vscp_bridge_forward(vscp_Message const * const msg, uint8_t dstPorts);
+static void vscp_bridge_sendQueued(uint8_t port);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/* The node is the highest port bit. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_BRIDGE_PORT_NODE >= VSCP_CONFIG_BRIDGE_PORT_NUM);
+VSCP_UTIL_COMPILE_TIME_ASSERT(2 <= VSCP_CONFIG_BRIDGE_PORT_NUM);
+
+/* The routing table is located in a single page. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_BRIDGE_ROUTES);
+VSCP_UTIL_COMPILE_TIME_ASSERT(16 >= VSCP_CONFIG_BRIDGE_ROUTES);
+
+/* The queues are ring buffers, which need a power of two. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_IS_POWER_OF_TWO(VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM));
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_RING_NUM_MAX >= VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM);
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_IS_POWER_OF_TWO(VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM));
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_RING_NUM_MAX >= VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM);
+
+/* The cache index is masked. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_IS_POWER_OF_TWO(VSCP_CONFIG_BRIDGE_CACHE_NUM));
+
+/** Data of all framework instances */
+static vscp_bridge_Instance vscp_bridge_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the bridge and loads the routing table.
+ */
+extern void vscp_bridge_init(void)
+{
+    uint8_t index   = 0;
+
+    VSCP_BRIDGE_INST.activePorts = VSCP_BRIDGE_PORT_BIT(0);
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_PORT_NUM; ++index)
+    {
+        vscp_bridge_Port * const    port    = &VSCP_BRIDGE_INST.ports[index];
+
+        vscp_util_ringInit(&port->txRing, port->txStorage, sizeof(port->txStorage), sizeof(port->txStorage[0]));
+        port->txDropCnt = 0;
+
+        if (NULL != port->writeFunc)
+        {
+            VSCP_BRIDGE_INST.activePorts |= VSCP_BRIDGE_PORT_BIT(index);
+        }
+    }
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_ROUTES; ++index)
+    {
+        vscp_bridge_loadRoute(index);
+    }
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_ECHO_NUM; ++index)
+    {
+        VSCP_BRIDGE_INST.echoes[index].ports = 0;
+    }
+    VSCP_BRIDGE_INST.echoIndex          = 0;
+    VSCP_BRIDGE_INST.echoAge            = 0;
+    VSCP_BRIDGE_INST.echoTimerId        = vscp_timer_create();
+    VSCP_BRIDGE_INST.isEchoTimerRunning = FALSE;
+
+    vscp_util_ringInit( &VSCP_BRIDGE_INST.rxRing,
+                        VSCP_BRIDGE_INST.rxStorage,
+                        sizeof(VSCP_BRIDGE_INST.rxStorage),
+                        sizeof(VSCP_BRIDGE_INST.rxStorage[0]));
+
+    VSCP_BRIDGE_INST.rxLent     = NULL;
+    VSCP_BRIDGE_INST.forwardCnt = 0;
+
+    vscp_bridge_clearCache();
+
+    return;
+}
+
+/**
+ * This function restores the factory default settings. All routes are
+ * disabled, which forwards every frame to all ports.
+ */
+extern void vscp_bridge_restoreFactoryDefaultSettings(void)
+{
+    uint16_t    index   = 0;
+
+    for(index = 0; index < VSCP_PS_SIZE_BRIDGE; ++index)
+    {
+        vscp_ps_writeBridge(index, 0);
+    }
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_ROUTES; ++index)
+    {
+        vscp_bridge_loadRoute((uint8_t)index);
+    }
+
+    vscp_bridge_clearCache();
+
+    return;
+}
+
+/**
+ * This function sets the transport callbacks of a port. Port 0 is the
+ * transport of the node and can't be set here. Frames are only forwarded to
+ * ports with a transmit callback.
+ *
+ * @param[in]   port    Port (1 - VSCP_CONFIG_BRIDGE_PORT_NUM - 1)
+ * @param[in]   read    Receive callback
+ * @param[in]   write   Transmit callback
+ */
+extern void vscp_bridge_setPort(uint8_t port, vscp_tp_adapter_Read read, vscp_tp_adapter_Write write)
+{
+    if ((0 < port) &&
+        (VSCP_CONFIG_BRIDGE_PORT_NUM > port))
+    {
+        VSCP_BRIDGE_INST.ports[port].readFunc  = read;
+        VSCP_BRIDGE_INST.ports[port].writeFunc = write;
+
+        if (NULL == write)
+        {
+            VSCP_BRIDGE_INST.activePorts &= (uint8_t)~VSCP_BRIDGE_PORT_BIT(port);
+        }
+        else
+        {
+            VSCP_BRIDGE_INST.activePorts |= VSCP_BRIDGE_PORT_BIT(port);
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function processes the bridge. It receives the frames of all ports,
+ * forwards them and sends the queued frames, as long as the ports accept them.
+ * A port is only read, if there is space left for its frame in all queues.
+ * Otherwise the frame stays in the driver.
+ */
+extern void vscp_bridge_process(void)
+{
+    uint8_t         port    = 0;
+    vscp_RxMessage  rxMsg;
+
+    vscp_bridge_expireEchoes();
+
+    for(port = 0; port < VSCP_CONFIG_BRIDGE_PORT_NUM; ++port)
+    {
+        uint8_t burst   = 0;
+
+        while((VSCP_BRIDGE_PORT_BURST > burst) &&
+              (TRUE == vscp_bridge_isSpaceLeft(port)) &&
+              (TRUE == vscp_bridge_readPort(port, &rxMsg)))
+        {
+            ++burst;
+
+            /* A frame, which was forwarded by this bridge before, came back. */
+            if (FALSE == vscp_bridge_isEcho(&rxMsg, port))
+            {
+                uint8_t dstPorts    = vscp_bridge_getDstPorts(&rxMsg, port);
+
+                /* The node needs all frames of the protocol class. */
+                if (VSCP_CLASS_L1_PROTOCOL == rxMsg.vscpClass)
+                {
+                    dstPorts |= VSCP_BRIDGE_PORT_BIT(VSCP_BRIDGE_PORT_NODE);
+                }
+
+                if (0 != (dstPorts & VSCP_BRIDGE_PORT_BIT(VSCP_BRIDGE_PORT_NODE)))
+                {
+                    (void)vscp_util_ringWrite(&VSCP_BRIDGE_INST.rxRing, &rxMsg, 1);
+                }
+
+                dstPorts = vscp_bridge_forward(&rxMsg, dstPorts & VSCP_BRIDGE_PORTS_ALL);
+
+                if (0 != dstPorts)
+                {
+                    vscp_bridge_addEcho(&rxMsg, dstPorts);
+                    ++VSCP_BRIDGE_INST.forwardCnt;
+                }
+            }
+        }
+    }
+
+    for(port = 0; port < VSCP_CONFIG_BRIDGE_PORT_NUM; ++port)
+    {
+        vscp_bridge_sendQueued(port);
+    }
+
+    return;
+}
+
+/**
+ * This function returns whether the bridge has queued frames.
+ *
+ * @return  Frames queued or not
+ * @retval  FALSE   Nothing to do
+ * @retval  TRUE    Process pending
+ */
+extern BOOL vscp_bridge_isProcessPending(void)
+{
+    BOOL    isPending   = FALSE;
+    uint8_t port        = 0;
+
+    if (0 < vscp_util_ringGetCount(&VSCP_BRIDGE_INST.rxRing))
+    {
+        isPending = TRUE;
+    }
+
+    for(port = 0; (port < VSCP_CONFIG_BRIDGE_PORT_NUM) && (FALSE == isPending); ++port)
+    {
+        if (0 < vscp_util_ringGetCount(&VSCP_BRIDGE_INST.ports[port].txRing))
+        {
+            isPending = TRUE;
+        }
+    }
+
+    return isPending;
+}
+
+/**
+ * This function borrows a received frame, which is forwarded to the node.
+ * It is lent in place and must be given back via vscp_bridge_releaseMessage().
+ *
+ * @param[in]   storage Message storage, not used
+ * @return  Received message or NULL if no message is available
+ */
+extern vscp_RxMessage const * vscp_bridge_borrowMessage(vscp_RxMessage * const storage)
+{
+    void *  elem    = NULL;
+
+    (void)storage;
+
+    /* Only one frame can be lent at a time. */
+    if (NULL != VSCP_BRIDGE_INST.rxLent)
+    {
+        return NULL;
+    }
+
+    /* Receive the frames of all ports, if the node has nothing to do. */
+    if (0 == vscp_util_ringGetCount(&VSCP_BRIDGE_INST.rxRing))
+    {
+        vscp_bridge_process();
+    }
+
+    if (0 < vscp_util_ringPeekRead(&VSCP_BRIDGE_INST.rxRing, &elem))
+    {
+        VSCP_BRIDGE_INST.rxLent = (vscp_RxMessage const *)elem;
+    }
+
+    return VSCP_BRIDGE_INST.rxLent;
+}
+
+/**
+ * This function gives a borrowed frame back.
+ *
+ * @param[in]   msg Borrowed message
+ */
+extern void vscp_bridge_releaseMessage(vscp_RxMessage const * const msg)
+{
+    if ((NULL != msg) &&
+        (VSCP_BRIDGE_INST.rxLent == msg))
+    {
+        vscp_util_ringCommitRead(&VSCP_BRIDGE_INST.rxRing, 1);
+        VSCP_BRIDGE_INST.rxLent = NULL;
+    }
+
+    return;
+}
+
+/**
+ * This function sends a frame of the node to the routed ports. If a port is
+ * busy, the frame is queued.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send or queue the message on any port
+ * @retval  TRUE    Message sent or queued
+ */
+extern BOOL vscp_bridge_writeMessage(vscp_TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&                        /* Message shall exists */
+        (VSCP_L1_DATA_SIZE >= msg->dataSize))   /* Number of data bytes is limited */
+    {
+        uint8_t dstPorts    = vscp_bridge_getDstPorts(msg, VSCP_BRIDGE_PORT_NODE) & VSCP_BRIDGE_PORTS_ALL;
+
+        if (0 == dstPorts)
+        {
+            /* Not routed to any port, which is not a error. */
+            status = TRUE;
+        }
+        else
+        {
+            dstPorts = vscp_bridge_forward(msg, dstPorts);
+
+            if (0 != dstPorts)
+            {
+                vscp_bridge_addEcho(msg, dstPorts);
+                status = TRUE;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function returns whether the register is part of the routing table.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Routing table register or not
+ * @retval  FALSE   Not a routing table register
+ * @retval  TRUE    Routing table register
+ */
+extern BOOL vscp_bridge_isRoutingTable(uint16_t page, uint8_t addr)
+{
+    BOOL    status  = FALSE;
+
+    if ((VSCP_CONFIG_BRIDGE_PAGE == page) &&
+        (VSCP_PS_SIZE_BRIDGE > addr))
+    {
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * Read a routing table register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+extern uint8_t  vscp_bridge_readRegister(uint16_t page, uint8_t addr)
+{
+    uint8_t value   = 0;
+
+    if (FALSE != vscp_bridge_isRoutingTable(page, addr))
+    {
+        value = vscp_ps_readBridge(addr);
+    }
+
+    return value;
+}
+
+/**
+ * Write a routing table register. The route is active immediately.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+extern uint8_t  vscp_bridge_writeRegister(uint16_t page, uint8_t addr, uint8_t value)
+{
+    uint8_t ret = 0;
+
+    if (FALSE != vscp_bridge_isRoutingTable(page, addr))
+    {
+        vscp_ps_writeBridge(addr, value);
+
+        vscp_bridge_loadRoute(addr / VSCP_BRIDGE_ROUTE_SIZE);
+        vscp_bridge_clearCache();
+
+        ret = vscp_ps_readBridge(addr);
+    }
+
+    return ret;
+}
+
+/**
+ * This function returns the number of forwarded frames.
+ *
+ * @return Number of forwarded frames
+ */
+extern uint32_t vscp_bridge_getForwarded(void)
+{
+    return VSCP_BRIDGE_INST.forwardCnt;
+}
+
+/**
+ * This function returns the number of frames, which were dropped on a port,
+ * because its transmit queue was full.
+ *
+ * @param[in]   port    Port
+ * @return Number of dropped frames
+ */
+extern uint16_t vscp_bridge_getTxDrops(uint8_t port)
+{
+    uint16_t    drops   = 0;
+
+    if (VSCP_CONFIG_BRIDGE_PORT_NUM > port)
+    {
+        drops = VSCP_BRIDGE_INST.ports[port].txDropCnt;
+    }
+
+    return drops;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Load a route from the persistent memory and compile it.
+ *
+ * @param[in]   index   Route index
+ */
+static void vscp_bridge_loadRoute(uint8_t index)
+{
+    uint16_t            base    = (uint16_t)index * VSCP_BRIDGE_ROUTE_SIZE;
+    uint8_t             ctrl    = 0;
+    vscp_bridge_Route * route   = NULL;
+
+    if (VSCP_CONFIG_BRIDGE_ROUTES <= index)
+    {
+        return;
+    }
+
+    route   = &VSCP_BRIDGE_INST.routes[index];
+    ctrl    = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_CTRL);
+
+    route->classFilter  = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_CLASS_FILTER);
+    route->classMask    = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_CLASS_MASK);
+    route->typeFilter   = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_TYPE_FILTER);
+    route->typeMask     = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_TYPE_MASK);
+    route->nickname     = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_NICKNAME);
+    route->srcPorts     = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_SRC_PORTS);
+    route->dstPorts     = vscp_ps_readBridge(base + VSCP_BRIDGE_REG_DST_PORTS);
+
+    if (0 != (ctrl & VSCP_BRIDGE_CTRL_CLASS_FILTER_8))
+    {
+        route->classFilter |= 0x0100;
+    }
+
+    if (0 != (ctrl & VSCP_BRIDGE_CTRL_CLASS_MASK_8))
+    {
+        route->classMask |= 0x0100;
+    }
+
+    /* A disabled route never matches, because it has no source port. */
+    if (0 == (ctrl & VSCP_BRIDGE_CTRL_ENABLED))
+    {
+        route->srcPorts = 0;
+    }
+
+    /* Only the filter bits, which are compared, are kept. */
+    route->classFilter &= route->classMask;
+    route->typeFilter  &= route->typeMask;
+
+    return;
+}
+
+/**
+ * Invalidate all cached routing decisions.
+ */
+static void vscp_bridge_clearCache(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_CACHE_NUM; ++index)
+    {
+        VSCP_BRIDGE_INST.cache[index].srcPort = VSCP_BRIDGE_PORT_INVALID;
+    }
+
+    return;
+}
+
+/**
+ * Get the destination ports of a frame. The decision is taken from the cache
+ * or determined by the routing table and cached. The source port is always
+ * excluded.
+ *
+ * @param[in]   msg     Frame
+ * @param[in]   srcPort Port, the frame was received from
+ * @return Destination ports, bit 7 is the node
+ */
+static uint8_t vscp_bridge_getDstPorts(vscp_Message const * const msg, uint8_t srcPort)
+{
+    uint8_t                 hash        = (uint8_t)msg->vscpClass ^ (uint8_t)(msg->vscpClass >> 8) ^ msg->vscpType ^ msg->oAddr ^ srcPort;
+    vscp_bridge_Decision *  decision    = NULL;
+
+    /* Mix the upper bits into the index. */
+    hash ^= (uint8_t)(hash >> 4);
+
+    decision = &VSCP_BRIDGE_INST.cache[hash & (VSCP_CONFIG_BRIDGE_CACHE_NUM - 1)];
+
+    if ((srcPort != decision->srcPort) ||
+        (msg->vscpClass != decision->vscpClass) ||
+        (msg->vscpType != decision->vscpType) ||
+        (msg->oAddr != decision->oAddr))
+    {
+        decision->vscpClass = msg->vscpClass;
+        decision->vscpType  = msg->vscpType;
+        decision->oAddr     = msg->oAddr;
+        decision->srcPort   = srcPort;
+        decision->dstPorts  = vscp_bridge_findRoute(msg, srcPort) & (uint8_t)~VSCP_BRIDGE_PORT_BIT(srcPort);
+    }
+
+    return decision->dstPorts;
+}
+
+/**
+ * Find the first matching route of a frame.
+ *
+ * @param[in]   msg     Frame
+ * @param[in]   srcPort Port, the frame was received from
+ * @return Destination ports of the route or all ports, if no route matches
+ */
+static uint8_t vscp_bridge_findRoute(vscp_Message const * const msg, uint8_t srcPort)
+{
+    uint8_t dstPorts    = VSCP_BRIDGE_PORTS_ALL | VSCP_BRIDGE_PORT_BIT(VSCP_BRIDGE_PORT_NODE);
+    uint8_t index       = 0;
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_ROUTES; ++index)
+    {
+        vscp_bridge_Route const * const route   = &VSCP_BRIDGE_INST.routes[index];
+
+        if ((0 != (route->srcPorts & VSCP_BRIDGE_PORT_BIT(srcPort))) &&
+            (route->classFilter == (msg->vscpClass & route->classMask)) &&
+            (route->typeFilter == (msg->vscpType & route->typeMask)) &&
+            ((VSCP_BRIDGE_NICKNAME_ANY == route->nickname) || (route->nickname == msg->oAddr)))
+        {
+            dstPorts = route->dstPorts;
+            break;
+        }
+    }
+
+    return dstPorts;
+}
+
+/**
+ * Compare two frames: The complete header and the data.
+ *
+ * @param[in]   msg1    Frame
+ * @param[in]   msg2    Frame
+ * @return If both frames are the same, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_bridge_isSameFrame(vscp_Message const * const msg1, vscp_Message const * const msg2)
+{
+    BOOL    isSame  = FALSE;
+
+    if ((msg1->vscpClass == msg2->vscpClass) &&
+        (msg1->vscpType == msg2->vscpType) &&
+        (msg1->oAddr == msg2->oAddr) &&
+        (msg1->priority == msg2->priority) &&
+        (msg1->hardCoded == msg2->hardCoded) &&
+        (msg1->dataSize == msg2->dataSize) &&
+        (VSCP_L1_DATA_SIZE >= msg1->dataSize) &&
+        (0 == memcmp(msg1->data, msg2->data, msg1->dataSize)))
+    {
+        isSame = TRUE;
+    }
+
+    return isSame;
+}
+
+/**
+ * Check whether a received frame is the echo of a forwarded frame. The echo
+ * is expected only once per port and only until the echo timeout.
+ *
+ * @param[in]   msg     Frame
+ * @param[in]   port    Port, the frame was received from
+ * @return If the frame is a echo, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_bridge_isEcho(vscp_Message const * const msg, uint8_t port)
+{
+    BOOL        isEcho      = FALSE;
+    uint8_t     index       = 0;
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_ECHO_NUM; ++index)
+    {
+        if (0 != VSCP_BRIDGE_INST.echoes[index].ports)
+        {
+            break;
+        }
+    }
+
+    /* Nothing forwarded, which may come back. */
+    if (VSCP_CONFIG_BRIDGE_ECHO_NUM <= index)
+    {
+        return FALSE;
+    }
+
+    for(index = 0; (index < VSCP_CONFIG_BRIDGE_ECHO_NUM) && (FALSE == isEcho); ++index)
+    {
+        vscp_bridge_Echo * const    echo    = &VSCP_BRIDGE_INST.echoes[index];
+
+        if ((0 != (echo->ports & VSCP_BRIDGE_PORT_BIT(port))) &&
+            (TRUE == vscp_bridge_isSameFrame(msg, &echo->msg)))
+        {
+            echo->ports &= (uint8_t)~VSCP_BRIDGE_PORT_BIT(port);
+            isEcho = TRUE;
+        }
+    }
+
+    return isEcho;
+}
+
+/**
+ * Remember a forwarded frame, to detect its echo. The oldest one is
+ * overwritten.
+ *
+ * @param[in]   msg     Frame
+ * @param[in]   ports   Ports, the frame was sent to
+ */
+static void vscp_bridge_addEcho(vscp_Message const * const msg, uint8_t ports)
+{
+    vscp_bridge_Echo * const    echo    = &VSCP_BRIDGE_INST.echoes[VSCP_BRIDGE_INST.echoIndex];
+
+    echo->msg   = *msg;
+    echo->ports = ports;
+    echo->age   = VSCP_BRIDGE_INST.echoAge;
+
+    ++VSCP_BRIDGE_INST.echoIndex;
+    if (VSCP_CONFIG_BRIDGE_ECHO_NUM <= VSCP_BRIDGE_INST.echoIndex)
+    {
+        VSCP_BRIDGE_INST.echoIndex = 0;
+    }
+
+    /* Start the echo timeout, if not already running. */
+    if (FALSE == VSCP_BRIDGE_INST.isEchoTimerRunning)
+    {
+        vscp_timer_start(VSCP_BRIDGE_INST.echoTimerId, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
+        VSCP_BRIDGE_INST.isEchoTimerRunning = TRUE;
+    }
+
+    return;
+}
+
+/**
+ * Forget the forwarded frames, whose echo didn't come back in time. After
+ * every timeout the age counter is increased. A frame expires after the
+ * second timeout since it was forwarded, which is after 1 to 2 times
+ * VSCP_CONFIG_MULTI_MSG_TIMEOUT. The timer runs only, as long as frames
+ * are remembered.
+ */
+static void vscp_bridge_expireEchoes(void)
+{
+    uint8_t index       = 0;
+    BOOL    isWaiting   = FALSE;
+
+    if ((FALSE == VSCP_BRIDGE_INST.isEchoTimerRunning) ||
+        (TRUE == vscp_timer_getStatus(VSCP_BRIDGE_INST.echoTimerId)))
+    {
+        return;
+    }
+
+    ++VSCP_BRIDGE_INST.echoAge;
+
+    for(index = 0; index < VSCP_CONFIG_BRIDGE_ECHO_NUM; ++index)
+    {
+        vscp_bridge_Echo * const    echo    = &VSCP_BRIDGE_INST.echoes[index];
+
+        if (0 != echo->ports)
+        {
+            if (2 <= (uint8_t)(VSCP_BRIDGE_INST.echoAge - echo->age))
+            {
+                echo->ports = 0;
+            }
+            else
+            {
+                isWaiting = TRUE;
+            }
+        }
+    }
+
+    if (TRUE == isWaiting)
+    {
+        vscp_timer_start(VSCP_BRIDGE_INST.echoTimerId, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
+    }
+
+    VSCP_BRIDGE_INST.isEchoTimerRunning = isWaiting;
+
+    return;
+}
+
+/**
+ * Check whether there is space left in all queues, a frame of the given port
+ * may be forwarded to.
+ *
+ * @param[in]   srcPort Port, the frame will be received from
+ * @return If there is space left, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_bridge_isSpaceLeft(uint8_t srcPort)
+{
+    BOOL    isSpaceLeft = TRUE;
+    uint8_t port        = 0;
+
+    if (VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM <= vscp_util_ringGetCount(&VSCP_BRIDGE_INST.rxRing))
+    {
+        isSpaceLeft = FALSE;
+    }
+
+    for(port = 0; (port < VSCP_CONFIG_BRIDGE_PORT_NUM) && (TRUE == isSpaceLeft); ++port)
+    {
+        if ((srcPort != port) &&
+            (VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM <= vscp_util_ringGetCount(&VSCP_BRIDGE_INST.ports[port].txRing)))
+        {
+            isSpaceLeft = FALSE;
+        }
+    }
+
+    return isSpaceLeft;
+}
+
+/**
+ * Receive a frame from a port. Port 0 is the transport of the node.
+ *
+ * @param[in]   port    Port
+ * @param[out]  msg     Message storage
+ * @return If a frame was received, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_bridge_readPort(uint8_t port, vscp_RxMessage * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (0 == port)
+    {
+        vscp_RxMessage const *  rxMsg   = vscp_tp_adapter_borrowMessage(msg);
+
+        if (NULL != rxMsg)
+        {
+            /* Frame buffer lent by the driver? */
+            if (msg != rxMsg)
+            {
+                *msg = *rxMsg;
+            }
+
+            vscp_tp_adapter_releaseMessage(rxMsg);
+            status = TRUE;
+        }
+    }
+    else if (NULL != VSCP_BRIDGE_INST.ports[port].readFunc)
+    {
+        status = VSCP_BRIDGE_INST.ports[port].readFunc(msg);
+    }
+
+    return status;
+}
+
+/**
+ * Send a frame to a port. Port 0 is the transport of the node.
+ *
+ * @param[in]   port    Port
+ * @param[in]   msg     Message
+ * @return If the frame was sent, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_bridge_writePort(uint8_t port, vscp_TxMessage const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (0 == port)
+    {
+        status = vscp_tp_adapter_writeMessage(msg);
+    }
+    else if (NULL != VSCP_BRIDGE_INST.ports[port].writeFunc)
+    {
+        status = VSCP_BRIDGE_INST.ports[port].writeFunc(msg);
+    }
+
+    return status;
+}
+
+/**
+ * Forward a frame to the destination ports. It is sent directly, if nothing
+ * is queued on the port. Otherwise it is appended to its transmit queue, to
+ * keep the order.
+ *
+ * @param[in]   msg         Frame
+ * @param[in]   dstPorts    Destination ports
+ * @return Ports, where the frame was sent or queued
+ */
+static uint8_t vscp_bridge_forward(vscp_Message const * const msg, uint8_t dstPorts)
+{
+    uint8_t port        = 0;
+    uint8_t sentPorts   = 0;
+
+    /* Ports without transport would only fill their queues. */
+    dstPorts &= VSCP_BRIDGE_INST.activePorts;
+
+    for(port = 0; port < VSCP_CONFIG_BRIDGE_PORT_NUM; ++port)
+    {
+        if (0 != (dstPorts & VSCP_BRIDGE_PORT_BIT(port)))
+        {
+            vscp_bridge_Port * const    dst = &VSCP_BRIDGE_INST.ports[port];
+
+            if ((0 == vscp_util_ringGetCount(&dst->txRing)) &&
+                (TRUE == vscp_bridge_writePort(port, msg)))
+            {
+                sentPorts |= VSCP_BRIDGE_PORT_BIT(port);
+            }
+            else if (0 < vscp_util_ringWrite(&dst->txRing, msg, 1))
+            {
+                sentPorts |= VSCP_BRIDGE_PORT_BIT(port);
+            }
+            else if (0xFFFF > dst->txDropCnt)
+            {
+                ++dst->txDropCnt;
+            }
+        }
+    }
+
+    return sentPorts;
+}
+
+/**
+ * Send the queued frames of a port, as long as the port accepts them.
+ *
+ * @param[in]   port    Port
+ */
+static void vscp_bridge_sendQueued(uint8_t port)
+{
+    vscp_util_Ring * const  txRing  = &VSCP_BRIDGE_INST.ports[port].txRing;
+    void *                  elem    = NULL;
+
+    while(0 < vscp_util_ringPeekRead(txRing, &elem))
+    {
+        if (FALSE == vscp_bridge_writePort(port, (vscp_TxMessage const *)elem))
+        {
+            break;
+        }
+
+        vscp_util_ringCommitRead(txRing, 1);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
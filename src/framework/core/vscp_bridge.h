@@ -0,0 +1,253 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP bridge
+@file   vscp_bridge.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module forwards the frames between several transports (ports).
+
+*******************************************************************************/
+/** @defgroup vscp_bridge VSCP bridge
+ * The bridge is located between the transport layer and the transport
+ * adapters. Port 0 is the transport of the node, which is set with
+ * vscp_tp_adapter_set(). The other ports are set with vscp_bridge_setPort().
+ *
+ * Every received frame is forwarded to the ports and to the node, according
+ * to the first matching route of the routing table. If no route matches, it
+ * is forwarded to all of them. A frame is never sent back to the port, it was
+ * received from. CLASS1.PROTOCOL frames are always provided to the node.
+ * The frames of the node itself are routed with the source port
+ * VSCP_BRIDGE_PORT_NODE.
+ *
+ * A route is located in the application register space, page
+ * VSCP_CONFIG_BRIDGE_PAGE, and needs VSCP_BRIDGE_ROUTE_SIZE registers:
+ *
+ * <pre>
+ * +--------+-------------------------------------------------------------+
+ * | Offset | Description                                                 |
+ * +--------+-------------------------------------------------------------+
+ * | 0      | Control: Bit 7 enables the route, bit 1 is bit 8 of the     |
+ * |        | class mask and bit 0 is bit 8 of the class filter.          |
+ * | 1      | Class filter bit 7-0                                        |
+ * | 2      | Class mask bit 7-0                                          |
+ * | 3      | Type filter                                                 |
+ * | 4      | Type mask                                                   |
+ * | 5      | Originating nickname (0xFF: any)                            |
+ * | 6      | Source ports, one bit per port, bit 7 is the node           |
+ * | 7      | Destination ports, one bit per port, bit 7 is the node      |
+ * +--------+-------------------------------------------------------------+
+ * </pre>
+ *
+ * The routing decisions are cached per class, type, originating nickname and
+ * source port. To break loops over a second bridge, the last forwarded frames
+ * are remembered. If one of them is received on a port, where it was sent
+ * to, it is dropped as echo.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_BRIDGE
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_BRIDGE_H__
+#define __VSCP_BRIDGE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+#include "../user/vscp_tp_adapter.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Port of the node itself, used in the source and destination ports of a route. */
+#define VSCP_BRIDGE_PORT_NODE   (7)
+
+/** Number of registers of a single route */
+#define VSCP_BRIDGE_ROUTE_SIZE  (8)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the bridge and loads the routing table.
+ */
+extern void vscp_bridge_init(void);
+
+/**
+ * This function restores the factory default settings. All routes are
+ * disabled, which forwards every frame to all ports.
+ */
+extern void vscp_bridge_restoreFactoryDefaultSettings(void);
+
+/**
+ * This function sets the transport callbacks of a port. Port 0 is the
+ * transport of the node and can't be set here.
+ *
+ * @param[in]   port    Port (1 - VSCP_CONFIG_BRIDGE_PORT_NUM - 1)
+ * @param[in]   read    Receive callback
+ * @param[in]   write   Transmit callback
+ */
+extern void vscp_bridge_setPort(uint8_t port, vscp_tp_adapter_Read read, vscp_tp_adapter_Write write);
+
+/**
+ * This function processes the bridge. It receives the frames of all ports,
+ * forwards them and sends the queued frames, as long as the ports accept them.
+ * A port is only read, if there is space left for its frame in all queues.
+ * Otherwise the frame stays in the driver.
+ */
+extern void vscp_bridge_process(void);
+
+/**
+ * This function returns whether the bridge has queued frames.
+ *
+ * @return  Frames queued or not
+ * @retval  FALSE   Nothing to do
+ * @retval  TRUE    Process pending
+ */
+extern BOOL vscp_bridge_isProcessPending(void);
+
+/**
+ * This function borrows a received frame, which is forwarded to the node.
+ * It is lent in place and must be given back via vscp_bridge_releaseMessage().
+ *
+ * @param[in]   storage Message storage, not used
+ * @return  Received message or NULL if no message is available
+ */
+extern vscp_RxMessage const * vscp_bridge_borrowMessage(vscp_RxMessage * const storage);
+
+/**
+ * This function gives a borrowed frame back.
+ *
+ * @param[in]   msg Borrowed message
+ */
+extern void vscp_bridge_releaseMessage(vscp_RxMessage const * const msg);
+
+/**
+ * This function sends a frame of the node to the routed ports. If a port is
+ * busy, the frame is queued.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send or queue the message on any port
+ * @retval  TRUE    Message sent or queued
+ */
+extern BOOL vscp_bridge_writeMessage(vscp_TxMessage const * const msg);
+
+/**
+ * This function returns whether the register is part of the routing table.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Routing table register or not
+ * @retval  FALSE   Not a routing table register
+ * @retval  TRUE    Routing table register
+ */
+extern BOOL vscp_bridge_isRoutingTable(uint16_t page, uint8_t addr);
+
+/**
+ * Read a routing table register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+extern uint8_t  vscp_bridge_readRegister(uint16_t page, uint8_t addr);
+
+/**
+ * Write a routing table register. The route is active immediately.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+extern uint8_t  vscp_bridge_writeRegister(uint16_t page, uint8_t addr, uint8_t value);
+
+/**
+ * This function returns the number of forwarded frames.
+ *
+ * @return Number of forwarded frames
+ */
+extern uint32_t vscp_bridge_getForwarded(void);
+
+/**
+ * This function returns the number of frames, which were dropped on a port,
+ * because its transmit queue was full.
+ *
+ * @param[in]   port    Port
+ * @return Number of dropped frames
+ */
+extern uint16_t vscp_bridge_getTxDrops(uint8_t port);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_BRIDGE_H__ */
+
+/** @} */
@@ -0,0 +1,123 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN identifier codec
+@file   vscp_can_id.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_can_id.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_can_id.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function encodes the header of a message into the 29-bit CAN
+ * identifier.
+ *
+ * @param[in]   msg Message
+ * @return 29-bit CAN identifier
+ */
+extern uint32_t vscp_can_id_encode(vscp_Message const * const msg)
+{
+    uint32_t    canId   = 0;
+
+    if (NULL != msg)
+    {
+        canId = (((uint32_t)(msg->priority & 0x07)) << VSCP_CAN_ID_POS_PRIORITY) |
+                (((uint32_t)((FALSE == msg->hardCoded) ? 0 : 1)) << VSCP_CAN_ID_POS_HARD_CODED) |
+                (((uint32_t)(msg->vscpClass & 0x01FF)) << VSCP_CAN_ID_POS_CLASS) |
+                (((uint32_t)msg->vscpType) << VSCP_CAN_ID_POS_TYPE) |
+                (((uint32_t)msg->oAddr) << VSCP_CAN_ID_POS_OADDR);
+    }
+
+    return canId;
+}
+
+/**
+ * This function decodes the 29-bit CAN identifier into the header of a
+ * message. The data and the number of data bytes are not touched.
+ *
+ * @param[in]   canId   29-bit CAN identifier, further bits are ignored
+ * @param[out]  msg     Message
+ */
+extern void vscp_can_id_decode(uint32_t canId, vscp_Message * const msg)
+{
+    if (NULL != msg)
+    {
+        msg->priority   = (VSCP_PRIORITY)((canId >> VSCP_CAN_ID_POS_PRIORITY) & 0x07);
+        msg->hardCoded  = (0 != ((canId >> VSCP_CAN_ID_POS_HARD_CODED) & 0x01)) ? TRUE : FALSE;
+        msg->vscpClass  = (uint16_t)((canId >> VSCP_CAN_ID_POS_CLASS) & 0x01FF);
+        msg->vscpType   = (uint8_t)((canId >> VSCP_CAN_ID_POS_TYPE) & 0xFF);
+        msg->oAddr      = (uint8_t)((canId >> VSCP_CAN_ID_POS_OADDR) & 0xFF);
+    }
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
@@ -0,0 +1,139 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP CAN identifier codec
+@file   vscp_can_id.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module encodes a VSCP message header into the 29-bit CAN identifier and
+decodes it back.
+
+*******************************************************************************/
+/** @defgroup vscp_can_id CAN identifier codec
+ * On the CAN bus, the header of a VSCP level 1 message is transported in the
+ * 29-bit extended CAN identifier:
+ * - Bit 28 - 26: Priority
+ * - Bit 25: Hard coded node flag
+ * - Bit 24 - 16: Class
+ * - Bit 15 - 8: Type
+ * - Bit 7 - 0: Originating address
+ *
+ * Every CAN transport needs the same packing and unpacking, therefore all of
+ * them shall use this module.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_CAN_ID_H__
+#define __VSCP_CAN_ID_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Bit position of the priority in the 29-bit CAN identifier */
+#define VSCP_CAN_ID_POS_PRIORITY    26
+
+/** Bit position of the hard coded flag in the 29-bit CAN identifier */
+#define VSCP_CAN_ID_POS_HARD_CODED  25
+
+/** Bit position of the class in the 29-bit CAN identifier */
+#define VSCP_CAN_ID_POS_CLASS       16
+
+/** Bit position of the type in the 29-bit CAN identifier */
+#define VSCP_CAN_ID_POS_TYPE        8
+
+/** Bit position of the originating address in the 29-bit CAN identifier */
+#define VSCP_CAN_ID_POS_OADDR       0
+
+/** Mask of the 29-bit CAN identifier */
+#define VSCP_CAN_ID_MASK            0x1FFFFFFFUL
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function encodes the header of a message into the 29-bit CAN
+ * identifier.
+ *
+ * @param[in]   msg Message
+ * @return 29-bit CAN identifier
+ */
+extern uint32_t vscp_can_id_encode(vscp_Message const * const msg);
+
+/**
+ * This function decodes the 29-bit CAN identifier into the header of a
+ * message. The data and the number of data bytes are not touched.
+ *
+ * @param[in]   canId   29-bit CAN identifier, further bits are ignored
+ * @param[out]  msg     Message
+ */
+extern void vscp_can_id_decode(uint32_t canId, vscp_Message * const msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_CAN_ID_H__ */
+
+/** @} */
@@ -167,6 +167,17 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_ENABLE_DM_EXTENSION */
 
+#ifndef VSCP_CONFIG_DM_RAM_INDEX
+
+/** Enable a RAM index of the decision matrix. The enabled rows are compiled
+ * once into RAM and grouped by their class/type filter, which avoids reading
+ * the whole decision matrix from the persistent memory for every received event.
+ * Disable it on devices with very low RAM.
+ */
+#define VSCP_CONFIG_DM_RAM_INDEX                VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_DM_RAM_INDEX */
+
 #if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM )
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
@@ -186,6 +197,15 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION */
 
+#ifndef VSCP_CONFIG_DM_NG_RULE_CACHE
+
+/** Enable a RAM cache of the decision matrix next generation. The rule set is
+ * validated and decoded once into RAM, after every change of the rule set.
+ */
+#define VSCP_CONFIG_DM_NG_RULE_CACHE            VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_DM_NG_RULE_CACHE */
+
 #ifndef VSCP_CONFIG_ENABLE_LOOPBACK
 
 /** Enable a loopback for all sent VSCP events. This feature is interesting to invoke
@@ -235,6 +255,137 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT */
 
+#ifndef VSCP_CONFIG_TIMER_DEADLINE
+
+/**
+ * Enable timers with absolute 32-bit deadlines in ms, based on the platform
+ * millisecond counter. A timer status query is a single comparison then and
+ * the timers run with ms resolution, independent of the vscp_timer_process()
+ * call period. Additionally periodic timers and expiry callbacks are supported.
+ * Disable it to use the tick based timers, which count down in vscp_timer_process().
+ */
+#define VSCP_CONFIG_TIMER_DEADLINE              VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_TIMER_DEADLINE */
+
+#ifndef VSCP_CONFIG_PS_CACHE
+
+/**
+ * Enable a RAM write-back cache for the persistent memory. Written data is
+ * collected and written back in idle time, after a timeout or on explicit
+ * request. Bytes, which are not changed, are not written at all.
+ * Note, that not written back data is lost at power loss.
+ */
+#define VSCP_CONFIG_PS_CACHE                    VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_PS_CACHE */
+
+#ifndef VSCP_CONFIG_PS_JOURNAL
+
+/**
+ * Enable a journal in the persistent memory for the nickname id and the
+ * segment controller CRC. Every change is written to the next journal slot,
+ * which spreads the wear over several EEPROM cells.
+ */
+#define VSCP_CONFIG_PS_JOURNAL                  VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_PS_JOURNAL */
+
+#ifndef VSCP_CONFIG_TX_QUEUE
+
+/**
+ * Enable a transmit queue in the transport layer. Messages, which the lower
+ * layer doesn't accept immediately, are queued by priority and sent later with
+ * a exponential backoff. Sending never waits for the lower layer.
+ */
+#define VSCP_CONFIG_TX_QUEUE                    VSCP_CONFIG_BASE_ENABLED
+
+#endif  /* Undefined VSCP_CONFIG_TX_QUEUE */
+
+#ifndef VSCP_CONFIG_RX_FILTER
+
+/**
+ * Enable the calculation of receive acceptance filters from the decision
+ * matrix, the decision matrix next generation and the application interest.
+ * They are provided to the transport adapter, which may configure the CAN
+ * controller with them. Note, the application receives only the events it
+ * declared its interest in.
+ */
+#define VSCP_CONFIG_RX_FILTER                   VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_RX_FILTER */
+
+#ifndef VSCP_CONFIG_EVENT_INTEREST
+
+/**
+ * Enable the response to CLASS1.PROTOCOL, Type=40 (Get event interest).
+ * The event interest is derived from the decision matrix, the decision
+ * matrix next generation and the application interest. Note, gateways may
+ * forward only the events to the application, it declared its interest in.
+ */
+#define VSCP_CONFIG_EVENT_INTEREST              VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_EVENT_INTEREST */
+
+#ifndef VSCP_CONFIG_EMBEDDED_MDF
+
+/**
+ * Enable the response to CLASS1.PROTOCOL, Type=35 (Get embedded MDF).
+ * The MDF is stored compressed in the program memory, see
+ * extras/mdf/mdf_embed.py, and streamed decompressed chunk by chunk.
+ */
+#define VSCP_CONFIG_EMBEDDED_MDF                VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_EMBEDDED_MDF */
+
+#ifndef VSCP_CONFIG_FW_UPDATE
+
+/**
+ * Enable the firmware update in the application, via the VSCP boot loader
+ * algorithm. The received blocks are programmed in the background by the
+ * firmware access driver, while the application keeps running. It replaces
+ * the jump to a external boot loader (VSCP_CONFIG_BOOT_LOADER_SUPPORTED).
+ */
+#define VSCP_CONFIG_FW_UPDATE                   VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_FW_UPDATE */
+
+#ifndef VSCP_CONFIG_MULTI_INSTANCE
+
+/**
+ * Enable several framework instances, e.g. to run more than one node on a
+ * single MCU, each with its own transport. Every module keeps its data per
+ * instance and works on the instance, which is selected with
+ * vscp_instance_select().
+ */
+#define VSCP_CONFIG_MULTI_INSTANCE              VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_MULTI_INSTANCE */
+
+#ifndef VSCP_CONFIG_BRIDGE
+
+/**
+ * Enable the bridge mode, which forwards the frames between several
+ * transports, e.g. two CAN buses. The forwarding is controlled by a routing
+ * table in the application register space. The node itself receives the
+ * frames of all transports and sends its own frames to all of them.
+ */
+#define VSCP_CONFIG_BRIDGE                      VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE */
+
+#ifndef VSCP_CONFIG_LEVEL2
+
+/**
+ * Enable the support of Level II events, e.g. for nodes on Ethernet. Their
+ * payload is stored in a pool of fixed blocks, therefore Level I events don't
+ * need more memory. Level II events, which are Level I events, are handled
+ * like them.
+ */
+#define VSCP_CONFIG_LEVEL2                      VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* Undefined VSCP_CONFIG_LEVEL2 */
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
@@ -327,9 +478,8 @@ extern "C"
 
 #ifndef VSCP_CONFIG_LOOPBACK_STORAGE_NUM
 
-/** Number of messages in the loopback cyclic buffer. Note, that if you want to
- * store up to 3 events, you have to configure 4, because of the technical
- * implementation of the cyclic buffer.
+/** Number of messages in the loopback ring buffer. It must be a power of two
+ * and all of them can be used.
  */
 #define VSCP_CONFIG_LOOPBACK_STORAGE_NUM        4
 
@@ -337,6 +487,23 @@ extern "C"
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
+#ifndef VSCP_CONFIG_RX_QUEUE_STORAGE_NUM
+
+/** Number of messages in the application receive queue cyclic buffer. Note, that
+ * if you want to store up to 3 events, you have to configure 4, because of the
+ * technical implementation of the cyclic buffer.
+ */
+#define VSCP_CONFIG_RX_QUEUE_STORAGE_NUM        4
+
+#endif  /* VSCP_CONFIG_RX_QUEUE_STORAGE_NUM */
+
+#ifndef VSCP_CONFIG_TIMER_APP_NUM
+
+/** Number of additional timers, which are reserved for the application. */
+#define VSCP_CONFIG_TIMER_APP_NUM               0
+
+#endif  /* VSCP_CONFIG_TIMER_APP_NUM */
+
 #ifndef VSCP_CONFIG_START_NODE_PROBE_NICKNAME
 
 /** Number to start probing nickname from. */
@@ -344,6 +511,299 @@ extern "C"
 
 #endif  /* Undefined VSCP_CONFIG_START_NODE_PROBE_NICKNAME */
 
+#ifndef VSCP_CONFIG_REG_RSP_STORAGE_NUM
+
+/** Number of register responses (e.g. to a page write), which can wait in a
+ * cyclic buffer until the transport layer accepts them. Note, that if you want
+ * to store up to 3 responses, you have to configure 4, because of the technical
+ * implementation of the cyclic buffer.
+ */
+#define VSCP_CONFIG_REG_RSP_STORAGE_NUM         4
+
+#endif  /* Undefined VSCP_CONFIG_REG_RSP_STORAGE_NUM */
+
+#ifndef VSCP_CONFIG_REG_RSP_FRAMES_PER_CYCLE
+
+/** Max. number of register responses (e.g. of a page read), which are sent in
+ * a single process cycle. The responses are sent as long as the transport layer
+ * accepts them, but not more than this limit, to keep the process cycle short.
+ */
+#define VSCP_CONFIG_REG_RSP_FRAMES_PER_CYCLE    8
+
+#endif  /* Undefined VSCP_CONFIG_REG_RSP_FRAMES_PER_CYCLE */
+
+#ifndef VSCP_CONFIG_SEGMENT_TX_NUM
+
+/** Number of multi-frame streams, which wait to be sent. */
+#define VSCP_CONFIG_SEGMENT_TX_NUM              2
+
+#endif  /* Undefined VSCP_CONFIG_SEGMENT_TX_NUM */
+
+#ifndef VSCP_CONFIG_SEGMENT_TX_SIZE
+
+/** Max. payload of a multi-frame stream in byte, which is copied to be sent. */
+#define VSCP_CONFIG_SEGMENT_TX_SIZE             32
+
+#endif  /* Undefined VSCP_CONFIG_SEGMENT_TX_SIZE */
+
+#ifndef VSCP_CONFIG_SEGMENT_TX_FRAMES_PER_CYCLE
+
+/** Max. number of multi-frame stream frames, which are sent in a single
+ * process cycle.
+ */
+#define VSCP_CONFIG_SEGMENT_TX_FRAMES_PER_CYCLE 8
+
+#endif  /* Undefined VSCP_CONFIG_SEGMENT_TX_FRAMES_PER_CYCLE */
+
+#ifndef VSCP_CONFIG_SEGMENT_RX_NUM
+
+/** Number of multi-frame streams, which are reassembled concurrently. Every
+ * stream needs a timer. The core needs one for the GUID drop nickname id.
+ */
+#define VSCP_CONFIG_SEGMENT_RX_NUM              2
+
+#endif  /* Undefined VSCP_CONFIG_SEGMENT_RX_NUM */
+
+#ifndef VSCP_CONFIG_SEGMENT_RX_SIZE
+
+/** Max. payload of a reassembled multi-frame stream in byte (16 - 255). */
+#define VSCP_CONFIG_SEGMENT_RX_SIZE             16
+
+#endif  /* Undefined VSCP_CONFIG_SEGMENT_RX_SIZE */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+#ifndef VSCP_CONFIG_PS_CACHE_LINES
+
+/** Number of persistent memory cache lines. Every cache line holds 8 bytes. */
+#define VSCP_CONFIG_PS_CACHE_LINES              4
+
+#endif  /* Undefined VSCP_CONFIG_PS_CACHE_LINES */
+
+#ifndef VSCP_CONFIG_PS_CACHE_FLUSH_TIMEOUT
+
+/** Max. time in ms, until changed data in the persistent memory cache is
+ * written back, even if the node is not idle.
+ */
+#define VSCP_CONFIG_PS_CACHE_FLUSH_TIMEOUT      ((uint16_t)1000)
+
+#endif  /* Undefined VSCP_CONFIG_PS_CACHE_FLUSH_TIMEOUT */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+#ifndef VSCP_CONFIG_PS_JOURNAL_SLOTS
+
+/** Number of journal slots in the persistent memory. Every slot needs 3 bytes. */
+#define VSCP_CONFIG_PS_JOURNAL_SLOTS            8
+
+#endif  /* Undefined VSCP_CONFIG_PS_JOURNAL_SLOTS */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+#ifndef VSCP_CONFIG_TX_QUEUE_STORAGE_NUM
+
+/** Number of messages, which can wait in the transmit queue. */
+#define VSCP_CONFIG_TX_QUEUE_STORAGE_NUM        4
+
+#endif  /* Undefined VSCP_CONFIG_TX_QUEUE_STORAGE_NUM */
+
+#ifndef VSCP_CONFIG_TX_QUEUE_RETRIES
+
+/** Number of retries, before a queued message is dropped. */
+#define VSCP_CONFIG_TX_QUEUE_RETRIES            8
+
+#endif  /* Undefined VSCP_CONFIG_TX_QUEUE_RETRIES */
+
+#ifndef VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN
+
+/** Backoff time in ms after the first refused message. It is doubled with
+ * every further refused message.
+ */
+#define VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN        ((uint16_t)2)
+
+#endif  /* Undefined VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN */
+
+#ifndef VSCP_CONFIG_TX_QUEUE_BACKOFF_MAX
+
+/** Max. backoff time in ms. */
+#define VSCP_CONFIG_TX_QUEUE_BACKOFF_MAX        ((uint16_t)128)
+
+#endif  /* Undefined VSCP_CONFIG_TX_QUEUE_BACKOFF_MAX */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+#ifndef VSCP_CONFIG_RX_FILTER_NUM
+
+/** Number of acceptance filters, which the transport supports.
+ * Note, a MCP2515 has only two masks. The VSCPMcp2515 transport merges the
+ * filters, which share a mask.
+ */
+#define VSCP_CONFIG_RX_FILTER_NUM               4
+
+#endif  /* Undefined VSCP_CONFIG_RX_FILTER_NUM */
+
+#ifndef VSCP_CONFIG_RX_FILTER_APP_NUM
+
+/** Max. number of event groups, the application can declare its interest in. */
+#define VSCP_CONFIG_RX_FILTER_APP_NUM           4
+
+#endif  /* Undefined VSCP_CONFIG_RX_FILTER_APP_NUM */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+#ifndef VSCP_CONFIG_EVENT_INTEREST_APP_NUM
+
+/** Max. number of event groups, the application can declare its interest in. */
+#define VSCP_CONFIG_EVENT_INTEREST_APP_NUM      4
+
+#endif  /* Undefined VSCP_CONFIG_EVENT_INTEREST_APP_NUM */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+#ifndef VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE
+
+/** Size of the decompression window in bytes. It must be at least the window
+ * size, the MDF was compressed with. Supported are 16, 32, 64, 128 and 256.
+ */
+#define VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE    64
+
+#endif  /* Undefined VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+#ifndef VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE
+
+/** Size of a firmware block in bytes, e.g. the flash page size.
+ * It must be a multiple of 8, which is the size of a block data event.
+ */
+#define VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE        128
+
+#endif  /* Undefined VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE */
+
+#ifndef VSCP_CONFIG_FW_UPDATE_BLOCKS
+
+/** Number of blocks in RAM, which are received while the previous ones are
+ * programmed. Each one needs VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE bytes.
+ */
+#define VSCP_CONFIG_FW_UPDATE_BLOCKS            2
+
+#endif  /* Undefined VSCP_CONFIG_FW_UPDATE_BLOCKS */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+#ifndef VSCP_CONFIG_INSTANCE_NUM
+
+/** Number of framework instances. The RAM of all modules is needed once
+ * per instance.
+ */
+#define VSCP_CONFIG_INSTANCE_NUM                2
+
+#endif  /* Undefined VSCP_CONFIG_INSTANCE_NUM */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+#ifndef VSCP_CONFIG_BRIDGE_PORT_NUM
+
+/** Number of bridge ports (2 - 7). Port 0 is the transport of the node, the
+ * others are set with vscp_bridge_setPort().
+ */
+#define VSCP_CONFIG_BRIDGE_PORT_NUM             2
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_PORT_NUM */
+
+#ifndef VSCP_CONFIG_BRIDGE_ROUTES
+
+/** Number of routes in the routing table (1 - 16). */
+#define VSCP_CONFIG_BRIDGE_ROUTES               8
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_ROUTES */
+
+#ifndef VSCP_CONFIG_BRIDGE_PAGE
+
+/** Routing table location: Page in the application register space. The
+ * routing table starts at the begin of the page.
+ */
+#define VSCP_CONFIG_BRIDGE_PAGE                 4
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_PAGE */
+
+#ifndef VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM
+
+/** Number of frames in the transmit queue of every port. It must be a power
+ * of two.
+ */
+#define VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM         4
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM */
+
+#ifndef VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM
+
+/** Number of frames in the receive queue of the node. It must be a power of
+ * two.
+ */
+#define VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM         4
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM */
+
+#ifndef VSCP_CONFIG_BRIDGE_CACHE_NUM
+
+/** Number of cached routing decisions. It must be a power of two. */
+#define VSCP_CONFIG_BRIDGE_CACHE_NUM            8
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_CACHE_NUM */
+
+#ifndef VSCP_CONFIG_BRIDGE_ECHO_NUM
+
+/** Number of the last forwarded frames, which are remembered to detect
+ * their echo over another bridge. A frame is forgotten 1 to 2 times
+ * VSCP_CONFIG_MULTI_MSG_TIMEOUT after it was forwarded.
+ */
+#define VSCP_CONFIG_BRIDGE_ECHO_NUM             8
+
+#endif  /* Undefined VSCP_CONFIG_BRIDGE_ECHO_NUM */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+#error The receive acceptance filter would drop the frames, which the bridge shall forward. Please disable VSCP_CONFIG_RX_FILTER.
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+#ifndef VSCP_CONFIG_L2_BLOCK_SIZE
+
+/** Size of a Level II payload block in byte (16 - 512). Received events with
+ * more data are dropped.
+ */
+#define VSCP_CONFIG_L2_BLOCK_SIZE               512
+
+#endif  /* Undefined VSCP_CONFIG_L2_BLOCK_SIZE */
+
+#ifndef VSCP_CONFIG_L2_BLOCK_NUM
+
+/** Number of Level II payload blocks (1 - 8), shared by all instances. */
+#define VSCP_CONFIG_L2_BLOCK_NUM                2
+
+#endif  /* Undefined VSCP_CONFIG_L2_BLOCK_NUM */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
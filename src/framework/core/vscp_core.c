@@ -41,6 +41,8 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_core.h"
+#include <string.h>
+#include "vscp_instance.h"
 #include "vscp_dev_data.h"
 #include "../user/vscp_portable.h"
 #include "vscp_transport.h"
@@ -53,9 +55,17 @@
 #include "../user/vscp_app_reg.h"
 #include "vscp_dm.h"
 #include "vscp_dm_ng.h"
+#include "vscp_bridge.h"
+#include "vscp_l2.h"
+#include "vscp_segment.h"
+#include "vscp_reg_map.h"
 #include "vscp_util.h"
 #include "../user/vscp_action.h"
 #include "vscp_logger.h"
+#include "vscp_rx_filter.h"
+#include "vscp_interest.h"
+#include "vscp_mdf.h"
+#include "vscp_fw_update.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -80,10 +90,22 @@
 /** Timer threshold of 1s in ms */
 #define VSCP_CORE_TIMER_THRESHOLD_1S    ((uint16_t)1000)
 
+/** Size of the MDF URL in byte */
+#define VSCP_CORE_MDF_URL_SIZE          (VSCP_REG_MDF_URL_END - VSCP_REG_MDF_URL_BEGIN + 1)
+
+/* The cyclic buffer handles its storage size with 8 bit. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(256 > (VSCP_CONFIG_REG_RSP_STORAGE_NUM * sizeof(vscp_TxMessage)));
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_CORE_INST          (vscp_core_instances[VSCP_INSTANCE])
+
+/** Entry of the VSCP specific register index: Range index + 1 */
+#define VSCP_CORE_REG_IDX(__range)  ((uint8_t)((__range) + 1))
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -112,17 +134,165 @@ typedef enum
 } INIT_STATE;
 
 /**
- * This type is used to store all necessary information, used by a extended
- * page read event.
+ * This type is used to store all necessary information, used by a page read
+ * or a extended page read event. It is the cursor of the register read, which
+ * is continued in the following process cycles.
  */
 typedef struct
 {
-    uint16_t    page;   /**< Page */
-    uint8_t     addr;   /**< Address (offset in page) */
-    uint16_t    count;  /**< Number of registers to read */
-    uint8_t     seq;    /**< Sequence id */
+    uint8_t     rspType;    /**< Response type (VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE or VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE) */
+    uint16_t    page;       /**< Page */
+    uint8_t     addr;       /**< Address (offset in page) */
+    uint16_t    count;      /**< Number of registers to read */
+    uint8_t     seq;        /**< Sequence id */
+
+} RegRead;
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Node nickname id */
+    uint8_t                 nickname;
+
+    /** Current state of the VSCP core stack */
+    STATE                   state;
+
+    /** Sub state of main state init */
+    INIT_STATE              initState;
+
+    /** Receive message storage, used if the transport layer can't lend its own frame buffer. */
+    vscp_RxMessage          rxMessageStorage;
+
+    /** Current received message. It points either to the frame buffer, which is lent
+     * by the transport layer or to the local receive message storage.
+     */
+    vscp_RxMessage const *  rxMessage;
+
+    /** Receive message storage contains a valid message or not. */
+    BOOL                    rxMessageValid;
+
+    /** Timer id, which is used for timeout handling, regarding state transitions. */
+    uint8_t                 timerId;
+
+    /** Timer id, which is used for vscp register 162 multi-frame timeout. */
+    uint8_t                 timerIdReg162;
+
+    /** Timer id, which is used to drive the time since epoch (unix timestamp). */
+    uint8_t                 timerIdTimeSinceEpoch;
+
+    /** Seconds counter, used to wait for reset request. */
+    uint8_t                 secCnt;
+
+    /** Nickname id used during nickname discovery process */
+    uint8_t                 nickname_probe;
+
+    /** Time since epoch 00:00:00 UTC, January 1, 1970 (unix timestamp) in s */
+    uint32_t                timeSinceEpoch;
+
+    /** The core has to be processed without waiting for a timer. */
+    BOOL                    isProcessPending;
+
+    /** A event was received in the last process cycle. */
+    BOOL                    isEventReceived;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
+
+    /** Timer id, which is used for node heartbeat handling. */
+    uint8_t                 heartbeatTimerId;
+
+    /** Enable/Disable node heartbeat */
+    BOOL                    isHeartbeatEnabled;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
+
+    /** Register: alarm status */
+    uint8_t                 regAlarmStatus;
+
+    /** Register: page select */
+    uint16_t                regPageSelect;
+
+    /** Register: node control flags, mirror of the persistent memory */
+    uint8_t                 regNodeControlFlags;
+
+    /** Register: user id, mirror of the persistent memory */
+    uint8_t                 regUserId[VSCP_PS_SIZE_USER_ID];
 
-} ExtPageRead;
+    /** Reset requested or not */
+    BOOL                    resetRequested;
+
+    /**
+     * Page read and extended page read data, which is used to continue the read
+     * in the next process cycles.
+     */
+    RegRead                 regReadData;
+
+    /** Register response, which is in progress to be sent. */
+    vscp_TxMessage          regRspMessage;
+
+    /** Is a register response in progress to be sent (TRUE) or not (FALSE)? */
+    BOOL                    regRspPending;
+
+    /** Storage of the register responses, which are waiting to be sent. */
+    vscp_TxMessage          regRspStorage[VSCP_CONFIG_REG_RSP_STORAGE_NUM];
+
+    /** Queue of the register responses, which are waiting to be sent. */
+    vscp_util_CyclicBuffer  regRspQueue;
+
+    /** Number of register responses, which were dropped, because the queue was full. */
+    uint16_t                regRspDrops;
+
+    /** Is a who is there response waiting for a free stream (TRUE) or not (FALSE)? */
+    BOOL                    whoIsThereRspPending;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+    /** Is a event interest response in progress (TRUE) or not (FALSE)? */
+    BOOL                    interestRspActive;
+
+    /** Index of the next event interest response */
+    uint8_t                 interestRspIndex;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+    /** Is a embedded MDF response in progress (TRUE) or not (FALSE)? */
+    BOOL                    mdfRspActive;
+
+    /** Is a embedded MDF available (TRUE) or not (FALSE)? */
+    BOOL                    mdfRspAvailable;
+
+    /** Index of the next embedded MDF response */
+    uint16_t                mdfRspIndex;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+} vscp_core_Instance;
+
+/** Register ranges, in the order of the register map */
+typedef enum
+{
+    VSCP_CORE_REG_RANGE_ALARM_STATUS = 0,       /**< Alarm status */
+    VSCP_CORE_REG_RANGE_VSCP_VERSION,           /**< VSCP version */
+    VSCP_CORE_REG_RANGE_NODE_CONTROL_FLAGS,     /**< Node control flags */
+    VSCP_CORE_REG_RANGE_USER_ID,                /**< User id */
+    VSCP_CORE_REG_RANGE_MANUFACTURER_DEV_ID,    /**< Manufacturer device id */
+    VSCP_CORE_REG_RANGE_MANUFACTURER_SUB_DEV_ID, /**< Manufacturer sub device id */
+    VSCP_CORE_REG_RANGE_NICKNAME_ID,            /**< Nickname id */
+    VSCP_CORE_REG_RANGE_PAGE_SELECT,            /**< Page select */
+    VSCP_CORE_REG_RANGE_FIRMWARE_VERSION,       /**< Firmware version */
+    VSCP_CORE_REG_RANGE_BOOT_LOADER_ALGORITHM,  /**< Boot loader algorithm */
+    VSCP_CORE_REG_RANGE_BUFFER_SIZE,            /**< Buffer size */
+    VSCP_CORE_REG_RANGE_PAGES_USED,             /**< Number of used pages */
+    VSCP_CORE_REG_RANGE_STD_DEV_FAMILY_CODE,    /**< Standard device family code */
+    VSCP_CORE_REG_RANGE_STD_DEV_TYPE,           /**< Standard device type */
+    VSCP_CORE_REG_RANGE_RESTORE_STD_CFG,        /**< Restore standard configuration */
+    VSCP_CORE_REG_RANGE_FIRMWARE_DEVICE_CODE,   /**< Firmware device code */
+    VSCP_CORE_REG_RANGE_GUID,                   /**< GUID */
+    VSCP_CORE_REG_RANGE_MDF_URL,                /**< MDF URL */
+    VSCP_CORE_REG_RANGE_FEATURE                 /**< First feature range, e.g. the decision matrix */
+
+} VSCP_CORE_REG_RANGE;
 
 /*******************************************************************************
     PROTOTYPES
@@ -137,6 +307,7 @@ static void vscp_core_changeToStatePreActive(void);
 static void vscp_core_statePreActive(void);
 static void vscp_core_changeToStateActive(void);
 static BOOL vscp_core_stateActive(void);
+static void vscp_core_handleEvent(void);
 static void vscp_core_changeToStateIdle(void);
 static void vscp_core_stateIdle(void);
 static void vscp_core_changeToStateReset(uint8_t timeout);
@@ -145,6 +316,12 @@ static void vscp_core_changeToStateError(void);
 static void vscp_core_stateError(void);
 static void vscp_core_handleProtocolClassType(void);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+static BOOL vscp_core_handleL2Event(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT )
 static void vscp_core_handleProtocolHeartbeat(void);
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_SUPPORT_SEGMENT ) */
@@ -157,6 +334,20 @@ static void vscp_core_handleProtocolReadRegister(void);
 static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value);
 static uint8_t vscp_core_readRegister(uint16_t page, uint8_t addr);
 static uint8_t vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed);
+static uint8_t vscp_core_readAlarmStatus(uint16_t page, uint8_t addr);
+static uint8_t vscp_core_readVscpVersion(uint16_t page, uint8_t addr);
+static uint8_t* vscp_core_getNodeControlFlagsStorage(void);
+static void vscp_core_nodeControlFlagsChanged(uint16_t page, uint8_t addr, uint8_t count);
+static uint8_t* vscp_core_getUserIdStorage(void);
+static void vscp_core_userIdChanged(uint16_t page, uint8_t addr, uint8_t count);
+static uint8_t* vscp_core_getNicknameStorage(void);
+static uint8_t vscp_core_readPageSelect(uint16_t page, uint8_t addr);
+static uint8_t vscp_core_writePageSelect(uint16_t page, uint8_t addr, uint8_t value);
+static uint8_t vscp_core_readBootLoaderAlgorithm(uint16_t page, uint8_t addr);
+static uint8_t vscp_core_readBufferSize(uint16_t page, uint8_t addr);
+static uint8_t vscp_core_readPagesUsed(uint16_t page, uint8_t addr);
+static uint8_t vscp_core_writeRestoreStdCfg(uint16_t page, uint8_t addr, uint8_t value);
+static BOOL vscp_core_isRegAppWriteable(void);
 static void vscp_core_handleProtocolWriteRegister(void);
 static void vscp_core_handleProtocolEnterBootLoaderMode(void);
 static void vscp_core_handleProtocolGuidDropNickname(void);
@@ -165,77 +356,183 @@ static void vscp_core_handleProtocolPageWrite(void);
 static void vscp_core_handleProtocolIncrementRegister(void);
 static void vscp_core_handleProtocolDecrementRegister(void);
 static void vscp_core_handleProtocolWhoIsThere(void);
+static void vscp_core_sendWhoIsThereRsp(void);
+static void vscp_core_getWhoIsThereData(uint8_t index, uint8_t * const buffer, uint8_t size);
 static void vscp_core_handleProtocolGetDecisionMatrixInfo(void);
 static void vscp_core_handleProtocolExtendedPageReadRegister(void);
-static void vscp_core_extendedPageReadRegister(ExtPageRead * const data);
 static void vscp_core_handleProtocolExtendedPageWriteRegister(void);
-static uint8_t vscp_core_getStartUpControl(void);
-static uint8_t vscp_core_getRegAppWriteProtect(void);
 
-/*******************************************************************************
-    LOCAL VARIABLES
-*******************************************************************************/
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+static void vscp_core_handleProtocolGetEventInterest(void);
+static BOOL vscp_core_buildEventInterestRsp(vscp_TxMessage * const txMessage);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
 
-/** Node nickname id */
-static uint8_t          vscp_core_nickname          = VSCP_NICKNAME_NOT_INIT;
+static void vscp_core_handleProtocolGetEmbeddedMdf(void);
+static BOOL vscp_core_buildEmbeddedMdfRsp(vscp_TxMessage * const txMessage);
 
-/** Current state of the VSCP core stack */
-static STATE            vscp_core_state             = STATE_STARTUP;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
 
-/** Sub state of main state init */
-static INIT_STATE       vscp_core_initState         = INIT_STATE_PROBE;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
 
-/** Receive message storage */
-static vscp_RxMessage   vscp_core_rxMessage;
+static void vscp_core_handleProtocolFwUpdateEnter(void);
+static void vscp_core_handleProtocolFwUpdate(void);
+static void vscp_core_sendFwUpdateRsp(vscp_TxMessage * const txMessage);
 
-/** Receive message storage contains a valid message or not. */
-static BOOL             vscp_core_rxMessageValid    = FALSE;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
 
-/** Timer id, which is used for timeout handling, regarding state transitions. */
-static uint8_t          vscp_core_timerId                   = VSCP_TIMER_ID_INVALID;
+static void vscp_core_initRegRsp(void);
+static void vscp_core_startRegRead(uint8_t rspType, uint16_t page, uint8_t addr, uint16_t count);
+static void vscp_core_buildRegReadRsp(RegRead * const data, vscp_TxMessage * const txMessage);
+static void vscp_core_sendRegRsp(vscp_TxMessage const * const txMessage);
+static BOOL vscp_core_processRegRsp(void);
+static BOOL vscp_core_isRegRspPending(void);
+static BOOL vscp_core_isRegRspQueueFull(void);
+static uint8_t vscp_core_getStartUpControl(void);
+static uint8_t vscp_core_getRegAppWriteProtect(void);
 
-/** Timer id, which is used for GUID drop nickname multi-frame timeout. */
-static uint8_t          vscp_core_timerIdGuidDropNickname   = VSCP_TIMER_ID_INVALID;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+static void vscp_core_timeSinceEpochCallback(uint8_t id);
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
 
-/** Timer id, which is used for vscp register 162 multi-frame timeout. */
-static uint8_t          vscp_core_timerIdReg162             = VSCP_TIMER_ID_INVALID;
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
 
-/** Timer id, which is used to drive the time since epoch (unix timestamp). */
-static uint8_t          vscp_core_timerIdTimeSinceEpoch     = VSCP_TIMER_ID_INVALID;
+/** Data of all framework instances */
+static vscp_core_Instance      vscp_core_instances[VSCP_INSTANCE_NUM];
 
-/** Seconds counter, used to wait for reset request. */
-static uint8_t          vscp_core_secCnt            = 0;
+/** Register ranges, the VSCP specific ones in the order of VSCP_CORE_REG_RANGE */
+static const vscp_reg_map_Range vscp_core_regRanges[] PROGMEM =
+{
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_ALARM_STATUS, 1, VSCP_REG_MAP_ACCESS_R, vscp_core_readAlarmStatus, NULL, NULL),
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_VSCP_VERSION_MAJOR, 2, VSCP_REG_MAP_ACCESS_R, vscp_core_readVscpVersion, NULL, NULL),
+    VSCP_REG_MAP_RAM(0, VSCP_REG_NODE_CONTROL_FLAGS, 1, VSCP_REG_MAP_ACCESS_RW, vscp_core_getNodeControlFlagsStorage, vscp_core_nodeControlFlagsChanged),
+    VSCP_REG_MAP_RAM(0, VSCP_REG_USER_ID_0, VSCP_PS_SIZE_USER_ID, VSCP_REG_MAP_ACCESS_RW, vscp_core_getUserIdStorage, vscp_core_userIdChanged),
+    VSCP_DEV_DATA_REG_MAP_MANUFACTURER_DEV_ID(0, VSCP_REG_MANUFACTURER_DEV_ID_0),
+    VSCP_DEV_DATA_REG_MAP_MANUFACTURER_SUB_DEV_ID(0, VSCP_REG_MANUFACTURER_SUB_DEV_ID_0),
+    VSCP_REG_MAP_RAM(0, VSCP_REG_NICKNAME_ID, 1, VSCP_REG_MAP_ACCESS_R, vscp_core_getNicknameStorage, NULL),
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_PAGE_SELECT_MSB, 2, VSCP_REG_MAP_ACCESS_RW, vscp_core_readPageSelect, vscp_core_writePageSelect, NULL),
+    VSCP_DEV_DATA_REG_MAP_FIRMWARE_VERSION(0, VSCP_REG_FIRMWARE_VERSION_MAJOR),
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_BOOT_LOADER_ALGORITHM, 1, VSCP_REG_MAP_ACCESS_R, vscp_core_readBootLoaderAlgorithm, NULL, NULL),
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_BUFFER_SIZE, 1, VSCP_REG_MAP_ACCESS_R, vscp_core_readBufferSize, NULL, NULL),
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_PAGES_USED, 1, VSCP_REG_MAP_ACCESS_R, vscp_core_readPagesUsed, NULL, NULL),
+    VSCP_DEV_DATA_REG_MAP_STD_DEV_FAMILY_CODE(0, VSCP_REG_STD_DEV_FAMILY_CODE_3),
+    VSCP_DEV_DATA_REG_MAP_STD_DEV_TYPE(0, VSCP_REG_STD_DEV_TYPE_3),
+    VSCP_REG_MAP_FUNC(0, VSCP_REG_RESTORE_STD_CFG, 1, VSCP_REG_MAP_ACCESS_W, NULL, vscp_core_writeRestoreStdCfg, NULL),
+    VSCP_DEV_DATA_REG_MAP_FIRMWARE_DEVICE_CODE(0, VSCP_REG_FIRMWARE_DEVICE_CODE_MSB),
+    VSCP_DEV_DATA_REG_MAP_GUID(0, VSCP_REG_GUID_15),
+    VSCP_DEV_DATA_REG_MAP_MDF_URL(0, VSCP_REG_MDF_URL_BEGIN),
 
-/** Nickname id used during nickname discovery process */
-static uint8_t          vscp_core_nickname_probe    = VSCP_NICKNAME_NOT_INIT;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
-/** Time since epoch 00:00:00 UTC, January 1, 1970 (unix timestamp) in s */
-static uint32_t         vscp_core_timeSinceEpoch    = 0;
+    VSCP_REG_MAP_FUNC(VSCP_DM_REG_PAGE, VSCP_DM_REG_ADDR, VSCP_DM_REG_SIZE, VSCP_REG_MAP_ACCESS_RW | VSCP_REG_MAP_ACCESS_PROTECTED, vscp_dm_readRegister, vscp_dm_writeRegister, NULL),
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
-/** Timer id, which is used for node heartbeat handling. */
-static uint8_t          vscp_core_heartbeatTimerId      = VSCP_TIMER_ID_INVALID;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
 
-/** Enable/Disable node heartbeat */
-static BOOL             vscp_core_isHeartbeatEnabled    = TRUE;
+    VSCP_REG_MAP_FUNC(VSCP_CONFIG_DM_NG_PAGE, 0, VSCP_CONFIG_DM_NG_RULE_SET_SIZE, VSCP_REG_MAP_ACCESS_RW | VSCP_REG_MAP_ACCESS_PROTECTED, vscp_dm_ng_readRegister, vscp_dm_ng_writeRegister, NULL),
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
-/** Register: alarm status */
-static uint8_t          vscp_core_regAlarmStatus    = 0;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
 
-/** Register: page select */
-static uint16_t         vscp_core_regPageSelect     = 0;
+    VSCP_REG_MAP_FUNC(VSCP_CONFIG_BRIDGE_PAGE, 0, VSCP_PS_SIZE_BRIDGE, VSCP_REG_MAP_ACCESS_RW | VSCP_REG_MAP_ACCESS_PROTECTED, vscp_bridge_readRegister, vscp_bridge_writeRegister, NULL),
 
-/** Reset requested or not */
-static BOOL             vscp_core_resetRequested    = FALSE;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
 
-/**
- * Extended page read data, which is used to continue a extended page read in
- * the next process cycle.
- */
-static ExtPageRead      vscp_core_extPageReadData   = { 0, 0, 0, 0 };
+    VSCP_APP_REG_MAP_RANGES
+};
+
+/** Range of every VSCP specific register (page 0, 0x80 - 0xFF) */
+static const uint8_t vscp_core_regStdIndex[] PROGMEM =
+{
+    /* 0x80 - 0x8F */
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_ALARM_STATUS),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_VSCP_VERSION),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_VSCP_VERSION),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_NODE_CONTROL_FLAGS),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_USER_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_USER_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_USER_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_USER_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_USER_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_SUB_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_SUB_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_SUB_DEV_ID),
+
+    /* 0x90 - 0x9F */
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MANUFACTURER_SUB_DEV_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_NICKNAME_ID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_PAGE_SELECT),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_PAGE_SELECT),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_FIRMWARE_VERSION),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_FIRMWARE_VERSION),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_FIRMWARE_VERSION),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_BOOT_LOADER_ALGORITHM),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_BUFFER_SIZE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_PAGES_USED),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_FAMILY_CODE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_FAMILY_CODE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_FAMILY_CODE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_FAMILY_CODE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_TYPE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_TYPE),
+
+    /* 0xA0 - 0xAF */
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_TYPE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_STD_DEV_TYPE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_RESTORE_STD_CFG),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_FIRMWARE_DEVICE_CODE),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_FIRMWARE_DEVICE_CODE),
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+
+    /* 0xB0 - 0xCF: Reserved */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+
+    /* 0xD0 - 0xDF */
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_GUID),
+
+    /* 0xE0 - 0xFF */
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL),
+    VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL), VSCP_CORE_REG_IDX(VSCP_CORE_REG_RANGE_MDF_URL)
+};
+
+/* Every VSCP specific register has an index entry. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_REG_MAP_STD_NUM == VSCP_UTIL_ARRAY_NUM(vscp_core_regStdIndex));
+
+/** Range of all other registers: The application registers */
+static const vscp_reg_map_Range vscp_core_regDefaultRange PROGMEM =
+    VSCP_REG_MAP_FUNC(0, 0, 0, VSCP_REG_MAP_ACCESS_RW | VSCP_REG_MAP_ACCESS_PROTECTED, vscp_app_reg_readRegister, vscp_app_reg_writeRegister, NULL);
+
+/** Register map */
+static const vscp_reg_map_Map vscp_core_regMap =
+{
+    vscp_core_regRanges,
+    vscp_core_regStdIndex,
+    VSCP_CORE_REG_RANGE_FEATURE,
+    (uint8_t)VSCP_UTIL_ARRAY_NUM(vscp_core_regRanges),
+    &vscp_core_regDefaultRange,
+    vscp_core_isRegAppWriteable
+};
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -253,19 +550,48 @@ static ExtPageRead      vscp_core_extPageReadData   = { 0, 0, 0, 0 };
  */
 extern VSCP_CORE_RET vscp_core_init(void)
 {
-    VSCP_CORE_RET   ret = VSCP_CORE_RET_OK;
-
-    /* Initialize persistent memory access */
-    vscp_ps_init();
+    VSCP_CORE_RET   ret     = VSCP_CORE_RET_OK;
+    uint8_t         index   = 0;
 
     /* Initialize timer driver */
     vscp_timer_init();
 
+    /* Initialize persistent memory access. It may use a timer. */
+    vscp_ps_init();
+
     /* Initialize transport layer */
     vscp_transport_init();
 
-    /* Initialize device data */
-    vscp_dev_data_init();
+    /* Initialize the multi-frame streams. They use a timer per received stream. */
+    vscp_segment_init();
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+    /* Initialize the receive acceptance filter */
+    vscp_rx_filter_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+    /* Initialize the event interest */
+    vscp_interest_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+    /* Initialize the embedded MDF */
+    vscp_mdf_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+    /* Initialize the firmware update */
+    vscp_fw_update_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
 
     /* Initialize the application register access */
     vscp_app_reg_init();
@@ -273,6 +599,9 @@ extern VSCP_CORE_RET vscp_core_init(void)
     /* Initialize portable functions */
     vscp_portable_init();
 
+    /* Initialize device data. It may be loaded with the portable functions. */
+    vscp_dev_data_init();
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
 
     /* Initialize decision matrix functions */
@@ -304,63 +633,85 @@ extern VSCP_CORE_RET vscp_core_init(void)
     /* Initialize utilities module */
     vscp_util_init();
 
-    vscp_core_nickname          = vscp_ps_readNicknameId();
-    vscp_core_state             = STATE_STARTUP;
-    vscp_core_initState         = INIT_STATE_PROBE;
-    vscp_core_resetRequested    = FALSE;
+    VSCP_CORE_INST.nickname         = vscp_ps_readNicknameId();
+    VSCP_CORE_INST.state            = STATE_STARTUP;
+    VSCP_CORE_INST.initState        = INIT_STATE_PROBE;
+    VSCP_CORE_INST.resetRequested   = FALSE;
+    VSCP_CORE_INST.isProcessPending = TRUE;
 
-    vscp_core_rxMessage.vscpClass   = VSCP_CLASS_L1_PROTOCOL;
-    vscp_core_rxMessage.vscpType    = VSCP_TYPE_PROTOCOL_GENERAL;
-    vscp_core_rxMessage.priority    = VSCP_PRIORITY_7_LOW;
-    vscp_core_rxMessage.oAddr       = VSCP_NICKNAME_NOT_INIT;
-    vscp_core_rxMessage.hardCoded   = FALSE;
-    vscp_core_rxMessageValid        = FALSE;
+    VSCP_CORE_INST.rxMessageStorage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    VSCP_CORE_INST.rxMessageStorage.vscpType  = VSCP_TYPE_PROTOCOL_GENERAL;
+    VSCP_CORE_INST.rxMessageStorage.priority  = VSCP_PRIORITY_7_LOW;
+    VSCP_CORE_INST.rxMessageStorage.oAddr     = VSCP_NICKNAME_NOT_INIT;
+    VSCP_CORE_INST.rxMessageStorage.hardCoded = FALSE;
+    VSCP_CORE_INST.rxMessage                  = &VSCP_CORE_INST.rxMessageStorage;
+    VSCP_CORE_INST.rxMessageValid             = FALSE;
+    VSCP_CORE_INST.nickname_probe             = VSCP_NICKNAME_NOT_INIT;
 
-    /* Show the user that the node starts up. */
-    vscp_portable_setLampState(VSCP_LAMP_STATE_BLINK_SLOW);
+    /* Load the register mirror of the persistent memory once. */
+    VSCP_CORE_INST.regNodeControlFlags = vscp_ps_readNodeControlFlags();
 
-    /* Create a timer for common timing issues */
-    vscp_core_timerId = vscp_timer_create();
-    if (VSCP_TIMER_ID_INVALID == vscp_core_timerId)
+    for(index = 0; index < VSCP_PS_SIZE_USER_ID; ++index)
     {
-        /* No timer available. */
-        ret = VSCP_CORE_RET_ERROR;
+        VSCP_CORE_INST.regUserId[index] = vscp_ps_readUserId(index);
     }
 
-    /* Create a timer for GUID drop nickname multi-frame timeout. */
-    vscp_core_timerIdGuidDropNickname = vscp_timer_create();
-    if (VSCP_TIMER_ID_INVALID == vscp_core_timerIdGuidDropNickname)
+    VSCP_CORE_INST.regRspDrops = 0;
+    vscp_core_initRegRsp();
+
+    /* Show the user that the node starts up. */
+    vscp_portable_setLampState(VSCP_LAMP_STATE_BLINK_SLOW);
+
+    /* Create a timer for common timing issues */
+    VSCP_CORE_INST.timerId = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == VSCP_CORE_INST.timerId)
     {
         /* No timer available. */
         ret = VSCP_CORE_RET_ERROR;
     }
 
     /* Create a timer for vscp register 162 multi-frame timeout. */
-    vscp_core_timerIdReg162 = vscp_timer_create();
-    if (VSCP_TIMER_ID_INVALID == vscp_core_timerIdReg162)
+    VSCP_CORE_INST.timerIdReg162 = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == VSCP_CORE_INST.timerIdReg162)
     {
         /* No timer available. */
         ret = VSCP_CORE_RET_ERROR;
     }
 
     /* Create a timer used to drive the internal time since epoch (unix timestamp). */
-    vscp_core_timerIdTimeSinceEpoch = vscp_timer_create();
-    if (VSCP_TIMER_ID_INVALID == vscp_core_timerIdTimeSinceEpoch)
+    VSCP_CORE_INST.timerIdTimeSinceEpoch = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == VSCP_CORE_INST.timerIdTimeSinceEpoch)
     {
         /* No timer available. */
         ret = VSCP_CORE_RET_ERROR;
     }
     else
     {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+        /* The time since epoch keeps counting, even if the node sleeps.
+         * Therefore it shall not wake up the node every second.
+         */
+        vscp_timer_setCallback(VSCP_CORE_INST.timerIdTimeSinceEpoch, vscp_core_timeSinceEpochCallback);
+        vscp_timer_setLazy(VSCP_CORE_INST.timerIdTimeSinceEpoch, TRUE);
+        vscp_timer_startPeriodic(VSCP_CORE_INST.timerIdTimeSinceEpoch, VSCP_CORE_TIMER_THRESHOLD_1S);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
         /* Start timer immediately. */
-        vscp_timer_start(vscp_core_timerIdTimeSinceEpoch, VSCP_CORE_TIMER_THRESHOLD_1S);
+        vscp_timer_start(VSCP_CORE_INST.timerIdTimeSinceEpoch, VSCP_CORE_TIMER_THRESHOLD_1S);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
     }
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
+    /* The node heartbeat is enabled by default. */
+    VSCP_CORE_INST.isHeartbeatEnabled = TRUE;
+
     /* Create a timer for own heartbeat */
-    vscp_core_heartbeatTimerId = vscp_timer_create();
-    if (VSCP_TIMER_ID_INVALID == vscp_core_heartbeatTimerId)
+    VSCP_CORE_INST.heartbeatTimerId = vscp_timer_create();
+    if (VSCP_TIMER_ID_INVALID == VSCP_CORE_INST.heartbeatTimerId)
     {
         /* No timer available. */
         ret = VSCP_CORE_RET_ERROR;
@@ -399,13 +750,11 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
 {
     uint8_t index   = 0;
 
-    vscp_core_regAlarmStatus    = 0;
-    vscp_core_regPageSelect     = 0;
+    VSCP_CORE_INST.regAlarmStatus = 0;
+    VSCP_CORE_INST.regPageSelect  = 0;
 
-    vscp_core_extPageReadData.page  = 0;
-    vscp_core_extPageReadData.addr  = 0;
-    vscp_core_extPageReadData.count = 0;
-    vscp_core_extPageReadData.seq   = 0;
+    /* Abort all register responses, which are in progress. */
+    vscp_core_initRegRsp();
 
     /* Clear nickname id */
     vscp_core_writeNicknameId(VSCP_NICKNAME_NOT_INIT);
@@ -420,11 +769,13 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
     /* Wait for explicit initialization and remove application registers
      * write protection.
      */
-    vscp_ps_writeNodeControlFlags(VSCP_NODE_CONTROL_FLAGS_DEFAULT);
+    VSCP_CORE_INST.regNodeControlFlags = VSCP_NODE_CONTROL_FLAGS_DEFAULT;
+    vscp_ps_writeNodeControlFlags(VSCP_CORE_INST.regNodeControlFlags);
 
     /* Reset user id */
     for(index = 0; index < VSCP_PS_SIZE_USER_ID; ++index)
     {
+        VSCP_CORE_INST.regUserId[index] = 0;
         vscp_ps_writeUserId(index, 0);
     }
 
@@ -444,6 +795,13 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+    /* Restore the bridge routing table factory default settings */
+    vscp_bridge_restoreFactoryDefaultSettings();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
     /* Restore application register factory default settings */
     vscp_app_reg_restoreFactoryDefaultSettings();
 
@@ -458,43 +816,73 @@ extern void vscp_core_restoreFactoryDefaultSettings(void)
  * cyclic period.
  *
  * Note, for a fast handling of received events, this function returns TRUE in
- * case a event was handled partly or completely, otherwise FALSE.
- * Call it e.g. in a loop until no event is handled anymore. If its not
+ * case a event was received or a response was sent, otherwise FALSE.
+ * Call it e.g. in a loop until no progress is made anymore. If its not
  * necessary in your application, just skip the return value.
+ * Work, which waits for the transport layer, is not reported as progress, but
+ * by vscp_core_getTimeToProcess().
  *
- * @return If a received event was handled, it will return TRUE otherwise FALSE.
+ * @return If a event was received or a response was sent, it will return TRUE otherwise FALSE.
  */
 extern BOOL vscp_core_process(void)
 {
-    BOOL isEventHandled = FALSE;
+    BOOL        isEventHandled  = FALSE;
+    STATE       state           = VSCP_CORE_INST.state;
+    INIT_STATE  initState       = VSCP_CORE_INST.initState;
 
     /* Get any received message.
      * Note, only in the active state all received messages are processed.
      * In the other ones it depends on their sub state.
+     * As long as the register response queue is full, no further event is
+     * taken, because its response could not be queued anymore.
      */
-    vscp_core_rxMessageValid = vscp_transport_readMessage(&vscp_core_rxMessage);
-    isEventHandled = vscp_core_rxMessageValid;
+    if ((STATE_ACTIVE == VSCP_CORE_INST.state) &&
+        (TRUE == vscp_core_isRegRspQueueFull()))
+    {
+        VSCP_CORE_INST.rxMessage = NULL;
+    }
+    else
+    {
+        VSCP_CORE_INST.rxMessage = vscp_transport_borrowMessage(&VSCP_CORE_INST.rxMessageStorage);
+    }
+
+    if (NULL == VSCP_CORE_INST.rxMessage)
+    {
+        VSCP_CORE_INST.rxMessage      = &VSCP_CORE_INST.rxMessageStorage;
+        VSCP_CORE_INST.rxMessageValid = FALSE;
+    }
+    else
+    {
+        VSCP_CORE_INST.rxMessageValid    = TRUE;
+    }
+
+    isEventHandled                  = VSCP_CORE_INST.rxMessageValid;
+    VSCP_CORE_INST.isEventReceived  = VSCP_CORE_INST.rxMessageValid;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
 
     /* Handle early as possible any kind of log control messages. */
-    vscp_logger_handleEvent(&vscp_core_rxMessage);
+    vscp_logger_handleEvent(VSCP_CORE_INST.rxMessage);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER ) */
 
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
     /* Handle internal time since epoch (unix timestamp), which increase per second. */
-    if ((VSCP_TIMER_ID_INVALID != vscp_core_timerIdTimeSinceEpoch) &&
-        (FALSE == vscp_timer_getStatus(vscp_core_timerIdTimeSinceEpoch)))
+    if ((VSCP_TIMER_ID_INVALID != VSCP_CORE_INST.timerIdTimeSinceEpoch) &&
+        (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.timerIdTimeSinceEpoch)))
     {
         /* Increase unix timestamp */
-        ++vscp_core_timeSinceEpoch;
+        ++VSCP_CORE_INST.timeSinceEpoch;
 
         /* Restart timer */
-        vscp_timer_start(vscp_core_timerIdTimeSinceEpoch, VSCP_CORE_TIMER_THRESHOLD_1S);
+        vscp_timer_start(VSCP_CORE_INST.timerIdTimeSinceEpoch, VSCP_CORE_TIMER_THRESHOLD_1S);
     }
 
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
     /* State machine */
-    switch(vscp_core_state)
+    switch(VSCP_CORE_INST.state)
     {
     /* VSCP is initialized, what about the nickname id? */
     case STATE_STARTUP:
@@ -515,7 +903,7 @@ extern BOOL vscp_core_process(void)
     case STATE_ACTIVE:
         if (TRUE == vscp_core_stateActive())
         {
-            /* An extended page read may need more cycles to complete. */
+            /* Responses were sent. */
             isEventHandled = TRUE;
         }
         break;
@@ -542,12 +930,86 @@ extern BOOL vscp_core_process(void)
         break;
     }
 
-    /* Invalidate received message */
-    vscp_core_rxMessageValid = FALSE;
+    /* Give a borrowed message back to the transport layer and invalidate it. */
+    if (TRUE == VSCP_CORE_INST.rxMessageValid)
+    {
+        vscp_transport_releaseMessage(VSCP_CORE_INST.rxMessage);
+    }
+
+    VSCP_CORE_INST.rxMessage      = &VSCP_CORE_INST.rxMessageStorage;
+    VSCP_CORE_INST.rxMessageValid = FALSE;
+
+    /* Send queued messages, as long as the lower layer accepts them. */
+    vscp_transport_process();
+
+    /* Write cached persistent memory data back, preferred in idle time. */
+    vscp_ps_process(FALSE == isEventHandled);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+    /* Provide changed acceptance filters to the transport, in idle time. */
+    vscp_rx_filter_process(FALSE == isEventHandled);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+    /* A handled event, a state change or responses, which wait for the
+     * transport layer, may lead to more work in the next cycle, without any
+     * timer involved.
+     */
+    if ((TRUE == isEventHandled) ||
+        (state != VSCP_CORE_INST.state) ||
+        (initState != VSCP_CORE_INST.initState) ||
+        ((STATE_ACTIVE == VSCP_CORE_INST.state) &&
+         ((TRUE == vscp_core_isRegRspPending()) ||
+          (TRUE == VSCP_CORE_INST.whoIsThereRspPending) ||
+          (TRUE == vscp_segment_isPending()))))
+    {
+        VSCP_CORE_INST.isProcessPending = TRUE;
+    }
+    else
+    {
+        VSCP_CORE_INST.isProcessPending = FALSE;
+    }
 
     return isEventHandled;
 }
 
+/**
+ * This function determines whether the last vscp_core_process() cycle received
+ * a event. In contrast to the return value of vscp_core_process(), responses
+ * which are sent without a received event are not considered.
+ *
+ * @return If a event was received, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_core_isEventReceived(void)
+{
+    return VSCP_CORE_INST.isEventReceived;
+}
+
+/**
+ * This function returns the time until the core stack has to be processed
+ * again. Until then, vscp_core_process() would have nothing to do and the
+ * node may sleep. A event, which is received in the meantime, needs to wake
+ * it up.
+ *
+ * If VSCP_CONFIG_TIMER_DEADLINE is disabled, the time is in ticks of
+ * vscp_timer_process().
+ *
+ * @return Time in ms, 0 if the core stack has to be processed immediately or VSCP_TIMER_NO_EXPIRY if no timer is running.
+ */
+extern uint32_t vscp_core_getTimeToProcess(void)
+{
+    uint32_t    timeToProcess   = 0;
+
+    if ((FALSE == VSCP_CORE_INST.isProcessPending) &&
+        (FALSE == vscp_transport_isProcessPending()))
+    {
+        timeToProcess = vscp_timer_getTimeToExpiry();
+    }
+
+    return timeToProcess;
+}
+
 /**
  * This function reads the nickname id of the node.
  *
@@ -555,7 +1017,7 @@ extern BOOL vscp_core_process(void)
  */
 extern uint8_t  vscp_core_readNicknameId(void)
 {
-    return vscp_core_nickname;
+    return VSCP_CORE_INST.nickname;
 }
 
 /**
@@ -568,10 +1030,12 @@ extern void vscp_core_startNodeSegmentInit(void)
      * see VSCP specification, chapter VSCP Level I Specifics,
      * Node segment initialization. Dynamic nodes, Step 1
      */
-    if (STATE_INIT != vscp_core_state)
+    if (STATE_INIT != VSCP_CORE_INST.state)
     {
         /* Change to init state */
         vscp_core_changeToStateInit(TRUE);
+
+        VSCP_CORE_INST.isProcessPending = TRUE;
     }
 
     return;
@@ -587,7 +1051,7 @@ extern void vscp_core_startNodeSegmentInit(void)
  */
 extern void vscp_core_setAlarm(uint8_t value)
 {
-    vscp_core_regAlarmStatus |= value;
+    VSCP_CORE_INST.regAlarmStatus |= value;
 
     return;
 }
@@ -602,7 +1066,23 @@ extern void vscp_core_setAlarm(uint8_t value)
  */
 extern BOOL vscp_core_isActive(void)
 {
-    return (STATE_ACTIVE == vscp_core_state) ? TRUE : FALSE;
+    return (STATE_ACTIVE == VSCP_CORE_INST.state) ? TRUE : FALSE;
+}
+
+/**
+ * This function returns the number of register responses, which were dropped,
+ * because the register response queue was full.
+ * Note, that calling this function clears the drop counter.
+ *
+ * @return Number of dropped register responses
+ */
+extern uint16_t vscp_core_getRegRspDrops(void)
+{
+    uint16_t    drops   = VSCP_CORE_INST.regRspDrops;
+
+    VSCP_CORE_INST.regRspDrops = 0;
+
+    return drops;
 }
 
 /**
@@ -613,7 +1093,7 @@ extern BOOL vscp_core_isActive(void)
  */
 extern uint32_t vscp_core_getTimeSinceEpoch(void)
 {
-    return vscp_core_timeSinceEpoch;
+    return VSCP_CORE_INST.timeSinceEpoch;
 }
 
 /**
@@ -625,7 +1105,7 @@ extern uint32_t vscp_core_getTimeSinceEpoch(void)
  */
 extern void vscp_core_setTimeSinceEpoch(uint32_t timestamp)
 {
-    vscp_core_timeSinceEpoch = timestamp;
+    VSCP_CORE_INST.timeSinceEpoch = timestamp;
     return;
 }
 
@@ -652,7 +1132,7 @@ extern void vscp_core_prepareTxMessage(vscp_TxMessage * const txMessage, uint16_
         txMessage->vscpClass    = vscpClass;
         txMessage->vscpType     = vscpType;
         txMessage->priority     = priority;
-        txMessage->oAddr        = vscp_core_nickname;
+        txMessage->oAddr        = VSCP_CORE_INST.nickname;
         txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
         txMessage->dataSize     = 0;
     }
@@ -675,6 +1155,59 @@ extern BOOL vscp_core_sendEvent(vscp_TxMessage const * const txMessage)
     return vscp_transport_writeMessage(txMessage);
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function prepares a Level II transmit message with default values.
+ *
+ * Default values:
+ * - Nodes GUID
+ * - No data
+ *
+ * The data itself is not touched. It may be a block of the payload pool,
+ * see vscp_l2_alloc(), or a buffer of the application.
+ *
+ * @param[in,out]   txMessage   Transmit message which will be prepared.
+ * @param[in]       vscpClass   Transmit message VSCP class
+ * @param[in]       vscpType    Transmit message VSCP type
+ * @param[in]       priority    Transmit message priority
+ */
+extern void vscp_core_prepareL2Message(vscp_L2Message * const txMessage, uint16_t vscpClass, uint16_t vscpType, VSCP_PRIORITY priority)
+{
+    uint8_t index   = 0;
+
+    if (NULL != txMessage)
+    {
+        txMessage->vscpClass    = vscpClass;
+        txMessage->vscpType     = vscpType;
+        txMessage->priority     = priority;
+        txMessage->dataSize     = 0;
+
+        /* The GUID is sent MSB first. */
+        for(index = 0; index < VSCP_GUID_SIZE; ++index)
+        {
+            txMessage->guid[index] = vscp_dev_data_getGUID(VSCP_GUID_SIZE - 1 - index);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Send a Level II event to the communication bus.
+ *
+ * @param[in]   txMessage   The event which will be sent.
+ * @return Status
+ * @retval FALSE    Failed to send the event.
+ * @retval TRUE     Event successful sent.
+ */
+extern BOOL vscp_core_sendL2Event(vscp_L2Message const * const txMessage)
+{
+    return vscp_transport_writeL2Message(txMessage);
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
 /**
@@ -684,13 +1217,13 @@ extern BOOL vscp_core_sendEvent(vscp_TxMessage const * const txMessage)
  */
 extern void vscp_core_enableHeartbeat(BOOL enableIt)
 {
-    if (FALSE == vscp_core_isHeartbeatEnabled)
+    if (FALSE == VSCP_CORE_INST.isHeartbeatEnabled)
     {
-        vscp_core_isHeartbeatEnabled = TRUE;
+        VSCP_CORE_INST.isHeartbeatEnabled = TRUE;
     }
     else
     {
-        vscp_core_isHeartbeatEnabled = FALSE;
+        VSCP_CORE_INST.isHeartbeatEnabled = FALSE;
     }
 
     return;
@@ -715,7 +1248,7 @@ static void vscp_core_writeNicknameId(uint8_t nickname)
     /* Read it back from persistent memory. This is done to be sure to provide
      * really the one, which is stored.
      */
-    vscp_core_nickname = vscp_ps_readNicknameId();
+    VSCP_CORE_INST.nickname = vscp_ps_readNicknameId();
 
     return;
 }
@@ -755,18 +1288,18 @@ static inline void  vscp_core_stateStartup(void)
      * If no nickname is assigned, the node will be set to initialization
      * state. Otherwise to active state.
      */
-    if (VSCP_NICKNAME_NOT_INIT == vscp_core_nickname)
+    if (VSCP_NICKNAME_NOT_INIT == VSCP_CORE_INST.nickname)
     {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_SILENT_NODE )
 
         /* Valid message? */
-        if (TRUE == vscp_core_rxMessageValid)
+        if (TRUE == VSCP_CORE_INST.rxMessageValid)
         {
             /* Be silent as long as someone request the initialization with a
                CLASS1.PROTOCOL GUID drop nickname-ID / reset event.
              */
-            if ((VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass) &&
-                (VSCP_TYPE_PROTOCOL_RESET_DEVICE == vscp_core_rxMessage.vscpType))
+            if ((VSCP_CLASS_L1_PROTOCOL == VSCP_CORE_INST.rxMessage->vscpClass) &&
+                (VSCP_TYPE_PROTOCOL_RESET_DEVICE == VSCP_CORE_INST.rxMessage->vscpType))
             {
                 vscp_core_handleProtocolGuidDropNickname();
             }
@@ -806,22 +1339,22 @@ static inline void  vscp_core_stateStartup(void)
  */
 static inline void  vscp_core_changeToStateInit(BOOL probeSegmentMaster)
 {
-    if (STATE_INIT != vscp_core_state)
+    if (STATE_INIT != VSCP_CORE_INST.state)
     {
         /* Show the user that the node enters initialization state by blinking lamp. */
         vscp_portable_setLampState(VSCP_LAMP_STATE_BLINK_FAST);
 
-        vscp_core_state = STATE_INIT;
+        VSCP_CORE_INST.state = STATE_INIT;
 
         if (FALSE == probeSegmentMaster)
         {
-            vscp_core_initState = INIT_STATE_PROBE;
-            vscp_core_nickname_probe = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
+            VSCP_CORE_INST.initState = INIT_STATE_PROBE;
+            VSCP_CORE_INST.nickname_probe = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
         }
         else
         {
-            vscp_core_initState = INIT_STATE_PROBE_MASTER;
-            vscp_core_nickname_probe = VSCP_NICKNAME_SEGMENT_MASTER;
+            VSCP_CORE_INST.initState = INIT_STATE_PROBE_MASTER;
+            VSCP_CORE_INST.nickname_probe = VSCP_NICKNAME_SEGMENT_MASTER;
         }
 
         /* Clear nickname id */
@@ -842,7 +1375,7 @@ static inline void  vscp_core_stateInit(void)
     vscp_TxMessage  txMessage;
 
     /* Process sub state machine */
-    switch(vscp_core_initState)
+    switch(VSCP_CORE_INST.initState)
     {
     case INIT_STATE_PROBE_MASTER:
 
@@ -853,7 +1386,7 @@ static inline void  vscp_core_stateInit(void)
         txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
         txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE;
         txMessage.priority  = VSCP_PRIORITY_7_LOW;
-        txMessage.oAddr     = vscp_core_nickname;
+        txMessage.oAddr     = VSCP_CORE_INST.nickname;
         txMessage.hardCoded = VSCP_CORE_HARD_CODED;
         txMessage.dataSize  = 1;
         txMessage.data[0]   = VSCP_NICKNAME_SEGMENT_MASTER;
@@ -865,10 +1398,10 @@ static inline void  vscp_core_stateInit(void)
         }
         else
         {
-            vscp_core_initState = INIT_STATE_PROBE_MASTER_WAIT;
+            VSCP_CORE_INST.initState = INIT_STATE_PROBE_MASTER_WAIT;
 
             /* Start timer to observe the node segment initialization */
-            vscp_timer_start(vscp_core_timerId, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT);
+            vscp_timer_start(VSCP_CORE_INST.timerId, VSCP_CONFIG_NODE_SEGMENT_INIT_TIMEOUT);
         }
 
         break;
@@ -876,24 +1409,24 @@ static inline void  vscp_core_stateInit(void)
     case INIT_STATE_PROBE_MASTER_WAIT:
 
         /* Timeout, because no segment master available? */
-        if (FALSE == vscp_timer_getStatus(vscp_core_timerId))
+        if (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.timerId))
         {
             /* Start nickname id discovery process */
-            vscp_core_initState = INIT_STATE_PROBE;
+            VSCP_CORE_INST.initState = INIT_STATE_PROBE;
 
             /* Probe shall start with nickname id 1. */
-            vscp_core_nickname_probe = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
+            VSCP_CORE_INST.nickname_probe = VSCP_CONFIG_START_NODE_PROBE_NICKNAME;
         }
         /* Valid message received */
-        else if (TRUE == vscp_core_rxMessageValid)
+        else if (TRUE == VSCP_CORE_INST.rxMessageValid)
         {
-            if (VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass)
+            if (VSCP_CLASS_L1_PROTOCOL == VSCP_CORE_INST.rxMessage->vscpClass)
             {
                 /* Probe event acknowledge? */
-                if (VSCP_TYPE_PROTOCOL_PROBE_ACK == vscp_core_rxMessage.vscpType)
+                if (VSCP_TYPE_PROTOCOL_PROBE_ACK == VSCP_CORE_INST.rxMessage->vscpType)
                 {
                     /* Acknowledge from the segment master? */
-                    if (VSCP_NICKNAME_SEGMENT_MASTER == vscp_core_rxMessage.oAddr)
+                    if (VSCP_NICKNAME_SEGMENT_MASTER == VSCP_CORE_INST.rxMessage->oAddr)
                     {
                         /* Wait for nickname id assignment and don't stop the timer,
                          * because the next state is still part of it.
@@ -919,10 +1452,10 @@ static inline void  vscp_core_stateInit(void)
         txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
         txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE;
         txMessage.priority  = VSCP_PRIORITY_7_LOW;
-        txMessage.oAddr     = vscp_core_nickname;
+        txMessage.oAddr     = VSCP_CORE_INST.nickname;
         txMessage.hardCoded = VSCP_CORE_HARD_CODED;
         txMessage.dataSize  = 1;
-        txMessage.data[0]   = vscp_core_nickname_probe;
+        txMessage.data[0]   = VSCP_CORE_INST.nickname_probe;
 
         if (FALSE == vscp_transport_writeMessage(&txMessage))
         {
@@ -930,20 +1463,20 @@ static inline void  vscp_core_stateInit(void)
             ;
         }
         /* Abort now, because the segment is full (of nodes)? */
-        else if (VSCP_NICKNAME_NOT_INIT == vscp_core_nickname_probe)
+        else if (VSCP_NICKNAME_NOT_INIT == VSCP_CORE_INST.nickname_probe)
         {
             /* Stop timer */
-            vscp_timer_stop(vscp_core_timerId);
+            vscp_timer_stop(VSCP_CORE_INST.timerId);
 
             /* Go offline, because segment is full. */
             vscp_core_changeToStateIdle();
         }
         else
         {
-            vscp_core_initState = INIT_STATE_PROBE_WAIT;
+            VSCP_CORE_INST.initState = INIT_STATE_PROBE_WAIT;
 
             /* Start timer to avoid that we wait infinite for the probe acknowledge. */
-            vscp_timer_start(vscp_core_timerId, VSCP_CONFIG_PROBE_ACK_TIMEOUT);
+            vscp_timer_start(VSCP_CORE_INST.timerId, VSCP_CONFIG_PROBE_ACK_TIMEOUT);
         }
 
         break;
@@ -951,26 +1484,26 @@ static inline void  vscp_core_stateInit(void)
     case INIT_STATE_PROBE_WAIT:
 
         /* Timeout, because no other node uses the nickname id? */
-        if (FALSE == vscp_timer_getStatus(vscp_core_timerId))
+        if (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.timerId))
         {
             /* Available nickname id found. */
-            vscp_core_writeNicknameId(vscp_core_nickname_probe);
+            vscp_core_writeNicknameId(VSCP_CORE_INST.nickname_probe);
 
             vscp_core_changeToStateActive();
         }
         /* Valid message received */
-        else if (TRUE == vscp_core_rxMessageValid)
+        else if (TRUE == VSCP_CORE_INST.rxMessageValid)
         {
-            if (VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass)
+            if (VSCP_CLASS_L1_PROTOCOL == VSCP_CORE_INST.rxMessage->vscpClass)
             {
                 /* Probe event acknowledge? */
-                if (VSCP_TYPE_PROTOCOL_PROBE_ACK == vscp_core_rxMessage.vscpType)
+                if (VSCP_TYPE_PROTOCOL_PROBE_ACK == VSCP_CORE_INST.rxMessage->vscpType)
                 {
                     /* Acknowledge from a node, which has the probed nickname id? */
-                    if (vscp_core_nickname_probe == vscp_core_rxMessage.oAddr)
+                    if (VSCP_CORE_INST.nickname_probe == VSCP_CORE_INST.rxMessage->oAddr)
                     {
                         /* Stop timer */
-                        vscp_timer_stop(vscp_core_timerId);
+                        vscp_timer_stop(VSCP_CORE_INST.timerId);
 
                         /* Try next nickname id.
                          * Note that sending a nickname of VSCP_NICKNAME_NOT_INIT,
@@ -978,9 +1511,9 @@ static inline void  vscp_core_stateInit(void)
                          * See VSCP specification, chapter Level I Events,
                          * CLASS1.PROTOCOL, Type=2 (0x02) New node on line / Probe
                          */
-                        ++vscp_core_nickname_probe;
+                        ++VSCP_CORE_INST.nickname_probe;
 
-                        vscp_core_initState = INIT_STATE_PROBE;
+                        VSCP_CORE_INST.initState = INIT_STATE_PROBE;
                     }
                     else
                     {
@@ -1008,7 +1541,7 @@ static inline void  vscp_core_stateInit(void)
  */
 static inline void  vscp_core_changeToStatePreActive(void)
 {
-    vscp_core_state = STATE_PREACTIVE;
+    VSCP_CORE_INST.state = STATE_PREACTIVE;
 
     return;
 }
@@ -1020,33 +1553,33 @@ static inline void  vscp_core_changeToStatePreActive(void)
 static inline void  vscp_core_statePreActive(void)
 {
     /* Timeout? Note, the timer was started in init state. */
-    if (FALSE == vscp_timer_getStatus(vscp_core_timerId))
+    if (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.timerId))
     {
         /* No nickname id received, start own nickname discovery. */
         vscp_core_changeToStateInit(FALSE);
     }
     /* Valid message received */
-    else if (TRUE == vscp_core_rxMessageValid)
+    else if (TRUE == VSCP_CORE_INST.rxMessageValid)
     {
-        if (VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass)
+        if (VSCP_CLASS_L1_PROTOCOL == VSCP_CORE_INST.rxMessage->vscpClass)
         {
             /* Nickname id from the segment master? */
-            if ((VSCP_TYPE_PROTOCOL_SET_NICKNAME == vscp_core_rxMessage.vscpType) &&
-                (VSCP_NICKNAME_SEGMENT_MASTER == vscp_core_rxMessage.oAddr) &&
-                (VSCP_NICKNAME_NOT_INIT == vscp_core_rxMessage.data[0]))
+            if ((VSCP_TYPE_PROTOCOL_SET_NICKNAME == VSCP_CORE_INST.rxMessage->vscpType) &&
+                (VSCP_NICKNAME_SEGMENT_MASTER == VSCP_CORE_INST.rxMessage->oAddr) &&
+                (VSCP_NICKNAME_NOT_INIT == VSCP_CORE_INST.rxMessage->data[0]))
             {
                 vscp_TxMessage  txMessage;
 
                 /* Stop timer */
-                vscp_timer_stop(vscp_core_timerId);
+                vscp_timer_stop(VSCP_CORE_INST.timerId);
 
                 /* Set nickname, respond to segment master and go active */
-                vscp_core_writeNicknameId(vscp_core_rxMessage.data[1]);
+                vscp_core_writeNicknameId(VSCP_CORE_INST.rxMessage->data[1]);
 
                 txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
                 txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NICKNAME_ACCEPTED;
                 txMessage.priority  = VSCP_PRIORITY_7_LOW;
-                txMessage.oAddr     = vscp_core_nickname;
+                txMessage.oAddr     = VSCP_CORE_INST.nickname;
                 txMessage.hardCoded = VSCP_CORE_HARD_CODED;
                 txMessage.dataSize  = 0;
 
@@ -1074,31 +1607,31 @@ static inline void  vscp_core_statePreActive(void)
  */
 static inline void  vscp_core_changeToStateActive(void)
 {
-    if (STATE_ACTIVE != vscp_core_state)
+    if (STATE_ACTIVE != VSCP_CORE_INST.state)
     {
         vscp_TxMessage  txMessage;
 
         /* Show the user that the node enters active state by enable the lamp. */
         vscp_portable_setLampState(VSCP_LAMP_STATE_ON);
 
-        vscp_core_state = STATE_ACTIVE;
+        VSCP_CORE_INST.state = STATE_ACTIVE;
 
         txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
         txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE;
         txMessage.priority  = VSCP_PRIORITY_0_HIGH;
-        txMessage.oAddr     = vscp_core_nickname;
+        txMessage.oAddr     = VSCP_CORE_INST.nickname;
         txMessage.hardCoded = VSCP_CORE_HARD_CODED;
         txMessage.dataSize  = 1;
-        txMessage.data[0]   = vscp_core_nickname;
+        txMessage.data[0]   = VSCP_CORE_INST.nickname;
 
         (void)vscp_transport_writeMessage(&txMessage);
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
-        if (FALSE != vscp_core_isHeartbeatEnabled)
+        if (FALSE != VSCP_CORE_INST.isHeartbeatEnabled)
         {
             /* Start timer for node heartbeat */
-            vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+            vscp_timer_start(VSCP_CORE_INST.heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
         }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
@@ -1111,64 +1644,37 @@ static inline void  vscp_core_changeToStateActive(void)
 /**
  * Handles the active state.
  * 
- * @return If a event is handled partly or completely, it will return TRUE oterhwise FALSE.
+ * @return If a event is handled partly or completely or a response was sent, it will return TRUE oterhwise FALSE.
  */
 static inline BOOL  vscp_core_stateActive(void)
 {
     BOOL isEventHandled = FALSE;
 
     /* Valid message? */
-    if (TRUE == vscp_core_rxMessageValid)
+    if (TRUE == VSCP_CORE_INST.rxMessageValid)
     {
-        /* Handle all protocol class specific events. This is mandatory for L1 and L2 nodes. */
-        if (VSCP_CLASS_L1_PROTOCOL == vscp_core_rxMessage.vscpClass)
-        {
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION )
-
-            /* Notify application about event.
-             * If application handles event, the core will not handle it.
-             */
-            if (FALSE == vscp_portable_provideProtocolEvent(&vscp_core_rxMessage))
-            {
-                vscp_core_handleProtocolClassType();
-            }
-
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION ) */
+        vscp_core_handleEvent();
 
-            vscp_core_handleProtocolClassType();
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION ) */
-        }
-        else
-        /* Notify application */
-        {
-            vscp_portable_provideEvent(&vscp_core_rxMessage);
-        }
-
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-
-        /* Execute actions of the decision matrix (standard + extension) */
-        vscp_dm_executeActions(&vscp_core_rxMessage);
-
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
-
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-
-        /* Execute actions of the decision matrix next generation */
-        vscp_dm_ng_executeActions(&vscp_core_rxMessage);
+        isEventHandled = TRUE;
+    }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
 
+    /* Level II events are handled, if no Level I event was received. */
+    else if (TRUE == vscp_core_handleL2Event())
+    {
         isEventHandled = TRUE;
     }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
     /* Send periodically the node heartbeat.
      * Note that sending the node heartbeat shall not be synchronized to the segment heartbeat!
      */
-    if ((FALSE != vscp_core_isHeartbeatEnabled) &&
-        (FALSE == vscp_timer_getStatus(vscp_core_heartbeatTimerId)))
+    if ((FALSE != VSCP_CORE_INST.isHeartbeatEnabled) &&
+        (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.heartbeatTimerId)))
     {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT )
         (void)vscp_portable_sendNodeHeartbeatEvent();
@@ -1177,32 +1683,160 @@ static inline BOOL  vscp_core_stateActive(void)
 #endif
 
         /* Restart timer */
-        vscp_timer_start(vscp_core_heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
+        vscp_timer_start(VSCP_CORE_INST.heartbeatTimerId, VSCP_CONFIG_HEARTBEAT_NODE_PERIOD);
     }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
-    /* Continue a extended page read? */
-    if (0 < vscp_core_extPageReadData.count)
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+    /* Program the received firmware blocks in the background. */
     {
-        vscp_core_extendedPageReadRegister(&vscp_core_extPageReadData);
-        isEventHandled = TRUE;
+        vscp_TxMessage  txMessage;
+
+        if (TRUE == vscp_fw_update_process(&txMessage))
+        {
+            vscp_core_sendFwUpdateRsp(&txMessage);
+        }
+
+        if (TRUE == vscp_fw_update_isBusy())
+        {
+            isEventHandled = TRUE;
+        }
     }
 
-    return isEventHandled;
-}
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+    /* Continue sending the register responses, e.g. of a page read.
+     * Responses, which are refused by the transport layer, are no progress.
+     */
+    if (TRUE == vscp_core_processRegRsp())
+    {
+        isEventHandled = TRUE;
+    }
+
+    /* Queue a deferred who is there response, if a stream is free again. */
+    if (TRUE == VSCP_CORE_INST.whoIsThereRspPending)
+    {
+        vscp_core_sendWhoIsThereRsp();
+    }
+
+    /* Continue sending the multi-frame streams, e.g. a who is there response. */
+    if (TRUE == vscp_segment_process())
+    {
+        isEventHandled = TRUE;
+    }
+
+    return isEventHandled;
+}
+
+/**
+ * Handle the received event in the active state. All protocol class events
+ * are handled by the core, all other ones are provided to the application.
+ * Both are provided to the decision matrices.
+ */
+static void vscp_core_handleEvent(void)
+{
+    /* Handle all protocol class specific events. This is mandatory for L1 and L2 nodes. */
+    if (VSCP_CLASS_L1_PROTOCOL == VSCP_CORE_INST.rxMessage->vscpClass)
+    {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION )
+
+        /* Notify application about event.
+         * If application handles event, the core will not handle it.
+         */
+        if (FALSE == vscp_portable_provideProtocolEvent(VSCP_CORE_INST.rxMessage))
+        {
+            vscp_core_handleProtocolClassType();
+        }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION ) */
+
+        vscp_core_handleProtocolClassType();
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION ) */
+    }
+    else
+    /* Notify application */
+    {
+        vscp_portable_provideEvent(VSCP_CORE_INST.rxMessage);
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    /* Execute actions of the decision matrix (standard + extension) */
+    vscp_dm_executeActions(VSCP_CORE_INST.rxMessage);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+    /* Execute actions of the decision matrix next generation */
+    vscp_dm_ng_executeActions(VSCP_CORE_INST.rxMessage);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * Receive and handle a Level II event. A Level I event is handled like a
+ * received Level I event. All other ones are provided to the application and
+ * to the decision matrix next generation, which sees the 16-bit class, the
+ * type and the first data bytes.
+ *
+ * @return If a event was handled, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_core_handleL2Event(void)
+{
+    vscp_L2Message  l2Msg;
+
+    if (FALSE == vscp_transport_readL2Message(&l2Msg))
+    {
+        return FALSE;
+    }
+
+    VSCP_CORE_INST.rxMessage = &VSCP_CORE_INST.rxMessageStorage;
+
+    if (TRUE == vscp_l2_toL1(&l2Msg, &VSCP_CORE_INST.rxMessageStorage))
+    {
+        vscp_core_handleEvent();
+    }
+    else
+    {
+        vscp_portable_provideL2Event(&l2Msg);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+        /* The decision matrix can't compare types above 8 bit. */
+        if (0xFF >= l2Msg.vscpType)
+        {
+            vscp_dm_ng_executeActions(VSCP_CORE_INST.rxMessage);
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+    }
+
+    vscp_l2_free(&l2Msg);
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
 
 /**
  * Change to idle state.
  */
 static inline void  vscp_core_changeToStateIdle(void)
 {
-    if (STATE_IDLE != vscp_core_state)
+    if (STATE_IDLE != VSCP_CORE_INST.state)
     {
         /* Disable lamp and show the user that the node is offline. */
         vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
 
-        vscp_core_state = STATE_IDLE;
+        VSCP_CORE_INST.state = STATE_IDLE;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT )
 
@@ -1232,25 +1866,25 @@ static inline void  vscp_core_stateIdle(void)
  */
 static inline void  vscp_core_changeToStateReset(uint8_t timeout)
 {
-    if (STATE_RESET != vscp_core_state)
+    if (STATE_RESET != VSCP_CORE_INST.state)
     {
         /* Disable lamp and show the user that the node is offline. */
         vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
 
-        vscp_core_state = STATE_RESET;
+        VSCP_CORE_INST.state = STATE_RESET;
 
-        vscp_core_secCnt = timeout;
+        VSCP_CORE_INST.secCnt = timeout;
 
         /* Is a timer needed? */
-        if (0 < vscp_core_secCnt)
+        if (0 < VSCP_CORE_INST.secCnt)
         {
             /* Start timer for a second */
-            vscp_timer_start(vscp_core_timerId, (uint16_t)1000);
+            vscp_timer_start(VSCP_CORE_INST.timerId, (uint16_t)1000);
         }
         else
         {
             /* No timer needed */
-            vscp_timer_stop(vscp_core_timerId);
+            vscp_timer_stop(VSCP_CORE_INST.timerId);
         }
     }
 
@@ -1262,29 +1896,32 @@ static inline void  vscp_core_changeToStateReset(uint8_t timeout)
  */
 static inline void  vscp_core_stateReset(void)
 {
-    if (FALSE == vscp_core_resetRequested)
+    if (FALSE == VSCP_CORE_INST.resetRequested)
     {
         /* Timeout? */
-        if (FALSE == vscp_timer_getStatus(vscp_core_timerId))
+        if (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.timerId))
         {
             /* Decrease number of seconds, before reset */
-            if (0 < vscp_core_secCnt)
+            if (0 < VSCP_CORE_INST.secCnt)
             {
-                --vscp_core_secCnt;
+                --VSCP_CORE_INST.secCnt;
             }
 
             /* Reset now? */
-            if (0 == vscp_core_secCnt)
+            if (0 == VSCP_CORE_INST.secCnt)
             {
+                /* Write all cached data back, before the reset. */
+                vscp_ps_flush();
+
                 /* Request reset */
                 vscp_portable_resetRequest();
 
-                vscp_core_resetRequested = TRUE;
+                VSCP_CORE_INST.resetRequested = TRUE;
             }
             else
             {
                 /* Restart timer for a second */
-                vscp_timer_start(vscp_core_timerId, (uint16_t)1000);
+                vscp_timer_start(VSCP_CORE_INST.timerId, (uint16_t)1000);
             }
         }
     }
@@ -1297,12 +1934,12 @@ static inline void  vscp_core_stateReset(void)
  */
 static inline void  vscp_core_changeToStateError(void)
 {
-    if (STATE_ERROR != vscp_core_state)
+    if (STATE_ERROR != VSCP_CORE_INST.state)
     {
         /* Disable lamp and show the user that the node is offline. */
         vscp_portable_setLampState(VSCP_LAMP_STATE_OFF);
 
-        vscp_core_state = STATE_ERROR;
+        VSCP_CORE_INST.state = STATE_ERROR;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ERROR_CALLOUT )
 
@@ -1332,7 +1969,7 @@ static inline void  vscp_core_stateError(void)
  */
 static inline void  vscp_core_handleProtocolClassType(void)
 {
-    switch(vscp_core_rxMessage.vscpType)
+    switch(VSCP_CORE_INST.rxMessage->vscpType)
     {
     /* VSCP specification, chapter Segment Controller Heartbeat. */
     case VSCP_TYPE_PROTOCOL_SEGCTRL_HEARTBEAT:
@@ -1383,7 +2020,11 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Enter boot loader mode. */
     case VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdateEnter();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         vscp_core_handleProtocolEnterBootLoaderMode();
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     /* VSCP specification, chapter ACK boot loader mode. */
@@ -1398,12 +2039,20 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Start block data transfer. */
     case VSCP_TYPE_PROTOCOL_START_BLOCK:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdate();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         /* Boot loader specific event. Not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     /* VSCP specification, chapter Block data. */
     case VSCP_TYPE_PROTOCOL_BLOCK_DATA:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdate();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         /* Boot loader specific event. Not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     /* VSCP specification, chapter ACK data block. */
@@ -1418,7 +2067,11 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Program data block */
     case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdate();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         /* Boot loader specific event. Not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     /* VSCP specification, chapter ACK program data block */
@@ -1433,7 +2086,11 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Activate new image */
     case VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdate();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         /* Boot loader specific event. Not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     /* VSCP specification, chapter GUID drop nickname-ID / reset device. */
@@ -1498,7 +2155,11 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Get embedded MDF. */
     case VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF:
-        /* Optional and not supported yet. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+        vscp_core_handleProtocolGetEmbeddedMdf();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+        /* Optional and not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
         break;
 
     /* VSCP specification, chapter Get embedded MDF response. */
@@ -1523,7 +2184,11 @@ static inline void  vscp_core_handleProtocolClassType(void)
 
     /* VSCP specification, chapter Get event interest. */
     case VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST:
-        /* Optional and not supported yet. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+        vscp_core_handleProtocolGetEventInterest();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+        /* Optional and not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_EVENT_INTEREST ) */
         break;
 
     /* VSCP specification, chapter Get event interest response. */
@@ -1560,11 +2225,19 @@ static inline void  vscp_core_handleProtocolClassType(void)
         break;
 
     case VSCP_TYPE_PROTOCOL_BOOT_LOADER_CHECK:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdate();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         /* Boot loader specific event. Not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT:
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+        vscp_core_handleProtocolFwUpdate();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         /* Boot loader specific event. Not supported. */
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_FW_UPDATE ) */
         break;
 
     case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_ACK:
@@ -1591,37 +2264,37 @@ static inline void  vscp_core_handleProtocolClassType(void)
 static inline void  vscp_core_handleProtocolHeartbeat(void)
 {
     /* Check number of parameters. */
-    if (0 < vscp_core_rxMessage.dataSize)
+    if (0 < VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* If the received segment controller CRC is different than the stored one,
          * it seems the node was moved to a new segment.
          */
-        if (vscp_ps_readSegmentControllerCRC() != vscp_core_rxMessage.data[0])
+        if (vscp_ps_readSegmentControllerCRC() != VSCP_CORE_INST.rxMessage->data[0])
         {
             /* Store CRC of the this segment */
-            vscp_ps_writeSegmentControllerCRC(vscp_core_rxMessage.data[0]);
+            vscp_ps_writeSegmentControllerCRC(VSCP_CORE_INST.rxMessage->data[0]);
 
             /* If a nickname discovery was processed just before, there is no
              * need to do it again.
              */
-            if (VSCP_NICKNAME_SEGMENT_MASTER != vscp_core_nickname_probe)
+            if (VSCP_NICKNAME_SEGMENT_MASTER != VSCP_CORE_INST.nickname_probe)
             {
                 vscp_core_changeToStateInit(TRUE);
             }
         }
 
         /* If available, store time since epoch 00:00:00 UTC, January 1, 1970 */
-        if (5 <= vscp_core_rxMessage.dataSize)
+        if (5 <= VSCP_CORE_INST.rxMessage->dataSize)
         {
-            vscp_core_timeSinceEpoch  = ((uint32_t)vscp_core_rxMessage.data[1]) << 24;
-            vscp_core_timeSinceEpoch |= ((uint32_t)vscp_core_rxMessage.data[2]) << 16;
-            vscp_core_timeSinceEpoch |= ((uint32_t)vscp_core_rxMessage.data[3]) <<  8;
-            vscp_core_timeSinceEpoch |= ((uint32_t)vscp_core_rxMessage.data[4]) <<  0;
+            VSCP_CORE_INST.timeSinceEpoch  = ((uint32_t)VSCP_CORE_INST.rxMessage->data[1]) << 24;
+            VSCP_CORE_INST.timeSinceEpoch |= ((uint32_t)VSCP_CORE_INST.rxMessage->data[2]) << 16;
+            VSCP_CORE_INST.timeSinceEpoch |= ((uint32_t)VSCP_CORE_INST.rxMessage->data[3]) <<  8;
+            VSCP_CORE_INST.timeSinceEpoch |= ((uint32_t)VSCP_CORE_INST.rxMessage->data[4]) <<  0;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT )
 
             /* Notify application about a new received timestamp. */
-            vscp_portable_updateTimeSinceEpoch(vscp_core_timeSinceEpoch);
+            vscp_portable_updateTimeSinceEpoch(VSCP_CORE_INST.timeSinceEpoch);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT ) */
         }
@@ -1638,10 +2311,10 @@ static inline void  vscp_core_handleProtocolHeartbeat(void)
 static inline void  vscp_core_handleProtocolNewNodeOnline(void)
 {
     /* Check number of parameters. */
-    if (1 == vscp_core_rxMessage.dataSize)
+    if (1 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* Does this belongs to a node with the same nickname id? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
             vscp_TxMessage  txMessage;
 
@@ -1649,7 +2322,7 @@ static inline void  vscp_core_handleProtocolNewNodeOnline(void)
             txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
             txMessage.vscpType  = VSCP_TYPE_PROTOCOL_PROBE_ACK;
             txMessage.priority  = VSCP_PRIORITY_0_HIGH;
-            txMessage.oAddr     = vscp_core_nickname;
+            txMessage.oAddr     = VSCP_CORE_INST.nickname;
             txMessage.hardCoded = VSCP_CORE_HARD_CODED;
             txMessage.dataSize  = 0;
 
@@ -1666,10 +2339,10 @@ static inline void  vscp_core_handleProtocolNewNodeOnline(void)
 static inline void  vscp_core_handleProtocolProbeAck(void)
 {
     /* Check number of parameters. */
-    if (0 == vscp_core_rxMessage.dataSize)
+    if (0 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* Response from a node with the same nickname id? */
-        if (vscp_core_nickname == vscp_core_rxMessage.oAddr)
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->oAddr)
         {
             /* Oups ... */
             vscp_core_changeToStateInit(TRUE);
@@ -1685,23 +2358,23 @@ static inline void  vscp_core_handleProtocolProbeAck(void)
 static inline void  vscp_core_handleProtocolSetNicknameId(void)
 {
     /* Check number of parameters. */
-    if (2 == vscp_core_rxMessage.dataSize)
+    if (2 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* Change the node nickname id? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
             /* But not all nickname ids are allowed. */
-            if (VSCP_NICKNAME_SEGMENT_MASTER != vscp_core_rxMessage.data[1])
+            if (VSCP_NICKNAME_SEGMENT_MASTER != VSCP_CORE_INST.rxMessage->data[1])
             {
                 vscp_TxMessage  txMessage;
 
-                vscp_core_writeNicknameId(vscp_core_rxMessage.data[1]);
+                vscp_core_writeNicknameId(VSCP_CORE_INST.rxMessage->data[1]);
 
                 /* Answer that the nickname id is already in use. */
                 txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
                 txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NICKNAME_ACCEPTED;
                 txMessage.priority  = VSCP_PRIORITY_7_LOW;
-                txMessage.oAddr     = vscp_core_nickname;
+                txMessage.oAddr     = VSCP_CORE_INST.nickname;
                 txMessage.hardCoded = VSCP_CORE_HARD_CODED;
                 txMessage.dataSize  = 0;
 
@@ -1719,27 +2392,27 @@ static inline void  vscp_core_handleProtocolSetNicknameId(void)
 static inline void  vscp_core_handleProtocolDropNicknameId(void)
 {
     /* Check number of parameters. */
-    if (0 < vscp_core_rxMessage.dataSize)
+    if (0 < VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* Drop the node nickname id? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
             /* Drop nickname and restart? */
-            if (1 == vscp_core_rxMessage.dataSize)
+            if (1 == VSCP_CORE_INST.rxMessage->dataSize)
             {
                 vscp_core_writeNicknameId(VSCP_NICKNAME_NOT_INIT);
                 vscp_core_changeToStateReset(0);
             }
             /* Additional flags received? */
-            else if ((2 == vscp_core_rxMessage.dataSize) ||
-                     (3 == vscp_core_rxMessage.dataSize))
+            else if ((2 == VSCP_CORE_INST.rxMessage->dataSize) ||
+                     (3 == VSCP_CORE_INST.rxMessage->dataSize))
             {
                 uint8_t waitTime    = 0;
 
                 /* Wait time received? */
-                if (3 == vscp_core_rxMessage.dataSize)
+                if (3 == VSCP_CORE_INST.rxMessage->dataSize)
                 {
-                    waitTime = vscp_core_rxMessage.data[2];
+                    waitTime = VSCP_CORE_INST.rxMessage->data[2];
                 }
 
                 /* Byte 1:
@@ -1749,16 +2422,16 @@ static inline void  vscp_core_handleProtocolDropNicknameId(void)
                  */
 
                 /* Set persistent memory to default (bit 6)? */
-                if (0 != (vscp_core_rxMessage.data[1] & (1 << 6)))
+                if (0 != (VSCP_CORE_INST.rxMessage->data[1] & (1 << 6)))
                 {
                     /* Backup nickname, because restore factory settings will clear it. */
-                    uint8_t nicknameBackup  = vscp_core_nickname;
+                    uint8_t nicknameBackup  = VSCP_CORE_INST.nickname;
 
                     /* Set defaults to persistent memory. */
                     vscp_core_restoreFactoryDefaultSettings();
 
                     /* Restore nickname? */
-                    if (0 != (vscp_core_rxMessage.data[1] & (1 << 5)))
+                    if (0 != (VSCP_CORE_INST.rxMessage->data[1] & (1 << 5)))
                     {
                         /* Restore nickname */
                         vscp_core_writeNicknameId(nicknameBackup);
@@ -1769,12 +2442,12 @@ static inline void  vscp_core_handleProtocolDropNicknameId(void)
                  * Note that "reset device" has a higher priority than "go idle".
                  * There is no exact description in the specification yet.
                  */
-                if (0 != (vscp_core_rxMessage.data[1] & (1 << 5)))
+                if (0 != (VSCP_CORE_INST.rxMessage->data[1] & (1 << 5)))
                 {
                     vscp_core_changeToStateReset(waitTime);
                 }
                 /* Change to idle state (bit 7)? */
-                else if (0 != (vscp_core_rxMessage.data[1] & (1 << 7)))
+                else if (0 != (VSCP_CORE_INST.rxMessage->data[1] & (1 << 7)))
                 {
                     vscp_core_writeNicknameId(VSCP_NICKNAME_NOT_INIT);
                     vscp_core_changeToStateIdle();
@@ -1797,12 +2470,12 @@ static inline void  vscp_core_handleProtocolDropNicknameId(void)
 static inline void  vscp_core_handleProtocolReadRegister(void)
 {
     /* Check number of parameters. */
-    if (2 == vscp_core_rxMessage.dataSize)
+    if (2 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
-            uint8_t addr    = vscp_core_rxMessage.data[1];
+            uint8_t addr    = VSCP_CORE_INST.rxMessage->data[1];
             uint8_t value   = vscp_core_readRegister(0, addr);
 
             /* Response to read register event */
@@ -1826,13 +2499,13 @@ static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value)
     txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
     txMessage.vscpType  = VSCP_TYPE_PROTOCOL_RW_RESPONSE;
     txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-    txMessage.oAddr     = vscp_core_nickname;
+    txMessage.oAddr     = VSCP_CORE_INST.nickname;
     txMessage.hardCoded = VSCP_CORE_HARD_CODED;
     txMessage.dataSize  = 2;
     txMessage.data[0]   = addr;
     txMessage.data[1]   = value;
 
-    (void)vscp_transport_writeMessage(&txMessage);
+    vscp_core_sendRegRsp(&txMessage);
 
     return;
 }
@@ -1846,455 +2519,257 @@ static void vscp_core_sendRegisterReadWriteRsp(uint8_t addr, uint8_t value)
  */
 static uint8_t  vscp_core_readRegister(uint16_t page, uint8_t addr)
 {
-    uint8_t ret = 0;
+    uint8_t value   = 0;
 
-    /* Page 0 includes the VSCP specific registers. */
-    if ((0 == page) &&
-        (VSCP_REGISTER_VSCP_START_ADDR <= addr) &&
-        (VSCP_REGISTER_VSCP_END_ADDR >= addr))
-    {
-        switch(addr)
-        {
-            case VSCP_REG_ALARM_STATUS:
-                ret = vscp_core_regAlarmStatus;
-
-                /* Reset alarm */
-                vscp_core_regAlarmStatus = 0;
-                break;
-
-            case VSCP_REG_VSCP_VERSION_MAJOR:
-                ret = VSCP_CORE_VERSION_MAJOR;
-                break;
-
-            case VSCP_REG_VSCP_VERSION_MINOR:
-                ret = VSCP_CORE_VERSION_MINOR;
-                break;
-
-            case VSCP_REG_NODE_CONTROL_FLAGS:
-                ret = vscp_ps_readNodeControlFlags();
-                break;
-
-            case VSCP_REG_USER_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_3:
-                /*@fallthrough@*/
-            case VSCP_REG_USER_ID_4:
-                ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
-                break;
-
-            case VSCP_REG_MANUFACTURER_DEV_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_DEV_ID_3:
-                ret = vscp_dev_data_getManufacturerDevId(addr - VSCP_REG_MANUFACTURER_DEV_ID_0);
-                break;
-
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
-                ret = vscp_dev_data_getManufacturerSubDevId(addr - VSCP_REG_MANUFACTURER_SUB_DEV_ID_0);
-                break;
-
-            case VSCP_REG_NICKNAME_ID:
-                ret = vscp_core_nickname;
-                break;
-
-            case VSCP_REG_PAGE_SELECT_MSB:
-                ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
-                break;
-
-            case VSCP_REG_PAGE_SELECT_LSB:
-                ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
-                break;
-
-            case VSCP_REG_FIRMWARE_VERSION_MAJOR:
-                ret = vscp_dev_data_getFirmwareVersionMajor();
-                break;
-
-            case VSCP_REG_FIRMWARE_VERSION_MINOR:
-                ret = vscp_dev_data_getFirmwareVersionMinor();
-                break;
-
-            case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
-                ret = vscp_dev_data_getFirmwareVersionSubMinor();
-                break;
-
-            case VSCP_REG_BOOT_LOADER_ALGORITHM:
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
-                ret = vscp_portable_getBootLoaderAlgorithm();
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
-                ret = 0xFF;
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
-                break;
-
-            case VSCP_REG_BUFFER_SIZE:
-                ret = VSCP_L1_DATA_SIZE;
-                break;
-
-            case VSCP_REG_PAGES_USED:
-                ret = vscp_app_reg_getPagesUsed();
-                break;
-
-            case VSCP_REG_STD_DEV_FAMILY_CODE_3:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_2:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_1:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_FAMILY_CODE_0:
-                ret = vscp_dev_data_getStdDevFamilyCode(3 - (addr - VSCP_REG_STD_DEV_FAMILY_CODE_3));
-                break;
-
-            case VSCP_REG_STD_DEV_TYPE_3:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_2:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_1:
-                /*@fallthrough@*/
-            case VSCP_REG_STD_DEV_TYPE_0:
-                ret = vscp_dev_data_getStdDevType(3 - (addr - VSCP_REG_STD_DEV_TYPE_3));
-                break;
-
-            case VSCP_REG_RESTORE_STD_CFG:
-                /* Write only */
-                break;
-
-            case VSCP_REG_FIRMWARE_DEVICE_CODE_MSB:
-                ret = VSCP_UTIL_WORD_MSB(vscp_dev_data_getFirmwareDeviceCode());
-                break;
-                
-            case VSCP_REG_FIRMWARE_DEVICE_CODE_LSB:
-                ret = VSCP_UTIL_WORD_LSB(vscp_dev_data_getFirmwareDeviceCode());
-                break;
-
-            case VSCP_REG_GUID_15:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_14:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_13:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_12:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_11:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_10:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_9:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_8:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_7:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_6:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_5:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_4:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_3:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_2:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_1:
-                /*@fallthrough@*/
-            case VSCP_REG_GUID_0:
-                ret = vscp_dev_data_getGUID(15 - (addr - VSCP_REG_GUID_15));
-                break;
-
-            default:
-
-                if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
-                    (VSCP_REG_MDF_URL_END >= addr))
-                {
-                    ret = vscp_dev_data_getMdfUrl(addr - VSCP_REG_MDF_URL_BEGIN);
-                }
+    vscp_reg_map_readRange(&vscp_core_regMap, page, addr, &value, 1);
 
-                break;
-        }
-    }
+    return value;
+}
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-    /* Is the addressed register part of the decision matrix? */
-    else if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
+/**
+ * Write to register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @param[out]  failed  Write error is set to TRUE
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed)
+{
+    BOOL    status  = vscp_reg_map_writeRange(&vscp_core_regMap, page, addr, &value, 1);
+
+    if (NULL != failed)
     {
-        ret = vscp_dm_readRegister(page, addr);
+        *failed = (FALSE == status) ? TRUE : FALSE;
     }
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-    /* Is the addressed register part of the decision matrix NG? */
-    else if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
+    return value;
+}
+
+/**
+ * Read the alarm status register. Reading resets the alarm.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readAlarmStatus(uint16_t page, uint8_t addr)
+{
+    uint8_t value   = VSCP_CORE_INST.regAlarmStatus;
+
+    /* Reset alarm */
+    VSCP_CORE_INST.regAlarmStatus = 0;
+
+    return value;
+}
+
+/**
+ * Read a VSCP version register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readVscpVersion(uint16_t page, uint8_t addr)
+{
+    return (VSCP_REG_VSCP_VERSION_MAJOR == addr) ? VSCP_CORE_VERSION_MAJOR : VSCP_CORE_VERSION_MINOR;
+}
+
+/**
+ * Get the storage of the node control flags register.
+ *
+ * @return  Storage
+ */
+static uint8_t* vscp_core_getNodeControlFlagsStorage(void)
+{
+    return &VSCP_CORE_INST.regNodeControlFlags;
+}
+
+/**
+ * Store the node control flags in the persistent memory, after the register
+ * was written.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first written register
+ * @param[in]   count   Number of written registers
+ */
+static void vscp_core_nodeControlFlagsChanged(uint16_t page, uint8_t addr, uint8_t count)
+{
+    vscp_ps_writeNodeControlFlags(VSCP_CORE_INST.regNodeControlFlags);
+
+    return;
+}
+
+/**
+ * Get the storage of the user id registers.
+ *
+ * @return  Storage
+ */
+static uint8_t* vscp_core_getUserIdStorage(void)
+{
+    return VSCP_CORE_INST.regUserId;
+}
+
+/**
+ * Store the user id in the persistent memory, after registers were written.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first written register
+ * @param[in]   count   Number of written registers
+ */
+static void vscp_core_userIdChanged(uint16_t page, uint8_t addr, uint8_t count)
+{
+    uint8_t index   = addr - VSCP_REG_USER_ID_0;
+
+    while(0 < count)
     {
-        ret = vscp_dm_ng_readRegister(page, addr);
+        vscp_ps_writeUserId(index, VSCP_CORE_INST.regUserId[index]);
+
+        ++index;
+        --count;
     }
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
-    else
-    /* Application specific register */
+    return;
+}
+
+/**
+ * Get the storage of the nickname id register.
+ *
+ * @return  Storage
+ */
+static uint8_t* vscp_core_getNicknameStorage(void)
+{
+    return &VSCP_CORE_INST.nickname;
+}
+
+/**
+ * Read a page select register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readPageSelect(uint16_t page, uint8_t addr)
+{
+    if (VSCP_REG_PAGE_SELECT_MSB == addr)
     {
-        ret = vscp_app_reg_readRegister(page, addr);
+        return VSCP_UTIL_WORD_MSB(VSCP_CORE_INST.regPageSelect);
     }
 
-    return ret;
+    return VSCP_UTIL_WORD_LSB(VSCP_CORE_INST.regPageSelect);
 }
 
 /**
- * Write to register.
+ * Write a page select register.
  *
  * @param[in]   page    Page
  * @param[in]   addr    Register address
  * @param[in]   value   Value to write
- * @param[out]  failed  Write error is set to TRUE
  * @return  Register value
  */
-static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t value, /*@null@*/ BOOL* failed)
+static uint8_t  vscp_core_writePageSelect(uint16_t page, uint8_t addr, uint8_t value)
 {
-    uint8_t ret     = 0;
-    BOOL    error   = TRUE;
-
-    /* Page 0 includes the VSCP specific registers. */
-    if ((0 == page) &&
-        (VSCP_REGISTER_VSCP_START_ADDR <= addr) &&
-        (VSCP_REGISTER_VSCP_END_ADDR >= addr))
+    if (VSCP_REG_PAGE_SELECT_MSB == addr)
     {
-        switch(addr)
-        {
-        case VSCP_REG_ALARM_STATUS:
-            /* Read only */
-            break;
-
-        case VSCP_REG_VSCP_VERSION_MAJOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_VSCP_VERSION_MINOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_NODE_CONTROL_FLAGS:
-            vscp_ps_writeNodeControlFlags(value);
-            ret = vscp_ps_readNodeControlFlags();
-            error = FALSE;
-            break;
-
-        case VSCP_REG_USER_ID_0:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_3:
-            /*@fallthrough@*/
-        case VSCP_REG_USER_ID_4:
-            vscp_ps_writeUserId(addr - VSCP_REG_USER_ID_0, value);
-            ret = vscp_ps_readUserId(addr - VSCP_REG_USER_ID_0);
-            error = FALSE;
-            break;
-
-        case VSCP_REG_MANUFACTURER_DEV_ID_0:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_DEV_ID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_DEV_ID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_DEV_ID_3:
-            /* Read only */
-            break;
-
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_0:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_MANUFACTURER_SUB_DEV_ID_3:
-            /* Read only */
-            break;
-
-        case VSCP_REG_NICKNAME_ID:
-            /* Read only */
-            break;
-
-        case VSCP_REG_PAGE_SELECT_MSB:
-            vscp_core_regPageSelect &= 0x00FF;
-            vscp_core_regPageSelect |= ((uint16_t)value) << 8;
-            ret = VSCP_UTIL_WORD_MSB(vscp_core_regPageSelect);
-            error = FALSE;
-            break;
-
-        case VSCP_REG_PAGE_SELECT_LSB:
-            vscp_core_regPageSelect &= 0xFF00;
-            vscp_core_regPageSelect |= ((uint16_t)value) << 0;
-            ret = VSCP_UTIL_WORD_LSB(vscp_core_regPageSelect);
-            error = FALSE;
-            break;
-
-        case VSCP_REG_FIRMWARE_VERSION_MAJOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_FIRMWARE_VERSION_MINOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_FIRMWARE_VERSION_SUB_MINOR:
-            /* Read only */
-            break;
-
-        case VSCP_REG_BOOT_LOADER_ALGORITHM:
-            /* Read only */
-            break;
-
-        case VSCP_REG_BUFFER_SIZE:
-            /* Read only */
-            break;
-
-        case VSCP_REG_PAGES_USED:
-            /* Read only */
-            break;
-
-        case VSCP_REG_STD_DEV_FAMILY_CODE_3:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_FAMILY_CODE_2:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_FAMILY_CODE_1:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_FAMILY_CODE_0:
-            /* Read only */
-            break;
-
-        case VSCP_REG_STD_DEV_TYPE_3:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_TYPE_2:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_TYPE_1:
-            /*@fallthrough@*/
-        case VSCP_REG_STD_DEV_TYPE_0:
-            /* Read only */
-            break;
-
-        case VSCP_REG_FIRMWARE_DEVICE_CODE_MSB:
-            /* Read only */
-            break;
-            
-        case VSCP_REG_FIRMWARE_DEVICE_CODE_LSB:
-            /* Read only */
-            break;
-
-        case VSCP_REG_RESTORE_STD_CFG:
-
-            /* 0x55 has to be written first, multi-frame timer is disabled. */
-            if ((0x55 == value) &&
-                (FALSE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
-            {
-                vscp_timer_start(vscp_core_timerIdReg162, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
-            }
-            /* 0xAA has to be written after 0x55 and within a specific time. */
-            else if ((0xAA == value) &&
-                     (TRUE == vscp_timer_getStatus(vscp_core_timerIdReg162)))
-            {
-                vscp_timer_stop(vscp_core_timerIdReg162);
-
-                /* Restore default settings */
-                vscp_core_restoreFactoryDefaultSettings();
-            }
-
-            error = FALSE;
-            break;
-
-        case VSCP_REG_GUID_15:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_14:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_13:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_12:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_11:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_10:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_9:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_8:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_7:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_6:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_5:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_4:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_3:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_2:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_1:
-            /*@fallthrough@*/
-        case VSCP_REG_GUID_0:
-            /* Read only */
-            break;
-
-        default:
-
-            if ((VSCP_REG_MDF_URL_BEGIN <= addr) &&
-                (VSCP_REG_MDF_URL_END >= addr))
-            {
-                /* Read only */
-                ;
-            }
-
-            break;
-        }
+        VSCP_CORE_INST.regPageSelect &= 0x00FF;
+        VSCP_CORE_INST.regPageSelect |= ((uint16_t)value) << 8;
     }
-    /* Write protection disabled? */
-    else if (0 != vscp_core_getRegAppWriteProtect())
+    else
     {
+        VSCP_CORE_INST.regPageSelect &= 0xFF00;
+        VSCP_CORE_INST.regPageSelect |= ((uint16_t)value) << 0;
+    }
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
-        /* Is the addressed register part of the decision matrix? */
-        if (FALSE != vscp_dm_isDecisionMatrix(page, addr))
-        {
-            ret = vscp_dm_writeRegister(page, addr, value);
-        }
-        else
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+    return vscp_core_readPageSelect(page, addr);
+}
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
-        /* Is the addressed register part of the decision matrix NG? */
-        if (FALSE != vscp_dm_ng_isDecisionMatrix(page, addr))
-        {
-            ret = vscp_dm_ng_writeRegister(page, addr, value);
-        }
-        else
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+/**
+ * Read the boot loader algorithm register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readBootLoaderAlgorithm(uint16_t page, uint8_t addr)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+    return VSCP_FW_UPDATE_ALGORITHM;
+#elif VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
+    return vscp_portable_getBootLoaderAlgorithm();
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+    return 0xFF;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED ) */
+}
 
-        /* Application specific registers */
-        {
-            ret = vscp_app_reg_writeRegister(page, addr, value);
-        }
+/**
+ * Read the buffer size register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readBufferSize(uint16_t page, uint8_t addr)
+{
+    return VSCP_L1_DATA_SIZE;
+}
 
-        error = FALSE;
-    }
+/**
+ * Read the number of used pages register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return  Register value
+ */
+static uint8_t  vscp_core_readPagesUsed(uint16_t page, uint8_t addr)
+{
+    return vscp_app_reg_getPagesUsed();
+}
 
-    if (NULL != failed)
+/**
+ * Write the restore standard configuration register. Writing 0x55 and
+ * afterwards 0xAA within a specific time restores the factory default
+ * settings.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return  Register value
+ */
+static uint8_t  vscp_core_writeRestoreStdCfg(uint16_t page, uint8_t addr, uint8_t value)
+{
+    /* 0x55 has to be written first, multi-frame timer is disabled. */
+    if ((0x55 == value) &&
+        (FALSE == vscp_timer_getStatus(VSCP_CORE_INST.timerIdReg162)))
     {
-        *failed = error;
+        vscp_timer_start(VSCP_CORE_INST.timerIdReg162, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
     }
+    /* 0xAA has to be written after 0x55 and within a specific time. */
+    else if ((0xAA == value) &&
+             (TRUE == vscp_timer_getStatus(VSCP_CORE_INST.timerIdReg162)))
+    {
+        vscp_timer_stop(VSCP_CORE_INST.timerIdReg162);
 
-    return ret;
+        /* Restore default settings */
+        vscp_core_restoreFactoryDefaultSettings();
+    }
+
+    /* Write only */
+    return 0;
+}
+
+/**
+ * Returns whether the application registers, including the decision matrix,
+ * are writeable. This depends on the register write protection in the node
+ * control flags.
+ *
+ * @return  Writeable or not
+ * @retval  FALSE   Write protected
+ * @retval  TRUE    Writeable
+ */
+static BOOL vscp_core_isRegAppWriteable(void)
+{
+    return (0 != vscp_core_getRegAppWriteProtect()) ? TRUE : FALSE;
 }
 
 /**
@@ -2303,13 +2778,13 @@ static uint8_t  vscp_core_writeRegister(uint16_t page, uint8_t addr, uint8_t val
 static inline void  vscp_core_handleProtocolWriteRegister(void)
 {
     /* Check number of parameters. */
-    if (3 == vscp_core_rxMessage.dataSize)
+    if (3 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
-            uint8_t addr    = vscp_core_rxMessage.data[1];
-            uint8_t value   = vscp_core_rxMessage.data[2];
+            uint8_t addr    = VSCP_CORE_INST.rxMessage->data[1];
+            uint8_t value   = VSCP_CORE_INST.rxMessage->data[2];
             BOOL    error   = FALSE;
 
             /* Write to register */
@@ -2333,16 +2808,16 @@ static inline void  vscp_core_handleProtocolWriteRegister(void)
 static inline void  vscp_core_handleProtocolEnterBootLoaderMode(void)
 {
     /* Check number of parameters. */
-    if (8 == vscp_core_rxMessage.dataSize)
+    if (8 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
             vscp_TxMessage  txMessage;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
 
-            uint16_t    pageSelect = (((uint16_t)vscp_core_rxMessage.data[6]) << 8) | vscp_core_rxMessage.data[7];
+            uint16_t    pageSelect = (((uint16_t)VSCP_CORE_INST.rxMessage->data[6]) << 8) | VSCP_CORE_INST.rxMessage->data[7];
 
             /* Boot loader not supported?
              * Boot loader algorithm not supported?
@@ -2350,17 +2825,17 @@ static inline void  vscp_core_handleProtocolEnterBootLoaderMode(void)
              * Wrong page select register values?
              */
             if ((0xFF == vscp_portable_getBootLoaderAlgorithm()) ||
-                (vscp_portable_getBootLoaderAlgorithm() != vscp_core_rxMessage.data[1]) ||
-                (vscp_dev_data_getGUID(15 - 0) != vscp_core_rxMessage.data[2]) ||
-                (vscp_dev_data_getGUID(15 - 3) != vscp_core_rxMessage.data[3]) ||
-                (vscp_dev_data_getGUID(15 - 5) != vscp_core_rxMessage.data[4]) ||
-                (vscp_dev_data_getGUID(15 - 7) != vscp_core_rxMessage.data[5]) ||
-                (vscp_core_regPageSelect != pageSelect))
+                (vscp_portable_getBootLoaderAlgorithm() != VSCP_CORE_INST.rxMessage->data[1]) ||
+                (vscp_dev_data_getGUID(15 - 0) != VSCP_CORE_INST.rxMessage->data[2]) ||
+                (vscp_dev_data_getGUID(15 - 3) != VSCP_CORE_INST.rxMessage->data[3]) ||
+                (vscp_dev_data_getGUID(15 - 5) != VSCP_CORE_INST.rxMessage->data[4]) ||
+                (vscp_dev_data_getGUID(15 - 7) != VSCP_CORE_INST.rxMessage->data[5]) ||
+                (VSCP_CORE_INST.regPageSelect != pageSelect))
             {
                 txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
                 txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER;
                 txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-                txMessage.oAddr     = vscp_core_nickname;
+                txMessage.oAddr     = VSCP_CORE_INST.nickname;
                 txMessage.hardCoded = VSCP_CORE_HARD_CODED;
                 txMessage.dataSize  = 1;
                 txMessage.data[0]   = 0;   /* User defined error code - not used */
@@ -2375,6 +2850,9 @@ static inline void  vscp_core_handleProtocolEnterBootLoaderMode(void)
                 /* Set boot flag to bootloader */
                 vscp_ps_writeBootFlag(VSCP_BOOT_FLAG_BOOTLOADER);
 
+                /* Write all cached data back, before the jump. */
+                vscp_ps_flush();
+
                 /* Request jump to boot loader */
                 vscp_portable_bootLoaderRequest();
 
@@ -2386,7 +2864,7 @@ static inline void  vscp_core_handleProtocolEnterBootLoaderMode(void)
             txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
             txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER;
             txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
+            txMessage.oAddr     = VSCP_CORE_INST.nickname;
             txMessage.hardCoded = VSCP_CORE_HARD_CODED;
             txMessage.dataSize  = 1;
             txMessage.data[0]   = 0;   /* User defined error code - not used */
@@ -2400,67 +2878,144 @@ static inline void  vscp_core_handleProtocolEnterBootLoaderMode(void)
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
 /**
- * Handles a protocol class GUID drop nickname id event.
+ * Handles a protocol class enter boot loader event, if the firmware update
+ * is done by the application itself. The node is selected either by its
+ * nickname id and the GUID bytes like in the standard procedure, or together
+ * with all nodes of the same family by the multicast nickname id and the
+ * family code. The node stays active during the whole firmware update.
  */
-static inline void  vscp_core_handleProtocolGuidDropNickname(void)
+static inline void  vscp_core_handleProtocolFwUpdateEnter(void)
 {
-    /* Check number of parameters. */
-    if ((5 == vscp_core_rxMessage.dataSize) &&
-        (4 > vscp_core_rxMessage.data[0]))
+    vscp_TxMessage  txMessage;
+    BOOL            isSelected  = FALSE;
+
+    /* Check number of parameters. */
+    if (8 != VSCP_CORE_INST.rxMessage->dataSize)
     {
-        static uint8_t  status = 0;
+        return;
+    }
 
-        /* First event of this multi-event? */
-        if (0 == vscp_core_rxMessage.data[0])
+    /* This node? */
+    if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
+    {
+        uint16_t    pageSelect = (((uint16_t)VSCP_CORE_INST.rxMessage->data[6]) << 8) | VSCP_CORE_INST.rxMessage->data[7];
+
+        /* Boot loader algorithm not supported?
+         * Wrong GUID bytes?
+         * Wrong page select register values?
+         */
+        if ((VSCP_FW_UPDATE_ALGORITHM != VSCP_CORE_INST.rxMessage->data[1]) ||
+            (vscp_dev_data_getGUID(15 - 0) != VSCP_CORE_INST.rxMessage->data[2]) ||
+            (vscp_dev_data_getGUID(15 - 3) != VSCP_CORE_INST.rxMessage->data[3]) ||
+            (vscp_dev_data_getGUID(15 - 5) != VSCP_CORE_INST.rxMessage->data[4]) ||
+            (vscp_dev_data_getGUID(15 - 7) != VSCP_CORE_INST.rxMessage->data[5]) ||
+            (VSCP_CORE_INST.regPageSelect != pageSelect))
         {
-            /* Reset flag, which is used during all events. */
-            status = 0;
+            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER;
+            txMessage.dataSize  = 1;
+            txMessage.data[0]   = 0;   /* User defined error code - not used */
 
-            /* Start timer to observe multi-message handling. */
-            vscp_timer_start(vscp_core_timerIdGuidDropNickname, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
+            vscp_core_sendFwUpdateRsp(&txMessage);
         }
-
-        /* Timeout? */
-        if (FALSE == vscp_timer_getStatus(vscp_core_timerIdGuidDropNickname))
+        else
         {
-            /* Prevent dropping the nickname. */
-            status = 0;
+            isSelected = TRUE;
         }
-        else
+    }
+    /* All nodes of the same family? Other nodes stay silent. */
+    else if ((VSCP_FW_UPDATE_NICKNAME_MULTICAST == VSCP_CORE_INST.rxMessage->data[0]) &&
+             (VSCP_FW_UPDATE_ALGORITHM == VSCP_CORE_INST.rxMessage->data[1]) &&
+             (vscp_dev_data_getStdDevFamilyCode(3) == VSCP_CORE_INST.rxMessage->data[2]) &&
+             (vscp_dev_data_getStdDevFamilyCode(2) == VSCP_CORE_INST.rxMessage->data[3]) &&
+             (vscp_dev_data_getStdDevFamilyCode(1) == VSCP_CORE_INST.rxMessage->data[4]) &&
+             (vscp_dev_data_getStdDevFamilyCode(0) == VSCP_CORE_INST.rxMessage->data[5]))
+    {
+        isSelected = TRUE;
+    }
+
+    if (TRUE == isSelected)
+    {
+        (void)vscp_fw_update_enter(&txMessage);
+
+        vscp_core_sendFwUpdateRsp(&txMessage);
+    }
+
+    return;
+}
+
+/**
+ * Handles the protocol class boot loader events, if the firmware update
+ * is done by the application itself.
+ */
+static inline void  vscp_core_handleProtocolFwUpdate(void)
+{
+    vscp_TxMessage  txMessage;
+
+    if (TRUE == vscp_fw_update_handleEvent(VSCP_CORE_INST.rxMessage, &txMessage))
+    {
+        vscp_core_sendFwUpdateRsp(&txMessage);
+    }
+
+    return;
+}
+
+/**
+ * Send a firmware update response. The firmware update sets only the type
+ * and the data, everything else is completed here.
+ *
+ * @param[in,out]   txMessage   Response message
+ */
+static void vscp_core_sendFwUpdateRsp(vscp_TxMessage * const txMessage)
+{
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->priority     = VSCP_PRIORITY_3_NORMAL;
+    txMessage->oAddr        = VSCP_CORE_INST.nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+
+    vscp_core_sendRegRsp(txMessage);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+/**
+ * Handles a protocol class GUID drop nickname id event.
+ */
+static inline void  vscp_core_handleProtocolGuidDropNickname(void)
+{
+    /* Check number of parameters. */
+    if ((5 == VSCP_CORE_INST.rxMessage->dataSize) &&
+        (4 > VSCP_CORE_INST.rxMessage->data[0]))
+    {
+        uint8_t const * guid        = NULL;
+        uint8_t         guidSize    = 0;
+
+        /* The GUID is sent MSB first in 4 events, with the event index in byte 0. */
+        if (VSCP_SEGMENT_RX_COMPLETE == vscp_segment_receive(VSCP_CORE_INST.rxMessage, 1, 0, VSCP_GUID_SIZE, &guid, &guidSize))
         {
             uint8_t index   = 0;
             BOOL    isEqual = TRUE;
 
-            for(index = 0; index < 4; ++index)
+            for(index = 0; index < VSCP_GUID_SIZE; ++index)
             {
-                if (vscp_core_rxMessage.data[1 + index] != vscp_dev_data_getGUID(15 - 4 * vscp_core_rxMessage.data[0] - index))
+                if (guid[index] != vscp_dev_data_getGUID(VSCP_GUID_SIZE - 1 - index))
                 {
                     isEqual = FALSE;
                     break;
                 }
             }
 
-            if (TRUE == isEqual)
-            {
-                /* Remember the compare result of each event. */
-                status |= 1 << vscp_core_rxMessage.data[0];
-            }
-
             /* Drop the node nickname id? */
-            if ((3 == vscp_core_rxMessage.data[0]) &&
-                (0x0F== status))
+            if (TRUE == isEqual)
             {
-                /* Stop timer */
-                vscp_timer_stop(vscp_core_timerIdGuidDropNickname);
-
-                /* Reset status */
-                status = 0;
-
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_SILENT_NODE )
 
                 /* Start nickname discovery? */
-                if (STATE_STARTUP == vscp_core_state)
+                if (STATE_STARTUP == VSCP_CORE_INST.state)
                 {
                     vscp_core_startNodeSegmentInit();
                 }
@@ -2492,16 +3047,13 @@ static inline void  vscp_core_handleProtocolGuidDropNickname(void)
 static inline void  vscp_core_handleProtocolPageRead(void)
 {
     /* Check number of parameters. */
-    if (3 == vscp_core_rxMessage.dataSize)
+    if (3 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
-            vscp_TxMessage  txMessage;
-            uint8_t         addr        = vscp_core_rxMessage.data[1];
-            uint8_t         index       = 0;
-            uint8_t         num         = vscp_core_rxMessage.data[2];
-            uint8_t         dataIndex   = 0;
+            uint8_t addr    = VSCP_CORE_INST.rxMessage->data[1];
+            uint8_t num     = VSCP_CORE_INST.rxMessage->data[2];
 
             /* If the number of bytes to read overflows the page, it will be
              * limited to the page end.
@@ -2511,40 +3063,11 @@ static inline void  vscp_core_handleProtocolPageRead(void)
                 num = 0xFF - addr;
             }
 
-            /* Prepare tx message */
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataSize  = VSCP_L1_DATA_SIZE;
-
-            /* Sequence number */
-            txMessage.data[dataIndex] = 0;
-            ++dataIndex;
-
-            for(index = 0; index < num; ++index)
-            {
-                txMessage.data[dataIndex] = vscp_core_readRegister(vscp_core_regPageSelect, addr + index);
-                ++dataIndex;
-
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
-
-                    /* Increase sequence number and reset data index */
-                    dataIndex = 0;
-                    ++(txMessage.data[dataIndex]);
-                    ++dataIndex;
-                }
-            }
-
-            if (1 < dataIndex)
-            {
-                txMessage.dataSize = dataIndex;
-
-                (void)vscp_transport_writeMessage(&txMessage);
-            }
+            /* The responses are sent as far as the transport layer accepts them.
+             * All others will be sent in the following process cycles. This avoids
+             * that the framework blocks the application too long.
+             */
+            vscp_core_startRegRead(VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE, VSCP_CORE_INST.regPageSelect, addr, num);
         }
     }
 
@@ -2557,15 +3080,14 @@ static inline void  vscp_core_handleProtocolPageRead(void)
 static inline void  vscp_core_handleProtocolPageWrite(void)
 {
     /* Check number of parameters. */
-    if (3 <= vscp_core_rxMessage.dataSize)
+    if (3 <= VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
             vscp_TxMessage  txMessage;
-            uint8_t         addr        = vscp_core_rxMessage.data[1];
-            uint8_t         index       = 0;
-            uint8_t         num         = vscp_core_rxMessage.dataSize - 2;
+            uint8_t         addr        = VSCP_CORE_INST.rxMessage->data[1];
+            uint8_t         num         = VSCP_CORE_INST.rxMessage->dataSize - 2;
             uint8_t         dataIndex   = 0;
 
             /* If the number of bytes to read overflows the page, it will be
@@ -2580,25 +3102,21 @@ static inline void  vscp_core_handleProtocolPageWrite(void)
             txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
             txMessage.vscpType  = VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE;
             txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
+            txMessage.oAddr     = VSCP_CORE_INST.nickname;
             txMessage.hardCoded = VSCP_CORE_HARD_CODED;
 
             /* Sequence number */
             txMessage.data[dataIndex] = 0;
             ++dataIndex;
 
-            for(index = 0; index < num; ++index)
-            {
-                txMessage.data[dataIndex] = vscp_core_writeRegister(vscp_core_regPageSelect,
-                                                                    addr + index,
-                                                                    vscp_core_rxMessage.data[2 + index],
-                                                                    NULL);
-                ++dataIndex;
-            }
+            /* Write registers, the response contains their values afterwards. */
+            memcpy(&txMessage.data[dataIndex], &VSCP_CORE_INST.rxMessage->data[2], num);
+            (void)vscp_reg_map_writeRange(&vscp_core_regMap, VSCP_CORE_INST.regPageSelect, addr, &txMessage.data[dataIndex], num);
+            dataIndex += num;
 
             txMessage.dataSize = dataIndex;
 
-            (void)vscp_transport_writeMessage(&txMessage);
+            vscp_core_sendRegRsp(&txMessage);
         }
     }
 
@@ -2611,12 +3129,12 @@ static inline void  vscp_core_handleProtocolPageWrite(void)
 static inline void  vscp_core_handleProtocolIncrementRegister(void)
 {
     /* Check number of parameters. */
-    if (2 == vscp_core_rxMessage.dataSize)
+    if (2 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
-            uint8_t addr    = vscp_core_rxMessage.data[1];
+            uint8_t addr    = VSCP_CORE_INST.rxMessage->data[1];
             uint8_t value   = vscp_core_readRegister(0, addr);
             BOOL    error   = FALSE;
 
@@ -2643,12 +3161,12 @@ static inline void  vscp_core_handleProtocolIncrementRegister(void)
 static inline void  vscp_core_handleProtocolDecrementRegister(void)
 {
     /* Check number of parameters. */
-    if (2 == vscp_core_rxMessage.dataSize)
+    if (2 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
-            uint8_t addr    = vscp_core_rxMessage.data[1];
+            uint8_t addr    = VSCP_CORE_INST.rxMessage->data[1];
             uint8_t value   = vscp_core_readRegister(0, addr);
             BOOL    error   = FALSE;
 
@@ -2675,78 +3193,63 @@ static inline void  vscp_core_handleProtocolDecrementRegister(void)
 static inline void  vscp_core_handleProtocolWhoIsThere(void)
 {
     /* Check number of parameters. */
-    if (1 == vscp_core_rxMessage.dataSize)
+    if (1 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if ((vscp_core_nickname == vscp_core_rxMessage.data[0]) ||
-            (VSCP_NICKNAME_NOT_INIT == vscp_core_rxMessage.data[0]))
+        if ((VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0]) ||
+            (VSCP_NICKNAME_NOT_INIT == VSCP_CORE_INST.rxMessage->data[0]))
         {
-            vscp_TxMessage  txMessage;
-            int8_t          sIndex      = 0;
-            uint8_t         uIndex      = 0;
-            uint8_t         dataIndex   = 0;
-            uint8_t         rowIndex    = 0;
-
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
-            txMessage.dataSize  = 8;
-
-            /* Row index */
-            txMessage.data[dataIndex] = rowIndex;
-            ++dataIndex;
-            ++rowIndex;
-
-            /* GUID */
-            for(sIndex = 15; sIndex >= 0; --sIndex)
-            {
-                txMessage.data[dataIndex] = vscp_dev_data_getGUID((uint8_t)sIndex);
-                ++dataIndex;
-
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
+            /* If the stream queue is full, the response is deferred until a
+             * stream is free again. Further requests in the meantime are
+             * answered by the same response.
+             */
+            VSCP_CORE_INST.whoIsThereRspPending = TRUE;
 
-                    dataIndex = 0;
+            vscp_core_sendWhoIsThereRsp();
+        }
+    }
 
-                    /* Row index */
-                    txMessage.data[dataIndex] = rowIndex;
-                    ++dataIndex;
-                    ++rowIndex;
-                }
-            }
+    return;
+}
 
-            /* MDF */
-            for(uIndex = 0; uIndex < 32; ++uIndex)
-            {
-                txMessage.data[dataIndex] = vscp_dev_data_getMdfUrl(uIndex);
-                ++dataIndex;
+/**
+ * Queue the who is there response. The GUID and the MDF URL are sent in the
+ * following process cycles, as far as the transport layer accepts them.
+ * If the stream queue is full, the response stays pending.
+ */
+static void vscp_core_sendWhoIsThereRsp(void)
+{
+    vscp_TxMessage  txMessage;
 
-                if (VSCP_L1_DATA_SIZE <= dataIndex)
-                {
-                    (void)vscp_transport_writeMessage(&txMessage);
+    txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+    txMessage.vscpType  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE;
+    txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+    txMessage.oAddr     = VSCP_CORE_INST.nickname;
+    txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+    txMessage.dataSize  = 1;
 
-                    dataIndex = 0;
+    /* Row index */
+    txMessage.data[0] = 0;
 
-                    /* Row index */
-                    txMessage.data[dataIndex] = rowIndex;
-                    ++dataIndex;
-                    ++rowIndex;
-                }
-            }
+    if (TRUE == vscp_segment_sendFunc(&txMessage, 0, TRUE, vscp_core_getWhoIsThereData, VSCP_GUID_SIZE + VSCP_CORE_MDF_URL_SIZE))
+    {
+        VSCP_CORE_INST.whoIsThereRspPending = FALSE;
+    }
 
-            /* Fill up */
-            while(VSCP_L1_DATA_SIZE > dataIndex)
-            {
-                txMessage.data[dataIndex] = 0;
-                ++dataIndex;
-            }
+    return;
+}
 
-            (void)vscp_transport_writeMessage(&txMessage);
-        }
-    }
+/**
+ * Get bytes of the who is there response: The GUID MSB first, followed by
+ * the MDF URL. This is the same order as in the GUID and MDF URL registers.
+ *
+ * @param[in]   index   Index of the first byte
+ * @param[out]  buffer  Buffer for the bytes
+ * @param[in]   size    Number of bytes
+ */
+static void vscp_core_getWhoIsThereData(uint8_t index, uint8_t * const buffer, uint8_t size)
+{
+    vscp_reg_map_readRange(&vscp_core_regMap, 0, VSCP_REG_GUID_15 + index, buffer, size);
 
     return;
 }
@@ -2757,10 +3260,10 @@ static inline void  vscp_core_handleProtocolWhoIsThere(void)
 static inline void  vscp_core_handleProtocolGetDecisionMatrixInfo(void)
 {
     /* Check number of parameters. */
-    if (1 == vscp_core_rxMessage.dataSize)
+    if (1 == VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
             vscp_TxMessage  txMessage;
             uint8_t         matrixSize      = 0;
@@ -2778,7 +3281,7 @@ static inline void  vscp_core_handleProtocolGetDecisionMatrixInfo(void)
             txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
             txMessage.vscpType  = VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE;
             txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
+            txMessage.oAddr     = VSCP_CORE_INST.nickname;
             txMessage.hardCoded = VSCP_CORE_HARD_CODED;
             txMessage.dataSize  = 4;
             txMessage.data[0]   = matrixSize;
@@ -2800,37 +3303,185 @@ static inline void  vscp_core_handleProtocolGetDecisionMatrixInfo(void)
 static inline void  vscp_core_handleProtocolExtendedPageReadRegister(void)
 {
     /* Check number of parameters. */
-    if (4 <= vscp_core_rxMessage.dataSize)
+    if (4 <= VSCP_CORE_INST.rxMessage->dataSize)
     {
         /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
         {
-            vscp_core_extPageReadData.page  = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
-            vscp_core_extPageReadData.addr  = vscp_core_rxMessage.data[3];
-            vscp_core_extPageReadData.seq   = 0;
+            uint16_t    page    = (((uint16_t)VSCP_CORE_INST.rxMessage->data[1]) << 8) | (VSCP_CORE_INST.rxMessage->data[2]);
+            uint8_t     addr    = VSCP_CORE_INST.rxMessage->data[3];
+            uint16_t    count   = 1;
 
             /* Read more than one register? */
-            if (5 == vscp_core_rxMessage.dataSize)
+            if (5 == VSCP_CORE_INST.rxMessage->dataSize)
             {
-                vscp_core_extPageReadData.count = vscp_core_rxMessage.data[4];
+                count = VSCP_CORE_INST.rxMessage->data[4];
 
                 /* Shall 256 registers be read? */
-                if (0 == vscp_core_extPageReadData.count)
+                if (0 == count)
                 {
-                    vscp_core_extPageReadData.count = 256;
+                    count = 256;
                 }
             }
-            else
+
+            /* The responses are sent as far as the transport layer accepts them.
+             * All others will be sent in the following process cycles. This avoids
+             * that the framework blocks the application too long. And makes the
+             * node more responsive.
+             */
+            vscp_core_startRegRead(VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE, page, addr, count);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Handles a protocol class extended page write register event.
+ */
+static inline void  vscp_core_handleProtocolExtendedPageWriteRegister(void)
+{
+    /* Check number of parameters. */
+    if (5 <= VSCP_CORE_INST.rxMessage->dataSize)
+    {
+        /* This node? */
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
+        {
+            vscp_TxMessage  txMessage;
+            uint16_t        page        = (((uint16_t)VSCP_CORE_INST.rxMessage->data[1]) << 8) | (VSCP_CORE_INST.rxMessage->data[2]);
+            uint8_t         addr        = VSCP_CORE_INST.rxMessage->data[3];
+            uint8_t         num         = VSCP_CORE_INST.rxMessage->dataSize - 4;
+            uint8_t         dataIndex   = 0;
+
+            /* If the number of bytes to write overflows the page, it will be
+             * limited to the page end.
+             */
+            if (((0xFF - num) + 1) < addr)
             {
-                vscp_core_extPageReadData.count = 1;
+                num = (0xFF - addr) + 1;
             }
 
-            /* Only one response will be sent now.
-             * If more responses are necessary, they will be sent in the following
-             * process cycles. This avoids that the framework blocks the application
-             * too long. And makes the node more responsive.
-             */
-            vscp_core_extendedPageReadRegister(&vscp_core_extPageReadData);
+            /* Prepare tx message */
+            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
+            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
+            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
+            txMessage.oAddr     = VSCP_CORE_INST.nickname;
+            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+
+            /* Sequence number */
+            txMessage.data[0] = 0;
+
+            /* Page and register */
+            txMessage.data[1] = VSCP_CORE_INST.rxMessage->data[1];
+            txMessage.data[2] = VSCP_CORE_INST.rxMessage->data[2];
+            txMessage.data[3] = VSCP_CORE_INST.rxMessage->data[3];
+
+            dataIndex = 4;
+
+            /* Write registers, the response contains their values afterwards. */
+            memcpy(&txMessage.data[dataIndex], &VSCP_CORE_INST.rxMessage->data[4], num);
+            (void)vscp_reg_map_writeRange(&vscp_core_regMap, page, addr, &txMessage.data[dataIndex], num);
+            dataIndex += num;
+
+            txMessage.dataSize = dataIndex;
+
+            vscp_core_sendRegRsp(&txMessage);
+        }
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+/**
+ * Handles a protocol class get event interest event.
+ * The responses are sent via the register response pipeline, because the
+ * node may be interested in more events, than the transport layer accepts
+ * at once. A event interest response, which is still in progress, is
+ * restarted.
+ */
+static inline void  vscp_core_handleProtocolGetEventInterest(void)
+{
+    /* Check number of parameters. */
+    if (1 <= VSCP_CORE_INST.rxMessage->dataSize)
+    {
+        /* This node? */
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
+        {
+            vscp_interest_start();
+
+            VSCP_CORE_INST.interestRspActive = TRUE;
+            VSCP_CORE_INST.interestRspIndex  = 0;
+
+            (void)vscp_core_processRegRsp();
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function builds the next event interest response.
+ *
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_core_buildEventInterestRsp(vscp_TxMessage * const txMessage)
+{
+    uint16_t    vscpClass   = 0;
+    uint16_t    vscpType    = 0;
+
+    if (NULL == txMessage)
+    {
+        return FALSE;
+    }
+
+    if (FALSE == vscp_interest_getNext(&vscpClass, &vscpType))
+    {
+        return FALSE;
+    }
+
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->vscpType     = VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE;
+    txMessage->priority     = VSCP_PRIORITY_3_NORMAL;
+    txMessage->oAddr        = VSCP_CORE_INST.nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+    txMessage->dataSize     = 5;
+    txMessage->data[0]      = VSCP_CORE_INST.interestRspIndex;
+    txMessage->data[1]      = VSCP_UTIL_WORD_MSB(vscpClass);
+    txMessage->data[2]      = VSCP_UTIL_WORD_LSB(vscpClass);
+    txMessage->data[3]      = VSCP_UTIL_WORD_MSB(vscpType);
+    txMessage->data[4]      = VSCP_UTIL_WORD_LSB(vscpType);
+
+    ++VSCP_CORE_INST.interestRspIndex;
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+/**
+ * Handles a protocol class get embedded MDF event.
+ * The MDF is decompressed chunk by chunk and sent via the register response
+ * pipeline, therefore a large MDF doesn't block the process cycle. A embedded
+ * MDF response, which is still in progress, is restarted.
+ */
+static inline void  vscp_core_handleProtocolGetEmbeddedMdf(void)
+{
+    /* Check number of parameters. */
+    if (1 <= VSCP_CORE_INST.rxMessage->dataSize)
+    {
+        /* This node? */
+        if (VSCP_CORE_INST.nickname == VSCP_CORE_INST.rxMessage->data[0])
+        {
+            VSCP_CORE_INST.mdfRspAvailable = vscp_mdf_start();
+            VSCP_CORE_INST.mdfRspActive    = TRUE;
+            VSCP_CORE_INST.mdfRspIndex     = 0;
+
+            (void)vscp_core_processRegRsp();
         }
     }
 
@@ -2838,141 +3489,374 @@ static inline void  vscp_core_handleProtocolExtendedPageReadRegister(void)
 }
 
 /**
- * This function handles a extended page read register.
+ * This function builds the next embedded MDF response. Every response
+ * contains the index and up to 6 bytes of the MDF. If no MDF is available,
+ * a single response with index 0 and no MDF data is built.
  *
- * @param[in] data  Extended page read register data
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
  */
-static void vscp_core_extendedPageReadRegister(ExtPageRead * const data)
+static BOOL vscp_core_buildEmbeddedMdfRsp(vscp_TxMessage * const txMessage)
+{
+    uint8_t size    = 0;
+
+    if (NULL == txMessage)
+    {
+        return FALSE;
+    }
+
+    if (TRUE == VSCP_CORE_INST.mdfRspAvailable)
+    {
+        size = vscp_mdf_read(&txMessage->data[2], VSCP_L1_DATA_SIZE - 2);
+
+        if (0 == size)
+        {
+            return FALSE;
+        }
+
+        txMessage->dataSize = 2 + size;
+    }
+    /* No MDF available, which is signalled by a single response with the data 0, 0, 0. */
+    else if (0 == VSCP_CORE_INST.mdfRspIndex)
+    {
+        txMessage->data[2]  = 0;
+        txMessage->dataSize = 3;
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+    txMessage->vscpType     = VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE;
+    txMessage->priority     = VSCP_PRIORITY_3_NORMAL;
+    txMessage->oAddr        = VSCP_CORE_INST.nickname;
+    txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
+    txMessage->data[0]      = VSCP_UTIL_WORD_MSB(VSCP_CORE_INST.mdfRspIndex);
+    txMessage->data[1]      = VSCP_UTIL_WORD_LSB(VSCP_CORE_INST.mdfRspIndex);
+
+    ++VSCP_CORE_INST.mdfRspIndex;
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+/**
+ * Initialize the register response pipeline. All register responses, which
+ * are in progress, are aborted.
+ */
+static void vscp_core_initRegRsp(void)
+{
+    VSCP_CORE_INST.regReadData.rspType = VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE;
+    VSCP_CORE_INST.regReadData.page    = 0;
+    VSCP_CORE_INST.regReadData.addr    = 0;
+    VSCP_CORE_INST.regReadData.count   = 0;
+    VSCP_CORE_INST.regReadData.seq     = 0;
+
+    VSCP_CORE_INST.regRspPending         = FALSE;
+    VSCP_CORE_INST.whoIsThereRspPending  = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+    VSCP_CORE_INST.interestRspActive = FALSE;
+    VSCP_CORE_INST.interestRspIndex  = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+    VSCP_CORE_INST.mdfRspActive     = FALSE;
+    VSCP_CORE_INST.mdfRspAvailable  = FALSE;
+    VSCP_CORE_INST.mdfRspIndex      = 0;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+    vscp_util_cyclicBufferInit( &VSCP_CORE_INST.regRspQueue,
+                                VSCP_CORE_INST.regRspStorage,
+                                sizeof(VSCP_CORE_INST.regRspStorage),
+                                sizeof(vscp_TxMessage));
+
+    return;
+}
+
+/**
+ * Start a page read or a extended page read. A register read, which is still
+ * in progress, will be aborted. As many responses as the transport layer
+ * accepts are sent immediately, all others in the following process cycles.
+ *
+ * @param[in] rspType   Response type (VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE or VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE)
+ * @param[in] page      Page
+ * @param[in] addr      Address of the first register
+ * @param[in] count     Number of registers to read
+ */
+static void vscp_core_startRegRead(uint8_t rspType, uint16_t page, uint8_t addr, uint16_t count)
+{
+    VSCP_CORE_INST.regReadData.rspType = rspType;
+    VSCP_CORE_INST.regReadData.page    = page;
+    VSCP_CORE_INST.regReadData.addr    = addr;
+    VSCP_CORE_INST.regReadData.count   = count;
+    VSCP_CORE_INST.regReadData.seq     = 0;
+
+    (void)vscp_core_processRegRsp();
+
+    return;
+}
+
+/**
+ * This function builds the next response of a page read or a extended page
+ * read and moves the register read cursor behind the read registers.
+ *
+ * @param[in,out]   data        Register read data
+ * @param[out]      txMessage   Response message
+ */
+static void vscp_core_buildRegReadRsp(RegRead * const data, vscp_TxMessage * const txMessage)
 {
     if ((NULL != data) &&
+        (NULL != txMessage) &&
         (0 < data->count))
     {
-        vscp_TxMessage  txMessage;
-        uint8_t         index       = 0;
-        uint8_t         addr        = data->addr;
-        uint16_t        count       = data->count;
-        BOOL            nextPage    = FALSE;
+        uint8_t     index       = 0;
+        uint8_t     addr        = data->addr;
+        uint16_t    count       = data->count;
+        uint8_t     num         = 0;
 
         /* Prepare tx message */
-        txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-        txMessage.vscpType  = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
-        txMessage.priority  = VSCP_PRIORITY_7_LOW;
-        txMessage.oAddr     = vscp_core_nickname;
-        txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+        txMessage->vscpClass    = VSCP_CLASS_L1_PROTOCOL;
+        txMessage->vscpType     = data->rspType;
+        txMessage->oAddr        = VSCP_CORE_INST.nickname;
+        txMessage->hardCoded    = VSCP_CORE_HARD_CODED;
 
         /* Sequence number */
-        txMessage.data[0] = data->seq;
+        txMessage->data[0] = data->seq;
+
+        if (VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE == data->rspType)
+        {
+            txMessage->priority = VSCP_PRIORITY_7_LOW;
 
-        /* Page and offset */
-        txMessage.data[1] = (data->page >> 8) & 0xff;
-        txMessage.data[2] = (data->page >> 0) & 0xff;
-        txMessage.data[3] = addr;
+            /* Page and offset */
+            txMessage->data[1] = (data->page >> 8) & 0xff;
+            txMessage->data[2] = (data->page >> 0) & 0xff;
+            txMessage->data[3] = addr;
 
-        /* Read registers */
-        index = 4;
-        do
+            index = 4;
+        }
+        else
         {
-            txMessage.data[index] = vscp_core_readRegister(data->page, addr);
-            ++index;
-            --count;
+            txMessage->priority = VSCP_PRIORITY_3_NORMAL;
 
-            /* If the read takes place on the next page, a new event shall be used,
-             * because the event parameter contains the page, where all read
-             * registers are located.
-             */
-            if (0xff > addr)
-            {
-                ++addr;
-            }
-            else
-            {
-                nextPage = TRUE;
-            }
+            index = 1;
         }
-        while((VSCP_L1_DATA_SIZE > index) && (0 < count) && (FALSE == nextPage));
 
-        /* Set event data size */
-        txMessage.dataSize = index;
+        /* Number of registers, which fit into the event. If the read takes
+         * place on the next page, a new event shall be used, because the event
+         * parameter contains the page, where all read registers are located.
+         */
+        num = VSCP_L1_DATA_SIZE - index;
 
-        if (TRUE == vscp_transport_writeMessage(&txMessage))
+        if (count < num)
         {
-            /* Continue on the next page? */
-            if (TRUE == nextPage)
-            {
-                ++data->page;
-                data->addr = 0;
-            }
-            /* Continue on the same page */
-            else
-            {
-                data->addr = addr;
-            }
+            num = (uint8_t)count;
+        }
+
+        if ((0xff - addr) < (num - 1))
+        {
+            num = (0xff - addr) + 1;
+        }
+
+        /* Read registers */
+        vscp_reg_map_readRange(&vscp_core_regMap, data->page, addr, &txMessage->data[index], num);
+        index += num;
+        count -= num;
+
+        /* Set event data size */
+        txMessage->dataSize = index;
 
-            data->count = count;
-            ++data->seq;
+        /* Continue on the next page? */
+        if ((0xff - addr) < num)
+        {
+            ++data->page;
+            data->addr = 0;
+        }
+        /* Continue on the same page */
+        else
+        {
+            data->addr = addr + num;
         }
+
+        data->count = count;
+        ++data->seq;
     }
 
     return;
 }
 
 /**
- * Handles a protocol class extended page write register event.
+ * Send a register response. If the transport layer is busy or other register
+ * responses are still waiting, it will be queued and sent in the following
+ * process cycles.
+ *
+ * Note, no event is taken from the transport layer, as long as the queue is
+ * full. A response can only be lost, if a single event causes more responses
+ * than the queue can hold. Such a response is counted as drop.
+ *
+ * @param[in] txMessage Response message
  */
-static inline void  vscp_core_handleProtocolExtendedPageWriteRegister(void)
+static void vscp_core_sendRegRsp(vscp_TxMessage const * const txMessage)
 {
-    /* Check number of parameters. */
-    if (5 <= vscp_core_rxMessage.dataSize)
+    /* Send it immediately only, if no other response is waiting, to keep the order. */
+    if ((TRUE == VSCP_CORE_INST.regRspPending) ||
+        (VSCP_CORE_INST.regRspQueue.readIndex != VSCP_CORE_INST.regRspQueue.writeIndex) ||
+        (FALSE == vscp_transport_writeMessage(txMessage)))
     {
-        /* This node? */
-        if (vscp_core_nickname == vscp_core_rxMessage.data[0])
+        if ((0 == vscp_util_cyclicBufferWrite(&VSCP_CORE_INST.regRspQueue, txMessage, 1)) &&
+            (0xffff > VSCP_CORE_INST.regRspDrops))
         {
-            vscp_TxMessage  txMessage;
-            uint16_t        page        = (((uint16_t)vscp_core_rxMessage.data[1]) << 8) | (vscp_core_rxMessage.data[2]);
-            uint8_t         addr        = vscp_core_rxMessage.data[3];
-            uint8_t         num         = vscp_core_rxMessage.dataSize - 4;
-            uint8_t         index       = 0;
-            uint8_t         dataIndex   = 0;
+            ++VSCP_CORE_INST.regRspDrops;
+        }
+    }
 
-            /* If the number of bytes to write overflows the page, it will be
-             * limited to the page end.
-             */
-            if (((0xFF - num) + 1) < addr)
+    return;
+}
+
+/**
+ * Send the waiting register responses and continue a page read, a extended
+ * page read, a event interest or a embedded MDF response, as long as the
+ * transport layer accepts the messages. A message, which is refused by the
+ * transport layer, will be retried in the next process cycle. The register
+ * read is not repeated, because it may have side effects, e.g. reading the
+ * alarm status register clears it.
+ *
+ * @return If at least one register response was sent, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_core_processRegRsp(void)
+{
+    uint8_t frames      = 0;
+    BOOL    isTxReady   = TRUE;
+
+    while((TRUE == isTxReady) &&
+          (VSCP_CONFIG_REG_RSP_FRAMES_PER_CYCLE > frames))
+    {
+        /* No response in progress? Take the next waiting one or continue the register read. */
+        if (FALSE == VSCP_CORE_INST.regRspPending)
+        {
+            if (0 < vscp_util_cyclicBufferRead(&VSCP_CORE_INST.regRspQueue, &VSCP_CORE_INST.regRspMessage, 1))
             {
-                num = (0xFF - addr) + 1;
+                VSCP_CORE_INST.regRspPending = TRUE;
+            }
+            else if (0 < VSCP_CORE_INST.regReadData.count)
+            {
+                vscp_core_buildRegReadRsp(&VSCP_CORE_INST.regReadData, &VSCP_CORE_INST.regRspMessage);
+                VSCP_CORE_INST.regRspPending = TRUE;
             }
 
-            /* Prepare tx message */
-            txMessage.vscpClass = VSCP_CLASS_L1_PROTOCOL;
-            txMessage.vscpType  = VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE;
-            txMessage.priority  = VSCP_PRIORITY_3_NORMAL;
-            txMessage.oAddr     = vscp_core_nickname;
-            txMessage.hardCoded = VSCP_CORE_HARD_CODED;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
 
-            /* Sequence number */
-            txMessage.data[0] = 0;
+            else if (TRUE == VSCP_CORE_INST.interestRspActive)
+            {
+                if (TRUE == vscp_core_buildEventInterestRsp(&VSCP_CORE_INST.regRspMessage))
+                {
+                    VSCP_CORE_INST.regRspPending = TRUE;
+                }
+                else
+                {
+                    VSCP_CORE_INST.interestRspActive = FALSE;
+                }
+            }
 
-            /* Page and register */
-            txMessage.data[1] = vscp_core_rxMessage.data[1];
-            txMessage.data[2] = vscp_core_rxMessage.data[2];
-            txMessage.data[3] = vscp_core_rxMessage.data[3];
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
 
-            dataIndex = 4;
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
 
-            /* Write registers */
-            for(index = 0; index < num; ++index)
+            else if (TRUE == VSCP_CORE_INST.mdfRspActive)
             {
-                txMessage.data[dataIndex] = vscp_core_writeRegister(page, addr + index, vscp_core_rxMessage.data[4 + index], NULL);
-                ++dataIndex;
+                if (TRUE == vscp_core_buildEmbeddedMdfRsp(&VSCP_CORE_INST.regRspMessage))
+                {
+                    VSCP_CORE_INST.regRspPending = TRUE;
+                }
+                else
+                {
+                    VSCP_CORE_INST.mdfRspActive = FALSE;
+                }
             }
 
-            txMessage.dataSize = dataIndex;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+        }
 
-            (void)vscp_transport_writeMessage(&txMessage);
+        if (FALSE == VSCP_CORE_INST.regRspPending)
+        {
+            /* Nothing to send */
+            isTxReady = FALSE;
+        }
+        else if (FALSE == vscp_transport_writeMessage(&VSCP_CORE_INST.regRspMessage))
+        {
+            /* Transport layer is busy, retry in the next process cycle. */
+            isTxReady = FALSE;
+        }
+        else
+        {
+            VSCP_CORE_INST.regRspPending = FALSE;
+            ++frames;
         }
     }
 
-    return;
+    return (0 < frames) ? TRUE : FALSE;
+}
+
+/**
+ * This function determines whether register responses are still in progress,
+ * e.g. because the transport layer refused them or a page read continues.
+ *
+ * @return If register responses are still in progress, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_core_isRegRspPending(void)
+{
+    BOOL    isBusy  = FALSE;
+
+    if ((TRUE == VSCP_CORE_INST.regRspPending) ||
+        (0 < VSCP_CORE_INST.regReadData.count) ||
+        (VSCP_CORE_INST.regRspQueue.readIndex != VSCP_CORE_INST.regRspQueue.writeIndex))
+    {
+        isBusy = TRUE;
+    }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+    if (TRUE == VSCP_CORE_INST.interestRspActive)
+    {
+        isBusy = TRUE;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+    if (TRUE == VSCP_CORE_INST.mdfRspActive)
+    {
+        isBusy = TRUE;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+    return isBusy;
+}
+
+/**
+ * This function determines whether the register response queue is full.
+ *
+ * @return If the queue is full, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_core_isRegRspQueueFull(void)
+{
+    BOOL    isFull          = FALSE;
+    uint8_t nextWriteIndex  = (VSCP_CORE_INST.regRspQueue.writeIndex + 1) % VSCP_CORE_INST.regRspQueue.num;
+
+    if (VSCP_CORE_INST.regRspQueue.readIndex == nextWriteIndex)
+    {
+        isFull = TRUE;
+    }
+
+    return isFull;
 }
 
 /**
@@ -2984,7 +3868,7 @@ static inline void  vscp_core_handleProtocolExtendedPageWriteRegister(void)
  */
 static inline uint8_t   vscp_core_getStartUpControl(void)
 {
-    return (vscp_ps_readNodeControlFlags() >> 6) & 0x03;
+    return (VSCP_CORE_INST.regNodeControlFlags >> 6) & 0x03;
 }
 
 /**
@@ -2996,5 +3880,25 @@ static inline uint8_t   vscp_core_getStartUpControl(void)
  */
 static inline uint8_t   vscp_core_getRegAppWriteProtect(void)
 {
-    return (vscp_ps_readNodeControlFlags() >> 5) & 0x01;
+    return (VSCP_CORE_INST.regNodeControlFlags >> 5) & 0x01;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+/**
+ * This function is called every second by the time since epoch timer and
+ * increases the unix timestamp. After a sleep, it is called for every missed
+ * second.
+ *
+ * @param[in]   id  Timer id
+ */
+static void vscp_core_timeSinceEpochCallback(uint8_t id)
+{
+    (void)id;
+
+    ++VSCP_CORE_INST.timeSinceEpoch;
+
+    return;
 }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
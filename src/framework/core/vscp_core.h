@@ -149,14 +149,38 @@ extern void vscp_core_restoreFactoryDefaultSettings(void);
  * cyclic period.
  *
  * Note, for a fast handling of received events, this function returns TRUE in
- * case a event was handled partly or completely, otherwise FALSE.
- * Call it e.g. in a loop until no event is handled anymore. If its not
+ * case a event was received or a response was sent, otherwise FALSE.
+ * Call it e.g. in a loop until no progress is made anymore. If its not
  * necessary in your application, just skip the return value.
+ * Work, which waits for the transport layer, is not reported as progress, but
+ * by vscp_core_getTimeToProcess().
  *
- * @return If a received event was handled, it will return TRUE otherwise FALSE.
+ * @return If a event was received or a response was sent, it will return TRUE otherwise FALSE.
  */
 extern BOOL vscp_core_process(void);
 
+/**
+ * This function determines whether the last vscp_core_process() cycle received
+ * a event. In contrast to the return value of vscp_core_process(), responses
+ * which are sent without a received event are not considered.
+ *
+ * @return If a event was received, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_core_isEventReceived(void);
+
+/**
+ * This function returns the time until the core stack has to be processed
+ * again. Until then, vscp_core_process() would have nothing to do and the
+ * node may sleep. A event, which is received in the meantime, needs to wake
+ * it up.
+ *
+ * If VSCP_CONFIG_TIMER_DEADLINE is disabled, the time is in ticks of
+ * vscp_timer_process().
+ *
+ * @return Time in ms, 0 if the core stack has to be processed immediately or VSCP_TIMER_NO_EXPIRY if no timer is running.
+ */
+extern uint32_t vscp_core_getTimeToProcess(void);
+
 /**
  * This function reads the nickname id of the node.
  *
@@ -189,6 +213,15 @@ extern void vscp_core_setAlarm(uint8_t value);
  */
 extern BOOL vscp_core_isActive(void);
 
+/**
+ * This function returns the number of register responses, which were dropped,
+ * because the register response queue was full.
+ * Note, that calling this function clears the drop counter.
+ *
+ * @return Number of dropped register responses
+ */
+extern uint16_t vscp_core_getRegRspDrops(void);
+
 /**
  * Get the time since epoch 00:00:00 UTC, January 1, 1970.
  * The time itself is received by the segment master.
@@ -236,6 +269,37 @@ extern void vscp_core_prepareTxMessage(vscp_TxMessage * const txMessage, uint16_
  */
 extern BOOL vscp_core_sendEvent(vscp_TxMessage const * const txMessage);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function prepares a Level II transmit message with default values.
+ *
+ * Default values:
+ * - Nodes GUID
+ * - No data
+ *
+ * The data itself is not touched. It may be a block of the payload pool,
+ * see vscp_l2_alloc(), or a buffer of the application.
+ *
+ * @param[in,out]   txMessage   Transmit message which will be prepared.
+ * @param[in]       vscpClass   Transmit message VSCP class
+ * @param[in]       vscpType    Transmit message VSCP type
+ * @param[in]       priority    Transmit message priority
+ */
+extern void vscp_core_prepareL2Message(vscp_L2Message * const txMessage, uint16_t vscpClass, uint16_t vscpType, VSCP_PRIORITY priority);
+
+/**
+ * Send a Level II event to the communication bus.
+ *
+ * @param[in]   txMessage   The event which will be sent.
+ * @return Status
+ * @retval FALSE    Failed to send the event.
+ * @retval TRUE     Event successful sent.
+ */
+extern BOOL vscp_core_sendL2Event(vscp_L2Message const * const txMessage);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
 /**
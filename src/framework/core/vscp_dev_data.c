@@ -41,6 +41,7 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_dev_data.h"
+#include "vscp_instance.h"
 #include "vscp_dev_data_config.h"
 #include "vscp_ps.h"
 #include "vscp_util.h"
@@ -50,28 +51,221 @@
     COMPILER SWITCHES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT )
+
+/** The GUID is loaded from a storage and mirrored in RAM. */
+#define VSCP_DEV_DATA_GUID_MIRROR               VSCP_CONFIG_BASE_ENABLED
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT ) */
+
+/** The GUID is set at run time, see vscp_dev_data_set(). */
+#define VSCP_DEV_DATA_GUID_MIRROR               VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS ) && VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) && VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS )
+
+/** The standard device family code is loaded from the persistent memory. */
+#define VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS    VSCP_CONFIG_BASE_ENABLED
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+
+/** The standard device family code is given at compile time. */
+#define VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS    VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) && VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS )
+
+/** The standard device type is loaded from the persistent memory. */
+#define VSCP_DEV_DATA_STD_DEV_TYPE_PS           VSCP_CONFIG_BASE_ENABLED
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+
+/** The standard device type is given at compile time. */
+#define VSCP_DEV_DATA_STD_DEV_TYPE_PS           VSCP_CONFIG_BASE_DISABLED
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+
 /*******************************************************************************
     CONSTANTS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE )
+
+/** Standard device family code */
+#define VSCP_DEV_DATA_STD_DEV_FAMILY_CODE       VSCP_DEV_DATA_CONFIG_STANDARD_DEVICE_FAMILY_CODE
+
+/** Standard device type */
+#define VSCP_DEV_DATA_STD_DEV_TYPE              VSCP_DEV_DATA_CONFIG_STANDARD_DEVICE_TYPE
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
+
+/** Standard device family code: Not supported */
+#define VSCP_DEV_DATA_STD_DEV_FAMILY_CODE       ((uint32_t)0x00000000)
+
+/** Standard device type: Not supported */
+#define VSCP_DEV_DATA_STD_DEV_TYPE              ((uint32_t)0x00000000)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_DEV_DATA_INST      (vscp_dev_data_instances[VSCP_INSTANCE])
+
+/** Get a byte of a value, index 0 is the LSB. */
+#define VSCP_DEV_DATA_BYTE(__value, __index) \
+    ((uint8_t)((((uint32_t)(__value)) >> (8U * (__index))) & 0xffU))
+
+/** Get a byte of the standard device family code or type. 0xFF shall be mapped to 0x00 according to specification. */
+#define VSCP_DEV_DATA_STD_DEV_BYTE(__value, __index) \
+    ((0xffU == VSCP_DEV_DATA_BYTE((__value), (__index))) ? 0U : VSCP_DEV_DATA_BYTE((__value), (__index)))
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Data of a framework instance */
+typedef struct
+{
+    /** Device parameter container */
+    vscp_dev_data_Container container;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_GUID_MIRROR )
+
+    /** GUID, MSB first */
+    uint8_t guid[VSCP_GUID_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_GUID_MIRROR ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS )
+
+    /** Node zone */
+    uint8_t zone;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS )
+
+    /** Node sub zone */
+    uint8_t subZone;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS )
+
+    /** Manufacturer device id, LSB first */
+    uint8_t manufacturerDevId[VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS )
+
+    /** Manufacturer sub device id, LSB first */
+    uint8_t manufacturerSubDevId[VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS )
+
+    /** Standard device family code, MSB first */
+    uint8_t stdDevFamilyCode[VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS )
+
+    /** Standard device type, MSB first */
+    uint8_t stdDevType[VSCP_DEV_DATA_STD_DEV_TYPE_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS )
+
+    /** MDF URL */
+    uint8_t mdfUrl[VSCP_DEV_DATA_MDF_URL_SIZE];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
+} vscp_dev_data_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+static void vscp_dev_data_load(void);
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Device parameter container */
-static vscp_dev_data_Container  vscp_dev_data_container;
+/** Data of all framework instances */
+static vscp_dev_data_Instance  vscp_dev_data_instances[VSCP_INSTANCE_NUM];
+
+/** Manufacturer device id, LSB first. It's the factory default, if it is stored in the persistent memory. */
+static const uint8_t vscp_dev_data_manufacturerDevId[VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE] PROGMEM =
+{
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_DEVICE_ID, 0),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_DEVICE_ID, 1),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_DEVICE_ID, 2),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_DEVICE_ID, 3)
+};
+
+/** Manufacturer sub device id, LSB first. It's the factory default, if it is stored in the persistent memory. */
+static const uint8_t vscp_dev_data_manufacturerSubDevId[VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE] PROGMEM =
+{
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_SUB_DEVICE_ID, 0),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_SUB_DEVICE_ID, 1),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_SUB_DEVICE_ID, 2),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_MANUFACTURER_SUB_DEVICE_ID, 3)
+};
+
+/** Firmware version */
+static const uint8_t vscp_dev_data_firmwareVersion[VSCP_DEV_DATA_FIRMWARE_VERSION_SIZE] PROGMEM =
+{
+    VSCP_DEV_DATA_CONFIG_VERSION_MAJOR,
+    VSCP_DEV_DATA_CONFIG_VERSION_MINOR,
+    VSCP_DEV_DATA_CONFIG_VERSION_SUB_MINOR
+};
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS )
+
+/** Standard device family code, MSB first */
+static const uint8_t vscp_dev_data_stdDevFamilyCode[VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE] PROGMEM =
+{
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_FAMILY_CODE, 3),
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_FAMILY_CODE, 2),
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_FAMILY_CODE, 1),
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_FAMILY_CODE, 0)
+};
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS )
+
+/** Standard device type, MSB first */
+static const uint8_t vscp_dev_data_stdDevType[VSCP_DEV_DATA_STD_DEV_TYPE_SIZE] PROGMEM =
+{
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_TYPE, 3),
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_TYPE, 2),
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_TYPE, 1),
+    VSCP_DEV_DATA_STD_DEV_BYTE(VSCP_DEV_DATA_STD_DEV_TYPE, 0)
+};
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
+
+/** Firmware device code, MSB first */
+static const uint8_t vscp_dev_data_firmwareDeviceCode[VSCP_DEV_DATA_FIRMWARE_DEVICE_CODE_SIZE] PROGMEM =
+{
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_FIRMWARE_DEVICE_CODE, 1),
+    VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_CONFIG_FIRMWARE_DEVICE_CODE, 0)
+};
+
+/** MDF URL, the rest is filled with zeros. It's the factory default, if it is stored in the persistent memory. */
+static const uint8_t vscp_dev_data_mdfUrl[VSCP_DEV_DATA_MDF_URL_SIZE] PROGMEM = VSCP_DEV_DATA_CONFIG_MDF_URL;
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -91,11 +285,14 @@ extern void vscp_dev_data_init(void)
     /* Initialize data container */
     for(index = 0; index < VSCP_GUID_SIZE; ++index)
     {
-        vscp_dev_data_container.guid[index] = 0;
+        VSCP_DEV_DATA_INST.container.guid[index] = 0;
     }
     
-    vscp_dev_data_container.zone    = 0xff;
-    vscp_dev_data_container.subZone = 0xff;
+    VSCP_DEV_DATA_INST.container.zone    = 0xff;
+    VSCP_DEV_DATA_INST.container.subZone = 0xff;
+
+    /* Load the data, which is mirrored in RAM, once. */
+    vscp_dev_data_load();
 
     return;
 }
@@ -109,7 +306,7 @@ extern void vscp_dev_data_set(vscp_dev_data_Container const * const container)
 {
     if (NULL != container)
     {
-        vscp_dev_data_container = *container;
+        VSCP_DEV_DATA_INST.container = *container;
     }
 
     return;
@@ -154,12 +351,11 @@ extern void vscp_dev_data_restoreFactoryDefaultSettings(void)
 
     /* Restore manufacturer device id */
     {
-        uint8_t         index               = 0;
-        const uint32_t  manufacturerDevId   = VSCP_DEV_DATA_CONFIG_MANUFACTURER_DEVICE_ID;
+        uint8_t index   = 0;
 
         for(index = 0; index < VSCP_PS_SIZE_MANUFACTURER_DEV_ID; ++index)
         {
-            vscp_ps_writeManufacturerDevId(index, ((const uint8_t*)&manufacturerDevId)[index]);
+            vscp_ps_writeManufacturerDevId(index, pgm_read_byte(&vscp_dev_data_manufacturerDevId[index]));
         }
     }
 
@@ -169,12 +365,11 @@ extern void vscp_dev_data_restoreFactoryDefaultSettings(void)
 
     /* Restore manufacturer sub device id */
     {
-        uint8_t         index               = 0;
-        const uint32_t  manufacturerSubDevId   = VSCP_DEV_DATA_CONFIG_MANUFACTURER_SUB_DEVICE_ID;
+        uint8_t index   = 0;
 
         for(index = 0; index < VSCP_PS_SIZE_MANUFACTURER_SUB_DEV_ID; ++index)
         {
-            vscp_ps_writeManufacturerSubDevId(index, ((const uint8_t*)&manufacturerSubDevId)[index]);
+            vscp_ps_writeManufacturerSubDevId(index, pgm_read_byte(&vscp_dev_data_manufacturerSubDevId[index]));
         }
     }
 
@@ -184,70 +379,46 @@ extern void vscp_dev_data_restoreFactoryDefaultSettings(void)
 
     /* Restore MDF URL */
     {
-        uint8_t     index       = 0;
-        uint8_t     mdfIndex    = 0;
-        const char  mdfUrl[]    = VSCP_DEV_DATA_CONFIG_MDF_URL;
+        uint8_t index   = 0;
 
         for(index = 0; index < VSCP_PS_SIZE_MDF_URL; ++index)
         {
-            uint8_t value   = 0;
-
-            if ('\0' != mdfUrl[mdfIndex])
-            {
-                value = (uint8_t)mdfUrl[mdfIndex];
-                ++mdfIndex;
-            }
-            else
-            /* Fill rest of mdf with zero's */
-            {
-                value = 0;
-            }
-
-            vscp_ps_writeMdfUrl(index, value);
+            vscp_ps_writeMdfUrl(index, pgm_read_byte(&vscp_dev_data_mdfUrl[index]));
         }
     }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE )
-
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS )
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS )
 
     /* Restore standard device family code */
     {
-        uint8_t     index               = 0;
-        uint32_t    stdDevFamilyCode    = VSCP_DEV_DATA_CONFIG_STANDARD_DEVICE_FAMILY_CODE;
-        uint8_t     value               = 0;
+        uint8_t index   = 0;
 
         for(index = 0; index < VSCP_PS_SIZE_STD_DEV_FAMILY_CODE; ++index)
         {
-            value   = (uint8_t)((stdDevFamilyCode >> index) & 0xff);
-
-            vscp_ps_writeStdDevFamilyCode(index, value);
+            vscp_ps_writeStdDevFamilyCode(index, VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_STD_DEV_FAMILY_CODE, index));
         }
     }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS )
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS )
 
     /* Restore standard device type */
     {
-        uint8_t     index       = 0;
-        uint32_t    stdDevType  = VSCP_DEV_DATA_CONFIG_STANDARD_DEVICE_TYPE;
-        uint8_t     value       = 0;
+        uint8_t index   = 0;
 
         for(index = 0; index < VSCP_PS_SIZE_STD_DEV_TYPE; ++index)
         {
-            value   = (uint8_t)((stdDevType >> index) & 0xff);
-
-            vscp_ps_writeStdDevType(index, value);
+            vscp_ps_writeStdDevType(index, VSCP_DEV_DATA_BYTE(VSCP_DEV_DATA_STD_DEV_TYPE, index));
         }
     }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
+    /* Update the data, which is mirrored in RAM. */
+    vscp_dev_data_load();
 
     return;
 }
@@ -261,28 +432,14 @@ extern void vscp_dev_data_restoreFactoryDefaultSettings(void)
  */
 extern uint8_t  vscp_dev_data_getGUID(uint8_t index)
 {
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS )
+    uint8_t value   = 0;
 
-    return vscp_ps_readGUID(index);
-
-#elif VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT )
-
-    return vscp_portable_readGUID(index);
-
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS )
-           VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT ) */
-
-    uint8_t         value   = 0;
-
-    if (VSCP_UTIL_ARRAY_NUM(vscp_dev_data_container.guid) > index)
+    if (VSCP_GUID_SIZE > index)
     {
-        value = vscp_dev_data_container.guid[VSCP_UTIL_ARRAY_NUM(vscp_dev_data_container.guid) - index - 1];
+        value = vscp_dev_data_getGUIDStorage()[VSCP_GUID_SIZE - index - 1];
     }
 
     return value;
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS )
-           VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_EXT ) */
 }
 
 /**
@@ -294,11 +451,11 @@ extern uint8_t  vscp_dev_data_getNodeZone(void)
 {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS )
 
-    return vscp_ps_readNodeZone();
+    return VSCP_DEV_DATA_INST.zone;
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS ) */
 
-    return vscp_dev_data_container.zone;
+    return VSCP_DEV_DATA_INST.container.zone;
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS ) */
 }
@@ -312,11 +469,11 @@ extern uint8_t  vscp_dev_data_getNodeSubZone(void)
 {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS )
 
-    return vscp_ps_readNodeSubZone();
+    return VSCP_DEV_DATA_INST.subZone;
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS ) */
 
-    return vscp_dev_data_container.subZone;
+    return VSCP_DEV_DATA_INST.container.subZone;
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS ) */
 }
@@ -330,23 +487,22 @@ extern uint8_t  vscp_dev_data_getNodeSubZone(void)
  */
 extern uint8_t  vscp_dev_data_getManufacturerDevId(uint8_t index)
 {
+    uint8_t value   = 0;
+
+    if (VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE > index)
+    {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS )
 
-    return vscp_ps_readManufacturerDevId(index);
+        value = VSCP_DEV_DATA_INST.manufacturerDevId[index];
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
 
-    uint8_t         value               = 0;
-    const uint32_t  manufacturerDevId   = VSCP_DEV_DATA_CONFIG_MANUFACTURER_DEVICE_ID;
+        value = pgm_read_byte(&vscp_dev_data_manufacturerDevId[index]);
 
-    if (sizeof(manufacturerDevId) > index)
-    {
-        value = ((const uint8_t*)&manufacturerDevId)[index];
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
     }
 
     return value;
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
 }
 
 /**
@@ -358,23 +514,22 @@ extern uint8_t  vscp_dev_data_getManufacturerDevId(uint8_t index)
  */
 extern uint8_t  vscp_dev_data_getManufacturerSubDevId(uint8_t index)
 {
+    uint8_t value   = 0;
+
+    if (VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE > index)
+    {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS )
 
-    return vscp_ps_readManufacturerSubDevId(index);
+        value = VSCP_DEV_DATA_INST.manufacturerSubDevId[index];
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
 
-    uint8_t         value               = 0;
-    const uint32_t  manufacturerSubDevId   = VSCP_DEV_DATA_CONFIG_MANUFACTURER_SUB_DEVICE_ID;
+        value = pgm_read_byte(&vscp_dev_data_manufacturerSubDevId[index]);
 
-    if (sizeof(manufacturerSubDevId) > index)
-    {
-        value = ((const uint8_t*)&manufacturerSubDevId)[index];
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
     }
 
     return value;
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
 }
 
 /**
@@ -385,30 +540,22 @@ extern uint8_t  vscp_dev_data_getManufacturerSubDevId(uint8_t index)
  */
 extern uint8_t  vscp_dev_data_getMdfUrl(uint8_t index)
 {
+    uint8_t value   = 0;
+
+    if (VSCP_DEV_DATA_MDF_URL_SIZE > index)
+    {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS )
 
-    return vscp_ps_readMdfUrl(index);
+        value = VSCP_DEV_DATA_INST.mdfUrl[index];
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
 
-    uint8_t     value       = 0;
-    const char  mdfUrl[]    = VSCP_DEV_DATA_CONFIG_MDF_URL;
-    uint8_t     run         = 0;
+        value = pgm_read_byte(&vscp_dev_data_mdfUrl[index]);
 
-    while('\0' != mdfUrl[run])
-    {
-        if (index == run)
-        {
-            value = (uint8_t)mdfUrl[run];
-            break;
-        }
-
-        ++run;
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
     }
 
     return value;
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
 }
 
 /**
@@ -451,30 +598,25 @@ extern uint8_t  vscp_dev_data_getFirmwareVersionSubMinor(void)
  */
 extern uint8_t  vscp_dev_data_getStdDevFamilyCode(uint8_t index)
 {
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE )
+    uint8_t value   = 0;
 
-    uint32_t    stdDevFamilyCode    = VSCP_DEV_DATA_CONFIG_STANDARD_DEVICE_FAMILY_CODE;
-    uint8_t     value               = (uint8_t)((stdDevFamilyCode >> ((uint32_t)index)) & 0xff);
+    if (VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE > index)
+    {
+        /* The storage is MSB first. */
+        index = VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE - index - 1;
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS )
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS )
 
-    value = vscp_ps_readStdDevFamilyCode(index);
+        value = VSCP_DEV_DATA_INST.stdDevFamilyCode[index];
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
 
-    /* 0xFF shall be mapped to 0x00 according to specification. */
-    if (0xFF == value)
-    {
-        value = 0x00;
+        value = pgm_read_byte(&vscp_dev_data_stdDevFamilyCode[index]);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
     }
 
     return value;
-
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
-
-    return 0;
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
 }
 
 /**
@@ -487,30 +629,25 @@ extern uint8_t  vscp_dev_data_getStdDevFamilyCode(uint8_t index)
  */
 extern uint8_t  vscp_dev_data_getStdDevType(uint8_t index)
 {
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE )
+    uint8_t value   = 0;
 
-    uint32_t    stdDevType  = VSCP_DEV_DATA_CONFIG_STANDARD_DEVICE_TYPE;
-    uint8_t     value       = (uint8_t)((stdDevType >> ((uint32_t)index)) & 0xff);
+    if (VSCP_DEV_DATA_STD_DEV_TYPE_SIZE > index)
+    {
+        /* The storage is MSB first. */
+        index = VSCP_DEV_DATA_STD_DEV_TYPE_SIZE - index - 1;
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS )
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS )
 
-    value = vscp_ps_readStdDevType(index);
+        value = VSCP_DEV_DATA_INST.stdDevType[index];
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
 
-    /* 0xFF shall be mapped to 0x00 according to specification. */
-    if (0xFF == value)
-    {
-        value = 0x00;
+        value = pgm_read_byte(&vscp_dev_data_stdDevType[index]);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
     }
 
     return value;
-
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
-
-    return 0;
-
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) */
 }
 
 /**
@@ -529,6 +666,312 @@ extern uint32_t vscp_dev_data_getFirmwareDeviceCode(void)
     return VSCP_DEV_DATA_CONFIG_FIRMWARE_DEVICE_CODE;
 }
 
+/**
+ * This function returns the GUID storage in RAM, MSB first.
+ *
+ * @return GUID storage
+ */
+extern uint8_t* vscp_dev_data_getGUIDStorage(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_GUID_MIRROR )
+
+    return VSCP_DEV_DATA_INST.guid;
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_GUID_MIRROR ) */
+
+    return VSCP_DEV_DATA_INST.container.guid;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_GUID_MIRROR ) */
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS )
+
+/**
+ * This function returns the manufacturer device id storage in RAM.
+ *
+ * @return Manufacturer device id storage
+ */
+extern uint8_t* vscp_dev_data_getManufacturerDevIdStorage(void)
+{
+    return VSCP_DEV_DATA_INST.manufacturerDevId;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+/**
+ * This function returns the manufacturer device id storage in program memory.
+ *
+ * @return Manufacturer device id storage
+ */
+extern uint8_t const * vscp_dev_data_getManufacturerDevIdStorage(void)
+{
+    return vscp_dev_data_manufacturerDevId;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS )
+
+/**
+ * This function returns the manufacturer sub device id storage in RAM.
+ *
+ * @return Manufacturer sub device id storage
+ */
+extern uint8_t* vscp_dev_data_getManufacturerSubDevIdStorage(void)
+{
+    return VSCP_DEV_DATA_INST.manufacturerSubDevId;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+/**
+ * This function returns the manufacturer sub device id storage in program
+ * memory.
+ *
+ * @return Manufacturer sub device id storage
+ */
+extern uint8_t const * vscp_dev_data_getManufacturerSubDevIdStorage(void)
+{
+    return vscp_dev_data_manufacturerSubDevId;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+/**
+ * This function returns the firmware version storage in program memory.
+ *
+ * @return Firmware version storage (major, minor, sub minor)
+ */
+extern uint8_t const * vscp_dev_data_getFirmwareVersionStorage(void)
+{
+    return vscp_dev_data_firmwareVersion;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS )
+
+/**
+ * This function returns the standard device family code storage in RAM,
+ * MSB first.
+ *
+ * @return Standard device family code storage
+ */
+extern uint8_t* vscp_dev_data_getStdDevFamilyCodeStorage(void)
+{
+    return VSCP_DEV_DATA_INST.stdDevFamilyCode;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
+
+/**
+ * This function returns the standard device family code storage in program
+ * memory, MSB first.
+ *
+ * @return Standard device family code storage
+ */
+extern uint8_t const * vscp_dev_data_getStdDevFamilyCodeStorage(void)
+{
+    return vscp_dev_data_stdDevFamilyCode;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS )
+
+/**
+ * This function returns the standard device type storage in RAM, MSB first.
+ *
+ * @return Standard device type storage
+ */
+extern uint8_t* vscp_dev_data_getStdDevTypeStorage(void)
+{
+    return VSCP_DEV_DATA_INST.stdDevType;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
+
+/**
+ * This function returns the standard device type storage in program memory,
+ * MSB first.
+ *
+ * @return Standard device type storage
+ */
+extern uint8_t const * vscp_dev_data_getStdDevTypeStorage(void)
+{
+    return vscp_dev_data_stdDevType;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
+
+/**
+ * This function returns the firmware device code storage in program memory,
+ * MSB first.
+ *
+ * @return Firmware device code storage
+ */
+extern uint8_t const * vscp_dev_data_getFirmwareDeviceCodeStorage(void)
+{
+    return vscp_dev_data_firmwareDeviceCode;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS )
+
+/**
+ * This function returns the MDF URL storage in RAM.
+ *
+ * @return MDF URL storage
+ */
+extern uint8_t* vscp_dev_data_getMdfUrlStorage(void)
+{
+    return VSCP_DEV_DATA_INST.mdfUrl;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
+/**
+ * This function returns the MDF URL storage in program memory.
+ *
+ * @return MDF URL storage
+ */
+extern uint8_t const * vscp_dev_data_getMdfUrlStorage(void)
+{
+    return vscp_dev_data_mdfUrl;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+/**
+ * This function loads the data, which is mirrored in RAM, from its storage.
+ */
+static void vscp_dev_data_load(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_GUID_MIRROR )
+
+    /* Load GUID */
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < VSCP_GUID_SIZE; ++index)
+        {
+            /* The storage provides it LSB first, but the mirror is MSB first. */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS )
+
+            VSCP_DEV_DATA_INST.guid[VSCP_GUID_SIZE - index - 1] = vscp_ps_readGUID(index);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS ) */
+
+            VSCP_DEV_DATA_INST.guid[VSCP_GUID_SIZE - index - 1] = vscp_portable_readGUID(index);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_GUID_STORAGE_PS ) */
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_GUID_MIRROR ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS )
+
+    /* Load node zone */
+    VSCP_DEV_DATA_INST.zone = vscp_ps_readNodeZone();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_ZONE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS )
+
+    /* Load node sub zone */
+    VSCP_DEV_DATA_INST.subZone = vscp_ps_readNodeSubZone();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_NODE_SUB_ZONE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS )
+
+    /* Load manufacturer device id */
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE; ++index)
+        {
+            VSCP_DEV_DATA_INST.manufacturerDevId[index] = vscp_ps_readManufacturerDevId(index);
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS )
+
+    /* Load manufacturer sub device id */
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE; ++index)
+        {
+            VSCP_DEV_DATA_INST.manufacturerSubDevId[index] = vscp_ps_readManufacturerSubDevId(index);
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS )
+
+    /* Load standard device family code, the persistent memory stores it LSB first. */
+    {
+        uint8_t index   = 0;
+        uint8_t value   = 0;
+
+        for(index = 0; index < VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE; ++index)
+        {
+            value = vscp_ps_readStdDevFamilyCode(index);
+
+            /* 0xFF shall be mapped to 0x00 according to specification. */
+            if (0xFF == value)
+            {
+                value = 0x00;
+            }
+
+            VSCP_DEV_DATA_INST.stdDevFamilyCode[VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE - index - 1] = value;
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS )
+
+    /* Load standard device type, the persistent memory stores it LSB first. */
+    {
+        uint8_t index   = 0;
+        uint8_t value   = 0;
+
+        for(index = 0; index < VSCP_DEV_DATA_STD_DEV_TYPE_SIZE; ++index)
+        {
+            value = vscp_ps_readStdDevType(index);
+
+            /* 0xFF shall be mapped to 0x00 according to specification. */
+            if (0xFF == value)
+            {
+                value = 0x00;
+            }
+
+            VSCP_DEV_DATA_INST.stdDevType[VSCP_DEV_DATA_STD_DEV_TYPE_SIZE - index - 1] = value;
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_STD_DEV_TYPE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS )
+
+    /* Load MDF URL */
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < VSCP_DEV_DATA_MDF_URL_SIZE; ++index)
+        {
+            VSCP_DEV_DATA_INST.mdfUrl[index] = vscp_ps_readMdfUrl(index);
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
+    return;
+}
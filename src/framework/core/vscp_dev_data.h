@@ -52,6 +52,13 @@ This module provides device (node) specific data.
  * - VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS
  * - VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS
  *
+ * The data is kept in memory: The data, which is loaded from the persistent
+ * memory or set at run time, is mirrored in RAM. It is loaded once during
+ * initialization and updated after a factory default restore. The data, which
+ * is given at compile time, is located in program memory. Therefore the
+ * VSCP specific registers of the device data are read with plain memory
+ * copies, see the VSCP_DEV_DATA_REG_MAP_* register ranges.
+ *
  * @{
  */
 
@@ -68,6 +75,8 @@ This module provides device (node) specific data.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_dev_data_config.h"
+#include "vscp_reg_map.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -82,10 +91,120 @@ extern "C"
     CONSTANTS
 *******************************************************************************/
 
+/** Number of manufacturer device id bytes */
+#define VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE      (4)
+
+/** Number of manufacturer sub device id bytes */
+#define VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE  (4)
+
+/** Number of firmware version bytes (major, minor, sub minor) */
+#define VSCP_DEV_DATA_FIRMWARE_VERSION_SIZE         (3)
+
+/** Number of standard device family code bytes */
+#define VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE      (4)
+
+/** Number of standard device type bytes */
+#define VSCP_DEV_DATA_STD_DEV_TYPE_SIZE             (4)
+
+/** Number of firmware device code bytes */
+#define VSCP_DEV_DATA_FIRMWARE_DEVICE_CODE_SIZE     (2)
+
+/** Number of MDF URL bytes */
+#define VSCP_DEV_DATA_MDF_URL_SIZE                  (32)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/*
+ * Register ranges of the device data. The data of a range is in the order of
+ * the VSCP specific registers, e.g. the GUID MSB first. Data, which is loaded
+ * from the persistent memory or set at run time, is a RAM range. Data, which
+ * is given at compile time, is a ROM range.
+ */
+
+/** Register range of the GUID */
+#define VSCP_DEV_DATA_REG_MAP_GUID(__page, __addr) \
+    VSCP_REG_MAP_RAM((__page), (__addr), VSCP_GUID_SIZE, VSCP_REG_MAP_ACCESS_R, vscp_dev_data_getGUIDStorage, NULL)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS )
+
+/** Register range of the manufacturer device id */
+#define VSCP_DEV_DATA_REG_MAP_MANUFACTURER_DEV_ID(__page, __addr) \
+    VSCP_REG_MAP_RAM((__page), (__addr), VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE, VSCP_REG_MAP_ACCESS_R, vscp_dev_data_getManufacturerDevIdStorage, NULL)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+/** Register range of the manufacturer device id */
+#define VSCP_DEV_DATA_REG_MAP_MANUFACTURER_DEV_ID(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_MANUFACTURER_DEV_ID_SIZE, vscp_dev_data_getManufacturerDevIdStorage)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS )
+
+/** Register range of the manufacturer sub device id */
+#define VSCP_DEV_DATA_REG_MAP_MANUFACTURER_SUB_DEV_ID(__page, __addr) \
+    VSCP_REG_MAP_RAM((__page), (__addr), VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE, VSCP_REG_MAP_ACCESS_R, vscp_dev_data_getManufacturerSubDevIdStorage, NULL)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+/** Register range of the manufacturer sub device id */
+#define VSCP_DEV_DATA_REG_MAP_MANUFACTURER_SUB_DEV_ID(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_MANUFACTURER_SUB_DEV_ID_SIZE, vscp_dev_data_getManufacturerSubDevIdStorage)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+/** Register range of the firmware version */
+#define VSCP_DEV_DATA_REG_MAP_FIRMWARE_VERSION(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_FIRMWARE_VERSION_SIZE, vscp_dev_data_getFirmwareVersionStorage)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) && VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS )
+
+/** Register range of the standard device family code */
+#define VSCP_DEV_DATA_REG_MAP_STD_DEV_FAMILY_CODE(__page, __addr) \
+    VSCP_REG_MAP_RAM((__page), (__addr), VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE, VSCP_REG_MAP_ACCESS_R, vscp_dev_data_getStdDevFamilyCodeStorage, NULL)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+
+/** Register range of the standard device family code */
+#define VSCP_DEV_DATA_REG_MAP_STD_DEV_FAMILY_CODE(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_STD_DEV_FAMILY_CODE_SIZE, vscp_dev_data_getStdDevFamilyCodeStorage)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) && VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS )
+
+/** Register range of the standard device type */
+#define VSCP_DEV_DATA_REG_MAP_STD_DEV_TYPE(__page, __addr) \
+    VSCP_REG_MAP_RAM((__page), (__addr), VSCP_DEV_DATA_STD_DEV_TYPE_SIZE, VSCP_REG_MAP_ACCESS_R, vscp_dev_data_getStdDevTypeStorage, NULL)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+
+/** Register range of the standard device type */
+#define VSCP_DEV_DATA_REG_MAP_STD_DEV_TYPE(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_STD_DEV_TYPE_SIZE, vscp_dev_data_getStdDevTypeStorage)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+
+/** Register range of the firmware device code */
+#define VSCP_DEV_DATA_REG_MAP_FIRMWARE_DEVICE_CODE(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_FIRMWARE_DEVICE_CODE_SIZE, vscp_dev_data_getFirmwareDeviceCodeStorage)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS )
+
+/** Register range of the MDF URL */
+#define VSCP_DEV_DATA_REG_MAP_MDF_URL(__page, __addr) \
+    VSCP_REG_MAP_RAM((__page), (__addr), VSCP_DEV_DATA_MDF_URL_SIZE, VSCP_REG_MAP_ACCESS_R, vscp_dev_data_getMdfUrlStorage, NULL)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
+/** Register range of the MDF URL */
+#define VSCP_DEV_DATA_REG_MAP_MDF_URL(__page, __addr) \
+    VSCP_REG_MAP_ROM((__page), (__addr), VSCP_DEV_DATA_MDF_URL_SIZE, vscp_dev_data_getMdfUrlStorage)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -229,6 +348,132 @@ extern uint8_t  vscp_dev_data_getStdDevType(uint8_t index);
  */
 extern uint32_t vscp_dev_data_getFirmwareDeviceCode(void);
 
+/**
+ * This function returns the GUID storage in RAM, MSB first.
+ *
+ * @return GUID storage
+ */
+extern uint8_t* vscp_dev_data_getGUIDStorage(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS )
+
+/**
+ * This function returns the manufacturer device id storage in RAM.
+ *
+ * @return Manufacturer device id storage
+ */
+extern uint8_t* vscp_dev_data_getManufacturerDevIdStorage(void);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+/**
+ * This function returns the manufacturer device id storage in program memory.
+ *
+ * @return Manufacturer device id storage
+ */
+extern uint8_t const * vscp_dev_data_getManufacturerDevIdStorage(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_DEV_ID_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS )
+
+/**
+ * This function returns the manufacturer sub device id storage in RAM.
+ *
+ * @return Manufacturer sub device id storage
+ */
+extern uint8_t* vscp_dev_data_getManufacturerSubDevIdStorage(void);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+/**
+ * This function returns the manufacturer sub device id storage in program
+ * memory.
+ *
+ * @return Manufacturer sub device id storage
+ */
+extern uint8_t const * vscp_dev_data_getManufacturerSubDevIdStorage(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MANUFACTURER_SUB_DEV_ID_STORAGE_PS ) */
+
+/**
+ * This function returns the firmware version storage in program memory.
+ *
+ * @return Firmware version storage (major, minor, sub minor)
+ */
+extern uint8_t const * vscp_dev_data_getFirmwareVersionStorage(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) && VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS )
+
+/**
+ * This function returns the standard device family code storage in RAM,
+ * MSB first.
+ *
+ * @return Standard device family code storage
+ */
+extern uint8_t* vscp_dev_data_getStdDevFamilyCodeStorage(void);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+
+/**
+ * This function returns the standard device family code storage in program
+ * memory, MSB first.
+ *
+ * @return Standard device family code storage
+ */
+extern uint8_t const * vscp_dev_data_getStdDevFamilyCodeStorage(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) && VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS )
+
+/**
+ * This function returns the standard device type storage in RAM, MSB first.
+ *
+ * @return Standard device type storage
+ */
+extern uint8_t* vscp_dev_data_getStdDevTypeStorage(void);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+
+/**
+ * This function returns the standard device type storage in program memory,
+ * MSB first.
+ *
+ * @return Standard device type storage
+ */
+extern uint8_t const * vscp_dev_data_getStdDevTypeStorage(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_FAMILY_CODE ) || VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS ) */
+
+/**
+ * This function returns the firmware device code storage in program memory,
+ * MSB first.
+ *
+ * @return Firmware device code storage
+ */
+extern uint8_t const * vscp_dev_data_getFirmwareDeviceCodeStorage(void);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS )
+
+/**
+ * This function returns the MDF URL storage in RAM.
+ *
+ * @return MDF URL storage
+ */
+extern uint8_t* vscp_dev_data_getMdfUrlStorage(void);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
+/**
+ * This function returns the MDF URL storage in program memory.
+ *
+ * @return MDF URL storage
+ */
+extern uint8_t const * vscp_dev_data_getMdfUrlStorage(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DEV_DATA_CONFIG_ENABLE_MDF_URL_STORAGE_PS ) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,10 +41,12 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_dm.h"
+#include "vscp_instance.h"
 #include "../user/vscp_action.h"
 #include "vscp_util.h"
 #include "vscp_dev_data.h"
 #include "vscp_ps.h"
+#include "vscp_rx_filter.h"
 
 #include <stddef.h>
 
@@ -73,7 +75,7 @@
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
 
 /** Address of the decision matrix byte index, if paged feature is enabled. */
-#define VSCP_DM_PAGED_INDEX             (0x7E)
+#define VSCP_DM_PAGED_INDEX             VSCP_DM_REG_ADDR
 
 /** Address of the decision matrix value, if paged feature is enabled. */
 #define VSCP_DM_PAGED_VALUE             (0x7F)
@@ -133,16 +135,112 @@ VSCP_UTIL_COMPILE_TIME_ASSERT(sizeof(vscp_dm_MatrixRow) == sizeof(vscp_dm_ExtRow
     MACROS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+/** Data of the selected framework instance */
+#define VSCP_DM_INST            (vscp_dm_instances[VSCP_INSTANCE])
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Class and type filter of a decision matrix row, with the class bit 8 already merged. */
+typedef struct
+{
+    uint16_t    classMask;      /**< Class mask (9 bit) */
+    uint16_t    classFilter;    /**< Class filter (9 bit) */
+    uint8_t     typeMask;       /**< Type mask */
+    uint8_t     typeFilter;     /**< Type filter */
+
+} vscp_dm_EventFilter;
+
+/** Decision matrix row (incl. extension) in a pre-decoded form, without the class/type filter. */
+typedef struct
+{
+    uint8_t     oaddr;          /**< Originating address */
+    uint8_t     flags;          /**< Flags */
+    uint8_t     action;         /**< Action (taken from the extension row, if extended) */
+    uint8_t     actionPar;      /**< Action parameter (taken from the extension row, if extended) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    BOOL        isExtended;     /**< Row uses the extension row */
+    uint8_t     extFlags;       /**< Extension flags */
+    uint8_t     zone;           /**< Zone */
+    uint8_t     subZone;        /**< Sub-zone */
+    uint8_t     par0;           /**< Event parameter byte 0 */
+    uint8_t     par3;           /**< Event parameter byte 3 */
+    uint8_t     par4;           /**< Event parameter byte 4 */
+    uint8_t     par5;           /**< Event parameter byte 5 */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+} vscp_dm_CompiledRow;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+/** A single entry of the decision matrix RAM index. */
+typedef struct
+{
+    uint8_t             filterIndex;    /**< Index of the class/type filter group */
+    vscp_dm_CompiledRow row;            /**< Pre-decoded decision matrix row */
+
+} vscp_dm_IndexEntry;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+/** Data of a framework instance */
+typedef struct
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
+
+    /** Decision matrix byte index, if paged feature is enabled. */
+    uint8_t             index;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+    /** Decision matrix RAM index is valid or must be rebuilt. */
+    BOOL                ramIndexIsValid;
+
+    /** Distinct class/type filters of all enabled decision matrix rows. */
+    vscp_dm_EventFilter ramIndexFilters[VSCP_CONFIG_DM_ROWS];
+
+    /** Number of used class/type filters. */
+    uint8_t             ramIndexFilterCnt;
+
+    /** Enabled decision matrix rows, in the order of the decision matrix. */
+    vscp_dm_IndexEntry  ramIndexEntries[VSCP_CONFIG_DM_ROWS];
+
+    /** Number of used index entries. */
+    uint8_t             ramIndexEntryCnt;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
+} vscp_dm_Instance;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
 static BOOL vscp_dm_isDecisionMatrixRowEnabled(uint8_t rowIndex);
 static void vscp_dm_readDecisionMatrix(vscp_dm_MatrixRow * const row, uint8_t rowIndex);
+static BOOL vscp_dm_compileRow(vscp_dm_EventFilter * const filter, vscp_dm_CompiledRow * const compiledRow, uint8_t rowIndex);
+static BOOL vscp_dm_isEventFilterMatch(vscp_dm_EventFilter const * const filter, vscp_RxMessage const * const msg);
+static BOOL vscp_dm_isRowMatch(vscp_dm_CompiledRow const * const row, vscp_RxMessage const * const msg);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+static void vscp_dm_buildIndex(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
 
@@ -170,12 +268,12 @@ static BOOL vscp_dm_calculateMatrixIndex(uint8_t* index, uint8_t* offset, uint16
     LOCAL VARIABLES
 *******************************************************************************/
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
 
-/** Decision matrix byte index, if paged feature is enabled. */
-static uint8_t  vscp_dm_index       = 0;
+/** Data of all framework instances */
+static vscp_dm_Instance        vscp_dm_instances[VSCP_INSTANCE_NUM];
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -192,10 +290,23 @@ extern void vscp_dm_init(void)
 {
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
 
-    vscp_dm_index   = 0;
+    VSCP_DM_INST.index   = 0;
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+    /* The index is built on demand by the first received event. */
+    VSCP_DM_INST.ramIndexIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+    vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
     return;
 }
 
@@ -226,6 +337,18 @@ extern void vscp_dm_restoreFactoryDefaultSettings(void)
 
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+    VSCP_DM_INST.ramIndexIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+    vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
     return;
 }
 
@@ -333,315 +456,551 @@ extern void vscp_dm_executeActions(vscp_RxMessage const * const msg)
 {
     uint8_t index   = 0;
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+    BOOL    filterMatch[VSCP_CONFIG_DM_ROWS];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
     if (NULL == msg)
     {
         return;
     }
 
-    /* Walk through all decision matrix rows and execute the triggered ones. */
-    for(index = 0; index < VSCP_CONFIG_DM_ROWS; ++index)
-    {
-        uint16_t            classMask   = 0;
-        uint16_t            classFilter = 0;
-        vscp_dm_MatrixRow   row         = { 0, 0, 0, 0, 0, 0, 0, 0 };
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+    /* Decision matrix changed since the index was built? */
+    if (FALSE == VSCP_DM_INST.ramIndexIsValid)
+    {
+        vscp_dm_buildIndex();
+    }
 
-        vscp_dm_ExtRow      extRow      = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    /* Check every class/type filter only once. */
+    for(index = 0; index < VSCP_DM_INST.ramIndexFilterCnt; ++index)
+    {
+        filterMatch[index] = vscp_dm_isEventFilterMatch(&VSCP_DM_INST.ramIndexFilters[index], msg);
+    }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    /* Walk through the candidate rows and execute the triggered ones.
+     * The index keeps the decision matrix row order.
+     */
+    for(index = 0; index < VSCP_DM_INST.ramIndexEntryCnt; ++index)
+    {
+        vscp_dm_IndexEntry const * const    entry   = &VSCP_DM_INST.ramIndexEntries[index];
 
-        /* Decision matrix row disabled? */
-        if (FALSE == vscp_dm_isDecisionMatrixRowEnabled(index))
+        /* Class or type doesn't match? */
+        if (FALSE == filterMatch[entry->filterIndex])
         {
             /* Next row */
             continue;
         }
 
-        vscp_dm_readDecisionMatrix(&row, index);
-
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+        if (TRUE == vscp_dm_isRowMatch(&entry->row, msg))
+        {
+            /* Execute action */
+            vscp_action_execute(entry->row.action, entry->row.actionPar, msg);
+        }
+    }
 
-        vscp_dm_readDecisionMatrixExt(&extRow, index);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+    /* Walk through all decision matrix rows and execute the triggered ones. */
+    for(index = 0; index < VSCP_CONFIG_DM_ROWS; ++index)
+    {
+        vscp_dm_EventFilter filter;
+        vscp_dm_CompiledRow row;
 
-        /* No action? */
-        if (VSCP_DM_ACTION_NO_OPERATION == row.action)
+        /* Decision matrix row disabled? */
+        if (FALSE == vscp_dm_isDecisionMatrixRowEnabled(index))
         {
             /* Next row */
             continue;
         }
 
-        /* Check originating address? */
-        if (0 != (row.flags & VSCP_DM_FLAG_CHECK_OADDR))
+        /* No action? */
+        if (FALSE == vscp_dm_compileRow(&filter, &row, index))
         {
-            /* Address doesn't match? */
-            if (row.oaddr != msg->oAddr)
-            {
-                /* Next row */
-                continue;
-            }
+            /* Next row */
+            continue;
         }
 
-        /* Check hard-coded bit? */
-        if (0 != (row.flags & VSCP_DM_FLAG_HARDCODED))
+        if ((TRUE == vscp_dm_isEventFilterMatch(&filter, msg)) &&
+            (TRUE == vscp_dm_isRowMatch(&row, msg)))
         {
-            /* No hard coded node? */
-            if (FALSE == msg->hardCoded)
-            {
-                /* Next row */
-                continue;
-            }
+            /* Execute action */
+            vscp_action_execute(row.action, row.actionPar, msg);
         }
+    }
 
-        /* Zone or sub zone match necessary? */
-        if ((0 != (row.flags & VSCP_DM_FLAG_MATCH_ZONE)) ||
-            (0 != (row.flags & VSCP_DM_FLAG_MATCH_SUB_ZONE)))
-        {
-            uint8_t zoneIndex   = vscp_util_getZoneIndex(msg->vscpClass, msg->vscpType);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
 
-            if ((0 <= zoneIndex) &&
-                (VSCP_L1_DATA_SIZE > zoneIndex))
-            {
-                uint8_t subZoneIndex    = zoneIndex + 1;
-                uint8_t zone            = msg->data[zoneIndex];
-                uint8_t subZone         = msg->data[subZoneIndex];
+    return;
+}
 
-                /* Zone match and event shall not apply to all zones? */
-                if ((0 != (row.flags & VSCP_DM_FLAG_MATCH_ZONE)) && (VSCP_ZONE_BROADCAST != zone))
-                {
-                    uint8_t dmZone  = vscp_dev_data_getNodeZone();
+/**
+ * This function provides the acceptance filter of a decision matrix row,
+ * which lets pass all events, the row may be triggered by. Zone and
+ * event parameters are not part of the CAN identifier and not considered.
+ *
+ * @param[in]   rowIndex    Row index
+ * @param[out]  entry       Acceptance filter
+ * @return  Row is used or not
+ * @retval  FALSE   Row is disabled or has no action.
+ * @retval  TRUE    Row is used and the acceptance filter is valid.
+ */
+extern BOOL vscp_dm_getAcceptanceFilter(uint8_t rowIndex, vscp_AcceptanceFilter * const entry)
+{
+    vscp_dm_EventFilter filter;
+    vscp_dm_CompiledRow row;
+
+    if ((NULL == entry) ||
+        (VSCP_CONFIG_DM_ROWS <= rowIndex))
+    {
+        return FALSE;
+    }
+
+    if (FALSE == vscp_dm_isDecisionMatrixRowEnabled(rowIndex))
+    {
+        return FALSE;
+    }
+
+    if (FALSE == vscp_dm_compileRow(&filter, &row, rowIndex))
+    {
+        return FALSE;
+    }
+
+    entry->mask     = VSCP_RX_FILTER_CLASS(filter.classMask) | VSCP_RX_FILTER_TYPE(filter.typeMask);
+    entry->filter   = VSCP_RX_FILTER_CLASS(filter.classFilter) | VSCP_RX_FILTER_TYPE(filter.typeFilter);
+
+    if (0 != (row.flags & VSCP_DM_FLAG_CHECK_OADDR))
+    {
+        entry->mask     |= VSCP_RX_FILTER_OADDR(0xFF);
+        entry->filter   |= VSCP_RX_FILTER_OADDR(row.oaddr);
+    }
+
+    if (0 != (row.flags & VSCP_DM_FLAG_HARDCODED))
+    {
+        entry->mask     |= ((uint32_t)1) << VSCP_RX_FILTER_POS_HARD_CODED;
+        entry->filter   |= ((uint32_t)1) << VSCP_RX_FILTER_POS_HARD_CODED;
+    }
+
+    entry->filter &= entry->mask;
+
+    return TRUE;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Is the decision matrix row enabled or disabled?
+ * 
+ * @param[in]   rowIndex    Row index
+ * @return DM row is enabled (TRUE) or disabled (FALSE).
+ */
+static BOOL vscp_dm_isDecisionMatrixRowEnabled(uint8_t rowIndex)
+{
+    uint16_t    start   = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow);
+    uint16_t    offset  = offsetof(vscp_dm_MatrixRow, flags);
+    uint8_t     flags   = vscp_ps_readDM(start + offset);
+
+    return (0 == (flags & VSCP_DM_FLAG_ENABLE)) ? FALSE : TRUE;
+}
+
+/**
+ * This function reads a single line from the decision matrix.
+ *
+ * @param[out]  row         Pointer to the row storage
+ * @param[in]   rowIndex    Row index
+ */
+static void vscp_dm_readDecisionMatrix(vscp_dm_MatrixRow * const row, uint8_t rowIndex)
+{
+    if (NULL != row)
+    {
+        uint16_t    start       = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow);
+        uint8_t*    rowBuffer   = (uint8_t*)row;
+
+        vscp_ps_readDMMultiple(start, rowBuffer, sizeof(vscp_dm_MatrixRow));
+    }
+
+    return;
+}
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
 
-                    /* Is the extension enabled for this row? */
-                    if (VSCP_DM_ACTION_EXTENDED_DM == row.action)
-                    {
-                        /* Overwrite node zone */
-                        dmZone = extRow.zone;
-                    }
+/**
+ * This function reads a single line from the decision matrix extension.
+ *
+ * @param[out]  row         Pointer to the row storage
+ * @param[in]   rowIndex    Row index
+ */
+static void vscp_dm_readDecisionMatrixExt(vscp_dm_ExtRow * const row, uint8_t rowIndex)
+{
+    if (NULL != row)
+    {
+        uint16_t    start       = ((uint16_t)rowIndex) * sizeof(vscp_dm_ExtRow);
+        uint8_t*    rowBuffer   = (uint8_t*)row;
+
+        vscp_ps_readDMExtensionMultiple(start, rowBuffer, sizeof(vscp_dm_ExtRow));
+    }
+
+    return;
+}
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
-                    /* Zone's doesn't match? */
-                    if (zone != dmZone)
-                    {
-                        /* Next row */
-                        continue;
-                    }
-                }
+/**
+ * This function reads a single decision matrix row (incl. its extension) and
+ * pre-decodes it for the evaluation.
+ *
+ * @param[out]  filter      Class/type filter of the row
+ * @param[out]  compiledRow Pre-decoded row
+ * @param[in]   rowIndex    Row index
+ * @return  Row has an action or not
+ * @retval  FALSE   No action, the row can be skipped.
+ * @retval  TRUE    Row has an action.
+ */
+static BOOL vscp_dm_compileRow(vscp_dm_EventFilter * const filter, vscp_dm_CompiledRow * const compiledRow, uint8_t rowIndex)
+{
+    BOOL                status  = FALSE;
+    vscp_dm_MatrixRow   row     = { 0, 0, 0, 0, 0, 0, 0, 0 };
 
-                /* Sub zone match and event shall not apply to all sub-zones? */
-                if ((0 != (row.flags & VSCP_DM_FLAG_MATCH_SUB_ZONE)) && (VSCP_SUBZONE_BROADCAST != subZone))
-                {
-                    uint8_t dmSubZone   = vscp_dev_data_getNodeSubZone();
+    if ((NULL == filter) ||
+        (NULL == compiledRow))
+    {
+        return FALSE;
+    }
+
+    vscp_dm_readDecisionMatrix(&row, rowIndex);
+
+    /* Build class mask and filter */
+    filter->classMask   = row.classMask;
+
+    if (0 != (row.flags & VSCP_DM_FLAG_CLASS_MASK_BIT8))
+    {
+        filter->classMask |= (uint16_t)0x0100;
+    }
+
+    filter->classFilter = row.classFilter;
+
+    if (0 != (row.flags & VSCP_DM_FLAG_CLASS_FILTER_BIT8))
+    {
+        filter->classFilter |= (uint16_t)0x0100;
+    }
+
+    filter->typeMask    = row.typeMask;
+    filter->typeFilter  = row.typeFilter;
+
+    compiledRow->oaddr      = row.oaddr;
+    compiledRow->flags      = row.flags;
+    compiledRow->action     = row.action;
+    compiledRow->actionPar  = row.actionPar;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
 
-                    /* Is the extension enabled for this row? */
-                    if (VSCP_DM_ACTION_EXTENDED_DM == row.action)
-                    {
-                        /* Overwrite node sub-zone */
-                        dmSubZone = extRow.subZone;
-                    }
+    compiledRow->isExtended = FALSE;
+    compiledRow->extFlags   = 0;
+    compiledRow->zone       = 0;
+    compiledRow->subZone    = 0;
+    compiledRow->par0       = 0;
+    compiledRow->par3       = 0;
+    compiledRow->par4       = 0;
+    compiledRow->par5       = 0;
+
+    /* Is the extension enabled for this row? */
+    if (VSCP_DM_ACTION_EXTENDED_DM == row.action)
+    {
+        vscp_dm_ExtRow  extRow  = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+        vscp_dm_readDecisionMatrixExt(&extRow, rowIndex);
+
+        compiledRow->isExtended = TRUE;
+
+        /* The action parameters transform to the extension flags. */
+        compiledRow->extFlags   = row.actionPar;
+        compiledRow->zone       = extRow.zone;
+        compiledRow->subZone    = extRow.subZone;
+        compiledRow->par0       = extRow.par0;
+        compiledRow->par3       = extRow.par3;
+        compiledRow->par4       = extRow.par4;
+        compiledRow->par5       = extRow.par5;
+        compiledRow->action     = extRow.action;
+        compiledRow->actionPar  = extRow.actionPar;
+    }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
 
-                    /* Sub-zone's doesn't match? */
-                    if (subZone != dmSubZone)
-                    {
-                        /* Next row */
-                        continue;
-                    }
-                }
-            }
-            else
-            {
-                /* Next row */
-                continue;
-            }
-        }
+    /* No action? */
+    if (VSCP_DM_ACTION_NO_OPERATION != row.action)
+    {
+        status = TRUE;
+    }
 
-        /* Build class mask and filter */
-        classMask   = row.classMask;
+    return status;
+}
 
-        if (0 != (row.flags & VSCP_DM_FLAG_CLASS_MASK_BIT8))
-        {
-            classMask |= (uint16_t)0x0100;
-        }
+/**
+ * This function checks whether the class and type of the received event
+ * match the given filter.
+ *
+ * @param[in]   filter  Class/type filter
+ * @param[in]   msg     Received message via VSCP
+ * @return  Match or not
+ * @retval  FALSE   Doesn't match
+ * @retval  TRUE    Match
+ */
+static BOOL vscp_dm_isEventFilterMatch(vscp_dm_EventFilter const * const filter, vscp_RxMessage const * const msg)
+{
+    /* Class doesn't match? */
+    if ((0 != filter->classMask) &&
+        (filter->classFilter != (filter->classMask & msg->vscpClass)))
+    {
+        return FALSE;
+    }
 
-        classFilter = row.classFilter;
+    /* Type doesn't match? */
+    if ((0 != filter->typeMask) &&
+        (filter->typeFilter != (filter->typeMask & msg->vscpType)))
+    {
+        return FALSE;
+    }
 
-        if (0 != (row.flags & VSCP_DM_FLAG_CLASS_FILTER_BIT8))
-        {
-            classFilter |= (uint16_t)0x0100;
-        }
+    return TRUE;
+}
 
-        /* Class doesn't match? */
-        if ((0 != classMask) &&
-            (classFilter != (classMask & msg->vscpClass)))
+/**
+ * This function checks whether the received event triggers the given
+ * pre-decoded decision matrix row. The class/type filter is not considered here.
+ *
+ * @param[in]   row     Pre-decoded decision matrix row
+ * @param[in]   msg     Received message via VSCP
+ * @return  Row triggered or not
+ * @retval  FALSE   Not triggered
+ * @retval  TRUE    Triggered
+ */
+static BOOL vscp_dm_isRowMatch(vscp_dm_CompiledRow const * const row, vscp_RxMessage const * const msg)
+{
+    /* Check originating address? */
+    if (0 != (row->flags & VSCP_DM_FLAG_CHECK_OADDR))
+    {
+        /* Address doesn't match? */
+        if (row->oaddr != msg->oAddr)
         {
-            /* Next row */
-            continue;
+            return FALSE;
         }
+    }
 
-        /* Type doesn't match? */
-        if ((0 != row.typeMask) &&
-            (row.typeFilter != (row.typeMask & msg->vscpType)))
+    /* Check hard-coded bit? */
+    if (0 != (row->flags & VSCP_DM_FLAG_HARDCODED))
+    {
+        /* No hard coded node? */
+        if (FALSE == msg->hardCoded)
         {
-            /* Next row */
-            continue;
+            return FALSE;
         }
+    }
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+    /* Zone or sub zone match necessary? */
+    if ((0 != (row->flags & VSCP_DM_FLAG_MATCH_ZONE)) ||
+        (0 != (row->flags & VSCP_DM_FLAG_MATCH_SUB_ZONE)))
+    {
+        uint8_t zoneIndex   = vscp_util_getZoneIndex(msg->vscpClass, msg->vscpType);
 
-        /* Is the extension enabled for this row? */
-        if (VSCP_DM_ACTION_EXTENDED_DM == row.action)
+        if ((0 <= zoneIndex) &&
+            (VSCP_L1_DATA_SIZE > zoneIndex))
         {
-            /* The action parameters transform to the extension flags. */
-            uint8_t extFlags    = row.actionPar;
+            uint8_t subZoneIndex    = zoneIndex + 1;
+            uint8_t zone            = msg->data[zoneIndex];
+            uint8_t subZone         = msg->data[subZoneIndex];
 
-            /* Compare to event parameter byte 0? */
-            if (0 != (extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_0))
+            /* Zone match and event shall not apply to all zones? */
+            if ((0 != (row->flags & VSCP_DM_FLAG_MATCH_ZONE)) && (VSCP_ZONE_BROADCAST != zone))
             {
-                if (0 == msg->dataSize)
-                {
-                    /* Next row */
-                    continue;
-                }
-                else if (extRow.par0 != msg->data[0])
+                uint8_t dmZone  = 0;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+                /* Is the extension enabled for this row? */
+                if (TRUE == row->isExtended)
                 {
-                    /* Next row */
-                    continue;
+                    /* Overwrite node zone */
+                    dmZone = row->zone;
                 }
-            }
+                else
 
-            /* Compare to event parameter byte 3? */
-            if (0 != (extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_3))
-            {
-                if (3 >= msg->dataSize)
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
                 {
-                    /* Next row */
-                    continue;
+                    dmZone = vscp_dev_data_getNodeZone();
                 }
-                else if (extRow.par3 != msg->data[3])
+
+                /* Zone's doesn't match? */
+                if (zone != dmZone)
                 {
-                    /* Next row */
-                    continue;
+                    return FALSE;
                 }
             }
 
-            /* Compare to event parameter byte 4? */
-            if (0 != (extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_4))
+            /* Sub zone match and event shall not apply to all sub-zones? */
+            if ((0 != (row->flags & VSCP_DM_FLAG_MATCH_SUB_ZONE)) && (VSCP_SUBZONE_BROADCAST != subZone))
             {
-                if (4 >= msg->dataSize)
-                {
-                    /* Next row */
-                    continue;
-                }
-                else if (extRow.par4 != msg->data[4])
+                uint8_t dmSubZone   = 0;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+                /* Is the extension enabled for this row? */
+                if (TRUE == row->isExtended)
                 {
-                    /* Next row */
-                    continue;
+                    /* Overwrite node sub-zone */
+                    dmSubZone = row->subZone;
                 }
-            }
+                else
 
-            /* Compare to event parameter byte 5? */
-            if (0 != (extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_5))
-            {
-                if (5 >= msg->dataSize)
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
                 {
-                    /* Next row */
-                    continue;
+                    dmSubZone = vscp_dev_data_getNodeSubZone();
                 }
-                else if (extRow.par5 != msg->data[5])
+
+                /* Sub-zone's doesn't match? */
+                if (subZone != dmSubZone)
                 {
-                    /* Next row */
-                    continue;
+                    return FALSE;
                 }
             }
-
-            /* Execute action */
-            vscp_action_execute(extRow.action, extRow.actionPar, msg);
         }
         else
         {
-            /* Execute action */
-            vscp_action_execute(row.action, row.actionPar, msg);
+            return FALSE;
         }
+    }
 
-#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+    /* Is the extension enabled for this row? */
+    if (TRUE == row->isExtended)
+    {
+        /* Compare to event parameter byte 0? */
+        if (0 != (row->extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_0))
+        {
+            if ((0 == msg->dataSize) ||
+                (row->par0 != msg->data[0]))
+            {
+                return FALSE;
+            }
+        }
 
-        /* Execute action */
-        vscp_action_execute(row.action, row.actionPar, msg);
+        /* Compare to event parameter byte 3? */
+        if (0 != (row->extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_3))
+        {
+            if ((3 >= msg->dataSize) ||
+                (row->par3 != msg->data[3]))
+            {
+                return FALSE;
+            }
+        }
 
-#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+        /* Compare to event parameter byte 4? */
+        if (0 != (row->extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_4))
+        {
+            if ((4 >= msg->dataSize) ||
+                (row->par4 != msg->data[4]))
+            {
+                return FALSE;
+            }
+        }
+
+        /* Compare to event parameter byte 5? */
+        if (0 != (row->extFlags & VSCP_DM_EXTFLAG_MATCH_PAR_5))
+        {
+            if ((5 >= msg->dataSize) ||
+                (row->par5 != msg->data[5]))
+            {
+                return FALSE;
+            }
+        }
     }
 
-    return;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+    return TRUE;
 }
 
-/*******************************************************************************
-    LOCAL FUNCTIONS
-*******************************************************************************/
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
 
 /**
- * Is the decision matrix row enabled or disabled?
- * 
- * @param[in]   rowIndex    Row index
- * @return DM row is enabled (TRUE) or disabled (FALSE).
+ * This function compiles all enabled decision matrix rows from the persistent
+ * memory into the RAM index. Rows with the same class/type filter share one
+ * filter entry, which is evaluated only once per received event.
  */
-static BOOL vscp_dm_isDecisionMatrixRowEnabled(uint8_t rowIndex)
+static void vscp_dm_buildIndex(void)
 {
-    uint16_t    start   = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow);
-    uint16_t    offset  = offsetof(vscp_dm_MatrixRow, flags);
-    uint8_t     flags   = vscp_ps_readDM(start + offset);
+    uint8_t rowIndex    = 0;
 
-    return (0 == (flags & VSCP_DM_FLAG_ENABLE)) ? FALSE : TRUE;
-}
+    VSCP_DM_INST.ramIndexFilterCnt = 0;
+    VSCP_DM_INST.ramIndexEntryCnt  = 0;
 
-/**
- * This function reads a single line from the decision matrix.
- *
- * @param[out]  row         Pointer to the row storage
- * @param[in]   rowIndex    Row index
- */
-static void vscp_dm_readDecisionMatrix(vscp_dm_MatrixRow * const row, uint8_t rowIndex)
-{
-    if (NULL != row)
+    for(rowIndex = 0; rowIndex < VSCP_CONFIG_DM_ROWS; ++rowIndex)
     {
-        uint16_t    start       = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow);
-        uint8_t*    rowBuffer   = (uint8_t*)row;
+        vscp_dm_EventFilter         filter;
+        vscp_dm_IndexEntry * const  entry       = &VSCP_DM_INST.ramIndexEntries[VSCP_DM_INST.ramIndexEntryCnt];
+        uint8_t                     filterIndex = 0;
 
-        vscp_ps_readDMMultiple(start, rowBuffer, sizeof(vscp_dm_MatrixRow));
-    }
+        /* Decision matrix row disabled? */
+        if (FALSE == vscp_dm_isDecisionMatrixRowEnabled(rowIndex))
+        {
+            /* Next row */
+            continue;
+        }
 
-    return;
-}
+        /* No action? */
+        if (FALSE == vscp_dm_compileRow(&filter, &entry->row, rowIndex))
+        {
+            /* Next row */
+            continue;
+        }
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+        /* Mask and filter are don't care, if the mask is 0. Normalize them to find more equal filters. */
+        if (0 == filter.classMask)
+        {
+            filter.classFilter = 0;
+        }
 
-/**
- * This function reads a single line from the decision matrix extension.
- *
- * @param[out]  row         Pointer to the row storage
- * @param[in]   rowIndex    Row index
- */
-static void vscp_dm_readDecisionMatrixExt(vscp_dm_ExtRow * const row, uint8_t rowIndex)
-{
-    if (NULL != row)
-    {
-        uint16_t    start       = ((uint16_t)rowIndex) * sizeof(vscp_dm_ExtRow);
-        uint8_t*    rowBuffer   = (uint8_t*)row;
+        if (0 == filter.typeMask)
+        {
+            filter.typeFilter = 0;
+        }
 
-        vscp_ps_readDMExtensionMultiple(start, rowBuffer, sizeof(vscp_dm_ExtRow));
+        /* Filter group already available? */
+        for(filterIndex = 0; filterIndex < VSCP_DM_INST.ramIndexFilterCnt; ++filterIndex)
+        {
+            vscp_dm_EventFilter const * const   group   = &VSCP_DM_INST.ramIndexFilters[filterIndex];
+
+            if ((group->classMask == filter.classMask) &&
+                (group->classFilter == filter.classFilter) &&
+                (group->typeMask == filter.typeMask) &&
+                (group->typeFilter == filter.typeFilter))
+            {
+                break;
+            }
+        }
+
+        /* New filter group? */
+        if (VSCP_DM_INST.ramIndexFilterCnt == filterIndex)
+        {
+            VSCP_DM_INST.ramIndexFilters[filterIndex] = filter;
+            ++VSCP_DM_INST.ramIndexFilterCnt;
+        }
+
+        entry->filterIndex = filterIndex;
+        ++VSCP_DM_INST.ramIndexEntryCnt;
     }
 
+    VSCP_DM_INST.ramIndexIsValid = TRUE;
+
     return;
 }
 
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
 
@@ -686,12 +1045,12 @@ static inline uint8_t  vscp_dm_readRegisterPagedFeature(uint16_t page, uint8_t a
     {
         if (VSCP_DM_PAGED_INDEX == addr)
         {
-            value = vscp_dm_index;
+            value = VSCP_DM_INST.index;
         }
         else if (VSCP_DM_PAGED_VALUE == addr)
         {
-            uint8_t rowIndex    = vscp_dm_index / sizeof(vscp_dm_MatrixRow);
-            uint8_t rowOffset   = vscp_dm_index % sizeof(vscp_dm_MatrixRow);
+            uint8_t rowIndex    = VSCP_DM_INST.index / sizeof(vscp_dm_MatrixRow);
+            uint8_t rowOffset   = VSCP_DM_INST.index % sizeof(vscp_dm_MatrixRow);
 
             /* Row out of bounds? */
             if (VSCP_DM_ROWS <= rowIndex)
@@ -729,13 +1088,13 @@ static inline uint8_t   vscp_dm_writeRegisterPagedFeature(uint16_t page, uint8_t
             /* Index in range? */
             if (lastIndex >= value)
             {
-                vscp_dm_index = value;
+                VSCP_DM_INST.index = value;
             }
         }
         else if (VSCP_DM_PAGED_VALUE == addr)
         {
-            uint8_t rowIndex    = vscp_dm_index / sizeof(vscp_dm_MatrixRow);
-            uint8_t rowOffset   = vscp_dm_index % sizeof(vscp_dm_MatrixRow);
+            uint8_t rowIndex    = VSCP_DM_INST.index / sizeof(vscp_dm_MatrixRow);
+            uint8_t rowOffset   = VSCP_DM_INST.index % sizeof(vscp_dm_MatrixRow);
 
             /* Row out of bounds? */
             if (VSCP_DM_ROWS <= rowIndex)
@@ -747,6 +1106,18 @@ static inline uint8_t   vscp_dm_writeRegisterPagedFeature(uint16_t page, uint8_t
                 uint16_t    index   = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow) + (uint16_t)rowOffset;
 
                 vscp_ps_writeDM(index, value);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+                VSCP_DM_INST.ramIndexIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+                vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
             }
         }
     }
@@ -856,7 +1227,19 @@ static inline uint8_t   vscp_dm_writeRegisterStd(uint16_t page, uint8_t addr, ui
         uint16_t    index   = ((uint16_t)rowIndex) * sizeof(vscp_dm_MatrixRow) + (uint16_t)rowOffset;
 
         vscp_ps_writeDM(index, value);
-        
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX )
+
+        VSCP_DM_INST.ramIndexIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_RAM_INDEX ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+        vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
         /* Read value back */
         value = vscp_ps_readDM(index);
     }
@@ -97,6 +97,41 @@ extern "C"
 /** Decision matrix (standard or extension) row size in bytes */
 #define VSCP_DM_ROW_SIZE            8
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_PAGED_FEATURE )
+
+/** Decision matrix registers: Page */
+#define VSCP_DM_REG_PAGE            0
+
+/** Decision matrix registers: Address of the index register of the special
+ * paged feature. The value register follows.
+ */
+#define VSCP_DM_REG_ADDR            (0x7E)
+
+/** Decision matrix registers: Number of registers */
+#define VSCP_DM_REG_SIZE            2
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
+/** Decision matrix registers: Page */
+#define VSCP_DM_REG_PAGE            VSCP_CONFIG_DM_PAGE
+
+/** Decision matrix registers: Address of the first register */
+#define VSCP_DM_REG_ADDR            VSCP_CONFIG_DM_OFFSET
+
+#if VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION )
+
+/** Decision matrix registers: Number of registers */
+#define VSCP_DM_REG_SIZE            (VSCP_CONFIG_DM_ROWS * VSCP_DM_ROW_SIZE)
+
+#else   /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+/** Decision matrix registers: Number of registers (standard + extension) */
+#define VSCP_DM_REG_SIZE            (2 * VSCP_CONFIG_DM_ROWS * VSCP_DM_ROW_SIZE)
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_EXTENSION ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_PAGED_FEATURE ) */
+
 /** Action: No operation */
 #define VSCP_DM_ACTION_NO_OPERATION (0x00)
 
@@ -260,6 +295,19 @@ extern uint8_t  vscp_dm_writeRegister(uint16_t page, uint8_t addr, uint8_t value
  */
 extern void vscp_dm_executeActions(vscp_RxMessage const * const msg);
 
+/**
+ * This function provides the acceptance filter of a decision matrix row,
+ * which lets pass all events, the row may be triggered by. Zone and
+ * event parameters are not part of the CAN identifier and not considered.
+ *
+ * @param[in]   rowIndex    Row index
+ * @param[out]  entry       Acceptance filter
+ * @return  Row is used or not
+ * @retval  FALSE   Row is disabled or has no action.
+ * @retval  TRUE    Row is used and the acceptance filter is valid.
+ */
+extern BOOL vscp_dm_getAcceptanceFilter(uint8_t rowIndex, vscp_AcceptanceFilter * const entry);
+
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
 
 #ifdef __cplusplus
@@ -41,9 +41,11 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_dm_ng.h"
+#include "vscp_instance.h"
 #include "vscp_util.h"
 #include "../user/vscp_action.h"
 #include "vscp_ps.h"
+#include "vscp_rx_filter.h"
 #include <stdint.h>
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
@@ -82,6 +84,29 @@
 /** Last offset in the last page of the decision matrix NG. */
 #define VSCP_DM_NG_LAST_PAGE_OFFSET ((0 < (VSCP_CONFIG_DM_NG_RULE_SET_SIZE % 256)) ? (VSCP_CONFIG_DM_NG_RULE_SET_SIZE % 256 - 1) : 255)
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+/** Size of the rule header in bytes: size, action id, action parameter */
+#define VSCP_DM_NG_RULE_HEADER_SIZE 3
+
+/** Minimum size of a single condition in bytes: condition operator, event parameter id, value */
+#define VSCP_DM_NG_COND_SIZE_MIN    3
+
+/** Maximum number of rules, which can be stored in the rule set. The rule set
+ * header contains the number of rules as a single byte, therefore more than
+ * 255 rules are not possible.
+ */
+#define VSCP_DM_NG_CACHE_RULES_MAX  ((((VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 1) / VSCP_DM_NG_SIZE_MIN) < 255) ? \
+                                     ((VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 1) / VSCP_DM_NG_SIZE_MIN) : 255)
+
+/** Maximum number of conditions, which can be stored in the rule set. */
+#define VSCP_DM_NG_CACHE_COND_MAX   ((VSCP_CONFIG_DM_NG_RULE_SET_SIZE - 1 - VSCP_DM_NG_RULE_HEADER_SIZE) / VSCP_DM_NG_COND_SIZE_MIN)
+
+/* The cached rules reference their conditions with a 16-bit index. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(65536 > VSCP_DM_NG_CACHE_COND_MAX);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -91,32 +116,32 @@
 /** Set error. */
 #define VSCP_DM_NG_DEBUG_SET_ERROR()    \
     do{                                 \
-        vscp_dm_ng_error = TRUE;        \
+        VSCP_DM_NG_INST.error = TRUE;        \
     }while(0)
 
 /** Clear error */
 #define VSCP_DM_NG_DEBUG_CLR_ERROR()    \
     do{                                 \
-        vscp_dm_ng_error = FALSE;       \
-        vscp_dm_ng_errorRule = 0;       \
-        vscp_dm_ng_errorPos = 0;        \
+        VSCP_DM_NG_INST.error = FALSE;       \
+        VSCP_DM_NG_INST.errorRule = 0;       \
+        VSCP_DM_NG_INST.errorPos = 0;        \
     }while(0)
 
 /** Increase rule number. If a error is set, the rule won't be increased. */
 #define VSCP_DM_NG_DEBUG_INC_RULE()     \
     do{                                 \
-        if (FALSE == vscp_dm_ng_error)  \
+        if (FALSE == VSCP_DM_NG_INST.error)  \
         {                               \
-            ++vscp_dm_ng_errorRule;     \
+            ++VSCP_DM_NG_INST.errorRule;     \
         }                               \
     }while(0);
 
 /** Increase the position in the current rule. If a error is set, the position won't be increased. */
 #define VSCP_DM_NG_DEBUG_INC_POS(__pos)     \
     do{                                     \
-        if (FALSE == vscp_dm_ng_error)      \
+        if (FALSE == VSCP_DM_NG_INST.error)      \
         {                                   \
-            vscp_dm_ng_errorPos += (__pos); \
+            VSCP_DM_NG_INST.errorPos += (__pos); \
         }                                   \
     }while(0);
 
@@ -132,15 +157,103 @@
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_DM_NG_DEBUG ) */
 
+/** Data of the selected framework instance */
+#define VSCP_DM_NG_INST         (vscp_dm_ng_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+/** A single pre-decoded condition of a rule. */
+typedef struct
+{
+    uint8_t     basicOp;        /**< Basic operator, see ::VSCP_DM_NG_BASIC_OP */
+    uint8_t     logicOp;        /**< Logic operator to the following condition, see ::VSCP_DM_NG_LOGIC_OP */
+    uint8_t     eventParId;     /**< Event parameter id, see ::VSCP_DM_NG_EVENT_PAR_ID */
+    uint8_t     eventParIndex;  /**< Data index (only used in case of VSCP_DM_NG_EVENT_PAR_ID_DATA) */
+    uint16_t    value;          /**< Value to compare with */
+
+} vscp_dm_ng_Condition;
+
+/** A single pre-decoded rule. */
+typedef struct
+{
+    uint8_t     actionId;       /**< Action id */
+    uint8_t     actionPar;      /**< Action parameter */
+    uint16_t    condIndex;      /**< Index of the first condition in the condition cache */
+    uint8_t     condNum;        /**< Number of conditions */
+
+} vscp_dm_ng_Rule;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+/** Data of a framework instance */
+typedef struct
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
+
+    /** Error flag */
+    BOOL                    error;
+
+    /** If a error happened, it contains the corresponding rule. */
+    uint8_t                 errorRule;
+
+    /** If a error happened, it contains the corresponding position in the rule. */
+    uint8_t                 errorPos;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG ) */
+
+    /** Counts the number of rules down, until all rules are read with the
+     * ::vscp_dm_ng_getFirstRule and
+     * ::vscp_dm_ng_getNextRule functions.
+     */
+    uint8_t                 ruleCnt;
+
+    /** Byte index in the rule set, used by
+     * ::vscp_dm_ng_getFirstRule and
+     * ::vscp_dm_ng_getNextRule functions.
+     */
+    uint16_t                ruleSetIndex;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+    /** Rule cache is valid or must be rebuilt. */
+    BOOL                    cacheIsValid;
+
+    /** Pre-decoded rules, in the order of the rule set. */
+    vscp_dm_ng_Rule         cacheRules[VSCP_DM_NG_CACHE_RULES_MAX];
+
+    /** Number of pre-decoded rules. */
+    uint8_t                 cacheRuleCnt;
+
+    /** Pre-decoded conditions of all rules. */
+    vscp_dm_ng_Condition    cacheConds[VSCP_DM_NG_CACHE_COND_MAX];
+
+    /** Number of pre-decoded conditions. */
+    uint16_t                cacheCondCnt;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+} vscp_dm_ng_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+static void vscp_dm_ng_buildCache(void);
+static BOOL vscp_dm_ng_compileConditions(uint8_t const * const rulePart, uint8_t size, vscp_dm_ng_Rule * const cachedRule);
+static BOOL vscp_dm_ng_getCachedDecisionResult(vscp_dm_ng_Rule const * const cachedRule, vscp_RxMessage const * const rxMsg);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 static BOOL vscp_dm_ng_getDecisionResult(uint8_t const * const rulePart, uint8_t size, vscp_RxMessage const * const rxMsg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 static uint16_t vscp_dm_ng_getEventParValue(vscp_RxMessage const * const rxMsg, VSCP_DM_NG_EVENT_PAR_ID eventParId, uint8_t dataIndex);
 static uint8_t  vscp_dm_ng_getZone(vscp_RxMessage const * const rxMsg);
 static uint8_t  vscp_dm_ng_getSubZone(vscp_RxMessage const * const rxMsg);
@@ -152,30 +265,8 @@ extern VSCP_DM_NG_RET   vscp_dm_ng_getNextRule(uint8_t * const rule, uint8_t max
     LOCAL VARIABLES
 *******************************************************************************/
 
-#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
-
-/** Error flag */
-static BOOL     vscp_dm_ng_error        = FALSE;
-
-/** If a error happened, it contains the corresponding rule. */
-static uint8_t  vscp_dm_ng_errorRule    = 0;
-
-/** If a error happened, it contains the corresponding position in the rule. */
-static uint8_t  vscp_dm_ng_errorPos     = 0;
-
-#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG ) */
-
-/** Counts the number of rules down, until all rules are read with the
- * ::vscp_dm_ng_getFirstRule and
- * ::vscp_dm_ng_getNextRule functions.
- */
-static uint8_t  vscp_dm_ng_ruleCnt      = 0;
-
-/** Byte index in the rule set, used by
- * ::vscp_dm_ng_getFirstRule and
- * ::vscp_dm_ng_getNextRule functions.
- */
-static uint16_t vscp_dm_ng_ruleSetIndex = 0;
+/** Data of all framework instances */
+static vscp_dm_ng_Instance     vscp_dm_ng_instances[VSCP_INSTANCE_NUM];
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -190,7 +281,18 @@ static uint16_t vscp_dm_ng_ruleSetIndex = 0;
  */
 extern void vscp_dm_ng_init(void)
 {
-    /* Nothing to do */
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+    /* The cache is built on demand by the first received event. */
+    VSCP_DM_NG_INST.cacheIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+    vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
 
     return;
 }
@@ -208,6 +310,18 @@ extern void vscp_dm_ng_restoreFactoryDefaultSettings(void)
         vscp_ps_writeDMNextGeneration(index, 0);
     }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+    VSCP_DM_NG_INST.cacheIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+    vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
     return;
 }
 
@@ -291,7 +405,19 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
         index = (page - VSCP_DM_NG_START_PAGE) * 256 + addr;
         
         vscp_ps_writeDMNextGeneration(index, value);
-        
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+        VSCP_DM_NG_INST.cacheIsValid = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+        vscp_rx_filter_invalidate();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
         /* Read value back */
         value = vscp_ps_readDMNextGeneration(index);
     }
@@ -307,6 +433,34 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
  */
 extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
 {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+    uint8_t index   = 0;
+
+    if (NULL == rxMsg)
+    {
+        return;
+    }
+
+    /* Rule set changed since the cache was built? */
+    if (FALSE == VSCP_DM_NG_INST.cacheIsValid)
+    {
+        vscp_dm_ng_buildCache();
+    }
+
+    /* Walk through every valid rule. Rules without action are not cached. */
+    for(index = 0; index < VSCP_DM_NG_INST.cacheRuleCnt; ++index)
+    {
+        vscp_dm_ng_Rule const * const   cachedRule  = &VSCP_DM_NG_INST.cacheRules[index];
+
+        if (TRUE == vscp_dm_ng_getCachedDecisionResult(cachedRule, rxMsg))
+        {
+            vscp_action_execute(cachedRule->actionId, cachedRule->actionPar, rxMsg);
+        }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
     uint8_t rule[VSCP_DM_NG_RULE_MAX_SIZE];
 
     if (NULL == rxMsg)
@@ -371,9 +525,113 @@ extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
     }
     while(VSCP_DM_NG_RET_OK == vscp_dm_ng_getNextRule(rule, VSCP_DM_NG_RULE_MAX_SIZE));
 
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+/**
+ * This function provides the acceptance filter of a rule, which lets pass
+ * all events, the rule may be triggered by. Only rules, which combine all
+ * conditions with logic AND, are considered. Their equal conditions on the
+ * class, type, nickname id, hard coded flag and priority are part of the
+ * acceptance filter. All other rules let pass every event.
+ *
+ * @param[in]   ruleIndex   Index of the rule with a action
+ * @param[out]  entry       Acceptance filter
+ * @return  Rule available or not
+ * @retval  FALSE   No rule with this index.
+ * @retval  TRUE    Acceptance filter is valid.
+ */
+extern BOOL vscp_dm_ng_getAcceptanceFilter(uint8_t ruleIndex, vscp_AcceptanceFilter * const entry)
+{
+    uint8_t                         index   = 0;
+    vscp_dm_ng_Rule const *         cachedRule;
+    vscp_dm_ng_Condition const *    cond;
+
+    if (NULL == entry)
+    {
+        return FALSE;
+    }
+
+    /* Rule set changed since the cache was built? */
+    if (FALSE == VSCP_DM_NG_INST.cacheIsValid)
+    {
+        vscp_dm_ng_buildCache();
+    }
+
+    if (VSCP_DM_NG_INST.cacheRuleCnt <= ruleIndex)
+    {
+        return FALSE;
+    }
+
+    cachedRule  = &VSCP_DM_NG_INST.cacheRules[ruleIndex];
+    cond        = &VSCP_DM_NG_INST.cacheConds[cachedRule->condIndex];
+
+    entry->mask     = 0;
+    entry->filter   = 0;
+
+    for(index = 0; index < cachedRule->condNum; ++index)
+    {
+        uint32_t    mask    = 0;
+        uint32_t    filter  = 0;
+
+        /* Any logic OR lets pass events, which don't fulfill this condition. */
+        if (VSCP_DM_NG_LOGIC_OP_OR == cond[index].logicOp)
+        {
+            entry->mask     = 0;
+            entry->filter   = 0;
+            break;
+        }
+
+        /* Only a equal condition limits a event parameter to a single value. */
+        if (VSCP_DM_NG_BASIC_OP_EQUAL != cond[index].basicOp)
+        {
+            continue;
+        }
+
+        switch(cond[index].eventParId)
+        {
+        case VSCP_DM_NG_EVENT_PAR_ID_CLASS:
+            mask    = VSCP_RX_FILTER_CLASS(0x01FF);
+            filter  = VSCP_RX_FILTER_CLASS(cond[index].value);
+            break;
+
+        case VSCP_DM_NG_EVENT_PAR_ID_TYPE:
+            mask    = VSCP_RX_FILTER_TYPE(0xFF);
+            filter  = VSCP_RX_FILTER_TYPE(cond[index].value);
+            break;
+
+        case VSCP_DM_NG_EVENT_PAR_ID_OADDR:
+            mask    = VSCP_RX_FILTER_OADDR(0xFF);
+            filter  = VSCP_RX_FILTER_OADDR(cond[index].value);
+            break;
+
+        case VSCP_DM_NG_EVENT_PAR_ID_HARD_CODED:
+            mask    = ((uint32_t)0x01) << VSCP_RX_FILTER_POS_HARD_CODED;
+            filter  = ((uint32_t)(cond[index].value & 0x01)) << VSCP_RX_FILTER_POS_HARD_CODED;
+            break;
+
+        case VSCP_DM_NG_EVENT_PAR_ID_PRIORITY:
+            mask    = ((uint32_t)0x07) << VSCP_RX_FILTER_POS_PRIORITY;
+            filter  = ((uint32_t)(cond[index].value & 0x07)) << VSCP_RX_FILTER_POS_PRIORITY;
+            break;
+
+        default:
+            break;
+        }
+
+        entry->mask     |= mask;
+        entry->filter   |= filter;
+    }
+
+    return TRUE;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
 
 /**
@@ -387,17 +645,27 @@ extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg)
  */
 extern BOOL vscp_dm_ng_getError(uint8_t * const rule, uint8_t * const pos)
 {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+    /* The rule set is validated only once, during building the cache. */
+    if (FALSE == VSCP_DM_NG_INST.cacheIsValid)
+    {
+        vscp_dm_ng_buildCache();
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
     if (NULL != rule)
     {
-        *rule = vscp_dm_ng_errorRule;
+        *rule = VSCP_DM_NG_INST.errorRule;
     }
 
     if (NULL != pos)
     {
-        *pos = vscp_dm_ng_errorPos;
+        *pos = VSCP_DM_NG_INST.errorPos;
     }
 
-    return vscp_dm_ng_error;
+    return VSCP_DM_NG_INST.error;
 }
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG ) */
@@ -406,6 +674,262 @@ extern BOOL vscp_dm_ng_getError(uint8_t * const rule, uint8_t * const pos)
     LOCAL FUNCTIONS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+/**
+ * This function validates the whole rule set and decodes all rules with an
+ * action into the rule cache. Invalid rules are not cached and reported
+ * via the debug error information.
+ */
+static void vscp_dm_ng_buildCache(void)
+{
+    uint8_t         rule[VSCP_DM_NG_RULE_MAX_SIZE];
+    VSCP_DM_NG_RET  ret     = VSCP_DM_NG_RET_OK;
+
+    VSCP_DM_NG_INST.cacheRuleCnt = 0;
+    VSCP_DM_NG_INST.cacheCondCnt = 0;
+
+    VSCP_DM_NG_DEBUG_CLR_ERROR();
+
+    /* Walk through every rule */
+    ret = vscp_dm_ng_getFirstRule(rule, VSCP_DM_NG_RULE_MAX_SIZE);
+
+    while(VSCP_DM_NG_RET_OK == ret)
+    {
+        /* rule: <rule size> <action id> <action parameter> ... */
+        uint8_t ruleSize    = rule[0];
+        uint8_t actionId    = rule[1];
+        uint8_t actionPar   = rule[2];
+
+        VSCP_DM_NG_DEBUG_INC_RULE();
+
+        if (VSCP_DM_NG_SIZE_MIN > ruleSize)
+        {
+            VSCP_DM_NG_DEBUG_INC_POS(1);
+            VSCP_DM_NG_DEBUG_SET_ERROR();
+        }
+        /* Decode the condition(s) only in case there is a action to execute. */
+        else if (VSCP_DM_NG_ACTION_NO_OPERATION != actionId)
+        {
+            vscp_dm_ng_Rule * const cachedRule  = &VSCP_DM_NG_INST.cacheRules[VSCP_DM_NG_INST.cacheRuleCnt];
+
+            /* Rule cache full? Can only happen, if the rule set is corrupt. */
+            if (VSCP_DM_NG_CACHE_RULES_MAX <= VSCP_DM_NG_INST.cacheRuleCnt)
+            {
+                VSCP_DM_NG_DEBUG_SET_ERROR();
+                break;
+            }
+
+            cachedRule->actionId    = actionId;
+            cachedRule->actionPar   = actionPar;
+
+            if (TRUE == vscp_dm_ng_compileConditions(&rule[VSCP_DM_NG_RULE_HEADER_SIZE], ruleSize - VSCP_DM_NG_RULE_HEADER_SIZE, cachedRule))
+            {
+                ++VSCP_DM_NG_INST.cacheRuleCnt;
+            }
+        }
+
+        ret = vscp_dm_ng_getNextRule(rule, VSCP_DM_NG_RULE_MAX_SIZE);
+    }
+
+    VSCP_DM_NG_INST.cacheIsValid = TRUE;
+
+    return;
+}
+
+/**
+ * This function validates and decodes all conditions of a rule into the
+ * condition cache.
+ *
+ * @param[in]   rulePart    Part of the rule, starting with the first condition.
+ * @param[in]   size        Size of the rule part
+ * @param[out]  cachedRule  Cached rule, which gets the condition index and number.
+ * @return Valid rule or not
+ * @retval FALSE    Invalid rule, nothing is cached.
+ * @retval TRUE     Valid rule, conditions are cached.
+ */
+static BOOL vscp_dm_ng_compileConditions(uint8_t const * const rulePart, uint8_t size, vscp_dm_ng_Rule * const cachedRule)
+{
+    uint8_t     index   = 0;
+    uint16_t    condCnt = VSCP_DM_NG_INST.cacheCondCnt;
+    BOOL        error   = FALSE;
+
+    /* ... <condition operator> <event parameter id> <value> ... */
+    do
+    {
+        vscp_dm_ng_Condition * const    cond    = &VSCP_DM_NG_INST.cacheConds[condCnt];
+
+        /* Overspan condition operator and event parameter id for rule end check. */
+        if (size <= (index + 2))
+        {
+            error = TRUE;
+            break;
+        }
+
+        /* Condition cache full? Can only happen, if the rule set is corrupt. */
+        if (VSCP_DM_NG_CACHE_COND_MAX <= condCnt)
+        {
+            error = TRUE;
+            break;
+        }
+
+        /* ... <condition operator> ... */
+        cond->basicOp = rulePart[index] & VSCP_DM_NG_MASK_BASIC_OP;
+        cond->logicOp = rulePart[index] & VSCP_DM_NG_MASK_LOGIC_OP;
+        ++index;
+
+        /* Out of bounce check */
+        if (VSCP_DM_NG_BASIC_OP_MAX_NUM <= cond->basicOp)
+        {
+            error = TRUE;
+            break;
+        }
+
+        if ((VSCP_DM_NG_LOGIC_OP_LAST != cond->logicOp) &&
+            (VSCP_DM_NG_LOGIC_OP_AND != cond->logicOp) &&
+            (VSCP_DM_NG_LOGIC_OP_OR != cond->logicOp))
+        {
+            error = TRUE;
+            break;
+        }
+
+        /* ... <event parameter id> ... */
+        cond->eventParId    = rulePart[index];
+        cond->eventParIndex = 0;
+        ++index;
+
+        /* Out of bounce check */
+        if (VSCP_DM_NG_EVENT_PAR_ID_MAX_NUM <= cond->eventParId)
+        {
+            error = TRUE;
+            break;
+        }
+
+        /* If the event parameter index is in the rule, it will be
+         * get now.
+         */
+        if (VSCP_DM_NG_EVENT_PAR_ID_DATA == cond->eventParId)
+        {
+            cond->eventParIndex = rulePart[index];
+            ++index;
+
+            /* End of rule reached? */
+            if (size <= index)
+            {
+                error = TRUE;
+                break;
+            }
+        }
+
+        /* ... <value ... */
+        cond->value = rulePart[index];
+        ++index;
+
+        /* To compare against the vscp class, a 16-value is needed. */
+        if (VSCP_DM_NG_EVENT_PAR_ID_CLASS == cond->eventParId)
+        {
+            /* End of rule reached? */
+            if (size <= index)
+            {
+                error = TRUE;
+                break;
+            }
+
+            cond->value <<= 8;
+            cond->value |= rulePart[index];
+            ++index;
+        }
+
+        ++condCnt;
+    }
+    while(VSCP_DM_NG_LOGIC_OP_LAST != VSCP_DM_NG_INST.cacheConds[condCnt - 1].logicOp);
+
+    /* Any error happened? */
+    if (FALSE != error)
+    {
+        VSCP_DM_NG_DEBUG_INC_POS(index);
+        VSCP_DM_NG_DEBUG_SET_ERROR();
+
+        return FALSE;
+    }
+
+    cachedRule->condIndex   = VSCP_DM_NG_INST.cacheCondCnt;
+    cachedRule->condNum     = (uint8_t)(condCnt - VSCP_DM_NG_INST.cacheCondCnt);
+
+    VSCP_DM_NG_INST.cacheCondCnt = condCnt;
+
+    return TRUE;
+}
+
+/**
+ * This function calculate the decision result of all conditions in the
+ * pre-decoded rule.
+ *
+ * @param[in]   cachedRule  Pre-decoded rule
+ * @param[in]   rxMsg       Received message
+ * @return Result
+ */
+static BOOL vscp_dm_ng_getCachedDecisionResult(vscp_dm_ng_Rule const * const cachedRule, vscp_RxMessage const * const rxMsg)
+{
+    uint8_t                         index       = 0;
+    BOOL                            result      = FALSE;
+    VSCP_DM_NG_LOGIC_OP             logicOpPrev = VSCP_DM_NG_LOGIC_OP_LAST;
+    vscp_dm_ng_Condition const *    cond        = &VSCP_DM_NG_INST.cacheConds[cachedRule->condIndex];
+
+    for(index = 0; index < cachedRule->condNum; ++index)
+    {
+        uint16_t    eventParValue   = vscp_dm_ng_getEventParValue(rxMsg, (VSCP_DM_NG_EVENT_PAR_ID)cond->eventParId, cond->eventParIndex);
+        BOOL        condResult      = vscp_dm_ng_compare((VSCP_DM_NG_BASIC_OP)cond->basicOp, eventParValue, cond->value);
+
+        /* The first condition result? */
+        if (0 == index)
+        {
+            result = condResult;
+        }
+        /* Combine previous result with current result via logic AND? */
+        else if (VSCP_DM_NG_LOGIC_OP_AND == logicOpPrev)
+        {
+            if ((TRUE == result) && (TRUE == condResult))
+            {
+                result = TRUE;
+            }
+            else
+            {
+                result = FALSE;
+            }
+        }
+        /* Combine previous result with current result via logic OR */
+        else
+        {
+            if ((TRUE == result) || (TRUE == condResult))
+            {
+                result = TRUE;
+            }
+            else
+            {
+                result = FALSE;
+            }
+        }
+
+        /* Is the decision result already known? */
+        if (((VSCP_DM_NG_LOGIC_OP_AND == cond->logicOp) && (FALSE == result)) ||
+            ((VSCP_DM_NG_LOGIC_OP_OR == cond->logicOp) && (TRUE == result)))
+        {
+            /* Makes no sense to continue with this rule, because the result
+             * won't change anymore.
+             */
+            break;
+        }
+
+        logicOpPrev = (VSCP_DM_NG_LOGIC_OP)cond->logicOp;
+        ++cond;
+    }
+
+    return result;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 /**
  * This function calculate the decision result of all conditions in the rule.
  *
@@ -592,6 +1116,8 @@ static BOOL vscp_dm_ng_getDecisionResult(uint8_t const * const rulePart, uint8_t
     return result;
 }
 
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 /**
  * This function returns the value from the event parameters.
  *
@@ -808,18 +1334,18 @@ static VSCP_DM_NG_RET   vscp_dm_ng_getFirstRule(uint8_t * const rule, uint8_t ma
     }
 
     /* Get the number of rules */
-    vscp_dm_ng_ruleSetIndex = 0;
-    vscp_dm_ng_ruleCnt      = vscp_ps_readDMNextGeneration(vscp_dm_ng_ruleSetIndex);
-    ++vscp_dm_ng_ruleSetIndex;
+    VSCP_DM_NG_INST.ruleSetIndex = 0;
+    VSCP_DM_NG_INST.ruleCnt      = vscp_ps_readDMNextGeneration(VSCP_DM_NG_INST.ruleSetIndex);
+    ++VSCP_DM_NG_INST.ruleSetIndex;
 
     /* Empty rule set? */
-    if (0 == vscp_dm_ng_ruleCnt)
+    if (0 == VSCP_DM_NG_INST.ruleCnt)
     {
         status = VSCP_DM_NG_RET_NO_RULE;
     }
     else
     {
-        uint8_t ruleSize = vscp_ps_readDMNextGeneration(vscp_dm_ng_ruleSetIndex);
+        uint8_t ruleSize = vscp_ps_readDMNextGeneration(VSCP_DM_NG_INST.ruleSetIndex);
 
         /* Is the rule buffer big enough to hold the complete rule? */
         if (maxSize < ruleSize)
@@ -833,12 +1359,12 @@ static VSCP_DM_NG_RET   vscp_dm_ng_getFirstRule(uint8_t * const rule, uint8_t ma
             /* Copy rule to buffer */
             for(index = 0; index < ruleSize; ++index)
             {
-                rule[index] = vscp_ps_readDMNextGeneration(vscp_dm_ng_ruleSetIndex + index);
+                rule[index] = vscp_ps_readDMNextGeneration(VSCP_DM_NG_INST.ruleSetIndex + index);
             }
 
             /* Increment rule set index to the next rule */
-            vscp_dm_ng_ruleSetIndex += ruleSize;
-            --vscp_dm_ng_ruleCnt;
+            VSCP_DM_NG_INST.ruleSetIndex += ruleSize;
+            --VSCP_DM_NG_INST.ruleCnt;
         }
     }
 
@@ -862,13 +1388,13 @@ extern VSCP_DM_NG_RET   vscp_dm_ng_getNextRule(uint8_t * const rule, uint8_t max
     }
 
     /* No rule available anymore? */
-    if (0 == vscp_dm_ng_ruleCnt)
+    if (0 == VSCP_DM_NG_INST.ruleCnt)
     {
         status = VSCP_DM_NG_RET_NO_RULE;
     }
     else
     {
-        uint8_t ruleSize = vscp_ps_readDMNextGeneration(vscp_dm_ng_ruleSetIndex);
+        uint8_t ruleSize = vscp_ps_readDMNextGeneration(VSCP_DM_NG_INST.ruleSetIndex);
 
         /* Is the rule buffer big enough to hold the complete rule? */
         if (maxSize < ruleSize)
@@ -882,12 +1408,12 @@ extern VSCP_DM_NG_RET   vscp_dm_ng_getNextRule(uint8_t * const rule, uint8_t max
             /* Copy rule to buffer */
             for(index = 0; index < ruleSize; ++index)
             {
-                rule[index] = vscp_ps_readDMNextGeneration(vscp_dm_ng_ruleSetIndex + index);
+                rule[index] = vscp_ps_readDMNextGeneration(VSCP_DM_NG_INST.ruleSetIndex + index);
             }
 
             /* Increment rule set index to the next rule */
-            vscp_dm_ng_ruleSetIndex += ruleSize;
-            --vscp_dm_ng_ruleCnt;
+            VSCP_DM_NG_INST.ruleSetIndex += ruleSize;
+            --VSCP_DM_NG_INST.ruleCnt;
         }
     }
 
@@ -219,6 +219,25 @@ extern uint8_t  vscp_dm_ng_writeRegister(uint16_t page, uint8_t addr, uint8_t va
  */
 extern void vscp_dm_ng_executeActions(vscp_RxMessage const * const rxMsg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+/**
+ * This function provides the acceptance filter of a rule, which lets pass
+ * all events, the rule may be triggered by. Only rules, which combine all
+ * conditions with logic AND, are considered. Their equal conditions on the
+ * class, type, nickname id, hard coded flag and priority are part of the
+ * acceptance filter. All other rules let pass every event.
+ *
+ * @param[in]   ruleIndex   Index of the rule with a action
+ * @param[out]  entry       Acceptance filter
+ * @return  Rule available or not
+ * @retval  FALSE   No rule with this index.
+ * @retval  TRUE    Acceptance filter is valid.
+ */
+extern BOOL vscp_dm_ng_getAcceptanceFilter(uint8_t ruleIndex, vscp_AcceptanceFilter * const entry);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_DM_NG_DEBUG )
 
 /**
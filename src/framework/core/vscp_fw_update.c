@@ -0,0 +1,875 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP firmware update
+@file   vscp_fw_update.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_fw_update.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_fw_update.h"
+#include "vscp_instance.h"
+#include "vscp_type_protocol.h"
+#include "vscp_util.h"
+#include "../user/vscp_fw_access.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/* A block is received with block data events, each with 8 bytes. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 == (VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE % VSCP_L1_DATA_SIZE));
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0xFFFF >= VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_FW_UPDATE_BLOCKS);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0xFF > VSCP_CONFIG_FW_UPDATE_BLOCKS);
+
+/** Index of no block */
+#define VSCP_FW_UPDATE_NO_BLOCK     ((uint8_t)0xFF)
+
+/** Highest block number */
+#define VSCP_FW_UPDATE_BLOCK_MAX    ((uint32_t)0xFFFFFFFF)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Data of the selected framework instance */
+#define VSCP_FW_UPDATE_INST     (vscp_fw_update_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the states of a block in RAM. */
+typedef enum
+{
+    VSCP_FW_UPDATE_BLOCK_STATE_RECEIVE = 0, /**< Block data is received */
+    VSCP_FW_UPDATE_BLOCK_STATE_RECEIVED,    /**< Block waits for the program request */
+    VSCP_FW_UPDATE_BLOCK_STATE_PROGRAM      /**< Block waits to be programmed */
+
+} VSCP_FW_UPDATE_BLOCK_STATE;
+
+/** This type defines a block in RAM. */
+typedef struct
+{
+    uint8_t                     data[VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE]; /**< Block data */
+    uint32_t                    number;     /**< Block number */
+    uint16_t                    size;       /**< Number of received bytes */
+    uint16_t                    crc;        /**< CRC of the block */
+    BOOL                        isWindowed; /**< Is the CRC given by the sender (TRUE) or not (FALSE)? */
+    VSCP_FW_UPDATE_BLOCK_STATE  state;      /**< Block state */
+
+} vscp_fw_update_Block;
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Blocks in RAM, used as cyclic buffer in the order of reception. */
+    vscp_fw_update_Block    blocks[VSCP_CONFIG_FW_UPDATE_BLOCKS];
+
+    /** Index of the oldest block */
+    uint8_t                 head;
+
+    /** Number of used blocks */
+    uint8_t                 count;
+
+    /** Index of the block, which is received or VSCP_FW_UPDATE_NO_BLOCK */
+    uint8_t                 rxIndex;
+
+    /** Is a firmware update in progress (TRUE) or not (FALSE)? */
+    BOOL                    active;
+
+    /** Are the blocks sent windowed (TRUE) or not (FALSE)? */
+    BOOL                    isWindowed;
+
+    /** Windowed: Number of the next expected block */
+    uint32_t                nextBlock;
+
+    /** Windowed: Was a NACK sent (TRUE) and the node waits for the next expected block or not (FALSE)? */
+    BOOL                    isNacked;
+
+    /** Is the received block data discarded (TRUE) or not (FALSE)? */
+    BOOL                    isDiscarding;
+
+    /** Was a block programmed (TRUE) or not (FALSE)? */
+    BOOL                    isProgrammed;
+
+    /** Number of the last programmed block */
+    uint32_t                lastProgrammed;
+
+    /** Is a program request waiting for its acknowledge (TRUE) or not (FALSE)? */
+    BOOL                    programPending;
+
+    /** Block number of the program request */
+    uint32_t                programBlock;
+
+    /** Is a activate request waiting for its response (TRUE) or not (FALSE)? */
+    BOOL                    activatePending;
+
+    /** CRC sum of the activate request */
+    uint16_t                activateCrc;
+
+    /** Sum of the CRCs of all programmed blocks */
+    uint16_t                crcSum;
+
+} vscp_fw_update_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_fw_update_reset(void);
+static BOOL vscp_fw_update_handleStartBlock(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage);
+static BOOL vscp_fw_update_handleBlockData(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage);
+static BOOL vscp_fw_update_handleProgramBlock(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage);
+static BOOL vscp_fw_update_handleActivate(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage);
+static BOOL vscp_fw_update_checkProgramRequest(vscp_TxMessage * const txMessage);
+static BOOL vscp_fw_update_checkActivate(vscp_TxMessage * const txMessage);
+static BOOL vscp_fw_update_isProgramPending(uint32_t number);
+static void vscp_fw_update_buildAck(vscp_TxMessage * const txMessage);
+static void vscp_fw_update_buildBlockNack(vscp_TxMessage * const txMessage, uint8_t vscpType, uint8_t error, uint32_t number);
+static uint32_t vscp_fw_update_getBlockNumber(uint8_t const * const data);
+static void vscp_fw_update_setBlockNumber(uint8_t * const data, uint32_t number);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Data of all framework instances */
+static vscp_fw_update_Instance vscp_fw_update_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_fw_update_init(void)
+{
+    vscp_fw_update_reset();
+    VSCP_FW_UPDATE_INST.active = FALSE;
+
+    return;
+}
+
+/**
+ * This function returns whether a firmware update is in progress.
+ *
+ * @return If a firmware update is in progress, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_isActive(void)
+{
+    return VSCP_FW_UPDATE_INST.active;
+}
+
+/**
+ * This function enters the firmware update mode. A firmware update, which is
+ * in progress, is restarted. The response is built, but only the type,
+ * the data and the data size are set.
+ *
+ * @param[out]  txMessage   Response message, ACK or NACK boot loader mode
+ * @return If the firmware update mode is entered, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_enter(vscp_TxMessage * const txMessage)
+{
+    if (NULL == txMessage)
+    {
+        return FALSE;
+    }
+
+    /* No firmware access driver available? */
+    if (0 == vscp_fw_access_getBlockNum())
+    {
+        txMessage->vscpType = VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER;
+        txMessage->dataSize = 1;
+        txMessage->data[0]  = VSCP_FW_UPDATE_ERROR_NOT_SUPPORTED;
+
+        return FALSE;
+    }
+
+    vscp_fw_update_reset();
+    VSCP_FW_UPDATE_INST.active = TRUE;
+
+    vscp_fw_update_buildAck(txMessage);
+
+    return TRUE;
+}
+
+/**
+ * This function handles the boot loader events of the protocol class, during
+ * a firmware update. The response is built, but only the type, the data and
+ * the data size are set.
+ *
+ * @param[in]   rxMessage   Received message
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_handleEvent(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage)
+{
+    BOOL    isRsp   = FALSE;
+
+    if ((NULL == rxMessage) ||
+        (NULL == txMessage))
+    {
+        return FALSE;
+    }
+
+    /* The boot loader events have no meaning for a node, which is not in boot loader mode. */
+    if (FALSE == VSCP_FW_UPDATE_INST.active)
+    {
+        return FALSE;
+    }
+
+    switch(rxMessage->vscpType)
+    {
+    case VSCP_TYPE_PROTOCOL_START_BLOCK:
+        isRsp = vscp_fw_update_handleStartBlock(rxMessage, txMessage);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BLOCK_DATA:
+        isRsp = vscp_fw_update_handleBlockData(rxMessage, txMessage);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA:
+        isRsp = vscp_fw_update_handleProgramBlock(rxMessage, txMessage);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE:
+        isRsp = vscp_fw_update_handleActivate(rxMessage, txMessage);
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BOOT_LOADER_CHECK:
+        vscp_fw_update_buildAck(txMessage);
+        isRsp = TRUE;
+        break;
+
+    case VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT:
+        /* The current firmware keeps running, therefore aborting is always possible. */
+        vscp_fw_update_reset();
+        VSCP_FW_UPDATE_INST.active = FALSE;
+
+        txMessage->vscpType = VSCP_TYPE_PROTOCOL_BOOT_LOADER_ABORT_ACK;
+        txMessage->dataSize = 0;
+        isRsp = TRUE;
+        break;
+
+    default:
+        break;
+    }
+
+    return isRsp;
+}
+
+/**
+ * This function programs the received blocks in the background. Call it
+ * every process cycle. The response is built, but only the type, the data
+ * and the data size are set.
+ *
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_process(vscp_TxMessage * const txMessage)
+{
+    vscp_fw_update_Block *  block   = NULL;
+
+    if ((NULL == txMessage) ||
+        (FALSE == VSCP_FW_UPDATE_INST.active))
+    {
+        return FALSE;
+    }
+
+    block = &VSCP_FW_UPDATE_INST.blocks[VSCP_FW_UPDATE_INST.head];
+
+    /* Program the oldest block, if it is verified or requested. */
+    if ((0 < VSCP_FW_UPDATE_INST.count) &&
+        (VSCP_FW_UPDATE_BLOCK_STATE_PROGRAM == block->state))
+    {
+        VSCP_FW_ACCESS_RET  ret = vscp_fw_access_program(block->number, block->data, VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+
+        if (VSCP_FW_ACCESS_RET_BUSY == ret)
+        {
+            return FALSE;
+        }
+
+        if (VSCP_FW_ACCESS_RET_OK != ret)
+        {
+            uint32_t    number  = block->number;
+
+            /* Discard all blocks and continue with the failed one. */
+            VSCP_FW_UPDATE_INST.count          = 0;
+            VSCP_FW_UPDATE_INST.rxIndex        = VSCP_FW_UPDATE_NO_BLOCK;
+            VSCP_FW_UPDATE_INST.nextBlock      = number;
+            VSCP_FW_UPDATE_INST.isNacked       = TRUE;
+            VSCP_FW_UPDATE_INST.isDiscarding   = TRUE;
+            VSCP_FW_UPDATE_INST.programPending = FALSE;
+
+            vscp_fw_update_buildBlockNack(txMessage, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK, VSCP_FW_UPDATE_ERROR_PROGRAM, number);
+
+            return TRUE;
+        }
+
+        VSCP_FW_UPDATE_INST.crcSum          += block->crc;
+        VSCP_FW_UPDATE_INST.lastProgrammed = block->number;
+        VSCP_FW_UPDATE_INST.isProgrammed   = TRUE;
+
+        VSCP_FW_UPDATE_INST.head = (VSCP_FW_UPDATE_INST.head + 1) % VSCP_CONFIG_FW_UPDATE_BLOCKS;
+        --VSCP_FW_UPDATE_INST.count;
+
+        return vscp_fw_update_checkProgramRequest(txMessage);
+    }
+
+    return vscp_fw_update_checkActivate(txMessage);
+}
+
+/**
+ * This function returns whether received blocks are waiting to be programmed.
+ *
+ * @return If blocks are waiting, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_isBusy(void)
+{
+    BOOL    isBusy  = FALSE;
+
+    if ((TRUE == VSCP_FW_UPDATE_INST.active) &&
+        (TRUE == vscp_fw_update_isProgramPending(VSCP_FW_UPDATE_BLOCK_MAX)))
+    {
+        isBusy = TRUE;
+    }
+
+    return isBusy;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function discards all received blocks and restarts the firmware update.
+ */
+static void vscp_fw_update_reset(void)
+{
+    VSCP_FW_UPDATE_INST.head            = 0;
+    VSCP_FW_UPDATE_INST.count           = 0;
+    VSCP_FW_UPDATE_INST.rxIndex         = VSCP_FW_UPDATE_NO_BLOCK;
+    VSCP_FW_UPDATE_INST.isWindowed      = FALSE;
+    VSCP_FW_UPDATE_INST.nextBlock       = 0;
+    VSCP_FW_UPDATE_INST.isNacked        = FALSE;
+    VSCP_FW_UPDATE_INST.isDiscarding    = FALSE;
+    VSCP_FW_UPDATE_INST.isProgrammed    = FALSE;
+    VSCP_FW_UPDATE_INST.lastProgrammed  = 0;
+    VSCP_FW_UPDATE_INST.programPending  = FALSE;
+    VSCP_FW_UPDATE_INST.programBlock    = 0;
+    VSCP_FW_UPDATE_INST.activatePending = FALSE;
+    VSCP_FW_UPDATE_INST.activateCrc     = 0;
+    VSCP_FW_UPDATE_INST.crcSum          = 0;
+
+    return;
+}
+
+/**
+ * Handles a start block data transfer event.
+ *
+ * @param[in]   rxMessage   Received message
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_handleStartBlock(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage)
+{
+    vscp_fw_update_Block *  block       = NULL;
+    uint32_t                number      = 0;
+    uint8_t                 memoryType  = VSCP_FW_UPDATE_MEMORY_TYPE_FLASH;
+    BOOL                    isWindowed  = FALSE;
+
+    /* Check number of parameters. */
+    if (4 > rxMessage->dataSize)
+    {
+        return FALSE;
+    }
+
+    number = vscp_fw_update_getBlockNumber(&rxMessage->data[0]);
+
+    if (5 <= rxMessage->dataSize)
+    {
+        memoryType = rxMessage->data[4];
+    }
+
+    if (8 == rxMessage->dataSize)
+    {
+        isWindowed = TRUE;
+    }
+
+    /* A block, which is not complete, is discarded. It is always the newest one. */
+    if (VSCP_FW_UPDATE_NO_BLOCK != VSCP_FW_UPDATE_INST.rxIndex)
+    {
+        --VSCP_FW_UPDATE_INST.count;
+        VSCP_FW_UPDATE_INST.rxIndex = VSCP_FW_UPDATE_NO_BLOCK;
+    }
+
+    VSCP_FW_UPDATE_INST.isDiscarding = TRUE;
+
+    if ((VSCP_FW_UPDATE_MEMORY_TYPE_FLASH != memoryType) ||
+        (vscp_fw_access_getBlockNum() <= number))
+    {
+        txMessage->vscpType = VSCP_TYPE_PROTOCOL_START_BLOCK_NACK;
+        txMessage->dataSize = 1;
+        txMessage->data[0]  = VSCP_FW_UPDATE_ERROR_INVALID_BLOCK;
+
+        return TRUE;
+    }
+
+    if (TRUE == isWindowed)
+    {
+        VSCP_FW_UPDATE_INST.isWindowed = TRUE;
+
+        /* Received again, e.g. because another node requested it? */
+        if (VSCP_FW_UPDATE_INST.nextBlock > number)
+        {
+            return FALSE;
+        }
+
+        /* Blocks are missing? Request them only once, until the next expected block is received. */
+        if (VSCP_FW_UPDATE_INST.nextBlock < number)
+        {
+            if (TRUE == VSCP_FW_UPDATE_INST.isNacked)
+            {
+                return FALSE;
+            }
+
+            VSCP_FW_UPDATE_INST.isNacked = TRUE;
+            vscp_fw_update_buildBlockNack(txMessage, VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, VSCP_FW_UPDATE_ERROR_SEQUENCE, VSCP_FW_UPDATE_INST.nextBlock);
+
+            return TRUE;
+        }
+
+        VSCP_FW_UPDATE_INST.isNacked = FALSE;
+    }
+    else if (0 < VSCP_FW_UPDATE_INST.count)
+    {
+        block = &VSCP_FW_UPDATE_INST.blocks[(VSCP_FW_UPDATE_INST.head + VSCP_FW_UPDATE_INST.count - 1) % VSCP_CONFIG_FW_UPDATE_BLOCKS];
+
+        /* A block, which waits for the program request, is sent again. */
+        if ((VSCP_FW_UPDATE_BLOCK_STATE_RECEIVED == block->state) &&
+            (number == block->number))
+        {
+            --VSCP_FW_UPDATE_INST.count;
+        }
+    }
+
+    /* No free block in RAM? */
+    if (VSCP_CONFIG_FW_UPDATE_BLOCKS <= VSCP_FW_UPDATE_INST.count)
+    {
+        if (TRUE == isWindowed)
+        {
+            VSCP_FW_UPDATE_INST.isNacked = TRUE;
+            vscp_fw_update_buildBlockNack(txMessage, VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, VSCP_FW_UPDATE_ERROR_BUSY, number);
+        }
+        else
+        {
+            txMessage->vscpType = VSCP_TYPE_PROTOCOL_START_BLOCK_NACK;
+            txMessage->dataSize = 1;
+            txMessage->data[0]  = VSCP_FW_UPDATE_ERROR_BUSY;
+        }
+
+        return TRUE;
+    }
+
+    VSCP_FW_UPDATE_INST.rxIndex = (VSCP_FW_UPDATE_INST.head + VSCP_FW_UPDATE_INST.count) % VSCP_CONFIG_FW_UPDATE_BLOCKS;
+    ++VSCP_FW_UPDATE_INST.count;
+    VSCP_FW_UPDATE_INST.isDiscarding = FALSE;
+
+    block               = &VSCP_FW_UPDATE_INST.blocks[VSCP_FW_UPDATE_INST.rxIndex];
+    block->number       = number;
+    block->size         = 0;
+    block->crc          = 0;
+    block->isWindowed   = isWindowed;
+    block->state        = VSCP_FW_UPDATE_BLOCK_STATE_RECEIVE;
+
+    if (TRUE == isWindowed)
+    {
+        block->crc  = ((uint16_t)rxMessage->data[6]) << 8;
+        block->crc |= ((uint16_t)rxMessage->data[7]) << 0;
+
+        return FALSE;
+    }
+
+    txMessage->vscpType = VSCP_TYPE_PROTOCOL_START_BLOCK_ACK;
+    txMessage->dataSize = 0;
+
+    return TRUE;
+}
+
+/**
+ * Handles a block data event.
+ *
+ * @param[in]   rxMessage   Received message
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_handleBlockData(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage)
+{
+    vscp_fw_update_Block *  block   = NULL;
+    uint8_t                 index   = 0;
+    uint16_t                crc     = 0;
+
+    if (VSCP_FW_UPDATE_NO_BLOCK == VSCP_FW_UPDATE_INST.rxIndex)
+    {
+        /* Block data without start block data transfer? */
+        if ((TRUE == VSCP_FW_UPDATE_INST.isWindowed) &&
+            (FALSE == VSCP_FW_UPDATE_INST.isDiscarding) &&
+            (FALSE == VSCP_FW_UPDATE_INST.isNacked))
+        {
+            VSCP_FW_UPDATE_INST.isNacked = TRUE;
+            vscp_fw_update_buildBlockNack(txMessage, VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, VSCP_FW_UPDATE_ERROR_SEQUENCE, VSCP_FW_UPDATE_INST.nextBlock);
+
+            return TRUE;
+        }
+
+        return FALSE;
+    }
+
+    block = &VSCP_FW_UPDATE_INST.blocks[VSCP_FW_UPDATE_INST.rxIndex];
+
+    for(index = 0; (index < rxMessage->dataSize) && (VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE > block->size); ++index)
+    {
+        block->data[block->size] = rxMessage->data[index];
+        ++block->size;
+    }
+
+    /* Block not complete yet? */
+    if (VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE > block->size)
+    {
+        return FALSE;
+    }
+
+    VSCP_FW_UPDATE_INST.rxIndex = VSCP_FW_UPDATE_NO_BLOCK;
+
+    crc = vscp_util_crc16(VSCP_UTIL_CRC16_INIT, block->data, VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+
+    if (TRUE == block->isWindowed)
+    {
+        /* Wrong CRC? Discard it and all following blocks. */
+        if (crc != block->crc)
+        {
+            --VSCP_FW_UPDATE_INST.count;
+            VSCP_FW_UPDATE_INST.isNacked     = TRUE;
+            VSCP_FW_UPDATE_INST.isDiscarding = TRUE;
+            vscp_fw_update_buildBlockNack(txMessage, VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK, VSCP_FW_UPDATE_ERROR_CRC, block->number);
+
+            return TRUE;
+        }
+
+        /* Program it without waiting for the program request. */
+        block->state = VSCP_FW_UPDATE_BLOCK_STATE_PROGRAM;
+        ++VSCP_FW_UPDATE_INST.nextBlock;
+
+        return FALSE;
+    }
+
+    block->crc      = crc;
+    block->state    = VSCP_FW_UPDATE_BLOCK_STATE_RECEIVED;
+
+    /* Keep the next expected block in sync, in case the sender changes to windowed. */
+    VSCP_FW_UPDATE_INST.nextBlock = block->number + 1;
+
+    txMessage->vscpType = VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK;
+    txMessage->dataSize = 6;
+    txMessage->data[0]  = VSCP_UTIL_WORD_MSB(crc);
+    txMessage->data[1]  = VSCP_UTIL_WORD_LSB(crc);
+    vscp_fw_update_setBlockNumber(&txMessage->data[2], block->number);
+
+    return TRUE;
+}
+
+/**
+ * Handles a program data block event. All received blocks until the
+ * requested one are programmed and acknowledged together.
+ *
+ * @param[in]   rxMessage   Received message
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_handleProgramBlock(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage)
+{
+    uint32_t    number  = 0;
+    uint8_t     index   = 0;
+    BOOL        isKnown = FALSE;
+
+    /* Check number of parameters. */
+    if (4 > rxMessage->dataSize)
+    {
+        return FALSE;
+    }
+
+    number = vscp_fw_update_getBlockNumber(&rxMessage->data[0]);
+
+    for(index = 0; index < VSCP_FW_UPDATE_INST.count; ++index)
+    {
+        vscp_fw_update_Block *  block   = &VSCP_FW_UPDATE_INST.blocks[(VSCP_FW_UPDATE_INST.head + index) % VSCP_CONFIG_FW_UPDATE_BLOCKS];
+
+        if ((VSCP_FW_UPDATE_BLOCK_STATE_RECEIVED == block->state) &&
+            (number >= block->number))
+        {
+            block->state = VSCP_FW_UPDATE_BLOCK_STATE_PROGRAM;
+        }
+
+        if ((VSCP_FW_UPDATE_BLOCK_STATE_RECEIVE != block->state) &&
+            (number == block->number))
+        {
+            isKnown = TRUE;
+        }
+    }
+
+    /* Windowed, all blocks before the next expected one are programmed or will be. */
+    if ((TRUE == VSCP_FW_UPDATE_INST.isWindowed) &&
+        (VSCP_FW_UPDATE_INST.nextBlock > number))
+    {
+        isKnown = TRUE;
+    }
+
+    if ((TRUE == VSCP_FW_UPDATE_INST.isProgrammed) &&
+        (VSCP_FW_UPDATE_INST.lastProgrammed == number))
+    {
+        isKnown = TRUE;
+    }
+
+    if (FALSE == isKnown)
+    {
+        if (TRUE == VSCP_FW_UPDATE_INST.isWindowed)
+        {
+            number = VSCP_FW_UPDATE_INST.nextBlock;
+        }
+
+        vscp_fw_update_buildBlockNack(txMessage, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK, VSCP_FW_UPDATE_ERROR_SEQUENCE, number);
+
+        return TRUE;
+    }
+
+    VSCP_FW_UPDATE_INST.programPending = TRUE;
+    VSCP_FW_UPDATE_INST.programBlock   = number;
+
+    /* Maybe all blocks are already programmed. */
+    return vscp_fw_update_checkProgramRequest(txMessage);
+}
+
+/**
+ * Handles a activate new image event. The response is sent, after all
+ * blocks are programmed.
+ *
+ * @param[in]   rxMessage   Received message
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_handleActivate(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage)
+{
+    /* Check number of parameters. */
+    if (2 > rxMessage->dataSize)
+    {
+        return FALSE;
+    }
+
+    VSCP_FW_UPDATE_INST.activatePending = TRUE;
+    VSCP_FW_UPDATE_INST.activateCrc     = ((uint16_t)rxMessage->data[0]) << 8;
+    VSCP_FW_UPDATE_INST.activateCrc     |= ((uint16_t)rxMessage->data[1]) << 0;
+
+    return vscp_fw_update_checkActivate(txMessage);
+}
+
+/**
+ * This function acknowledges the pending program request, if all blocks
+ * until the requested one are programmed.
+ *
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_checkProgramRequest(vscp_TxMessage * const txMessage)
+{
+    if ((FALSE == VSCP_FW_UPDATE_INST.programPending) ||
+        (TRUE == vscp_fw_update_isProgramPending(VSCP_FW_UPDATE_INST.programBlock)))
+    {
+        return FALSE;
+    }
+
+    VSCP_FW_UPDATE_INST.programPending = FALSE;
+
+    txMessage->vscpType = VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK;
+    txMessage->dataSize = 4;
+    vscp_fw_update_setBlockNumber(&txMessage->data[0], VSCP_FW_UPDATE_INST.programBlock);
+
+    return TRUE;
+}
+
+/**
+ * This function responds to the pending activate request, after all blocks
+ * are programmed. The new firmware is activated, if the sum of all block
+ * CRCs is correct.
+ *
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_checkActivate(vscp_TxMessage * const txMessage)
+{
+    if ((FALSE == VSCP_FW_UPDATE_INST.activatePending) ||
+        (TRUE == vscp_fw_update_isProgramPending(VSCP_FW_UPDATE_BLOCK_MAX)))
+    {
+        return FALSE;
+    }
+
+    VSCP_FW_UPDATE_INST.activatePending = FALSE;
+
+    txMessage->vscpType = VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK;
+    txMessage->dataSize = 0;
+
+    if ((TRUE == VSCP_FW_UPDATE_INST.isProgrammed) &&
+        (VSCP_FW_UPDATE_INST.crcSum == VSCP_FW_UPDATE_INST.activateCrc) &&
+        (TRUE == vscp_fw_access_activate()))
+    {
+        txMessage->vscpType = VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK;
+
+        /* Firmware update finished */
+        vscp_fw_update_reset();
+        VSCP_FW_UPDATE_INST.active = FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function returns whether a block, which waits to be programmed, has
+ * the given or a lower block number.
+ *
+ * @param[in]   number  Block number
+ * @return If such a block waits, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_fw_update_isProgramPending(uint32_t number)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_FW_UPDATE_INST.count; ++index)
+    {
+        vscp_fw_update_Block const *    block   = &VSCP_FW_UPDATE_INST.blocks[(VSCP_FW_UPDATE_INST.head + index) % VSCP_CONFIG_FW_UPDATE_BLOCKS];
+
+        if ((VSCP_FW_UPDATE_BLOCK_STATE_PROGRAM == block->state) &&
+            (number >= block->number))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * This function builds the ACK boot loader mode response, which contains
+ * the block size and the number of blocks.
+ *
+ * @param[out]  txMessage   Response message
+ */
+static void vscp_fw_update_buildAck(vscp_TxMessage * const txMessage)
+{
+    txMessage->vscpType = VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER;
+    txMessage->dataSize = 8;
+    vscp_fw_update_setBlockNumber(&txMessage->data[0], VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE);
+    vscp_fw_update_setBlockNumber(&txMessage->data[4], vscp_fw_access_getBlockNum());
+
+    return;
+}
+
+/**
+ * This function builds a NACK response, which contains the error code and a
+ * block number.
+ *
+ * @param[out]  txMessage   Response message
+ * @param[in]   vscpType    NACK type
+ * @param[in]   error       Error code
+ * @param[in]   number      Block number
+ */
+static void vscp_fw_update_buildBlockNack(vscp_TxMessage * const txMessage, uint8_t vscpType, uint8_t error, uint32_t number)
+{
+    txMessage->vscpType = vscpType;
+    txMessage->dataSize = 5;
+    txMessage->data[0]  = error;
+    vscp_fw_update_setBlockNumber(&txMessage->data[1], number);
+
+    return;
+}
+
+/**
+ * This function gets a 32 bit value, e.g. a block number, MSB first.
+ *
+ * @param[in]   data    Data
+ * @return Value
+ */
+static uint32_t vscp_fw_update_getBlockNumber(uint8_t const * const data)
+{
+    uint32_t    number  = 0;
+
+    number  = ((uint32_t)data[0]) << 24;
+    number |= ((uint32_t)data[1]) << 16;
+    number |= ((uint32_t)data[2]) <<  8;
+    number |= ((uint32_t)data[3]) <<  0;
+
+    return number;
+}
+
+/**
+ * This function sets a 32 bit value, e.g. a block number, MSB first.
+ *
+ * @param[out]  data    Data
+ * @param[in]   number  Value
+ */
+static void vscp_fw_update_setBlockNumber(uint8_t * const data, uint32_t number)
+{
+    data[0] = (uint8_t)((number >> 24) & 0xff);
+    data[1] = (uint8_t)((number >> 16) & 0xff);
+    data[2] = (uint8_t)((number >>  8) & 0xff);
+    data[3] = (uint8_t)((number >>  0) & 0xff);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
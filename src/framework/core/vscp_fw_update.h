@@ -0,0 +1,207 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP firmware update
+@file   vscp_fw_update.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module updates the firmware in the application, via the VSCP boot loader
+algorithm.
+
+*******************************************************************************/
+/** @defgroup vscp_fw_update Firmware update
+ * The firmware update receives the blocks of the new firmware via the boot
+ * loader events of the protocol class. Every block is received into RAM and
+ * programmed in the background by the firmware access driver, while the next
+ * block is received. At the end the new firmware is activated, if the sum of
+ * all block CRCs is correct.
+ *
+ * Standard sequence, one round trip per block:
+ * - Start block data transfer: Block number, memory type.
+ * - Block data: The node acknowledges the complete block with its CRC.
+ * - Program data block: The node acknowledges it, after the block is programmed.
+ *
+ * Windowed sequence, if the start block data transfer contains the CRC of the
+ * block in byte 6 and 7 (MSB first):
+ * - The blocks are sent back to back with increasing block numbers, without
+ *   a gap. The node verifies the CRC of every block and programs it without
+ *   a acknowledge.
+ * - After several blocks, a program data block with the number of the last
+ *   block requests the acknowledge of all blocks until it.
+ * - If a block is missing, the CRC is wrong or no RAM block is free, the node
+ *   responds with a NACK, which contains the block number to continue with.
+ *   All following blocks are discarded, until this block is sent again.
+ *
+ * Several nodes are updated at once, by sending the enter boot loader mode
+ * event to the nickname VSCP_FW_UPDATE_NICKNAME_MULTICAST with the family
+ * code (MSB first) in byte 2-5 instead of the GUID. All nodes of the family
+ * code respond and receive the same block stream.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_FW_UPDATE
+ * - VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE
+ * - VSCP_CONFIG_FW_UPDATE_BLOCKS
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_FW_UPDATE_H__
+#define __VSCP_FW_UPDATE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+#include "vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** VSCP boot loader algorithm */
+#define VSCP_FW_UPDATE_ALGORITHM            0x00
+
+/** Nickname, which addresses all nodes with the same family code. */
+#define VSCP_FW_UPDATE_NICKNAME_MULTICAST   0xFF
+
+/** Memory type: Program flash */
+#define VSCP_FW_UPDATE_MEMORY_TYPE_FLASH    0x00
+
+/** Error code: Firmware update not supported */
+#define VSCP_FW_UPDATE_ERROR_NOT_SUPPORTED  1
+
+/** Error code: Invalid block number or memory type */
+#define VSCP_FW_UPDATE_ERROR_INVALID_BLOCK  2
+
+/** Error code: No free block in RAM */
+#define VSCP_FW_UPDATE_ERROR_BUSY           3
+
+/** Error code: Wrong CRC */
+#define VSCP_FW_UPDATE_ERROR_CRC            4
+
+/** Error code: Missing block or block data */
+#define VSCP_FW_UPDATE_ERROR_SEQUENCE       5
+
+/** Error code: Programming failed */
+#define VSCP_FW_UPDATE_ERROR_PROGRAM        6
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_fw_update_init(void);
+
+/**
+ * This function returns whether a firmware update is in progress.
+ *
+ * @return If a firmware update is in progress, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_isActive(void);
+
+/**
+ * This function enters the firmware update mode. A firmware update, which is
+ * in progress, is restarted. The response is built, but only the type,
+ * the data and the data size are set.
+ *
+ * @param[out]  txMessage   Response message, ACK or NACK boot loader mode
+ * @return If the firmware update mode is entered, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_enter(vscp_TxMessage * const txMessage);
+
+/**
+ * This function handles the boot loader events of the protocol class, during
+ * a firmware update. The response is built, but only the type, the data and
+ * the data size are set.
+ *
+ * @param[in]   rxMessage   Received message
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_handleEvent(vscp_RxMessage const * const rxMessage, vscp_TxMessage * const txMessage);
+
+/**
+ * This function programs the received blocks in the background. Call it
+ * every process cycle. The response is built, but only the type, the data
+ * and the data size are set.
+ *
+ * @param[out]  txMessage   Response message
+ * @return If a response is built, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_process(vscp_TxMessage * const txMessage);
+
+/**
+ * This function returns whether received blocks are waiting to be programmed.
+ *
+ * @return If blocks are waiting, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_update_isBusy(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_FW_UPDATE_H__ */
+
+/** @} */
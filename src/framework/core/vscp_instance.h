@@ -0,0 +1,168 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP framework instances
+@file   vscp_instance.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module selects the framework instance, which the framework functions
+work on.
+
+*******************************************************************************/
+/** @defgroup vscp_instance Framework instances
+ * Every module keeps its data per instance. If VSCP_CONFIG_MULTI_INSTANCE is
+ * enabled, the data of the instance, which is selected with
+ * vscp_instance_select(), is used. All framework functions, including the
+ * callbacks to the user modules, work on the selected instance, until another
+ * one is selected.
+ *
+ * If VSCP_CONFIG_MULTI_INSTANCE is disabled, there is only one instance with
+ * the index 0. The instance data is accessed directly then, without any
+ * run-time cost.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_INSTANCE_H__
+#define __VSCP_INSTANCE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Number of framework instances */
+#define VSCP_INSTANCE_NUM   VSCP_CONFIG_INSTANCE_NUM
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/** Number of framework instances */
+#define VSCP_INSTANCE_NUM   1
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Index of the selected instance */
+#define VSCP_INSTANCE       vscp_instance_current
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/** Index of the selected instance */
+#define VSCP_INSTANCE       0
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Index of the selected instance, don't write it directly. */
+extern uint16_t vscp_instance_current;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function selects the instance, which the framework functions work on.
+ * A invalid instance is ignored.
+ *
+ * @param[in]   instance    Instance index (0 - VSCP_INSTANCE_NUM - 1)
+ */
+static inline void vscp_instance_select(uint16_t instance)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+    if (VSCP_INSTANCE_NUM > instance)
+    {
+        vscp_instance_current = instance;
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+    (void)instance;
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+    return;
+}
+
+/**
+ * This function returns the selected instance. Use it e.g. in the transport
+ * or action callbacks, to find out which node called them.
+ *
+ * @return Instance index
+ */
+static inline uint16_t vscp_instance_get(void)
+{
+    return VSCP_INSTANCE;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_INSTANCE_H__ */
+
+/** @} */
@@ -0,0 +1,498 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP event interest
+@file   vscp_interest.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_interest.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_interest.h"
+#include "vscp_instance.h"
+#include "vscp_class_l1.h"
+#include "vscp_dm.h"
+#include "vscp_dm_ng.h"
+#include "vscp_rx_filter.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Mask of all class bits */
+#define VSCP_INTEREST_CLASS_MASK    ((uint16_t)0x01FF)
+
+/** Mask of all type bits */
+#define VSCP_INTEREST_TYPE_MASK     ((uint8_t)0xFF)
+
+/** Number of classes, which can be represented by the class bits */
+#define VSCP_INTEREST_CLASS_NUM     ((uint16_t)(VSCP_INTEREST_CLASS_MASK + 1))
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Data of the selected framework instance */
+#define VSCP_INTEREST_INST      (vscp_interest_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** This type defines the sources of the event interest. */
+typedef enum
+{
+    VSCP_INTEREST_SOURCE_DM = 0,    /**< Decision matrix */
+    VSCP_INTEREST_SOURCE_DM_NG,     /**< Decision matrix next generation */
+    VSCP_INTEREST_SOURCE_APP,       /**< Application */
+    VSCP_INTEREST_SOURCE_END        /**< All sources are reported */
+
+} VSCP_INTEREST_SOURCE;
+
+/** This type defines a class/type interest. */
+typedef struct
+{
+    uint16_t    classMask;      /**< Class mask (9 bit) */
+    uint16_t    classFilter;    /**< Class filter (9 bit) */
+    uint8_t     typeMask;       /**< Type mask */
+    uint8_t     typeFilter;     /**< Type filter */
+
+} vscp_interest_Entry;
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Event interest of the application */
+    vscp_interest_Entry     app[VSCP_CONFIG_EVENT_INTEREST_APP_NUM];
+
+    /** Number of application interests */
+    uint8_t                 appCnt;
+
+    /** Source, which is currently reported. */
+    VSCP_INTEREST_SOURCE    source;
+
+    /** Index of the next entry in the current source. */
+    uint8_t                 index;
+
+    /** Entry, which is currently reported. */
+    vscp_interest_Entry     entry;
+
+    /** Is a entry currently reported (TRUE) or not (FALSE)? */
+    BOOL                    entryValid;
+
+    /** Next class of the current entry, which is checked. */
+    uint16_t                class;
+
+} vscp_interest_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static BOOL vscp_interest_getEntry(VSCP_INTEREST_SOURCE source, uint8_t * const index, vscp_interest_Entry * const entry);
+static BOOL vscp_interest_getNextEntry(vscp_interest_Entry * const entry);
+static BOOL vscp_interest_isReported(uint16_t vscpClass, uint16_t vscpType);
+static BOOL vscp_interest_isAll(void);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Data of all framework instances */
+static vscp_interest_Instance  vscp_interest_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module. The application interest is cleared.
+ */
+extern void vscp_interest_init(void)
+{
+    VSCP_INTEREST_INST.appCnt     = 0;
+    VSCP_INTEREST_INST.source     = VSCP_INTEREST_SOURCE_END;
+    VSCP_INTEREST_INST.entryValid = FALSE;
+
+    return;
+}
+
+/**
+ * This function declares the interest of the application in the events,
+ * which match the given class and type mask/filter.
+ * A event matches, if (class & classMask) == classFilter and
+ * (type & typeMask) == typeFilter.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_interest_add(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    BOOL    status  = FALSE;
+
+    if (VSCP_CONFIG_EVENT_INTEREST_APP_NUM > VSCP_INTEREST_INST.appCnt)
+    {
+        vscp_interest_Entry * const entry   = &VSCP_INTEREST_INST.app[VSCP_INTEREST_INST.appCnt];
+
+        entry->classMask    = classMask & VSCP_INTEREST_CLASS_MASK;
+        entry->classFilter  = classFilter & entry->classMask;
+        entry->typeMask     = typeMask;
+        entry->typeFilter   = typeFilter & typeMask;
+        ++VSCP_INTEREST_INST.appCnt;
+
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function removes all interests of the application.
+ */
+extern void vscp_interest_clear(void)
+{
+    VSCP_INTEREST_INST.appCnt = 0;
+
+    return;
+}
+
+/**
+ * This function starts to report the event interest from the beginning.
+ * The events are retrieved one by one with vscp_interest_getNext().
+ */
+extern void vscp_interest_start(void)
+{
+    VSCP_INTEREST_INST.source     = VSCP_INTEREST_SOURCE_DM;
+    VSCP_INTEREST_INST.index      = 0;
+    VSCP_INTEREST_INST.entryValid = FALSE;
+
+    /* Interested in all events? Nothing shall be reported. */
+    if (TRUE == vscp_interest_isAll())
+    {
+        VSCP_INTEREST_INST.source = VSCP_INTEREST_SOURCE_END;
+    }
+
+    return;
+}
+
+/**
+ * This function gets the next event, the node is interested in.
+ *
+ * @param[out]  vscpClass   Class
+ * @param[out]  vscpType    Type or VSCP_INTEREST_TYPE_ALL
+ * @return If a event is available, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_interest_getNext(uint16_t * const vscpClass, uint16_t * const vscpType)
+{
+    BOOL    isFound = FALSE;
+
+    if ((NULL == vscpClass) ||
+        (NULL == vscpType))
+    {
+        return FALSE;
+    }
+
+    while(FALSE == isFound)
+    {
+        if (FALSE == VSCP_INTEREST_INST.entryValid)
+        {
+            if (FALSE == vscp_interest_getNextEntry(&VSCP_INTEREST_INST.entry))
+            {
+                break;
+            }
+
+            VSCP_INTEREST_INST.entryValid = TRUE;
+            VSCP_INTEREST_INST.class      = 0;
+        }
+
+        /* A single class can be taken directly, all others are searched. */
+        if (VSCP_INTEREST_CLASS_MASK == VSCP_INTEREST_INST.entry.classMask)
+        {
+            if (VSCP_INTEREST_INST.entry.classFilter >= VSCP_INTEREST_INST.class)
+            {
+                VSCP_INTEREST_INST.class = VSCP_INTEREST_INST.entry.classFilter;
+            }
+            else
+            {
+                VSCP_INTEREST_INST.class = VSCP_INTEREST_CLASS_NUM;
+            }
+        }
+        else
+        {
+            while((VSCP_INTEREST_CLASS_NUM > VSCP_INTEREST_INST.class) &&
+                  (VSCP_INTEREST_INST.entry.classFilter != (VSCP_INTEREST_INST.class & VSCP_INTEREST_INST.entry.classMask)))
+            {
+                ++VSCP_INTEREST_INST.class;
+            }
+        }
+
+        if (VSCP_INTEREST_CLASS_NUM <= VSCP_INTEREST_INST.class)
+        {
+            VSCP_INTEREST_INST.entryValid = FALSE;
+        }
+        else
+        {
+            /* Every node is interested in the protocol events. */
+            if (VSCP_CLASS_L1_PROTOCOL != VSCP_INTEREST_INST.class)
+            {
+                uint16_t    type    = VSCP_INTEREST_TYPE_ALL;
+
+                /* A partial type mask is reported as all types, which is
+                 * a superset of the interest.
+                 */
+                if (VSCP_INTEREST_TYPE_MASK == VSCP_INTEREST_INST.entry.typeMask)
+                {
+                    type = VSCP_INTEREST_INST.entry.typeFilter;
+                }
+
+                /* Several entries may cover the same class/type, e.g. decision
+                 * matrix rows with different actions. Report it only once.
+                 */
+                if (FALSE == vscp_interest_isReported(VSCP_INTEREST_INST.class, type))
+                {
+                    *vscpClass  = VSCP_INTEREST_INST.class;
+                    *vscpType   = type;
+                    isFound     = TRUE;
+                }
+            }
+
+            ++VSCP_INTEREST_INST.class;
+        }
+    }
+
+    return isFound;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function gets the next entry of the given source, starting at the
+ * given index. The index is moved behind the entry. Decision matrix rows,
+ * which are not used, are skipped.
+ *
+ * @param[in]       source  Source
+ * @param[in,out]   index   Index of the entry in the source
+ * @param[out]      entry   Entry
+ * @return If a entry is available, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_interest_getEntry(VSCP_INTEREST_SOURCE source, uint8_t * const index, vscp_interest_Entry * const entry)
+{
+    BOOL                    status  = FALSE;
+    vscp_AcceptanceFilter   filter;
+
+    filter.mask     = 0;
+    filter.filter   = 0;
+
+    switch(source)
+    {
+    case VSCP_INTEREST_SOURCE_DM:
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+        while((FALSE == status) &&
+              (vscp_dm_getMatrixRows() > *index))
+        {
+            status = vscp_dm_getAcceptanceFilter(*index, &filter);
+            ++(*index);
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+        break;
+
+    case VSCP_INTEREST_SOURCE_DM_NG:
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+        status = vscp_dm_ng_getAcceptanceFilter(*index, &filter);
+        ++(*index);
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+        /* Without the pre-decoded rules, every event may be relevant. */
+        if (0 == *index)
+        {
+            status = TRUE;
+            ++(*index);
+        }
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+        break;
+
+    case VSCP_INTEREST_SOURCE_APP:
+        if (VSCP_INTEREST_INST.appCnt > *index)
+        {
+            *entry = VSCP_INTEREST_INST.app[*index];
+            ++(*index);
+            return TRUE;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (TRUE == status)
+    {
+        entry->classMask    = (uint16_t)(filter.mask >> VSCP_RX_FILTER_POS_CLASS) & VSCP_INTEREST_CLASS_MASK;
+        entry->classFilter  = (uint16_t)(filter.filter >> VSCP_RX_FILTER_POS_CLASS) & entry->classMask;
+        entry->typeMask     = (uint8_t)(filter.mask >> VSCP_RX_FILTER_POS_TYPE);
+        entry->typeFilter   = (uint8_t)(filter.filter >> VSCP_RX_FILTER_POS_TYPE) & entry->typeMask;
+    }
+
+    return status;
+}
+
+/**
+ * This function gets the next entry of all sources.
+ *
+ * @param[out]  entry   Entry
+ * @return If a entry is available, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_interest_getNextEntry(vscp_interest_Entry * const entry)
+{
+    BOOL    isFound = FALSE;
+
+    while((FALSE == isFound) &&
+          (VSCP_INTEREST_SOURCE_END != VSCP_INTEREST_INST.source))
+    {
+        isFound = vscp_interest_getEntry(VSCP_INTEREST_INST.source, &VSCP_INTEREST_INST.index, entry);
+
+        /* Source completely reported? Continue with the next one. */
+        if (FALSE == isFound)
+        {
+            VSCP_INTEREST_INST.source = (VSCP_INTEREST_SOURCE)(VSCP_INTEREST_INST.source + 1);
+            VSCP_INTEREST_INST.index  = 0;
+        }
+    }
+
+    return isFound;
+}
+
+/**
+ * This function checks whether the given class/type was already reported by
+ * an entry before the current one. A type is reported too, if all types of
+ * the class were reported.
+ *
+ * @param[in]   vscpClass   Class
+ * @param[in]   vscpType    Type or VSCP_INTEREST_TYPE_ALL
+ * @return If already reported, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_interest_isReported(uint16_t vscpClass, uint16_t vscpType)
+{
+    BOOL                    isReported  = FALSE;
+    VSCP_INTEREST_SOURCE    source      = VSCP_INTEREST_SOURCE_DM;
+    uint8_t                 index       = 0;
+    vscp_interest_Entry     entry;
+
+    while((FALSE == isReported) &&
+          (VSCP_INTEREST_INST.source >= source))
+    {
+        if (FALSE == vscp_interest_getEntry(source, &index, &entry))
+        {
+            source = (VSCP_INTEREST_SOURCE)(source + 1);
+            index  = 0;
+        }
+        /* The index is moved behind the current entry, therefore it is reached
+         * if the index catches up.
+         */
+        else if ((VSCP_INTEREST_INST.source == source) &&
+                 (VSCP_INTEREST_INST.index <= index))
+        {
+            break;
+        }
+        /* A partial type mask was reported as all types. */
+        else if ((entry.classFilter == (vscpClass & entry.classMask)) &&
+                 ((VSCP_INTEREST_TYPE_MASK != entry.typeMask) ||
+                  (vscpType == entry.typeFilter)))
+        {
+            isReported = TRUE;
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    return isReported;
+}
+
+/**
+ * This function checks whether the node is interested in all classes.
+ *
+ * @return If interested in all classes, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_interest_isAll(void)
+{
+    BOOL                isAll   = FALSE;
+    vscp_interest_Entry entry;
+
+    while((FALSE == isAll) &&
+          (TRUE == vscp_interest_getNextEntry(&entry)))
+    {
+        if (0 == entry.classMask)
+        {
+            isAll = TRUE;
+        }
+    }
+
+    /* Start from the beginning again. */
+    VSCP_INTEREST_INST.source = VSCP_INTEREST_SOURCE_DM;
+    VSCP_INTEREST_INST.index  = 0;
+
+    return isAll;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
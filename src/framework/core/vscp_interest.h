@@ -0,0 +1,162 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP event interest
+@file   vscp_interest.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module reports the events, the node is interested in.
+
+*******************************************************************************/
+/** @defgroup vscp_interest Event interest
+ * A node may be asked via CLASS1.PROTOCOL, Type=40 (Get event interest),
+ * which events it is interested in. Gateways and segment controllers use it
+ * to forward only the relevant events to the segment of the node.
+ *
+ * The event interest is derived from:
+ * - All enabled decision matrix rows.
+ * - All decision matrix next generation rules.
+ * - The events, the application declared its interest in.
+ *
+ * Every reported event consists of the class and the type. If the node is
+ * interested in all types of a class, the type is reported as 0xFFFF.
+ * CLASS1.PROTOCOL is never reported, because every node is interested in it.
+ * If the node is interested in all classes, nothing is reported, which means
+ * according to the specification, that the node is interested in all events.
+ *
+ * Attention: If this module is enabled, gateways may not forward events to
+ * the application, which it didn't declare its interest in via
+ * vscp_interest_add().
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_EVENT_INTEREST
+ * - VSCP_CONFIG_EVENT_INTEREST_APP_NUM
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_INTEREST_H__
+#define __VSCP_INTEREST_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+#include "vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Reported type, if the node is interested in all types of a class. */
+#define VSCP_INTEREST_TYPE_ALL  ((uint16_t)0xFFFF)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST )
+
+/**
+ * This function initializes the module. The application interest is cleared.
+ */
+extern void vscp_interest_init(void);
+
+/**
+ * This function declares the interest of the application in the events,
+ * which match the given class and type mask/filter.
+ * A event matches, if (class & classMask) == classFilter and
+ * (type & typeMask) == typeFilter.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_interest_add(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+/**
+ * This function removes all interests of the application.
+ */
+extern void vscp_interest_clear(void);
+
+/**
+ * This function starts to report the event interest from the beginning.
+ * The events are retrieved one by one with vscp_interest_getNext().
+ */
+extern void vscp_interest_start(void);
+
+/**
+ * This function gets the next event, the node is interested in.
+ *
+ * @param[out]  vscpClass   Class
+ * @param[out]  vscpType    Type or VSCP_INTEREST_TYPE_ALL
+ * @return If a event is available, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_interest_getNext(uint16_t * const vscpClass, uint16_t * const vscpType);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EVENT_INTEREST ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_INTEREST_H__ */
+
+/** @} */
@@ -0,0 +1,262 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP Level II events
+@file   vscp_l2.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_l2.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_l2.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+#include "vscp_util.h"
+#include "vscp_class_l1_l2.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** First class after the Level I events over Level II. */
+#define VSCP_L2_CLASS_L1_L2_END     (1024)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/* The used blocks are stored in a 8-bit mask. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_L2_BLOCK_NUM);
+VSCP_UTIL_COMPILE_TIME_ASSERT(8 >= VSCP_CONFIG_L2_BLOCK_NUM);
+
+/* A block shall hold at least the destination GUID of a Level I event over Level II. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_GUID_SIZE <= VSCP_CONFIG_L2_BLOCK_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_L2_DATA_SIZE >= VSCP_CONFIG_L2_BLOCK_SIZE);
+
+/** Payload blocks */
+static uint8_t  vscp_l2_pool[VSCP_CONFIG_L2_BLOCK_NUM][VSCP_CONFIG_L2_BLOCK_SIZE];
+
+/** Used payload blocks, one bit per block */
+static uint8_t  vscp_l2_used    = 0;
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function allocates a payload block for a message. The data size of
+ * the message is set to 0.
+ *
+ * @param[in,out]   msg Message
+ * @return  Block allocated or not
+ * @retval  FALSE   No block left
+ * @retval  TRUE    Block allocated
+ */
+extern BOOL vscp_l2_alloc(vscp_L2Message * const msg)
+{
+    BOOL    status  = FALSE;
+    uint8_t index   = 0;
+
+    if (NULL == msg)
+    {
+        return FALSE;
+    }
+
+    for(index = 0; index < VSCP_CONFIG_L2_BLOCK_NUM; ++index)
+    {
+        uint8_t bit = (uint8_t)(1U << index);
+
+        if (0 == (vscp_l2_used & bit))
+        {
+            vscp_l2_used |= bit;
+
+            msg->data       = vscp_l2_pool[index];
+            msg->dataSize   = 0;
+
+            status = TRUE;
+            break;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function gives the payload block of a message back to the pool.
+ * If the data isn't a block of the pool, nothing happens.
+ *
+ * @param[in,out]   msg Message
+ */
+extern void vscp_l2_free(vscp_L2Message * const msg)
+{
+    uint8_t index   = 0;
+
+    if ((NULL == msg) ||
+        (NULL == msg->data))
+    {
+        return;
+    }
+
+    for(index = 0; index < VSCP_CONFIG_L2_BLOCK_NUM; ++index)
+    {
+        if (vscp_l2_pool[index] == msg->data)
+        {
+            vscp_l2_used &= (uint8_t)~(1U << index);
+
+            msg->data       = NULL;
+            msg->dataSize   = 0;
+            break;
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function returns the number of free payload blocks.
+ *
+ * @return Number of free blocks
+ */
+extern uint8_t  vscp_l2_getFreeBlocks(void)
+{
+    uint8_t freeBlocks  = 0;
+    uint8_t index       = 0;
+
+    for(index = 0; index < VSCP_CONFIG_L2_BLOCK_NUM; ++index)
+    {
+        if (0 == (vscp_l2_used & (1U << index)))
+        {
+            ++freeBlocks;
+        }
+    }
+
+    return freeBlocks;
+}
+
+/**
+ * This function converts a Level II event to a Level I event. If it is no
+ * Level I event, the Level I event is still a view of it, with the first
+ * data bytes only.
+ *
+ * @param[in]   l2Msg   Level II message
+ * @param[out]  l1Msg   Level I message
+ * @return  Level I event or not
+ * @retval  FALSE   Level II event, the Level I event is incomplete
+ * @retval  TRUE    Level I event
+ */
+extern BOOL vscp_l2_toL1(vscp_L2Message const * const l2Msg, vscp_RxMessage * const l1Msg)
+{
+    BOOL        isL1        = FALSE;
+    uint16_t    offset      = 0;
+    uint16_t    dataSize    = 0;
+    uint8_t     index       = 0;
+
+    if ((NULL == l2Msg) ||
+        (NULL == l1Msg))
+    {
+        return FALSE;
+    }
+
+    l1Msg->priority     = l2Msg->priority;
+    l1Msg->vscpClass    = l2Msg->vscpClass;
+    l1Msg->vscpType     = (uint8_t)l2Msg->vscpType;
+    l1Msg->oAddr        = l2Msg->guid[VSCP_GUID_SIZE - 1];
+    l1Msg->hardCoded    = FALSE;
+
+    if (VSCP_CLASS_L1_L2_BASE > l2Msg->vscpClass)
+    {
+        isL1 = TRUE;
+    }
+    /* Level I event over Level II with the destination GUID in front of the data.
+     * The protocol class has a different data layout and stays a Level II event.
+     */
+    else if ((VSCP_CLASS_L1_L2_PROTOCOL < l2Msg->vscpClass) &&
+             (VSCP_L2_CLASS_L1_L2_END > l2Msg->vscpClass) &&
+             (VSCP_GUID_SIZE <= l2Msg->dataSize))
+    {
+        l1Msg->vscpClass -= VSCP_CLASS_L1_L2_BASE;
+        offset = VSCP_GUID_SIZE;
+        isL1 = TRUE;
+    }
+
+    if (0xFF < l2Msg->vscpType)
+    {
+        isL1 = FALSE;
+    }
+
+    dataSize = l2Msg->dataSize - offset;
+
+    if (VSCP_L1_DATA_SIZE < dataSize)
+    {
+        dataSize = VSCP_L1_DATA_SIZE;
+        isL1 = FALSE;
+    }
+
+    l1Msg->dataSize = (uint8_t)dataSize;
+
+    for(index = 0; index < l1Msg->dataSize; ++index)
+    {
+        l1Msg->data[index] = l2Msg->data[offset + index];
+    }
+
+    return isL1;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
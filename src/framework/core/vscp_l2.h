@@ -0,0 +1,156 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP Level II events
+@file   vscp_l2.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides the payload pool of the Level II events and their
+conversion to Level I events.
+
+*******************************************************************************/
+/** @defgroup vscp_l2 VSCP Level II events
+ * A Level II event has a 16-bit class and type, the GUID of the originating
+ * node and up to VSCP_L2_DATA_SIZE data bytes. The data isn't part of the
+ * message, it is stored in a block of a pool. The pool consists of
+ * VSCP_CONFIG_L2_BLOCK_NUM blocks, each with VSCP_CONFIG_L2_BLOCK_SIZE bytes.
+ * There is no heap and the data is never copied on the stack.
+ *
+ * A Level II event is a Level I event, if
+ * - its class is lower than 512 and it carries not more than 8 data bytes or
+ * - its class is in the range of 513 - 1023 (Level I events over Level II)
+ *   and it carries the destination GUID followed by not more than 8 data
+ *   bytes.
+ * The type must be lower than 256 in both cases. The nickname id of the
+ * originating node is the LSB of its GUID.
+ *
+ * The pool is shared by all framework instances. It is not interrupt safe.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_LEVEL2
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_L2_H__
+#define __VSCP_L2_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function allocates a payload block for a message. The data size of
+ * the message is set to 0.
+ *
+ * @param[in,out]   msg Message
+ * @return  Block allocated or not
+ * @retval  FALSE   No block left
+ * @retval  TRUE    Block allocated
+ */
+extern BOOL vscp_l2_alloc(vscp_L2Message * const msg);
+
+/**
+ * This function gives the payload block of a message back to the pool.
+ * If the data isn't a block of the pool, nothing happens.
+ *
+ * @param[in,out]   msg Message
+ */
+extern void vscp_l2_free(vscp_L2Message * const msg);
+
+/**
+ * This function returns the number of free payload blocks.
+ *
+ * @return Number of free blocks
+ */
+extern uint8_t  vscp_l2_getFreeBlocks(void);
+
+/**
+ * This function converts a Level II event to a Level I event. If it is no
+ * Level I event, the Level I event is still a view of it, with the first
+ * data bytes only.
+ *
+ * @param[in]   l2Msg   Level II message
+ * @param[out]  l1Msg   Level I message
+ * @return  Level I event or not
+ * @retval  FALSE   Level II event, the Level I event is incomplete
+ * @retval  TRUE    Level I event
+ */
+extern BOOL vscp_l2_toL1(vscp_L2Message const * const l2Msg, vscp_RxMessage * const l1Msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_L2_H__ */
+
+/** @} */
@@ -41,10 +41,12 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_logger.h"
+#include "vscp_instance.h"
 #include "vscp_core.h"
 #include "vscp_class_l1.h"
 #include "vscp_type_log.h"
 #include "vscp_ps.h"
+#include "vscp_segment.h"
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOGGER )
 
@@ -60,10 +62,24 @@
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_LOGGER_INST        (vscp_logger_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Data of a framework instance */
+typedef struct
+{
+    /** Logging enabled or not */
+    BOOL    isEnabled;
+
+    /** Current log level bitfield */
+    uint8_t logLevel;
+
+} vscp_logger_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
@@ -72,11 +88,8 @@
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Logging enabled or not */
-static BOOL     vscp_logger_isEnabled   = FALSE;
-
-/** Current log level bitfield */
-static uint8_t  vscp_logger_logLevel    = 0;
+/** Data of all framework instances */
+static vscp_logger_Instance    vscp_logger_instances[VSCP_INSTANCE_NUM];
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -101,7 +114,7 @@ extern void vscp_logger_init(void)
  */
 extern void vscp_logger_enable(BOOL enableIt)
 {
-    vscp_logger_isEnabled = enableIt;
+    VSCP_LOGGER_INST.isEnabled = enableIt;
     return;
 }
 
@@ -112,7 +125,7 @@ extern void vscp_logger_enable(BOOL enableIt)
  */
 extern uint8_t vscp_logger_getLogLevel(void)
 {
-    return vscp_logger_logLevel;
+    return VSCP_LOGGER_INST.logLevel;
 }
 
 /**
@@ -122,7 +135,7 @@ extern uint8_t vscp_logger_getLogLevel(void)
  */
 extern void vscp_logger_setLogLevel(uint8_t level)
 {
-    vscp_logger_logLevel = level;
+    VSCP_LOGGER_INST.logLevel = level;
 
     return;
 }
@@ -137,9 +150,9 @@ extern void vscp_logger_setLogLevel(uint8_t level)
  */
 extern void vscp_logger_log(uint8_t id, VSCP_LOGGER_LVL level, uint8_t const * const msg, uint8_t size)
 {
-    if (TRUE == vscp_logger_isEnabled)
+    if (TRUE == VSCP_LOGGER_INST.isEnabled)
     {
-        if (0 != (vscp_logger_logLevel & (1 << level)))
+        if (0 != (VSCP_LOGGER_INST.logLevel & (1 << level)))
         {
             (void)vscp_logger_sendLogEvent(id, level, msg, size);
         }
@@ -188,7 +201,7 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
             {
                 if (vscp_ps_readLogId() == msg->data[0])
                 {
-                    vscp_logger_isEnabled = TRUE;
+                    VSCP_LOGGER_INST.isEnabled = TRUE;
                 }
             }
         }
@@ -199,7 +212,7 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
             {
                 if (vscp_ps_readLogId() == msg->data[0])
                 {
-                    vscp_logger_isEnabled = FALSE;
+                    VSCP_LOGGER_INST.isEnabled = FALSE;
                 }
             }
         }
@@ -208,7 +221,7 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
         {
             if (1 == msg->dataSize)
             {
-                vscp_logger_logLevel = msg->data[0];
+                VSCP_LOGGER_INST.logLevel = msg->data[0];
             }
         }
         else
@@ -227,59 +240,37 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg)
  * five bytes which is the maximum for each frame. In this case the zero based index
  * (byte 2) should be increased for each frame.
  *
+ * The frames are sent in the following process cycles, as far as the transport
+ * layer accepts them. The message is copied, therefore it may not be larger than
+ * VSCP_CONFIG_SEGMENT_TX_SIZE.
+ *
  * @param[in] id ID for event.
  * @param[in] level Log level for message.
  * @param[in] msg Message.
  * @param[in] size Message size in bytes.
  * @return Status
- * @retval FALSE Failed to send the event
- * @retval TRUE  Event successful sent
+ * @retval FALSE Failed to send the event, e.g. message too large
+ * @retval TRUE  Event queued
  *
  */
 extern BOOL vscp_logger_sendLogEvent(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size)
 {
     vscp_TxMessage  txMsg;
-    uint8_t         index       = 0;
-    uint8_t         eventIndex  = 0;
-    uint8_t         msgIndex    = 0;
-    BOOL            status      = FALSE;
 
     vscp_core_prepareTxMessage(&txMsg, VSCP_CLASS_L1_LOG, VSCP_TYPE_LOG_MESSAGE, VSCP_PRIORITY_3_NORMAL);
 
-    txMsg.dataSize = 8;
+    txMsg.dataSize = 3;
     txMsg.data[0]  = id;
     txMsg.data[1]  = level;
+    txMsg.data[2]  = 0;     /* Log event index, later needed to reassemble the log message */
 
-    /* If necessary, send several log events for a single log message. */
-    do
+    if (NULL == msg)
     {
-        /* Log event index, later needed to reassemble the log message */
-        txMsg.data[2] = eventIndex;
-
-        /* Defragment the log message */
-        for(index = 3; index < VSCP_L1_DATA_SIZE; ++index)
-        {
-            if ((NULL != msg) &&
-                (0 < size))
-            {
-                txMsg.data[index] = msg[msgIndex];
-                ++msgIndex;
-                --size;
-            }
-            /* Fill the rest of the log event with zeros. */
-            else
-            {
-                txMsg.data[index] = 0;
-            }
-        }
-
-        status = vscp_core_sendEvent(&txMsg);
-
-        ++eventIndex;
+        size = 0;
     }
-    while((NULL != msg) && (0 < size) && (TRUE == status));
 
-    return status;
+    /* The rest of the last log event is filled with zeros. */
+    return vscp_segment_send(&txMsg, 2, TRUE, msg, size);
 }
 
 /*******************************************************************************
@@ -265,13 +265,17 @@ extern void vscp_logger_handleEvent(vscp_RxMessage const * const msg);
  * five bytes which is the maximum for each frame. In this case the zero based index
  * (byte 2) should be increased for each frame.
  *
+ * The frames are sent in the following process cycles, as far as the transport
+ * layer accepts them. The message is copied, therefore it may not be larger than
+ * VSCP_CONFIG_SEGMENT_TX_SIZE.
+ *
  * @param[in] id ID for event.
  * @param[in] level Log level for message.
  * @param[in] msg Message.
  * @param[in] size Message size in bytes.
  * @return Status
- * @retval FALSE Failed to send the event
- * @retval TRUE  Event successful sent
+ * @retval FALSE Failed to send the event, e.g. message too large
+ * @retval TRUE  Event queued
  *
  */
 extern BOOL vscp_logger_sendLogEvent(uint8_t id, uint8_t level, uint8_t const * const msg, uint8_t size);
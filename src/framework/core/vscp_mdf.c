@@ -0,0 +1,250 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP embedded MDF
+@file   vscp_mdf.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_mdf.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_mdf.h"
+#include "vscp_instance.h"
+#include "vscp_util.h"
+#include "../user/vscp_mdf_access.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/* The window is addressed with a mask and a reference reaches max. 256 bytes back. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(16 <= VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(256 >= VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 == (VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE & (VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE - 1)));
+
+/** Size of the stream header in bytes */
+#define VSCP_MDF_HEADER_SIZE    3
+
+/** Min. supported window size as power of two */
+#define VSCP_MDF_WINDOW_BITS    4
+
+/** Min. length of a reference */
+#define VSCP_MDF_MATCH_MIN      3
+
+/** Mask to get the position in the window */
+#define VSCP_MDF_WINDOW_MASK    ((uint16_t)(VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE - 1))
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Data of the selected framework instance */
+#define VSCP_MDF_INST           (vscp_mdf_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Decompression window with the last decompressed bytes */
+    uint8_t     window[VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE];
+
+    /** Read position in the compressed MDF */
+    uint16_t    pos;
+
+    /** Number of remaining bytes of the uncompressed MDF */
+    uint16_t    remaining;
+
+    /** Write position in the window */
+    uint16_t    windowPos;
+
+    /** Flags of the current block */
+    uint8_t     flags;
+
+    /** Number of remaining flags of the current block */
+    uint8_t     flagCnt;
+
+    /** Distance of the current reference */
+    uint16_t    matchDistance;
+
+    /** Remaining length of the current reference */
+    uint16_t    matchLength;
+
+} vscp_mdf_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Data of all framework instances */
+static vscp_mdf_Instance       vscp_mdf_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_mdf_init(void)
+{
+    VSCP_MDF_INST.remaining   = 0;
+    VSCP_MDF_INST.matchLength = 0;
+
+    return;
+}
+
+/**
+ * This function starts to decompress the MDF from the beginning.
+ *
+ * @return If a MDF is available, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_mdf_start(void)
+{
+    uint8_t windowBits  = 0;
+
+    VSCP_MDF_INST.remaining     = 0;
+    VSCP_MDF_INST.pos           = VSCP_MDF_HEADER_SIZE;
+    VSCP_MDF_INST.windowPos     = 0;
+    VSCP_MDF_INST.flags         = 0;
+    VSCP_MDF_INST.flagCnt       = 0;
+    VSCP_MDF_INST.matchDistance = 0;
+    VSCP_MDF_INST.matchLength   = 0;
+
+    if (VSCP_MDF_HEADER_SIZE >= vscp_mdf_access_getSize())
+    {
+        return FALSE;
+    }
+
+    windowBits = vscp_mdf_access_read8(0);
+
+    /* A MDF, which was compressed with a larger window, can't be decompressed. */
+    if ((VSCP_MDF_WINDOW_BITS > windowBits) ||
+        (8 < windowBits) ||
+        (VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE < (1u << windowBits)))
+    {
+        return FALSE;
+    }
+
+    VSCP_MDF_INST.remaining  = ((uint16_t)vscp_mdf_access_read8(1)) << 8;
+    VSCP_MDF_INST.remaining |= ((uint16_t)vscp_mdf_access_read8(2)) << 0;
+
+    return (0 < VSCP_MDF_INST.remaining) ? TRUE : FALSE;
+}
+
+/**
+ * This function decompresses the next chunk of the MDF.
+ *
+ * @param[out]  buffer  Buffer, which to fill
+ * @param[in]   size    Buffer size in byte
+ * @return Number of decompressed bytes. If the MDF is complete, it returns 0.
+ */
+extern uint8_t vscp_mdf_read(uint8_t * const buffer, uint8_t size)
+{
+    uint8_t count   = 0;
+    uint8_t value   = 0;
+
+    if (NULL == buffer)
+    {
+        return 0;
+    }
+
+    while((size > count) && (0 < VSCP_MDF_INST.remaining))
+    {
+        if (0 == VSCP_MDF_INST.matchLength)
+        {
+            if (0 == VSCP_MDF_INST.flagCnt)
+            {
+                VSCP_MDF_INST.flags = vscp_mdf_access_read8(VSCP_MDF_INST.pos);
+                ++VSCP_MDF_INST.pos;
+                VSCP_MDF_INST.flagCnt = 8;
+            }
+
+            /* Literal? */
+            if (0 != (VSCP_MDF_INST.flags & 0x01))
+            {
+                value = vscp_mdf_access_read8(VSCP_MDF_INST.pos);
+                ++VSCP_MDF_INST.pos;
+            }
+            /* Reference */
+            else
+            {
+                VSCP_MDF_INST.matchDistance = ((uint16_t)vscp_mdf_access_read8(VSCP_MDF_INST.pos)) + 1;
+                VSCP_MDF_INST.matchLength   = ((uint16_t)vscp_mdf_access_read8(VSCP_MDF_INST.pos + 1)) + VSCP_MDF_MATCH_MIN;
+                VSCP_MDF_INST.pos += 2;
+            }
+
+            VSCP_MDF_INST.flags >>= 1;
+            --VSCP_MDF_INST.flagCnt;
+        }
+
+        if (0 < VSCP_MDF_INST.matchLength)
+        {
+            value = VSCP_MDF_INST.window[(VSCP_MDF_INST.windowPos - VSCP_MDF_INST.matchDistance) & VSCP_MDF_WINDOW_MASK];
+            --VSCP_MDF_INST.matchLength;
+        }
+
+        VSCP_MDF_INST.window[VSCP_MDF_INST.windowPos & VSCP_MDF_WINDOW_MASK] = value;
+        ++VSCP_MDF_INST.windowPos;
+
+        buffer[count] = value;
+        ++count;
+        --VSCP_MDF_INST.remaining;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
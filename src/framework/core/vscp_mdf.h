@@ -0,0 +1,137 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP embedded MDF
+@file   vscp_mdf.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module decompresses the embedded module description file (MDF).
+
+*******************************************************************************/
+/** @defgroup vscp_mdf Embedded MDF
+ * A node may be asked via CLASS1.PROTOCOL, Type=35 (Get embedded MDF) for its
+ * module description file. The MDF is stored LZSS compressed in the program
+ * memory and is read via the MDF access driver.
+ *
+ * The MDF is decompressed with a cursor, which provides the next chunk on
+ * every call. Only the decompression window is kept in RAM, therefore the
+ * size of the MDF doesn't influence the RAM consumption.
+ *
+ * Compressed stream:
+ * - Byte 0: Window size as power of two.
+ * - Byte 1-2: Size of the uncompressed MDF (MSB first).
+ * - Byte 3-n: Blocks of a flag byte, followed by 8 items. A set flag bit
+ *   (LSB first) means a literal byte, a cleared one a reference to the
+ *   window: distance - 1 and length - 3.
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_EMBEDDED_MDF
+ * - VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_MDF_H__
+#define __VSCP_MDF_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+#include "vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_mdf_init(void);
+
+/**
+ * This function starts to decompress the MDF from the beginning.
+ *
+ * @return If a MDF is available, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_mdf_start(void);
+
+/**
+ * This function decompresses the next chunk of the MDF.
+ *
+ * @param[out]  buffer  Buffer, which to fill
+ * @param[in]   size    Buffer size in byte
+ * @return Number of decompressed bytes. If the MDF is complete, it returns 0.
+ */
+extern uint8_t vscp_mdf_read(uint8_t * const buffer, uint8_t size);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_MDF_H__ */
+
+/** @} */
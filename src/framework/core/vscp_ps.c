@@ -41,6 +41,8 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_ps.h"
+#include "vscp_instance.h"
+#include "vscp_ps_cache.h"
 #include "../user/vscp_ps_access.h"
 
 /*******************************************************************************
@@ -51,22 +53,86 @@
     CONSTANTS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+/** Offset of the nickname id in a journal slot */
+#define VSCP_PS_JOURNAL_OFFSET_NICKNAME 0
+
+/** Offset of the segment controller CRC in a journal slot */
+#define VSCP_PS_JOURNAL_OFFSET_CRC      1
+
+/** Offset of the sequence number in a journal slot. It is written last. */
+#define VSCP_PS_JOURNAL_OFFSET_SEQ      2
+
+/** Sequence number of a erased journal slot */
+#define VSCP_PS_JOURNAL_SEQ_ERASED      0xFF
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+/** Get the address of a journal slot. */
+#define VSCP_PS_JOURNAL_SLOT_ADDR(__slot)   (VSCP_PS_ADDR_JOURNAL + ((uint16_t)(__slot) * VSCP_PS_JOURNAL_SLOT_SIZE))
+
+/** Get the sequence number, which follows the given one. The erased value is skipped. */
+#define VSCP_PS_JOURNAL_SEQ_NEXT(__seq)     ((uint8_t)(((__seq) + 1) % VSCP_PS_JOURNAL_SEQ_ERASED))
+
+/** Data of the selected framework instance */
+#define VSCP_PS_INST                        (vscp_ps_instances[VSCP_INSTANCE])
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Nickname id, mirrored from the latest journal slot */
+    uint8_t journalNickname;
+
+    /** Segment controller CRC, mirrored from the latest journal slot */
+    uint8_t journalCrc;
+
+    /** Index of the latest journal slot */
+    uint8_t journalSlot;
+
+    /** Sequence number of the latest journal slot */
+    uint8_t journalSeq;
+
+} vscp_ps_Instance;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+static void vscp_ps_journalLoad(void);
+static void vscp_ps_journalWrite(uint8_t nickname, uint8_t crc);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+/** Data of all framework instances */
+static vscp_ps_Instance vscp_ps_instances[VSCP_INSTANCE_NUM];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -82,8 +148,36 @@
  */
 extern void vscp_ps_init(void)
 {
-    /* Initialize persistent memory access driver */
-    vscp_ps_access_init();
+    /* Initialize persistent memory cache and access driver */
+    vscp_ps_cache_init();
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+    vscp_ps_journalLoad();
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
+    return;
+}
+
+/**
+ * This function processes the persistent memory cache. It shall be called
+ * periodically.
+ *
+ * @param[in]   isIdle  Node is idle (TRUE) or busy (FALSE)
+ */
+extern void vscp_ps_process(BOOL isIdle)
+{
+    vscp_ps_cache_process(isIdle);
+
+    return;
+}
+
+/**
+ * This function writes all cached data back to the persistent memory.
+ * Call it e.g. before a reset or if a power loss is detected.
+ */
+extern void vscp_ps_flush(void)
+{
+    vscp_ps_cache_flush();
 
     return;
 }
@@ -97,7 +191,7 @@ extern void vscp_ps_init(void)
  */
 extern uint8_t  vscp_ps_readBootFlag(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_BOOT_FLAG);
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_BOOT_FLAG);
 }
 
 /**
@@ -107,7 +201,7 @@ extern uint8_t  vscp_ps_readBootFlag(void)
  */
 extern void vscp_ps_writeBootFlag(uint8_t bootFlag)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_BOOT_FLAG, bootFlag);
+    vscp_ps_cache_write8(VSCP_PS_ADDR_BOOT_FLAG, bootFlag);
     return;
 }
 
@@ -120,7 +214,11 @@ extern void vscp_ps_writeBootFlag(uint8_t bootFlag)
  */
 extern uint8_t  vscp_ps_readNicknameId(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NICKNAME);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+    return VSCP_PS_INST.journalNickname;
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_NICKNAME);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
 }
 
 /**
@@ -130,7 +228,11 @@ extern uint8_t  vscp_ps_readNicknameId(void)
  */
 extern void vscp_ps_writeNicknameId(uint8_t nickname)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NICKNAME, nickname);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+    vscp_ps_journalWrite(nickname, VSCP_PS_INST.journalCrc);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
+    vscp_ps_cache_write8(VSCP_PS_ADDR_NICKNAME, nickname);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
     return;
 }
 
@@ -143,7 +245,11 @@ extern void vscp_ps_writeNicknameId(uint8_t nickname)
  */
 extern uint8_t  vscp_ps_readSegmentControllerCRC(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+    return VSCP_PS_INST.journalCrc;
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
 }
 
 /**
@@ -153,7 +259,11 @@ extern uint8_t  vscp_ps_readSegmentControllerCRC(void)
  */
 extern void vscp_ps_writeSegmentControllerCRC(uint8_t crc)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC, crc);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+    vscp_ps_journalWrite(VSCP_PS_INST.journalNickname, crc);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
+    vscp_ps_cache_write8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC, crc);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
     return;
 }
 
@@ -166,7 +276,7 @@ extern void vscp_ps_writeSegmentControllerCRC(uint8_t crc)
  */
 extern uint8_t  vscp_ps_readNodeControlFlags(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS);
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS);
 }
 
 /**
@@ -176,7 +286,7 @@ extern uint8_t  vscp_ps_readNodeControlFlags(void)
  */
 extern void vscp_ps_writeNodeControlFlags(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS, value);
+    vscp_ps_cache_write8(VSCP_PS_ADDR_NODE_CONTROL_FLAGS, value);
     return;
 }
 
@@ -193,7 +303,7 @@ extern uint8_t  vscp_ps_readUserId(uint8_t index)
 
     if (VSCP_PS_SIZE_USER_ID > index)
     {
-        data = vscp_ps_access_read8(VSCP_PS_ADDR_USER_ID + index);
+        data = vscp_ps_cache_read8(VSCP_PS_ADDR_USER_ID + index);
     }
 
     return data;
@@ -210,7 +320,7 @@ extern void vscp_ps_writeUserId(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_USER_ID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_USER_ID + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_USER_ID + index, value);
     }
 
     return;
@@ -231,7 +341,7 @@ extern uint8_t  vscp_ps_readGUID(uint8_t index)
 
     if (VSCP_PS_SIZE_GUID > index)
     {
-        data = vscp_ps_access_read8(VSCP_PS_ADDR_GUID + index);
+        data = vscp_ps_cache_read8(VSCP_PS_ADDR_GUID + index);
     }
 
     return data;
@@ -248,7 +358,7 @@ extern void vscp_ps_writeGUID(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_GUID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_GUID + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_GUID + index, value);
     }
 
     return;
@@ -265,7 +375,7 @@ extern void vscp_ps_writeGUID(uint8_t index, uint8_t value)
  */
 extern uint8_t  vscp_ps_readNodeZone(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NODE_ZONE);
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_NODE_ZONE);
 }
 
 /**
@@ -275,7 +385,7 @@ extern uint8_t  vscp_ps_readNodeZone(void)
  */
 extern void vscp_ps_writeNodeZone(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NODE_ZONE, value);
+    vscp_ps_cache_write8(VSCP_PS_ADDR_NODE_ZONE, value);
     return;
 }
 
@@ -290,7 +400,7 @@ extern void vscp_ps_writeNodeZone(uint8_t value)
  */
 extern uint8_t  vscp_ps_readNodeSubZone(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_NODE_SUB_ZONE);
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_NODE_SUB_ZONE);
 }
 
 /**
@@ -300,7 +410,7 @@ extern uint8_t  vscp_ps_readNodeSubZone(void)
  */
 extern void vscp_ps_writeNodeSubZone(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_NODE_SUB_ZONE, value);
+    vscp_ps_cache_write8(VSCP_PS_ADDR_NODE_SUB_ZONE, value);
     return;
 }
 
@@ -321,7 +431,7 @@ extern uint8_t  vscp_ps_readManufacturerDevId(uint8_t index)
 
     if (VSCP_PS_SIZE_MANUFACTURER_DEV_ID > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index);
     }
 
     return value;
@@ -338,7 +448,7 @@ extern void vscp_ps_writeManufacturerDevId(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_MANUFACTURER_DEV_ID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_MANUFACTURER_DEV_ID + index, value);
     }
 
     return;
@@ -361,7 +471,7 @@ extern uint8_t  vscp_ps_readManufacturerSubDevId(uint8_t index)
 
     if (VSCP_PS_SIZE_MANUFACTURER_SUB_DEV_ID > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index);
     }
 
     return value;
@@ -378,7 +488,7 @@ extern void vscp_ps_writeManufacturerSubDevId(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_MANUFACTURER_SUB_DEV_ID > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_MANUFACTURER_SUB_DEV_ID + index, value);
     }
 
     return;
@@ -400,7 +510,7 @@ extern uint8_t  vscp_ps_readMdfUrl(uint8_t index)
 
     if (VSCP_PS_SIZE_MDF_URL > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_MDF_URL + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_MDF_URL + index);
     }
 
     return value;
@@ -417,7 +527,7 @@ extern void vscp_ps_writeMdfUrl(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_MDF_URL > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_MDF_URL + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_MDF_URL + index, value);
     }
 
     return;
@@ -440,7 +550,7 @@ extern uint8_t  vscp_ps_readStdDevFamilyCode(uint8_t index)
 
     if (VSCP_PS_SIZE_STD_DEV_FAMILY_CODE > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index);
     }
 
     return value;
@@ -457,7 +567,7 @@ extern void vscp_ps_writeStdDevFamilyCode(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_STD_DEV_FAMILY_CODE > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_STD_DEV_FAMILY_CODE + index, value);
     }
 
     return;
@@ -480,7 +590,7 @@ extern uint8_t  vscp_ps_readStdDevType(uint8_t index)
 
     if (VSCP_PS_SIZE_STD_DEV_TYPE > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_STD_DEV_TYPE + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_STD_DEV_TYPE + index);
     }
 
     return value;
@@ -497,7 +607,7 @@ extern void vscp_ps_writeStdDevType(uint8_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_STD_DEV_TYPE > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_STD_DEV_TYPE + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_STD_DEV_TYPE + index, value);
     }
 
     return;
@@ -514,7 +624,7 @@ extern void vscp_ps_writeStdDevType(uint8_t index, uint8_t value)
  */
 extern uint8_t  vscp_ps_readLogId(void)
 {
-    return vscp_ps_access_read8(VSCP_PS_ADDR_LOG_ID);
+    return vscp_ps_cache_read8(VSCP_PS_ADDR_LOG_ID);
 }
 
 /**
@@ -524,7 +634,7 @@ extern uint8_t  vscp_ps_readLogId(void)
  */
 extern void vscp_ps_writeLogId(uint8_t value)
 {
-    vscp_ps_access_write8(VSCP_PS_ADDR_LOG_ID, value);
+    vscp_ps_cache_write8(VSCP_PS_ADDR_LOG_ID, value);
     return;
 }
 
@@ -544,7 +654,7 @@ extern uint8_t  vscp_ps_readDM(uint16_t index)
 
     if (VSCP_PS_SIZE_DM > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_DM + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_DM + index);
     }
 
     return value;
@@ -560,7 +670,7 @@ extern void vscp_ps_writeDM(uint16_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_DM > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_DM + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_DM + index, value);
     }
 
     return;
@@ -580,7 +690,7 @@ extern void vscp_ps_readDMMultiple(uint16_t index, uint8_t* const buffer, uint8_
     {
         if (VSCP_PS_SIZE_DM >= (index + size))
         {
-            vscp_ps_access_readMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
+            vscp_ps_cache_readMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
         }
     }
 
@@ -601,7 +711,7 @@ extern void vscp_ps_writeDMMultiple(uint16_t index, const uint8_t* const buffer,
     {
         if (VSCP_PS_SIZE_DM >= (index + size))
         {
-            vscp_ps_access_writeMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
+            vscp_ps_cache_writeMultiple(VSCP_PS_ADDR_DM + index, buffer, size);
         }
     }
 
@@ -622,7 +732,7 @@ extern uint8_t  vscp_ps_readDMExtension(uint16_t index)
 
     if (VSCP_PS_SIZE_DM_EXTENSION > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_DM_EXTENSION + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_DM_EXTENSION + index);
     }
 
     return value;
@@ -638,7 +748,7 @@ extern void vscp_ps_writeDMExtension(uint16_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_DM_EXTENSION > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_DM_EXTENSION + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_DM_EXTENSION + index, value);
     }
 
     return;
@@ -655,7 +765,7 @@ extern void vscp_ps_readDMExtensionMultiple(uint16_t index, uint8_t* const buffe
 {
     if (VSCP_PS_SIZE_DM_EXTENSION >= (index + size))
     {
-        vscp_ps_access_readMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
+        vscp_ps_cache_readMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
     }
 
     return;
@@ -672,7 +782,7 @@ extern void vscp_ps_writeDMExtensionMultiple(uint16_t index, const uint8_t* cons
 {
     if (VSCP_PS_SIZE_DM_EXTENSION >= (index + size))
     {
-        vscp_ps_access_writeMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
+        vscp_ps_cache_writeMultiple(VSCP_PS_ADDR_DM_EXTENSION + index, buffer, size);
     }
 
     return;
@@ -696,7 +806,7 @@ extern uint8_t  vscp_ps_readDMNextGeneration(uint16_t index)
 
     if (VSCP_PS_SIZE_DM_NEXT_GENERATION > index)
     {
-        value = vscp_ps_access_read8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index);
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index);
     }
 
     return value;
@@ -712,7 +822,7 @@ extern void vscp_ps_writeDMNextGeneration(uint16_t index, uint8_t value)
 {
     if (VSCP_PS_SIZE_DM_NEXT_GENERATION > index)
     {
-        vscp_ps_access_write8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index, value);
+        vscp_ps_cache_write8(VSCP_PS_ADDR_DM_NEXT_GENERATION + index, value);
     }
 
     return;
@@ -720,6 +830,139 @@ extern void vscp_ps_writeDMNextGeneration(uint16_t index, uint8_t value)
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/**
+ * Read the bridge routing table from persistent memory.
+ *
+ * @param[in]   index   Routing table index
+ * @return  Value
+ */
+extern uint8_t  vscp_ps_readBridge(uint16_t index)
+{
+    uint8_t value   = 0;
+
+    if (VSCP_PS_SIZE_BRIDGE > index)
+    {
+        value = vscp_ps_cache_read8(VSCP_PS_ADDR_BRIDGE + index);
+    }
+
+    return value;
+}
+
+/**
+ * Write the bridge routing table to persistent memory.
+ *
+ * @param[in]   index   Routing table index
+ * @param[in]   value   Value
+ */
+extern void vscp_ps_writeBridge(uint16_t index, uint8_t value)
+{
+    if (VSCP_PS_SIZE_BRIDGE > index)
+    {
+        vscp_ps_cache_write8(VSCP_PS_ADDR_BRIDGE + index, value);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+/**
+ * Find the latest journal slot and mirror its data. The slots are written in
+ * ascending order with a ascending sequence number, therefore the latest slot
+ * is the one, which is not followed by its successor sequence number.
+ * If the journal is erased, the data is taken from its fixed location.
+ */
+static void vscp_ps_journalLoad(void)
+{
+    uint8_t slot        = 0;
+    BOOL    isFound     = FALSE;
+    uint8_t seq         = vscp_ps_access_read8(VSCP_PS_JOURNAL_SLOT_ADDR(0) + VSCP_PS_JOURNAL_OFFSET_SEQ);
+
+    if (VSCP_PS_JOURNAL_SEQ_ERASED == seq)
+    {
+        /* Erased journal: The next write uses the first slot. */
+        VSCP_PS_INST.journalNickname = vscp_ps_access_read8(VSCP_PS_ADDR_NICKNAME);
+        VSCP_PS_INST.journalCrc      = vscp_ps_access_read8(VSCP_PS_ADDR_SEGMENT_CONTROLLER_CRC);
+        VSCP_PS_INST.journalSlot     = VSCP_CONFIG_PS_JOURNAL_SLOTS - 1;
+        VSCP_PS_INST.journalSeq      = VSCP_PS_JOURNAL_SEQ_ERASED - 1;
+    }
+    else
+    {
+        while((VSCP_CONFIG_PS_JOURNAL_SLOTS > slot) && (FALSE == isFound))
+        {
+            uint8_t nextSlot    = slot + 1;
+            uint8_t nextSeq     = 0;
+
+            if (VSCP_CONFIG_PS_JOURNAL_SLOTS <= nextSlot)
+            {
+                nextSlot = 0;
+            }
+
+            nextSeq = vscp_ps_access_read8(VSCP_PS_JOURNAL_SLOT_ADDR(nextSlot) + VSCP_PS_JOURNAL_OFFSET_SEQ);
+
+            if (VSCP_PS_JOURNAL_SEQ_NEXT(seq) != nextSeq)
+            {
+                isFound = TRUE;
+            }
+            else
+            {
+                seq = nextSeq;
+                slot = nextSlot;
+            }
+        }
+
+        VSCP_PS_INST.journalSlot     = slot;
+        VSCP_PS_INST.journalSeq      = seq;
+        VSCP_PS_INST.journalNickname = vscp_ps_access_read8(VSCP_PS_JOURNAL_SLOT_ADDR(slot) + VSCP_PS_JOURNAL_OFFSET_NICKNAME);
+        VSCP_PS_INST.journalCrc      = vscp_ps_access_read8(VSCP_PS_JOURNAL_SLOT_ADDR(slot) + VSCP_PS_JOURNAL_OFFSET_CRC);
+    }
+
+    return;
+}
+
+/**
+ * Write the nickname id and the segment controller CRC to the next journal
+ * slot. The sequence number is written last, so a interrupted write keeps the
+ * previous slot as the latest one. Nothing is written, if the data is unchanged.
+ *
+ * The journal is written directly to the persistent memory, because the write
+ * order is important.
+ *
+ * @param[in]   nickname    Nickname id
+ * @param[in]   crc         Segment controller CRC
+ */
+static void vscp_ps_journalWrite(uint8_t nickname, uint8_t crc)
+{
+    if ((VSCP_PS_INST.journalNickname != nickname) ||
+        (VSCP_PS_INST.journalCrc != crc))
+    {
+        uint16_t    addr    = 0;
+
+        ++VSCP_PS_INST.journalSlot;
+        if (VSCP_CONFIG_PS_JOURNAL_SLOTS <= VSCP_PS_INST.journalSlot)
+        {
+            VSCP_PS_INST.journalSlot = 0;
+        }
+
+        VSCP_PS_INST.journalSeq      = VSCP_PS_JOURNAL_SEQ_NEXT(VSCP_PS_INST.journalSeq);
+        VSCP_PS_INST.journalNickname = nickname;
+        VSCP_PS_INST.journalCrc      = crc;
+
+        addr = VSCP_PS_JOURNAL_SLOT_ADDR(VSCP_PS_INST.journalSlot);
+        vscp_ps_access_write8(addr + VSCP_PS_JOURNAL_OFFSET_NICKNAME, nickname);
+        vscp_ps_access_write8(addr + VSCP_PS_JOURNAL_OFFSET_CRC, crc);
+        vscp_ps_access_write8(addr + VSCP_PS_JOURNAL_OFFSET_SEQ, VSCP_PS_INST.journalSeq);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL ) */
@@ -63,6 +63,15 @@ This module handles VSCP related information in persistent memory.
  * - VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_FAMILY_CODE_STORAGE_PS
  * - VSCP_DEV_DATA_CONFIG_ENABLE_STD_DEV_TYPE_STORAGE_PS
  * - VSCP_CONFIG_ENABLE_LOGGER
+ * - VSCP_CONFIG_PS_JOURNAL
+ *
+ * All accesses are done via the persistent memory write-back cache
+ * (see @ref vscp_ps_cache). Call vscp_ps_flush() before the node is reset.
+ *
+ * If the journal is enabled, the nickname id and the segment controller CRC
+ * are not stored at their fixed location anymore. They are written to the
+ * next slot of a ring of journal slots instead, to spread the EEPROM wear.
+ * The fixed location is only read once, as long as the journal is erased.
  *
  *
  * Attention, the persistent memory contains all data in LSB first!
@@ -86,6 +95,7 @@ This module handles VSCP related information in persistent memory.
  * |    15 | VSCP_CONFIG_DM_ROWS * VSCP_DM_ROW_SIZE | VSCP_CONFIG_ENABLE_DM                                          | Standard decision matrix |
  * |    16 | VSCP_CONFIG_DM_ROWS * VSCP_DM_ROW_SIZE | VSCP_CONFIG_ENABLE_DM_EXTENSION                                | Extended decision matrix |
  * |    17 | VSCP_CONFIG_DM_NG_RULE_SET_SIZE        | VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION                          | Decision matrix next generation |
+ * |    18 | VSCP_CONFIG_PS_JOURNAL_SLOTS * 3       | VSCP_CONFIG_PS_JOURNAL                                         | Journal (nickname id, segment controller CRC, sequence number) |
  * @{
  */
 
@@ -105,6 +115,7 @@ This module handles VSCP related information in persistent memory.
 #include "vscp_config.h"
 #include "vscp_dev_data_config.h"
 #include "vscp_dm.h"
+#include "vscp_bridge.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -363,13 +374,54 @@ extern "C"
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+/* ------------------------------------------------------------------ */
+/* -------- VSCP journal of frequently changed data (optional) ------- */
+/* ------------------------------------------------------------------ */
+
+/** Size of a single journal slot in byte */
+#define VSCP_PS_JOURNAL_SLOT_SIZE           3
+
+/** Address of the journal */
+#define VSCP_PS_ADDR_JOURNAL                (VSCP_PS_ADDR_DM_NEXT_GENERATION + VSCP_PS_SIZE_DM_NEXT_GENERATION)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_JOURNAL )
+
+/** Size of the journal in byte */
+#define VSCP_PS_SIZE_JOURNAL                (VSCP_CONFIG_PS_JOURNAL_SLOTS * VSCP_PS_JOURNAL_SLOT_SIZE)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
+/** Journal is not available */
+#define VSCP_PS_SIZE_JOURNAL                0
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_JOURNAL ) */
+
+/* ------------------------------------------ */
+/* -------- VSCP bridge routing table ------- */
+/* ------------------------------------------ */
+
+/** Address of the bridge routing table */
+#define VSCP_PS_ADDR_BRIDGE                 (VSCP_PS_ADDR_JOURNAL + VSCP_PS_SIZE_JOURNAL)
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/** Size of the bridge routing table in byte */
+#define VSCP_PS_SIZE_BRIDGE                 (VSCP_CONFIG_BRIDGE_ROUTES * VSCP_BRIDGE_ROUTE_SIZE)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+
+/** Bridge routing table is not available */
+#define VSCP_PS_SIZE_BRIDGE                 0
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+
 /* -------- */
 
 /** Next available address after all VSCP related data.
  * Use this define if you want right after VSCP your application specific data
  * in the persistent memory.
  */
-#define VSCP_PS_ADDR_NEXT                   (VSCP_PS_ADDR_DM_NEXT_GENERATION + VSCP_PS_SIZE_DM_NEXT_GENERATION)
+#define VSCP_PS_ADDR_NEXT                   (VSCP_PS_ADDR_BRIDGE + VSCP_PS_SIZE_BRIDGE)
 
 /*******************************************************************************
     MACROS
@@ -394,6 +446,20 @@ extern "C"
  */
 extern void vscp_ps_init(void);
 
+/**
+ * This function processes the persistent memory cache. It shall be called
+ * periodically.
+ *
+ * @param[in]   isIdle  Node is idle (TRUE) or busy (FALSE)
+ */
+extern void vscp_ps_process(BOOL isIdle);
+
+/**
+ * This function writes all cached data back to the persistent memory.
+ * Call it e.g. before a reset or if a power loss is detected.
+ */
+extern void vscp_ps_flush(void);
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BOOT_LOADER_SUPPORTED )
 
 /**
@@ -757,6 +823,26 @@ extern void vscp_ps_writeDMNextGeneration(uint16_t index, uint8_t value);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/**
+ * Read the bridge routing table from persistent memory.
+ *
+ * @param[in]   index   Routing table index
+ * @return  Value
+ */
+extern uint8_t  vscp_ps_readBridge(uint16_t index);
+
+/**
+ * Write the bridge routing table to persistent memory.
+ *
+ * @param[in]   index   Routing table index
+ * @param[in]   value   Value
+ */
+extern void vscp_ps_writeBridge(uint16_t index, uint8_t value);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
 #ifdef __cplusplus
 }
 #endif
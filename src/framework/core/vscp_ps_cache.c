@@ -0,0 +1,544 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP persistent memory write-back cache
+@file   vscp_ps_cache.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_ps_cache.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_ps_cache.h"
+#include "vscp_instance.h"
+#include "vscp_util.h"
+#include "../user/vscp_ps_access.h"
+#include "../user/vscp_timer.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+/** Cache line size in byte. It is equal to a decision matrix row, because
+ * decision matrix uploads are the most common bulk writes.
+ */
+#define VSCP_PS_CACHE_LINE_SIZE     8
+
+/** Address of a unused cache line */
+#define VSCP_PS_CACHE_ADDR_INVALID  0xFFFF
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+/** Get the address of the cache line, which contains the given address. */
+#define VSCP_PS_CACHE_LINE_ADDR(__addr)     ((uint16_t)((__addr) & ~((uint16_t)(VSCP_PS_CACHE_LINE_SIZE - 1))))
+
+/** Get the offset in the cache line of the given address. */
+#define VSCP_PS_CACHE_LINE_OFFSET(__addr)   ((uint8_t)((__addr) & (VSCP_PS_CACHE_LINE_SIZE - 1)))
+
+/** Data of the selected framework instance */
+#define VSCP_PS_CACHE_INST      (vscp_ps_cache_instances[VSCP_INSTANCE])
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+/** This type defines a single cache line. */
+typedef struct
+{
+    uint16_t    addr;                           /**< Address of the first byte or VSCP_PS_CACHE_ADDR_INVALID */
+    uint8_t     dirty;                          /**< Not written back bytes, one bit per byte */
+    uint8_t     data[VSCP_PS_CACHE_LINE_SIZE];  /**< Data */
+
+} vscp_ps_cache_Line;
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Cache lines */
+    vscp_ps_cache_Line  lines[VSCP_CONFIG_PS_CACHE_LINES];
+
+    /** Index of the next cache line, which is replaced if all are in use. */
+    uint8_t             victim;
+
+    /** Timer id of the flush timeout */
+    uint8_t             timerId;
+
+} vscp_ps_cache_Instance;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+static vscp_ps_cache_Line* vscp_ps_cache_findLine(uint16_t addr);
+static vscp_ps_cache_Line* vscp_ps_cache_allocLine(uint16_t addr);
+static BOOL vscp_ps_cache_writeBack(vscp_ps_cache_Line * const line, BOOL all);
+static BOOL vscp_ps_cache_isDirty(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+/** Data of all framework instances */
+static vscp_ps_cache_Instance  vscp_ps_cache_instances[VSCP_INSTANCE_NUM];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the persistent memory cache and the persistent
+ * memory access driver. Data, which was not written back yet, is written back
+ * and all cache lines are empty afterwards.
+ */
+extern void vscp_ps_cache_init(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+    uint8_t index   = 0;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    /* Initialize persistent memory access driver */
+    vscp_ps_access_init();
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    for(index = 0; index < VSCP_CONFIG_PS_CACHE_LINES; ++index)
+    {
+        /* Don't loose data, in case of a re-initialization. */
+        (void)vscp_ps_cache_writeBack(&VSCP_PS_CACHE_INST.lines[index], TRUE);
+
+        VSCP_PS_CACHE_INST.lines[index].addr  = VSCP_PS_CACHE_ADDR_INVALID;
+        VSCP_PS_CACHE_INST.lines[index].dirty = 0;
+    }
+
+    VSCP_PS_CACHE_INST.victim  = 0;
+    VSCP_PS_CACHE_INST.timerId = vscp_timer_create();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return;
+}
+
+/**
+ * Read a single byte from the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @return  Value
+ */
+extern uint8_t  vscp_ps_cache_read8(uint16_t addr)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    uint8_t             value   = 0;
+    vscp_ps_cache_Line* line    = vscp_ps_cache_findLine(addr);
+
+    if (NULL != line)
+    {
+        value = line->data[VSCP_PS_CACHE_LINE_OFFSET(addr)];
+    }
+    else
+    {
+        value = vscp_ps_access_read8(addr);
+    }
+
+    return value;
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return vscp_ps_access_read8(addr);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+}
+
+/**
+ * Write a single byte to the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   value   Value to write
+ */
+extern void vscp_ps_cache_write8(uint16_t addr, uint8_t value)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    vscp_ps_cache_Line* line    = vscp_ps_cache_findLine(addr);
+
+    /* Not cached yet? */
+    if (NULL == line)
+    {
+        /* Nothing to do, if the value is already stored. */
+        if (value != vscp_ps_access_read8(addr))
+        {
+            line = vscp_ps_cache_allocLine(addr);
+        }
+    }
+
+    if (NULL != line)
+    {
+        uint8_t offset  = VSCP_PS_CACHE_LINE_OFFSET(addr);
+
+        if (value != line->data[offset])
+        {
+            /* Start the flush timeout with the first not written back byte. */
+            if (FALSE == vscp_ps_cache_isDirty())
+            {
+                vscp_timer_start(VSCP_PS_CACHE_INST.timerId, VSCP_CONFIG_PS_CACHE_FLUSH_TIMEOUT);
+            }
+
+            line->data[offset]  = value;
+            line->dirty        |= (uint8_t)(1 << offset);
+        }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    vscp_ps_access_write8(addr, value);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return;
+}
+
+/**
+ * Read several bytes from the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   buffer  Buffer which to read in
+ * @param[in]   size    Buffer size in byte (Number of data to read)
+ */
+extern void vscp_ps_cache_readMultiple(uint16_t addr, uint8_t* const buffer, uint8_t size)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    if ((NULL != buffer) &&
+        (0 < size))
+    {
+        uint8_t index   = 0;
+
+        /* Read all at once and overwrite the cached bytes afterwards. */
+        vscp_ps_access_readMultiple(addr, buffer, size);
+
+        for(index = 0; index < VSCP_CONFIG_PS_CACHE_LINES; ++index)
+        {
+            vscp_ps_cache_Line* line    = &VSCP_PS_CACHE_INST.lines[index];
+
+            if ((VSCP_PS_CACHE_ADDR_INVALID != line->addr) &&
+                (line->addr < (addr + size)) &&
+                ((line->addr + VSCP_PS_CACHE_LINE_SIZE) > addr))
+            {
+                uint8_t offset  = 0;
+
+                for(offset = 0; offset < VSCP_PS_CACHE_LINE_SIZE; ++offset)
+                {
+                    uint16_t    lineAddr    = line->addr + offset;
+
+                    if ((addr <= lineAddr) &&
+                        ((addr + size) > lineAddr))
+                    {
+                        buffer[lineAddr - addr] = line->data[offset];
+                    }
+                }
+            }
+        }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    vscp_ps_access_readMultiple(addr, buffer, size);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return;
+}
+
+/**
+ * Write several bytes to the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   buffer  Buffer which to write
+ * @param[in]   size    Buffer size in byte (Number of data to write)
+ */
+extern void vscp_ps_cache_writeMultiple(uint16_t addr, const uint8_t* const buffer, uint8_t size)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    if ((NULL != buffer) &&
+        (0 < size))
+    {
+        uint8_t index   = 0;
+
+        for(index = 0; index < size; ++index)
+        {
+            vscp_ps_cache_write8(addr + index, buffer[index]);
+        }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    vscp_ps_access_writeMultiple(addr, buffer, size);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return;
+}
+
+/**
+ * Process the cache and write back cached data. If the node is idle, a single
+ * byte is written back. If the flush timeout is reached, all data is written
+ * back.
+ *
+ * @param[in]   isIdle  Node is idle (TRUE) or busy (FALSE)
+ */
+extern void vscp_ps_cache_process(BOOL isIdle)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    if (TRUE == vscp_ps_cache_isDirty())
+    {
+        /* Flush timeout reached? */
+        if (FALSE == vscp_timer_getStatus(VSCP_PS_CACHE_INST.timerId))
+        {
+            vscp_ps_cache_flush();
+        }
+        /* Write back a single byte in idle time. */
+        else if (TRUE == isIdle)
+        {
+            uint8_t index       = 0;
+            BOOL    isWritten   = FALSE;
+
+            while((VSCP_CONFIG_PS_CACHE_LINES > index) && (FALSE == isWritten))
+            {
+                isWritten = vscp_ps_cache_writeBack(&VSCP_PS_CACHE_INST.lines[index], FALSE);
+                ++index;
+            }
+
+            if (FALSE == vscp_ps_cache_isDirty())
+            {
+                vscp_timer_stop(VSCP_PS_CACHE_INST.timerId);
+            }
+        }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    VSCP_UTIL_UNUSED(isIdle);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return;
+}
+
+/**
+ * Write back all cached data to the persistent memory.
+ */
+extern void vscp_ps_cache_flush(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_PS_CACHE_LINES; ++index)
+    {
+        (void)vscp_ps_cache_writeBack(&VSCP_PS_CACHE_INST.lines[index], TRUE);
+    }
+
+    vscp_timer_stop(VSCP_PS_CACHE_INST.timerId);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+/**
+ * Find the cache line, which contains the given address.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @return Cache line or NULL, if the address is not cached.
+ */
+static vscp_ps_cache_Line* vscp_ps_cache_findLine(uint16_t addr)
+{
+    uint16_t            lineAddr    = VSCP_PS_CACHE_LINE_ADDR(addr);
+    uint8_t             index       = 0;
+    vscp_ps_cache_Line* line        = NULL;
+
+    while((VSCP_CONFIG_PS_CACHE_LINES > index) && (NULL == line))
+    {
+        if (lineAddr == VSCP_PS_CACHE_INST.lines[index].addr)
+        {
+            line = &VSCP_PS_CACHE_INST.lines[index];
+        }
+
+        ++index;
+    }
+
+    return line;
+}
+
+/**
+ * Allocate a cache line for the given address and load its data from the
+ * persistent memory. A unused or clean cache line is preferred, otherwise
+ * the next cache line in round-robin order is written back and replaced.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @return Cache line
+ */
+static vscp_ps_cache_Line* vscp_ps_cache_allocLine(uint16_t addr)
+{
+    uint8_t             index   = 0;
+    vscp_ps_cache_Line* line    = NULL;
+
+    while((VSCP_CONFIG_PS_CACHE_LINES > index) && (NULL == line))
+    {
+        if (0 == VSCP_PS_CACHE_INST.lines[index].dirty)
+        {
+            line = &VSCP_PS_CACHE_INST.lines[index];
+        }
+
+        ++index;
+    }
+
+    if (NULL == line)
+    {
+        line = &VSCP_PS_CACHE_INST.lines[VSCP_PS_CACHE_INST.victim];
+        (void)vscp_ps_cache_writeBack(line, TRUE);
+
+        ++VSCP_PS_CACHE_INST.victim;
+        if (VSCP_CONFIG_PS_CACHE_LINES <= VSCP_PS_CACHE_INST.victim)
+        {
+            VSCP_PS_CACHE_INST.victim = 0;
+        }
+    }
+
+    line->addr  = VSCP_PS_CACHE_LINE_ADDR(addr);
+    line->dirty = 0;
+    vscp_ps_access_readMultiple(line->addr, line->data, VSCP_PS_CACHE_LINE_SIZE);
+
+    return line;
+}
+
+/**
+ * Write back the dirty bytes of a cache line. Bytes, which are equal to the
+ * persistent memory, are not written.
+ *
+ * @param[in]   line    Cache line
+ * @param[in]   all     Write back all dirty bytes (TRUE) or stop after the first written byte (FALSE).
+ * @return If at least one byte was written, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_ps_cache_writeBack(vscp_ps_cache_Line * const line, BOOL all)
+{
+    uint8_t offset      = 0;
+    BOOL    isWritten   = FALSE;
+
+    while((0 != line->dirty) &&
+          ((TRUE == all) || (FALSE == isWritten)))
+    {
+        uint8_t mask    = (uint8_t)(1 << offset);
+
+        if (0 != (line->dirty & mask))
+        {
+            uint16_t    addr    = line->addr + offset;
+
+            if (line->data[offset] != vscp_ps_access_read8(addr))
+            {
+                vscp_ps_access_write8(addr, line->data[offset]);
+                isWritten = TRUE;
+            }
+
+            line->dirty &= (uint8_t)~mask;
+        }
+
+        ++offset;
+    }
+
+    return isWritten;
+}
+
+/**
+ * Check whether any cached byte is not written back yet.
+ *
+ * @return If cached data is not written back, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_ps_cache_isDirty(void)
+{
+    uint8_t index   = 0;
+    BOOL    isDirty = FALSE;
+
+    while((VSCP_CONFIG_PS_CACHE_LINES > index) && (FALSE == isDirty))
+    {
+        if (0 != VSCP_PS_CACHE_INST.lines[index].dirty)
+        {
+            isDirty = TRUE;
+        }
+
+        ++index;
+    }
+
+    return isDirty;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE ) */
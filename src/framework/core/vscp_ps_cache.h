@@ -0,0 +1,166 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP persistent memory write-back cache
+@file   vscp_ps_cache.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module provides a RAM write-back cache between the persistent memory
+driver and the persistent memory access driver.
+
+*******************************************************************************/
+/** @defgroup vscp_ps_cache Persistent memory write-back cache
+ * Writing a byte to a EEPROM takes several ms (e.g. 3.3 ms on a AVR) and the
+ * number of write cycles of a EEPROM cell is limited. Therefore all writes are
+ * collected in a few cache lines in RAM and written back later:
+ * - If the node is idle, one byte per process cycle.
+ * - If the oldest not written data reaches the flush timeout, all at once.
+ * - If explicit requested with vscp_ps_cache_flush(), e.g. before a reset.
+ * - If a cache line is required for another address.
+ *
+ * A byte is only written, if its value in the persistent memory differs.
+ *
+ * Attention, data which is not written back yet, is lost at power loss!
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_PS_CACHE
+ * - VSCP_CONFIG_PS_CACHE_LINES
+ * - VSCP_CONFIG_PS_CACHE_FLUSH_TIMEOUT
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_PS_CACHE_H__
+#define __VSCP_PS_CACHE_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+#include "vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the persistent memory cache and the persistent
+ * memory access driver. Data, which was not written back yet, is written back
+ * and all cache lines are empty afterwards.
+ */
+extern void vscp_ps_cache_init(void);
+
+/**
+ * Read a single byte from the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @return  Value
+ */
+extern uint8_t  vscp_ps_cache_read8(uint16_t addr);
+
+/**
+ * Write a single byte to the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   value   Value to write
+ */
+extern void vscp_ps_cache_write8(uint16_t addr, uint8_t value);
+
+/**
+ * Read several bytes from the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   buffer  Buffer which to read in
+ * @param[in]   size    Buffer size in byte (Number of data to read)
+ */
+extern void vscp_ps_cache_readMultiple(uint16_t addr, uint8_t* const buffer, uint8_t size);
+
+/**
+ * Write several bytes to the persistent memory.
+ *
+ * @param[in]   addr    Address in persistent memory
+ * @param[in]   buffer  Buffer which to write
+ * @param[in]   size    Buffer size in byte (Number of data to write)
+ */
+extern void vscp_ps_cache_writeMultiple(uint16_t addr, const uint8_t* const buffer, uint8_t size);
+
+/**
+ * Process the cache and write back cached data. If the node is idle, a single
+ * byte is written back. If the flush timeout is reached, all data is written
+ * back.
+ *
+ * @param[in]   isIdle  Node is idle (TRUE) or busy (FALSE)
+ */
+extern void vscp_ps_cache_process(BOOL isIdle);
+
+/**
+ * Write back all cached data to the persistent memory.
+ */
+extern void vscp_ps_cache_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_PS_CACHE_H__ */
+
+/** @} */
@@ -0,0 +1,341 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP register map
+@file   vscp_reg_map.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_reg_map.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_reg_map.h"
+#include <string.h>
+#include "vscp_ps_cache.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Get the linear address of a register. */
+#define VSCP_REG_MAP_LINEAR(__page, __addr)    ((((uint32_t)(__page)) << 8) | (uint32_t)(__addr))
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static uint8_t vscp_reg_map_find(vscp_reg_map_Map const * const map, uint16_t page, uint8_t addr, uint8_t count, vscp_reg_map_Range * const range, uint16_t * const offset);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function reads several registers on the same page.
+ *
+ * @param[in]   map     Register map
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Register values
+ * @param[in]   count   Number of registers, limited to the page end
+ */
+extern void vscp_reg_map_readRange(vscp_reg_map_Map const * const map, uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t count)
+{
+    uint8_t index   = 0;
+
+    if ((NULL == map) ||
+        (NULL == buffer))
+    {
+        return;
+    }
+
+    /* Limit to the page end */
+    if ((0xFF - addr) < (count - 1))
+    {
+        count = (0xFF - addr) + 1;
+    }
+
+    while(count > index)
+    {
+        vscp_reg_map_Range  range;
+        uint16_t            offset  = 0;
+        uint8_t             num     = vscp_reg_map_find(map, page, addr + index, count - index, &range, &offset);
+        uint8_t * const     data    = &buffer[index];
+
+        if (0 == (VSCP_REG_MAP_ACCESS_R & range.access))
+        {
+            memset(data, 0, num);
+        }
+        else if (VSCP_REG_MAP_KIND_RAM == range.kind)
+        {
+            memcpy(data, &range.getRam()[offset], num);
+        }
+        else if (VSCP_REG_MAP_KIND_PS == range.kind)
+        {
+            vscp_ps_cache_readMultiple(range.psAddr + offset, data, num);
+        }
+        else if (VSCP_REG_MAP_KIND_ROM == range.kind)
+        {
+            memcpy_P(data, &range.getRom()[offset], num);
+        }
+        else
+        {
+            uint8_t pos = 0;
+
+            for(pos = 0; pos < num; ++pos)
+            {
+                data[pos] = (NULL != range.read) ? range.read(page, addr + index + pos) : 0;
+            }
+        }
+
+        index += num;
+    }
+
+    return;
+}
+
+/**
+ * This function writes several registers on the same page. The buffer
+ * contains the register values after the write. A register, which can't be
+ * written, is 0.
+ *
+ * @param[in]       map     Register map
+ * @param[in]       page    Page
+ * @param[in]       addr    Address of the first register
+ * @param[in,out]   buffer  Values to write, register values after the write
+ * @param[in]       count   Number of registers, limited to the page end
+ * @return  Successful written or not
+ * @retval  FALSE   At least one register can't be written
+ * @retval  TRUE    All registers were written
+ */
+extern BOOL vscp_reg_map_writeRange(vscp_reg_map_Map const * const map, uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t count)
+{
+    BOOL    status  = TRUE;
+    uint8_t index   = 0;
+
+    if ((NULL == map) ||
+        (NULL == buffer))
+    {
+        return FALSE;
+    }
+
+    /* Limit to the page end */
+    if ((0xFF - addr) < (count - 1))
+    {
+        count = (0xFF - addr) + 1;
+    }
+
+    while(count > index)
+    {
+        vscp_reg_map_Range  range;
+        uint16_t            offset      = 0;
+        uint8_t             num         = vscp_reg_map_find(map, page, addr + index, count - index, &range, &offset);
+        uint8_t * const     data        = &buffer[index];
+        BOOL                isWriteable = FALSE;
+
+        if (0 != (VSCP_REG_MAP_ACCESS_W & range.access))
+        {
+            if (0 == (VSCP_REG_MAP_ACCESS_PROTECTED & range.access))
+            {
+                isWriteable = TRUE;
+            }
+            else if (NULL != map->isWriteable)
+            {
+                isWriteable = map->isWriteable();
+            }
+        }
+
+        if (FALSE == isWriteable)
+        {
+            memset(data, 0, num);
+            status = FALSE;
+        }
+        else
+        {
+            if (VSCP_REG_MAP_KIND_RAM == range.kind)
+            {
+                memcpy(&range.getRam()[offset], data, num);
+            }
+            else if (VSCP_REG_MAP_KIND_PS == range.kind)
+            {
+                vscp_ps_cache_writeMultiple(range.psAddr + offset, data, num);
+
+                /* Read values back */
+                vscp_ps_cache_readMultiple(range.psAddr + offset, data, num);
+            }
+            else
+            {
+                uint8_t pos = 0;
+
+                for(pos = 0; pos < num; ++pos)
+                {
+                    data[pos] = (NULL != range.write) ? range.write(page, addr + index + pos, data[pos]) : 0;
+                }
+            }
+
+            if (NULL != range.changed)
+            {
+                range.changed(page, addr + index, num);
+            }
+        }
+
+        index += num;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function looks up the range of a register and returns the number of
+ * the following registers, which belong to the same range. A VSCP specific
+ * register, which is not used, is returned as range without access rights.
+ *
+ * @param[in]   map     Register map
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   count   Max. number of registers
+ * @param[out]  range   Range of the register
+ * @param[out]  offset  Register offset in the range
+ * @return Number of registers, which belong to the range
+ */
+static uint8_t vscp_reg_map_find(vscp_reg_map_Map const * const map, uint16_t page, uint8_t addr, uint8_t count, vscp_reg_map_Range * const range, uint16_t * const offset)
+{
+    uint32_t    linear  = VSCP_REG_MAP_LINEAR(page, addr);
+    uint32_t    end     = linear + count;
+    uint32_t    begin   = 0;
+    uint8_t     index   = 0;
+
+    *offset = 0;
+
+    /* VSCP specific register? */
+    if ((0 == page) &&
+        (VSCP_REGISTER_VSCP_START_ADDR <= addr))
+    {
+        index = pgm_read_byte(&map->stdIndex[addr - VSCP_REGISTER_VSCP_START_ADDR]);
+
+        /* Not used */
+        if (0 == index)
+        {
+            uint8_t num = 1;
+
+            memset(range, 0, sizeof(vscp_reg_map_Range));
+            range->kind = VSCP_REG_MAP_KIND_FUNC;
+
+            /* All following registers, which are not used too. */
+            while((count > num) &&
+                  (0 == pgm_read_byte(&map->stdIndex[addr + num - VSCP_REGISTER_VSCP_START_ADDR])))
+            {
+                ++num;
+            }
+
+            return num;
+        }
+
+        memcpy_P(range, &map->ranges[index - 1], sizeof(vscp_reg_map_Range));
+    }
+    else
+    {
+        /* The VSCP specific registers have priority over all other ranges. */
+        if ((0 == page) &&
+            (VSCP_REGISTER_VSCP_START_ADDR < end))
+        {
+            end = VSCP_REGISTER_VSCP_START_ADDR;
+        }
+
+        for(index = map->featureBegin; index < map->featureEnd; ++index)
+        {
+            memcpy_P(range, &map->ranges[index], sizeof(vscp_reg_map_Range));
+
+            begin = VSCP_REG_MAP_LINEAR(range->page, range->addr);
+
+            /* Register is part of the range? */
+            if ((begin <= linear) &&
+                ((begin + range->size) > linear))
+            {
+                break;
+            }
+
+            /* The range begins behind the register, therefore the default
+             * range ends there.
+             */
+            if ((linear < begin) &&
+                (end > begin))
+            {
+                end = begin;
+            }
+        }
+
+        /* Default range */
+        if (map->featureEnd <= index)
+        {
+            memcpy_P(range, map->defaultRange, sizeof(vscp_reg_map_Range));
+
+            return (uint8_t)(end - linear);
+        }
+    }
+
+    begin   = VSCP_REG_MAP_LINEAR(range->page, range->addr);
+    *offset = (uint16_t)(linear - begin);
+
+    if ((begin + range->size) < end)
+    {
+        end = begin + range->size;
+    }
+
+    return (uint8_t)(end - linear);
+}
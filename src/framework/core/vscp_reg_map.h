@@ -0,0 +1,297 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP register map
+@file   vscp_reg_map.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module dispatches register accesses with a register descriptor table.
+
+*******************************************************************************/
+/** @defgroup vscp_reg_map VSCP register map
+ * The register space is described by a table of register ranges, which is
+ * placed in the program memory. Every range carries its storage kind, its
+ * access rights and a change hook:
+ * - RAM: The registers are a byte array in RAM.
+ * - PS: The registers are located in the persistent memory.
+ * - FUNC: The registers are read and written with callbacks.
+ * - ROM: The registers are a constant byte array in program memory.
+ *
+ * The VSCP specific registers on page 0 (0x80 - 0xFF) are dispatched with an
+ * index, which contains the range of every register, in constant time. All
+ * other registers are looked up linearly in the feature ranges, e.g. the
+ * decision matrix. A register, which is not part of any feature range,
+ * belongs to the default range, e.g. the application registers. The lookup
+ * time depends therefore on the number of feature ranges, which is small.
+ *
+ * The range functions read or write several registers on the same page. A
+ * range is looked up only once for all of its registers and RAM/PS/ROM
+ * ranges are copied as a whole.
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_REG_MAP_H__
+#define __VSCP_REG_MAP_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Storage kind: Byte array in RAM */
+#define VSCP_REG_MAP_KIND_RAM           (0)
+
+/** Storage kind: Persistent memory */
+#define VSCP_REG_MAP_KIND_PS            (1)
+
+/** Storage kind: Read and write callbacks */
+#define VSCP_REG_MAP_KIND_FUNC          (2)
+
+/** Storage kind: Constant byte array in program memory */
+#define VSCP_REG_MAP_KIND_ROM           (3)
+
+/** Access right: Read */
+#define VSCP_REG_MAP_ACCESS_R           (0x01)
+
+/** Access right: Write */
+#define VSCP_REG_MAP_ACCESS_W           (0x02)
+
+/** Access right: Read and write */
+#define VSCP_REG_MAP_ACCESS_RW          (VSCP_REG_MAP_ACCESS_R | VSCP_REG_MAP_ACCESS_W)
+
+/** Access right: Write only, if the register write protection is disabled */
+#define VSCP_REG_MAP_ACCESS_PROTECTED   (0x04)
+
+/** Number of VSCP specific registers on page 0 */
+#define VSCP_REG_MAP_STD_NUM            (0x100 - VSCP_REGISTER_VSCP_START_ADDR)
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/**
+ * Initializer of a RAM range.
+ *
+ * @param[in]   __page      Page of the first register
+ * @param[in]   __addr      Address of the first register
+ * @param[in]   __size      Number of registers
+ * @param[in]   __access    Access rights
+ * @param[in]   __getRam    Function, which returns the storage
+ * @param[in]   __changed   Change hook or NULL
+ */
+#define VSCP_REG_MAP_RAM(__page, __addr, __size, __access, __getRam, __changed) \
+    { (__page), (__addr), (__size), VSCP_REG_MAP_KIND_RAM, (__access), 0, (__getRam), NULL, NULL, NULL, (__changed) }
+
+/**
+ * Initializer of a persistent memory range.
+ *
+ * @param[in]   __page      Page of the first register
+ * @param[in]   __addr      Address of the first register
+ * @param[in]   __size      Number of registers
+ * @param[in]   __access    Access rights
+ * @param[in]   __psAddr    Persistent memory address of the first register
+ * @param[in]   __changed   Change hook or NULL
+ */
+#define VSCP_REG_MAP_PS(__page, __addr, __size, __access, __psAddr, __changed) \
+    { (__page), (__addr), (__size), VSCP_REG_MAP_KIND_PS, (__access), (__psAddr), NULL, NULL, NULL, NULL, (__changed) }
+
+/**
+ * Initializer of a callback range.
+ *
+ * @param[in]   __page      Page of the first register
+ * @param[in]   __addr      Address of the first register
+ * @param[in]   __size      Number of registers
+ * @param[in]   __access    Access rights
+ * @param[in]   __read      Read callback or NULL
+ * @param[in]   __write     Write callback or NULL
+ * @param[in]   __changed   Change hook or NULL
+ */
+#define VSCP_REG_MAP_FUNC(__page, __addr, __size, __access, __read, __write, __changed) \
+    { (__page), (__addr), (__size), VSCP_REG_MAP_KIND_FUNC, (__access), 0, NULL, NULL, (__read), (__write), (__changed) }
+
+/**
+ * Initializer of a read only range in program memory.
+ *
+ * @param[in]   __page      Page of the first register
+ * @param[in]   __addr      Address of the first register
+ * @param[in]   __size      Number of registers
+ * @param[in]   __getRom    Function, which returns the storage
+ */
+#define VSCP_REG_MAP_ROM(__page, __addr, __size, __getRom) \
+    { (__page), (__addr), (__size), VSCP_REG_MAP_KIND_ROM, VSCP_REG_MAP_ACCESS_R, 0, NULL, (__getRom), NULL, NULL, NULL }
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/**
+ * This type defines a function, which returns the RAM storage of a range.
+ *
+ * @return Storage of the first register
+ */
+typedef uint8_t* (*vscp_reg_map_GetRam)(void);
+
+/**
+ * This type defines a function, which returns the program memory storage of
+ * a range.
+ *
+ * @return Storage of the first register
+ */
+typedef uint8_t const * (*vscp_reg_map_GetRom)(void);
+
+/**
+ * This type defines a callback, which reads a register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @return Register value
+ */
+typedef uint8_t (*vscp_reg_map_Read)(uint16_t page, uint8_t addr);
+
+/**
+ * This type defines a callback, which writes a register.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Register address
+ * @param[in]   value   Value to write
+ * @return Register value
+ */
+typedef uint8_t (*vscp_reg_map_Write)(uint16_t page, uint8_t addr, uint8_t value);
+
+/**
+ * This type defines a change hook, which is called after registers of a range
+ * were written.
+ *
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first written register
+ * @param[in]   count   Number of written registers
+ */
+typedef void (*vscp_reg_map_Changed)(uint16_t page, uint8_t addr, uint8_t count);
+
+/**
+ * This type defines a function, which returns whether the protected
+ * registers are writeable.
+ *
+ * @return Writeable or not
+ */
+typedef BOOL (*vscp_reg_map_IsWriteable)(void);
+
+/** A range of registers. It may span several pages. */
+typedef struct
+{
+    uint16_t                page;       /**< Page of the first register */
+    uint8_t                 addr;       /**< Address of the first register */
+    uint16_t                size;       /**< Number of registers */
+    uint8_t                 kind;       /**< Storage kind */
+    uint8_t                 access;     /**< Access rights */
+    uint16_t                psAddr;     /**< PS: Persistent memory address of the first register */
+    vscp_reg_map_GetRam     getRam;     /**< RAM: Function, which returns the storage */
+    vscp_reg_map_GetRom     getRom;     /**< ROM: Function, which returns the storage */
+    vscp_reg_map_Read       read;       /**< FUNC: Read callback */
+    vscp_reg_map_Write      write;      /**< FUNC: Write callback */
+    vscp_reg_map_Changed    changed;    /**< Change hook or NULL */
+
+} vscp_reg_map_Range;
+
+/** A register map. The ranges and the index are located in program memory. */
+typedef struct
+{
+    vscp_reg_map_Range const *  ranges;         /**< Ranges */
+    uint8_t const *             stdIndex;       /**< Range of every VSCP specific register (range index + 1) or 0 if not used */
+    uint8_t                     featureBegin;   /**< Index of the first feature range */
+    uint8_t                     featureEnd;     /**< Index behind the last feature range */
+    vscp_reg_map_Range const *  defaultRange;   /**< Callback range of all other registers, page and size are not used */
+    vscp_reg_map_IsWriteable    isWriteable;    /**< Returns whether the protected registers are writeable */
+
+} vscp_reg_map_Map;
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function reads several registers on the same page.
+ *
+ * @param[in]   map     Register map
+ * @param[in]   page    Page
+ * @param[in]   addr    Address of the first register
+ * @param[out]  buffer  Register values
+ * @param[in]   count   Number of registers, limited to the page end
+ */
+extern void vscp_reg_map_readRange(vscp_reg_map_Map const * const map, uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t count);
+
+/**
+ * This function writes several registers on the same page. The buffer
+ * contains the register values after the write. A register, which can't be
+ * written, is 0.
+ *
+ * @param[in]       map     Register map
+ * @param[in]       page    Page
+ * @param[in]       addr    Address of the first register
+ * @param[in,out]   buffer  Values to write, register values after the write
+ * @param[in]       count   Number of registers, limited to the page end
+ * @return  Successful written or not
+ * @retval  FALSE   At least one register can't be written
+ * @retval  TRUE    All registers were written
+ */
+extern BOOL vscp_reg_map_writeRange(vscp_reg_map_Map const * const map, uint16_t page, uint8_t addr, uint8_t * const buffer, uint8_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_REG_MAP_H__ */
+
+/** @} */
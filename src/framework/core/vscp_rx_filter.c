@@ -0,0 +1,394 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP receive acceptance filter
+@file   vscp_rx_filter.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_rx_filter.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_rx_filter.h"
+#include "vscp_instance.h"
+#include "vscp_class_l1.h"
+#include "vscp_dm.h"
+#include "vscp_dm_ng.h"
+#include "vscp_util.h"
+#include "../user/vscp_tp_adapter.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/* At least one acceptance filter is necessary, which lets pass all events. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_RX_FILTER_NUM);
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Data of the selected framework instance */
+#define VSCP_RX_FILTER_INST     (vscp_rx_filter_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Acceptance filters are valid or must be recalculated. */
+    BOOL                    isValid;
+
+    /** Calculated acceptance filters. One more, than the transport supports, to merge them. */
+    vscp_AcceptanceFilter   list[VSCP_CONFIG_RX_FILTER_NUM + 1];
+
+    /** Number of calculated acceptance filters */
+    uint8_t                 listCnt;
+
+    /** Acceptance filters of the application interest */
+    vscp_AcceptanceFilter   app[VSCP_CONFIG_RX_FILTER_APP_NUM];
+
+    /** Number of acceptance filters of the application interest */
+    uint8_t                 appCnt;
+
+} vscp_rx_filter_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static void vscp_rx_filter_calculate(void);
+static void vscp_rx_filter_add(uint32_t mask, uint32_t filter);
+static void vscp_rx_filter_reduce(void);
+static uint8_t vscp_rx_filter_countBits(uint32_t value);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Data of all framework instances */
+static vscp_rx_filter_Instance vscp_rx_filter_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module. The application interest is cleared.
+ */
+extern void vscp_rx_filter_init(void)
+{
+    VSCP_RX_FILTER_INST.listCnt = 0;
+    VSCP_RX_FILTER_INST.appCnt  = 0;
+    VSCP_RX_FILTER_INST.isValid = FALSE;
+
+    return;
+}
+
+/**
+ * This function requests a recalculation of the acceptance filters, e.g.
+ * after the decision matrix changed.
+ */
+extern void vscp_rx_filter_invalidate(void)
+{
+    VSCP_RX_FILTER_INST.isValid = FALSE;
+
+    return;
+}
+
+/**
+ * This function recalculates the acceptance filters, if requested, and
+ * provides them to the transport adapter. To avoid a recalculation for
+ * every single changed register, it is done only in idle time.
+ *
+ * @param[in]   isIdle  Node is idle (TRUE) or busy (FALSE)
+ */
+extern void vscp_rx_filter_process(BOOL isIdle)
+{
+    if ((FALSE == VSCP_RX_FILTER_INST.isValid) &&
+        (TRUE == isIdle))
+    {
+        vscp_rx_filter_calculate();
+        vscp_tp_adapter_setAcceptanceFilter(VSCP_RX_FILTER_INST.list, VSCP_RX_FILTER_INST.listCnt);
+
+        VSCP_RX_FILTER_INST.isValid = TRUE;
+    }
+
+    return;
+}
+
+/**
+ * This function declares the interest of the application in the events,
+ * which match the given class and type mask/filter.
+ * A event matches, if (class & classMask) == classFilter and
+ * (type & typeMask) == typeFilter.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_rx_filter_addInterest(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    BOOL    status  = FALSE;
+
+    if (VSCP_CONFIG_RX_FILTER_APP_NUM > VSCP_RX_FILTER_INST.appCnt)
+    {
+        vscp_AcceptanceFilter * const   entry   = &VSCP_RX_FILTER_INST.app[VSCP_RX_FILTER_INST.appCnt];
+
+        entry->mask     = VSCP_RX_FILTER_CLASS(classMask) | VSCP_RX_FILTER_TYPE(typeMask);
+        entry->filter   = VSCP_RX_FILTER_CLASS(classFilter) | VSCP_RX_FILTER_TYPE(typeFilter);
+        ++VSCP_RX_FILTER_INST.appCnt;
+
+        VSCP_RX_FILTER_INST.isValid = FALSE;
+
+        status = TRUE;
+    }
+
+    return status;
+}
+
+/**
+ * This function removes all interests of the application.
+ */
+extern void vscp_rx_filter_clearInterest(void)
+{
+    VSCP_RX_FILTER_INST.appCnt  = 0;
+    VSCP_RX_FILTER_INST.isValid = FALSE;
+
+    return;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function calculates the acceptance filters from all sources.
+ */
+static void vscp_rx_filter_calculate(void)
+{
+    uint8_t                 index   = 0;
+    vscp_AcceptanceFilter   entry;
+
+    VSCP_RX_FILTER_INST.listCnt = 0;
+
+    /* The core needs all protocol events. */
+    vscp_rx_filter_add(VSCP_RX_FILTER_CLASS(0x01FF), VSCP_RX_FILTER_CLASS(VSCP_CLASS_L1_PROTOCOL));
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM )
+
+    for(index = 0; index < vscp_dm_getMatrixRows(); ++index)
+    {
+        if (TRUE == vscp_dm_getAcceptanceFilter(index, &entry))
+        {
+            vscp_rx_filter_add(entry.mask, entry.filter);
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_DM_NG_RULE_CACHE )
+
+    index = 0;
+    while(TRUE == vscp_dm_ng_getAcceptanceFilter(index, &entry))
+    {
+        vscp_rx_filter_add(entry.mask, entry.filter);
+        ++index;
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+    /* Without the pre-decoded rules, every event may be relevant. */
+    vscp_rx_filter_add(0, 0);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_DM_NG_RULE_CACHE ) */
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION ) */
+
+    for(index = 0; index < VSCP_RX_FILTER_INST.appCnt; ++index)
+    {
+        vscp_rx_filter_add(VSCP_RX_FILTER_INST.app[index].mask, VSCP_RX_FILTER_INST.app[index].filter);
+    }
+
+    VSCP_UTIL_UNUSED(entry);
+
+    return;
+}
+
+/**
+ * This function adds a acceptance filter to the list. If a filter in the list
+ * already lets pass all of its events, it is skipped. Filters in the list,
+ * which let pass only a subset of its events, are removed.
+ * If the list exceeds the number of supported filters, two are merged.
+ *
+ * @param[in]   mask    Mask
+ * @param[in]   filter  Filter
+ */
+static void vscp_rx_filter_add(uint32_t mask, uint32_t filter)
+{
+    uint8_t index       = 0;
+    BOOL    isCovered   = FALSE;
+
+    filter &= mask;
+
+    while((VSCP_RX_FILTER_INST.listCnt > index) && (FALSE == isCovered))
+    {
+        vscp_AcceptanceFilter const * const entry   = &VSCP_RX_FILTER_INST.list[index];
+
+        /* All bits of the entry are compared by the new one with the same value? */
+        if ((0 == (entry->mask & ~mask)) &&
+            (entry->filter == (filter & entry->mask)))
+        {
+            isCovered = TRUE;
+        }
+
+        ++index;
+    }
+
+    if (FALSE == isCovered)
+    {
+        /* Remove the entries, which the new one covers. */
+        index = 0;
+        while(VSCP_RX_FILTER_INST.listCnt > index)
+        {
+            vscp_AcceptanceFilter const * const entry   = &VSCP_RX_FILTER_INST.list[index];
+
+            if ((0 == (mask & ~entry->mask)) &&
+                (filter == (entry->filter & mask)))
+            {
+                --VSCP_RX_FILTER_INST.listCnt;
+                VSCP_RX_FILTER_INST.list[index] = VSCP_RX_FILTER_INST.list[VSCP_RX_FILTER_INST.listCnt];
+            }
+            else
+            {
+                ++index;
+            }
+        }
+
+        VSCP_RX_FILTER_INST.list[VSCP_RX_FILTER_INST.listCnt].mask   = mask;
+        VSCP_RX_FILTER_INST.list[VSCP_RX_FILTER_INST.listCnt].filter = filter;
+        ++VSCP_RX_FILTER_INST.listCnt;
+
+        if (VSCP_CONFIG_RX_FILTER_NUM < VSCP_RX_FILTER_INST.listCnt)
+        {
+            vscp_rx_filter_reduce();
+        }
+    }
+
+    return;
+}
+
+/**
+ * This function merges the two acceptance filters in the list, which result
+ * in the most specific filter. The merged filter compares only the bits,
+ * which both compare with the same value.
+ */
+static void vscp_rx_filter_reduce(void)
+{
+    uint8_t     first       = 0;
+    uint8_t     second      = 0;
+    uint8_t     bestFirst   = 0;
+    uint8_t     bestSecond  = 1;
+    uint8_t     bestBits    = 0;
+    uint32_t    bestMask    = 0;
+    uint32_t    bestFilter  = 0;
+
+    for(first = 0; first < VSCP_RX_FILTER_INST.listCnt; ++first)
+    {
+        for(second = first + 1; second < VSCP_RX_FILTER_INST.listCnt; ++second)
+        {
+            vscp_AcceptanceFilter const * const entryA  = &VSCP_RX_FILTER_INST.list[first];
+            vscp_AcceptanceFilter const * const entryB  = &VSCP_RX_FILTER_INST.list[second];
+            uint32_t                            mask    = entryA->mask & entryB->mask & ~(entryA->filter ^ entryB->filter);
+            uint8_t                             bits    = vscp_rx_filter_countBits(mask);
+
+            if (((0 == first) && (1 == second)) ||
+                (bestBits < bits))
+            {
+                bestFirst   = first;
+                bestSecond  = second;
+                bestBits    = bits;
+                bestMask    = mask;
+                bestFilter  = entryA->filter & mask;
+            }
+        }
+    }
+
+    /* Remove both and add the merged one. The second is always behind the first. */
+    --VSCP_RX_FILTER_INST.listCnt;
+    VSCP_RX_FILTER_INST.list[bestSecond] = VSCP_RX_FILTER_INST.list[VSCP_RX_FILTER_INST.listCnt];
+    --VSCP_RX_FILTER_INST.listCnt;
+    VSCP_RX_FILTER_INST.list[bestFirst] = VSCP_RX_FILTER_INST.list[VSCP_RX_FILTER_INST.listCnt];
+
+    vscp_rx_filter_add(bestMask, bestFilter);
+
+    return;
+}
+
+/**
+ * This function counts the set bits.
+ *
+ * @param[in]   value   Value
+ * @return Number of set bits
+ */
+static uint8_t vscp_rx_filter_countBits(uint32_t value)
+{
+    uint8_t cnt = 0;
+
+    while(0 != value)
+    {
+        value &= value - 1;
+        ++cnt;
+    }
+
+    return cnt;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
@@ -0,0 +1,185 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP receive acceptance filter
+@file   vscp_rx_filter.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module calculates the acceptance filters of the transport layer.
+
+*******************************************************************************/
+/** @defgroup vscp_rx_filter Receive acceptance filter
+ * Most of the events on a segment are not relevant for the node. A CAN
+ * controller can drop them already in hardware, if its acceptance filters are
+ * set up accordingly. This module calculates a small set of mask/filter pairs,
+ * in the layout of the 29-bit CAN identifier, which lets pass at least:
+ * - All CLASS1.PROTOCOL events, which the core needs.
+ * - All events, which match a enabled decision matrix row.
+ * - All events, which may match a decision matrix next generation rule.
+ * - All events, which the application declared its interest in.
+ *
+ * If more filters are necessary as the transport supports, the two filters
+ * are merged, which lose the least number of identifier bits. Therefore the
+ * transport may still pass events, which are not relevant.
+ *
+ * The filters are recalculated in idle time after a change of the decision
+ * matrix or the application interest and provided to the transport adapter.
+ *
+ * Attention: If this module is enabled, the application receives only the
+ * events it declared its interest in via vscp_rx_filter_addInterest().
+ *
+ * Supported compile switches:
+ * - VSCP_CONFIG_RX_FILTER
+ * - VSCP_CONFIG_RX_FILTER_NUM
+ * - VSCP_CONFIG_RX_FILTER_APP_NUM
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_RX_FILTER_H__
+#define __VSCP_RX_FILTER_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_types.h"
+#include "vscp_config.h"
+#include "vscp_can_id.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/** Bit position of the priority in the 29-bit CAN identifier */
+#define VSCP_RX_FILTER_POS_PRIORITY     VSCP_CAN_ID_POS_PRIORITY
+
+/** Bit position of the hard coded flag in the 29-bit CAN identifier */
+#define VSCP_RX_FILTER_POS_HARD_CODED   VSCP_CAN_ID_POS_HARD_CODED
+
+/** Bit position of the class in the 29-bit CAN identifier */
+#define VSCP_RX_FILTER_POS_CLASS        VSCP_CAN_ID_POS_CLASS
+
+/** Bit position of the type in the 29-bit CAN identifier */
+#define VSCP_RX_FILTER_POS_TYPE         VSCP_CAN_ID_POS_TYPE
+
+/** Bit position of the originating address in the 29-bit CAN identifier */
+#define VSCP_RX_FILTER_POS_OADDR        VSCP_CAN_ID_POS_OADDR
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Get the class bits of the 29-bit CAN identifier. */
+#define VSCP_RX_FILTER_CLASS(__class)   (((uint32_t)((__class) & 0x01FF)) << VSCP_RX_FILTER_POS_CLASS)
+
+/** Get the type bits of the 29-bit CAN identifier. */
+#define VSCP_RX_FILTER_TYPE(__type)     (((uint32_t)((__type) & 0xFF)) << VSCP_RX_FILTER_POS_TYPE)
+
+/** Get the originating address bits of the 29-bit CAN identifier. */
+#define VSCP_RX_FILTER_OADDR(__oAddr)   (((uint32_t)((__oAddr) & 0xFF)) << VSCP_RX_FILTER_POS_OADDR)
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER )
+
+/**
+ * This function initializes the module. The application interest is cleared.
+ */
+extern void vscp_rx_filter_init(void);
+
+/**
+ * This function requests a recalculation of the acceptance filters, e.g.
+ * after the decision matrix changed.
+ */
+extern void vscp_rx_filter_invalidate(void);
+
+/**
+ * This function recalculates the acceptance filters, if requested, and
+ * provides them to the transport adapter. To avoid a recalculation for
+ * every single changed register, it is done only in idle time.
+ *
+ * @param[in]   isIdle  Node is idle (TRUE) or busy (FALSE)
+ */
+extern void vscp_rx_filter_process(BOOL isIdle);
+
+/**
+ * This function declares the interest of the application in the events,
+ * which match the given class and type mask/filter.
+ * A event matches, if (class & classMask) == classFilter and
+ * (type & typeMask) == typeFilter.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ * @return If successful, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_rx_filter_addInterest(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+/**
+ * This function removes all interests of the application.
+ */
+extern void vscp_rx_filter_clearInterest(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_RX_FILTER ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_RX_FILTER_H__ */
+
+/** @} */
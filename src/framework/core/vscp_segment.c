@@ -0,0 +1,617 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP multi-frame streams
+@file   vscp_segment.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_segment.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_segment.h"
+#include <string.h>
+#include "vscp_instance.h"
+#include "vscp_transport.h"
+#include "vscp_util.h"
+#include "../user/vscp_timer.h"
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Data of the selected framework instance */
+#define VSCP_SEGMENT_INST       (vscp_segment_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** A stream, which waits to be sent. */
+typedef struct
+{
+    vscp_TxMessage          header;                             /**< Header, with the index of the next frame */
+    uint8_t                 indexPos;                           /**< Position of the index byte in the header */
+    BOOL                    fillUp;                             /**< Fill up the last frame with zeros */
+    vscp_segment_GetData    getData;                            /**< Payload callback, NULL if the payload is copied */
+    uint8_t                 dataSize;                           /**< Payload size in byte */
+    uint8_t                 dataPos;                            /**< Payload position of the next frame */
+    uint8_t                 data[VSCP_CONFIG_SEGMENT_TX_SIZE];  /**< Copied payload */
+
+} vscp_segment_TxStream;
+
+/** A stream, which is reassembled. */
+typedef struct
+{
+    BOOL        isUsed;                             /**< Slot used or not */
+    uint8_t     timerId;                            /**< Timer id of the frame timeout */
+    uint8_t     oAddr;                              /**< Originating nickname id */
+    uint16_t    vscpClass;                          /**< Class */
+    uint8_t     vscpType;                           /**< Type */
+    uint8_t     headerSize;                         /**< Header size in byte */
+    uint8_t     header[VSCP_L1_DATA_SIZE];          /**< Header, the index byte is 0 */
+    uint8_t     nextIndex;                          /**< Index of the next expected frame */
+    uint8_t     dataSize;                           /**< Reassembled payload size in byte */
+    uint8_t     data[VSCP_CONFIG_SEGMENT_RX_SIZE];  /**< Reassembled payload */
+
+} vscp_segment_RxStream;
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Streams, which wait to be sent */
+    vscp_segment_TxStream   txStreams[VSCP_CONFIG_SEGMENT_TX_NUM];
+
+    /** Index of the stream, which is sent */
+    uint8_t                 txHead;
+
+    /** Number of streams, which wait to be sent */
+    uint8_t                 txCount;
+
+    /** Streams, which are reassembled */
+    vscp_segment_RxStream   rxStreams[VSCP_CONFIG_SEGMENT_RX_NUM];
+
+} vscp_segment_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+static vscp_segment_TxStream* vscp_segment_queue(vscp_TxMessage const * const header, uint8_t indexPos, BOOL fillUp, uint8_t dataSize);
+static BOOL vscp_segment_sendFrame(vscp_segment_TxStream * const stream);
+static BOOL vscp_segment_isExpired(vscp_segment_RxStream const * const stream);
+static vscp_segment_RxStream* vscp_segment_findRxStream(vscp_RxMessage const * const msg, uint8_t headerSize, uint8_t indexPos);
+static vscp_segment_RxStream* vscp_segment_allocRxStream(void);
+static void vscp_segment_freeRxStream(vscp_segment_RxStream * const stream);
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/* The GUID drop nickname id is reassembled. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_GUID_SIZE <= VSCP_CONFIG_SEGMENT_RX_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0xFF >= VSCP_CONFIG_SEGMENT_RX_SIZE);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_SEGMENT_RX_NUM);
+
+VSCP_UTIL_COMPILE_TIME_ASSERT(0 < VSCP_CONFIG_SEGMENT_TX_NUM);
+VSCP_UTIL_COMPILE_TIME_ASSERT(0xFF >= VSCP_CONFIG_SEGMENT_TX_SIZE);
+
+/** Data of all framework instances */
+static vscp_segment_Instance    vscp_segment_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_segment_init(void)
+{
+    uint8_t index   = 0;
+
+    VSCP_SEGMENT_INST.txHead    = 0;
+    VSCP_SEGMENT_INST.txCount   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_SEGMENT_RX_NUM; ++index)
+    {
+        VSCP_SEGMENT_INST.rxStreams[index].isUsed   = FALSE;
+        VSCP_SEGMENT_INST.rxStreams[index].timerId  = vscp_timer_create();
+    }
+
+    return;
+}
+
+/**
+ * This function queues a stream to be sent. The payload is copied.
+ *
+ * The header message contains the class, type, priority, originating address
+ * and the header bytes (data size = header size). The index byte in the header
+ * is the index of the first frame.
+ *
+ * @param[in]   header      Header message
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   fillUp      Fill up the last frame with zeros (TRUE) or not (FALSE)
+ * @param[in]   data        Payload
+ * @param[in]   dataSize    Payload size in byte
+ * @return  Queued or not
+ * @retval  FALSE   Invalid parameter, payload too large or queue full
+ * @retval  TRUE    Queued
+ */
+extern BOOL vscp_segment_send(vscp_TxMessage const * const header, uint8_t indexPos, BOOL fillUp, uint8_t const * const data, uint8_t dataSize)
+{
+    vscp_segment_TxStream*  stream  = NULL;
+
+    if (((NULL == data) && (0 < dataSize)) ||
+        (VSCP_CONFIG_SEGMENT_TX_SIZE < dataSize))
+    {
+        return FALSE;
+    }
+
+    stream = vscp_segment_queue(header, indexPos, fillUp, dataSize);
+
+    if (NULL == stream)
+    {
+        return FALSE;
+    }
+
+    if (0 < dataSize)
+    {
+        memcpy(stream->data, data, dataSize);
+    }
+
+    return TRUE;
+}
+
+/**
+ * This function queues a stream to be sent. The payload is read with the
+ * callback, when its frame is sent.
+ *
+ * @param[in]   header      Header message, see vscp_segment_send()
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   fillUp      Fill up the last frame with zeros (TRUE) or not (FALSE)
+ * @param[in]   getData     Callback, which provides the payload
+ * @param[in]   dataSize    Payload size in byte
+ * @return  Queued or not
+ * @retval  FALSE   Invalid parameter or queue full
+ * @retval  TRUE    Queued
+ */
+extern BOOL vscp_segment_sendFunc(vscp_TxMessage const * const header, uint8_t indexPos, BOOL fillUp, vscp_segment_GetData getData, uint8_t dataSize)
+{
+    vscp_segment_TxStream*  stream  = NULL;
+
+    if (NULL == getData)
+    {
+        return FALSE;
+    }
+
+    stream = vscp_segment_queue(header, indexPos, fillUp, dataSize);
+
+    if (NULL == stream)
+    {
+        return FALSE;
+    }
+
+    stream->getData = getData;
+
+    return TRUE;
+}
+
+/**
+ * This function sends the frames of the queued streams, as long as the
+ * transport layer accepts them. A refused frame is retried in the next cycle.
+ *
+ * @return If at least one frame was sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_segment_process(void)
+{
+    uint8_t frames  = 0;
+
+    while((0 < VSCP_SEGMENT_INST.txCount) &&
+          (VSCP_CONFIG_SEGMENT_TX_FRAMES_PER_CYCLE > frames))
+    {
+        vscp_segment_TxStream * const   stream  = &VSCP_SEGMENT_INST.txStreams[VSCP_SEGMENT_INST.txHead];
+
+        /* Transport layer is busy, retry in the next process cycle. */
+        if (FALSE == vscp_segment_sendFrame(stream))
+        {
+            break;
+        }
+
+        ++frames;
+
+        /* Stream complete? */
+        if (stream->dataSize <= stream->dataPos)
+        {
+            ++VSCP_SEGMENT_INST.txHead;
+            if (VSCP_CONFIG_SEGMENT_TX_NUM <= VSCP_SEGMENT_INST.txHead)
+            {
+                VSCP_SEGMENT_INST.txHead = 0;
+            }
+
+            --VSCP_SEGMENT_INST.txCount;
+        }
+    }
+
+    return (0 < frames) ? TRUE : FALSE;
+}
+
+/**
+ * This function determines whether streams are still waiting to be sent,
+ * e.g. because the transport layer refused their frames.
+ *
+ * @return If streams are still in progress, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_segment_isPending(void)
+{
+    return (0 < VSCP_SEGMENT_INST.txCount) ? TRUE : FALSE;
+}
+
+/**
+ * This function reassembles a stream. The data of a complete stream is valid
+ * until the next call.
+ *
+ * @param[in]   msg         Received message
+ * @param[in]   headerSize  Header size in byte
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   size        Stream payload size in byte or 0, if a frame, which isn't full, completes the stream
+ * @param[out]  data        Payload of the complete stream
+ * @param[out]  dataSize    Payload size of the complete stream in byte
+ * @return Receive status
+ */
+extern VSCP_SEGMENT_RX vscp_segment_receive(vscp_RxMessage const * const msg, uint8_t headerSize, uint8_t indexPos, uint8_t size, uint8_t const ** const data, uint8_t * const dataSize)
+{
+    vscp_segment_RxStream*  stream      = NULL;
+    uint8_t                 index       = 0;
+    uint8_t                 payloadSize = 0;
+    VSCP_SEGMENT_RX         status      = VSCP_SEGMENT_RX_PENDING;
+
+    if ((NULL == msg) ||
+        (NULL == data) ||
+        (NULL == dataSize) ||
+        (indexPos >= headerSize) ||
+        (headerSize > msg->dataSize) ||
+        (VSCP_L1_DATA_SIZE < msg->dataSize) ||
+        (VSCP_CONFIG_SEGMENT_RX_SIZE < size))
+    {
+        return VSCP_SEGMENT_RX_DROPPED;
+    }
+
+    index   = msg->data[indexPos];
+    stream  = vscp_segment_findRxStream(msg, headerSize, indexPos);
+
+    /* First frame of a stream? A already started one is restarted. */
+    if (0 == index)
+    {
+        if (NULL == stream)
+        {
+            stream = vscp_segment_allocRxStream();
+
+            /* No free slot, the stream is lost. */
+            if (NULL == stream)
+            {
+                return VSCP_SEGMENT_RX_DROPPED;
+            }
+
+            stream->isUsed      = TRUE;
+            stream->oAddr       = msg->oAddr;
+            stream->vscpClass   = msg->vscpClass;
+            stream->vscpType    = msg->vscpType;
+            stream->headerSize  = headerSize;
+
+            memcpy(stream->header, msg->data, headerSize);
+            stream->header[indexPos] = 0;
+        }
+
+        stream->nextIndex   = 0;
+        stream->dataSize    = 0;
+    }
+    /* No stream found? */
+    else if (NULL == stream)
+    {
+        return VSCP_SEGMENT_RX_DROPPED;
+    }
+    /* Frame lost or timeout? */
+    else if ((stream->nextIndex != index) ||
+             (TRUE == vscp_segment_isExpired(stream)))
+    {
+        vscp_segment_freeRxStream(stream);
+        return VSCP_SEGMENT_RX_DROPPED;
+    }
+    else
+    {
+        ;
+    }
+
+    payloadSize = msg->dataSize - headerSize;
+
+    /* Payload, which exceeds the expected stream size, is padding. */
+    if ((0 < size) &&
+        ((size - stream->dataSize) < payloadSize))
+    {
+        payloadSize = size - stream->dataSize;
+    }
+    /* A stream, which is larger than the slot, is lost. */
+    else if ((VSCP_CONFIG_SEGMENT_RX_SIZE - stream->dataSize) < payloadSize)
+    {
+        vscp_segment_freeRxStream(stream);
+        return VSCP_SEGMENT_RX_DROPPED;
+    }
+    else
+    {
+        ;
+    }
+
+    memcpy(&stream->data[stream->dataSize], &msg->data[headerSize], payloadSize);
+    stream->dataSize += payloadSize;
+    ++stream->nextIndex;
+
+    if (0 < size)
+    {
+        if (size <= stream->dataSize)
+        {
+            status = VSCP_SEGMENT_RX_COMPLETE;
+        }
+    }
+    else if ((VSCP_L1_DATA_SIZE - headerSize) > payloadSize)
+    {
+        status = VSCP_SEGMENT_RX_COMPLETE;
+    }
+    else
+    {
+        ;
+    }
+
+    if (VSCP_SEGMENT_RX_COMPLETE == status)
+    {
+        *data       = stream->data;
+        *dataSize   = stream->dataSize;
+
+        /* The data stays valid until the slot is used again. */
+        vscp_segment_freeRxStream(stream);
+    }
+    else
+    {
+        vscp_timer_start(stream->timerId, VSCP_CONFIG_MULTI_MSG_TIMEOUT);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * Queue a stream, without its payload.
+ *
+ * @param[in]   header      Header message
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   fillUp      Fill up the last frame with zeros (TRUE) or not (FALSE)
+ * @param[in]   dataSize    Payload size in byte
+ * @return Queued stream or NULL, if the parameters are invalid or the queue is full
+ */
+static vscp_segment_TxStream* vscp_segment_queue(vscp_TxMessage const * const header, uint8_t indexPos, BOOL fillUp, uint8_t dataSize)
+{
+    vscp_segment_TxStream*  stream  = NULL;
+    uint8_t                 slot    = 0;
+
+    /* At least a single payload byte must fit into a frame. */
+    if ((NULL == header) ||
+        (VSCP_L1_DATA_SIZE <= header->dataSize) ||
+        (indexPos >= header->dataSize) ||
+        (VSCP_CONFIG_SEGMENT_TX_NUM <= VSCP_SEGMENT_INST.txCount))
+    {
+        return NULL;
+    }
+
+    slot = VSCP_SEGMENT_INST.txHead + VSCP_SEGMENT_INST.txCount;
+    if (VSCP_CONFIG_SEGMENT_TX_NUM <= slot)
+    {
+        slot -= VSCP_CONFIG_SEGMENT_TX_NUM;
+    }
+
+    stream = &VSCP_SEGMENT_INST.txStreams[slot];
+
+    stream->header      = *header;
+    stream->indexPos    = indexPos;
+    stream->fillUp      = fillUp;
+    stream->getData     = NULL;
+    stream->dataSize    = dataSize;
+    stream->dataPos     = 0;
+
+    ++VSCP_SEGMENT_INST.txCount;
+
+    return stream;
+}
+
+/**
+ * Send the next frame of a stream.
+ *
+ * @param[in,out]   stream  Stream
+ * @return If the frame is sent, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_segment_sendFrame(vscp_segment_TxStream * const stream)
+{
+    vscp_TxMessage  txMessage   = stream->header;
+    uint8_t         dataPos     = stream->dataPos;
+    uint8_t         size        = VSCP_L1_DATA_SIZE - txMessage.dataSize;
+
+    /* Payload */
+    if ((stream->dataSize - dataPos) < size)
+    {
+        size = stream->dataSize - dataPos;
+    }
+
+    if (NULL != stream->getData)
+    {
+        stream->getData(dataPos, &txMessage.data[txMessage.dataSize], size);
+    }
+    else
+    {
+        memcpy(&txMessage.data[txMessage.dataSize], &stream->data[dataPos], size);
+    }
+
+    txMessage.dataSize  += size;
+    dataPos             += size;
+
+    /* Fill up the last frame */
+    if (TRUE == stream->fillUp)
+    {
+        while(VSCP_L1_DATA_SIZE > txMessage.dataSize)
+        {
+            txMessage.data[txMessage.dataSize] = 0;
+            ++txMessage.dataSize;
+        }
+    }
+
+    if (FALSE == vscp_transport_writeMessage(&txMessage))
+    {
+        return FALSE;
+    }
+
+    stream->dataPos = dataPos;
+    ++stream->header.data[stream->indexPos];
+
+    return TRUE;
+}
+
+/**
+ * Is the frame timeout of a reassembled stream expired?
+ *
+ * @param[in]   stream  Stream
+ * @return If the timeout is expired, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_segment_isExpired(vscp_segment_RxStream const * const stream)
+{
+    /* Without a timer, the stream never times out. */
+    if (VSCP_TIMER_ID_INVALID == stream->timerId)
+    {
+        return FALSE;
+    }
+
+    return (FALSE == vscp_timer_getStatus(stream->timerId)) ? TRUE : FALSE;
+}
+
+/**
+ * Find the reassembled stream of a received message.
+ *
+ * @param[in]   msg         Received message
+ * @param[in]   headerSize  Header size in byte
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @return Stream or NULL, if not found
+ */
+static vscp_segment_RxStream* vscp_segment_findRxStream(vscp_RxMessage const * const msg, uint8_t headerSize, uint8_t indexPos)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_SEGMENT_RX_NUM; ++index)
+    {
+        vscp_segment_RxStream * const   stream  = &VSCP_SEGMENT_INST.rxStreams[index];
+
+        if ((TRUE == stream->isUsed) &&
+            (msg->oAddr == stream->oAddr) &&
+            (msg->vscpClass == stream->vscpClass) &&
+            (msg->vscpType == stream->vscpType) &&
+            (headerSize == stream->headerSize))
+        {
+            uint8_t headerIndex = 0;
+
+            for(headerIndex = 0; headerIndex < headerSize; ++headerIndex)
+            {
+                if ((indexPos != headerIndex) &&
+                    (msg->data[headerIndex] != stream->header[headerIndex]))
+                {
+                    break;
+                }
+            }
+
+            if (headerSize == headerIndex)
+            {
+                return stream;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Allocate a slot for a reassembled stream. A stream, which timed out, is
+ * replaced.
+ *
+ * @return Stream or NULL, if all slots are used
+ */
+static vscp_segment_RxStream* vscp_segment_allocRxStream(void)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_CONFIG_SEGMENT_RX_NUM; ++index)
+    {
+        vscp_segment_RxStream * const   stream  = &VSCP_SEGMENT_INST.rxStreams[index];
+
+        if ((FALSE == stream->isUsed) ||
+            (TRUE == vscp_segment_isExpired(stream)))
+        {
+            return stream;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Free the slot of a reassembled stream.
+ *
+ * @param[in,out]   stream  Stream
+ */
+static void vscp_segment_freeRxStream(vscp_segment_RxStream * const stream)
+{
+    stream->isUsed = FALSE;
+    vscp_timer_stop(stream->timerId);
+
+    return;
+}
@@ -0,0 +1,199 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP multi-frame streams
+@file   vscp_segment.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module segments a payload, which doesn't fit into a single frame, into
+several frames and reassembles them on the receiver side.
+
+*******************************************************************************/
+/** @defgroup vscp_segment VSCP multi-frame streams
+ * Several Level I events carry more data than a single frame, e.g. the who
+ * is there response, the log message or the display text. Every frame of such
+ * a stream starts with the same header, which contains an index byte. The
+ * index is increased by one for every frame, the remaining bytes carry the
+ * payload.
+ *
+ * Transmit: The stream is queued and its frames are sent in the following
+ * process cycles, as long as the transport layer accepts them. The payload is
+ * either copied (up to VSCP_CONFIG_SEGMENT_TX_SIZE bytes) or read with a
+ * callback, when its frame is sent. The streams are sent in the order
+ * of their queuing, so the frames of different streams are not interleaved.
+ *
+ * Receive: Up to VSCP_CONFIG_SEGMENT_RX_NUM streams are reassembled
+ * concurrently, e.g. of different nodes. A stream is identified by its
+ * originating nickname id, class, type and header, without the index. It
+ * starts with index 0. A missing frame or a timeout of
+ * VSCP_CONFIG_MULTI_MSG_TIMEOUT between two frames drops the stream.
+ *
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_SEGMENT_H__
+#define __VSCP_SEGMENT_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "vscp_config.h"
+#include "vscp_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Receive status of a multi-frame stream */
+typedef enum
+{
+    VSCP_SEGMENT_RX_PENDING = 0,    /**< Frame accepted, more frames expected */
+    VSCP_SEGMENT_RX_COMPLETE,       /**< Stream complete */
+    VSCP_SEGMENT_RX_DROPPED         /**< Frame dropped, e.g. out of sequence */
+
+} VSCP_SEGMENT_RX;
+
+/**
+ * This type defines a callback, which provides the payload bytes of a frame,
+ * when it is sent.
+ *
+ * @param[in]   index   Index of the first payload byte
+ * @param[out]  buffer  Buffer for the payload bytes
+ * @param[in]   size    Number of payload bytes
+ */
+typedef void (*vscp_segment_GetData)(uint8_t index, uint8_t * const buffer, uint8_t size);
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function initializes the module.
+ */
+extern void vscp_segment_init(void);
+
+/**
+ * This function queues a stream to be sent. The payload is copied.
+ *
+ * The header message contains the class, type, priority, originating address
+ * and the header bytes (data size = header size). The index byte in the header
+ * is the index of the first frame.
+ *
+ * @param[in]   header      Header message
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   fillUp      Fill up the last frame with zeros (TRUE) or not (FALSE)
+ * @param[in]   data        Payload
+ * @param[in]   dataSize    Payload size in byte
+ * @return  Queued or not
+ * @retval  FALSE   Invalid parameter, payload too large or queue full
+ * @retval  TRUE    Queued
+ */
+extern BOOL vscp_segment_send(vscp_TxMessage const * const header, uint8_t indexPos, BOOL fillUp, uint8_t const * const data, uint8_t dataSize);
+
+/**
+ * This function queues a stream to be sent. The payload is read with the
+ * callback, when its frame is sent.
+ *
+ * @param[in]   header      Header message, see vscp_segment_send()
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   fillUp      Fill up the last frame with zeros (TRUE) or not (FALSE)
+ * @param[in]   getData     Callback, which provides the payload
+ * @param[in]   dataSize    Payload size in byte
+ * @return  Queued or not
+ * @retval  FALSE   Invalid parameter or queue full
+ * @retval  TRUE    Queued
+ */
+extern BOOL vscp_segment_sendFunc(vscp_TxMessage const * const header, uint8_t indexPos, BOOL fillUp, vscp_segment_GetData getData, uint8_t dataSize);
+
+/**
+ * This function sends the frames of the queued streams, as long as the
+ * transport layer accepts them. A refused frame is retried in the next cycle.
+ *
+ * @return If at least one frame was sent, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_segment_process(void);
+
+/**
+ * This function determines whether streams are still waiting to be sent,
+ * e.g. because the transport layer refused their frames.
+ *
+ * @return If streams are still in progress, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_segment_isPending(void);
+
+/**
+ * This function reassembles a stream. The data of a complete stream is valid
+ * until the next call.
+ *
+ * @param[in]   msg         Received message
+ * @param[in]   headerSize  Header size in byte
+ * @param[in]   indexPos    Position of the index byte in the header
+ * @param[in]   size        Stream payload size in byte or 0, if a frame, which isn't full, completes the stream
+ * @param[out]  data        Payload of the complete stream
+ * @param[out]  dataSize    Payload size of the complete stream in byte
+ * @return Receive status
+ */
+extern VSCP_SEGMENT_RX vscp_segment_receive(vscp_RxMessage const * const msg, uint8_t headerSize, uint8_t indexPos, uint8_t size, uint8_t const ** const data, uint8_t * const dataSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_SEGMENT_H__ */
+
+/** @} */
@@ -41,10 +41,14 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_transport.h"
+#include "vscp_instance.h"
 #include "../user/vscp_tp_adapter.h"
 #include "vscp_config.h"
 #include "vscp_util.h"
 #include "vscp_class_l1.h"
+#include "../user/vscp_timer.h"
+#include "vscp_bridge.h"
+#include "vscp_l2.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -54,35 +58,122 @@
     CONSTANTS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+/** Number of message priorities */
+#define VSCP_TRANSPORT_PRIORITY_NUM     (VSCP_PRIORITY_7_LOW + 1)
+
+/** Marks the end of a transmit queue list. */
+#define VSCP_TRANSPORT_TX_QUEUE_END     (0xFF)
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_TRANSPORT_INST     (vscp_transport_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Data of a framework instance */
+typedef struct
+{
+    /** Transmit error counter, counts every message, which couldn't be sent. */
+    uint8_t                 txErrorCnt;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+    /** Ring buffer instance for VSCP event loopback. */
+    vscp_util_Ring          loopBackRing;
+
+    /** Message storage of the ring buffer, used for loopback VSCP events. */
+    vscp_Message            loopBackStorage[VSCP_CONFIG_LOOPBACK_STORAGE_NUM];
+
+    /** Message of the loopback, which is lent in place to the upper layer. */
+    vscp_RxMessage const *  loopBackLent;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+    /** Message storage of the transmit queue. */
+    vscp_TxMessage          txQueueStorage[VSCP_CONFIG_TX_QUEUE_STORAGE_NUM];
+
+    /** Index of the next message in the same list, per message storage. */
+    uint8_t                 txQueueNext[VSCP_CONFIG_TX_QUEUE_STORAGE_NUM];
+
+    /** Index of the oldest queued message, per priority. */
+    uint8_t                 txQueueHead[VSCP_TRANSPORT_PRIORITY_NUM];
+
+    /** Index of the newest queued message, per priority. */
+    uint8_t                 txQueueTail[VSCP_TRANSPORT_PRIORITY_NUM];
+
+    /** Index of the first unused message storage. */
+    uint8_t                 txQueueFree;
+
+    /** Number of queued messages */
+    uint8_t                 txQueueCnt;
+
+    /** Number of failed tries to send the next message */
+    uint8_t                 txRetryCnt;
+
+    /** Current backoff time in ms */
+    uint16_t                txBackoff;
+
+    /** Backoff timer id */
+    uint8_t                 txTimerId;
+
+    /** Number of dropped messages, per priority. */
+    uint16_t                txDropCnt[VSCP_TRANSPORT_PRIORITY_NUM];
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+} vscp_transport_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+static vscp_RxMessage const * vscp_transport_lowerBorrow(vscp_RxMessage * const storage);
+static void vscp_transport_lowerRelease(vscp_RxMessage const * const msg);
+static BOOL vscp_transport_lowerWrite(vscp_TxMessage const * const msg);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+static BOOL vscp_transport_txQueueWrite(vscp_TxMessage const * const msg);
+static uint8_t vscp_transport_txQueueGetPriority(vscp_TxMessage const * const msg);
+static uint8_t vscp_transport_txQueueHeadPriority(void);
+static void vscp_transport_txQueueRemove(uint8_t priority);
+static void vscp_transport_txQueueCountDrop(uint8_t priority);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Transmit error counter, counts every message, which couldn't be sent. */
-static uint8_t                  vscp_txErrorCnt = 0;
-
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
-/** Cyclic buffer instance for VSCP event loopback. */
-static vscp_util_CyclicBuffer   vscp_transport_loopBackCyclicBuffer;
-
-/** Message storage of the cyclic buffer, used for loopback VSCP events. */
-static vscp_Message             vscp_transport_loopBackStorage[VSCP_CONFIG_LOOPBACK_STORAGE_NUM];
+/* The ring buffer needs a power of two. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_IS_POWER_OF_TWO(VSCP_CONFIG_LOOPBACK_STORAGE_NUM));
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_UTIL_RING_NUM_MAX >= VSCP_CONFIG_LOOPBACK_STORAGE_NUM);
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+/* The list indices are stored in a byte. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(VSCP_TRANSPORT_TX_QUEUE_END > VSCP_CONFIG_TX_QUEUE_STORAGE_NUM);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+/** Data of all framework instances */
+static vscp_transport_Instance vscp_transport_instances[VSCP_INSTANCE_NUM];
+
 /*******************************************************************************
     GLOBAL VARIABLES
 *******************************************************************************/
@@ -96,91 +187,172 @@ static vscp_Message             vscp_transport_loopBackStorage[VSCP_CONFIG_LOOPB
  */
 extern void vscp_transport_init(void)
 {
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+    uint8_t index   = 0;
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
-    /* Initialize the cyclic buffer for the VSCP event loopback */
-    vscp_util_cyclicBufferInit( &vscp_transport_loopBackCyclicBuffer,
-                                &vscp_transport_loopBackStorage,
-                                sizeof(vscp_transport_loopBackStorage),
-                                sizeof(vscp_transport_loopBackStorage[0]));
+    /* Initialize the ring buffer for the VSCP event loopback */
+    vscp_util_ringInit( &VSCP_TRANSPORT_INST.loopBackRing,
+                        VSCP_TRANSPORT_INST.loopBackStorage,
+                        sizeof(VSCP_TRANSPORT_INST.loopBackStorage),
+                        sizeof(VSCP_TRANSPORT_INST.loopBackStorage[0]));
+
+    VSCP_TRANSPORT_INST.loopBackLent = NULL;
 
 #endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+    /* All message storages are unused. */
+    for(index = 0; index < VSCP_CONFIG_TX_QUEUE_STORAGE_NUM; ++index)
+    {
+        VSCP_TRANSPORT_INST.txQueueNext[index] = index + 1;
+    }
+    VSCP_TRANSPORT_INST.txQueueNext[VSCP_CONFIG_TX_QUEUE_STORAGE_NUM - 1] = VSCP_TRANSPORT_TX_QUEUE_END;
+    VSCP_TRANSPORT_INST.txQueueFree = 0;
+
+    for(index = 0; index < VSCP_TRANSPORT_PRIORITY_NUM; ++index)
+    {
+        VSCP_TRANSPORT_INST.txQueueHead[index] = VSCP_TRANSPORT_TX_QUEUE_END;
+        VSCP_TRANSPORT_INST.txQueueTail[index] = VSCP_TRANSPORT_TX_QUEUE_END;
+        VSCP_TRANSPORT_INST.txDropCnt[index]   = 0;
+    }
+
+    VSCP_TRANSPORT_INST.txQueueCnt = 0;
+    VSCP_TRANSPORT_INST.txRetryCnt = 0;
+    VSCP_TRANSPORT_INST.txBackoff  = VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN;
+    VSCP_TRANSPORT_INST.txTimerId  = vscp_timer_create();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
     /* Initialize transport layer adapter */
     vscp_tp_adapter_init();
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+    /* Initialize the bridge between the transport layer adapters */
+    vscp_bridge_init();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
     return;
 }
 
 /**
- * This function reads a message from the transport layer.
+ * This function borrows a received message from the transport layer.
+ * If the lower layer lends its own frame buffer, a pointer to it is returned
+ * without copying. Otherwise the message is read into the given storage.
+ * Every borrowed message must be given back via vscp_transport_releaseMessage().
  *
- * @param[out]  msg Message storage
- * @return  Message received or not
- * @retval  FALSE   No message received
- * @retval  TRUE    Message received
+ * @param[in]   storage Message storage, used if no frame buffer is lent
+ * @return  Received message or NULL if no message is available
  */
-extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg)
+extern vscp_RxMessage const * vscp_transport_borrowMessage(vscp_RxMessage * const storage)
 {
-    BOOL    status  = FALSE;
+    vscp_RxMessage const *  msg = NULL;
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
-    if (NULL != msg)
+    if (NULL != storage)
     {
+        void *  elem    = NULL;
+
         /* The loopback works as FIFO (first in, first out).
-         * A easy way would be to write now a received message to the loopback.
-         * Read from the loopback and provide it to the upper layer.
-         * This would cause three copy operations:
-         * 1. Copy from lower layer to msg.
-         * 2. Copy from msg to loopback.
-         * 3. Copy from loopback to msg.
+         * Its oldest message is lent in place to the upper layer and removed
+         * from the loopback, when it is given back.
+         *
+         * To keep the order, a message, which is received from the lower
+         * layer in the meantime, is appended to the loopback. It is read
+         * directly into the free element of the loopback. If the loopback is
+         * full, it stays in the lower layer.
          *
-         * In the case that the loopback is empty, this can be reduced to only
-         * one copy operation, which is implemented below.
+         * In the case that the loopback is empty, the message of the lower
+         * layer is provided directly.
          */
-
-        /* Read message from loopback */
-        uint8_t read = vscp_util_cyclicBufferRead(&vscp_transport_loopBackCyclicBuffer, msg, 1);
-
-        /* Read a message? */
-        if (0 < read)
+        if ((NULL == VSCP_TRANSPORT_INST.loopBackLent) &&
+            (0 < vscp_util_ringPeekRead(&VSCP_TRANSPORT_INST.loopBackRing, &elem)))
         {
-            /* Write any received message from the lower layer to the loopback. */
-            vscp_RxMessage  rxMsg;
-            BOOL            received = vscp_tp_adapter_readMessage(&rxMsg);
+            void *  slot    = NULL;
 
-            if (TRUE == received)
+            if (0 < vscp_util_ringPeekWrite(&VSCP_TRANSPORT_INST.loopBackRing, &slot))
             {
-                (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, &rxMsg, 1);
+                vscp_RxMessage const *  rxMsg = vscp_transport_lowerBorrow((vscp_RxMessage*)slot);
+
+                if (NULL != rxMsg)
+                {
+                    /* Frame buffer lent by the driver? */
+                    if (slot != rxMsg)
+                    {
+                        *((vscp_RxMessage*)slot) = *rxMsg;
+                    }
+
+                    vscp_transport_lowerRelease(rxMsg);
+                    vscp_util_ringCommitWrite(&VSCP_TRANSPORT_INST.loopBackRing, 1);
+                }
             }
 
-            status = TRUE;
+            VSCP_TRANSPORT_INST.loopBackLent = (vscp_RxMessage const *)elem;
+            msg = VSCP_TRANSPORT_INST.loopBackLent;
         }
         else
         /* No message in the loopback, maybe one is received from lower layer. */
         {
-            status = vscp_tp_adapter_readMessage(msg);
+            msg = vscp_transport_lowerBorrow(storage);
         }
+    }
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+    msg = vscp_transport_lowerBorrow(storage);
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+    return msg;
+}
+
+/**
+ * This function gives a borrowed message back to the transport layer.
+ *
+ * @param[in]   msg Borrowed message
+ */
+extern void vscp_transport_releaseMessage(vscp_RxMessage const * const msg)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
 
+    /* Messages from the loopback are located in the loopback itself,
+     * which are not given back to the lower layer.
+     */
+    if ((NULL != msg) &&
+        (VSCP_TRANSPORT_INST.loopBackLent == msg))
+    {
+        vscp_util_ringCommitRead(&VSCP_TRANSPORT_INST.loopBackRing, 1);
+        VSCP_TRANSPORT_INST.loopBackLent = NULL;
+    }
+    else
+    {
+        vscp_transport_lowerRelease(msg);
     }
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
-    status = vscp_tp_adapter_readMessage(msg);
+    vscp_transport_lowerRelease(msg);
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
-    return status;
+    return;
 }
 
 /**
  * This function writes a message to the transport layer.
+ * If the transmit queue is enabled, the message is sent or queued. It never
+ * waits for the lower layer.
  *
  * @param[in]   msg Message storage
  * @return  Message sent or not
- * @retval  FALSE   Couldn't send message
- * @retval  TRUE    Message successful sent
+ * @retval  FALSE   Couldn't send or queue message
+ * @retval  TRUE    Message successful sent or queued
  */
 extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
 {
@@ -198,30 +370,160 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
         if ((VSCP_CLASS_L1_PROTOCOL != msg->vscpClass) &&
             (VSCP_CLASS_L1_LOG != msg->vscpClass))
         {
-            (void)vscp_util_cyclicBufferWrite(&vscp_transport_loopBackCyclicBuffer, msg, 1);
+            (void)vscp_util_ringWrite(&VSCP_TRANSPORT_INST.loopBackRing, msg, 1);
         }
 
-        status = vscp_tp_adapter_writeMessage(msg);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+        status = vscp_transport_txQueueWrite(msg);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
+        status = vscp_transport_lowerWrite(msg);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
     }
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
-    status = vscp_tp_adapter_writeMessage(msg);
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+    status = vscp_transport_txQueueWrite(msg);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
+    status = vscp_transport_lowerWrite(msg);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
 
     /* Count every transmit error */
     if (FALSE == status)
     {
-        if (255 > vscp_txErrorCnt)
+        if (255 > VSCP_TRANSPORT_INST.txErrorCnt)
         {
-            ++vscp_txErrorCnt;
+            ++VSCP_TRANSPORT_INST.txErrorCnt;
         }
     }
 
     return status;
 }
 
+/**
+ * This function processes the transport layer. It sends queued messages, as
+ * long as the lower layer accepts them. Call it once per process cycle.
+ */
+extern void vscp_transport_process(void)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+    /* Forward the frames between the ports, independent of the node. */
+    vscp_bridge_process();
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+    /* Wait until the backoff time is over. */
+    if ((0 < VSCP_TRANSPORT_INST.txQueueCnt) &&
+        (FALSE == vscp_timer_getStatus(VSCP_TRANSPORT_INST.txTimerId)))
+    {
+        BOOL    isRefused   = FALSE;
+
+        while((0 < VSCP_TRANSPORT_INST.txQueueCnt) && (FALSE == isRefused))
+        {
+            uint8_t priority    = vscp_transport_txQueueHeadPriority();
+            uint8_t index       = VSCP_TRANSPORT_INST.txQueueHead[priority];
+
+            if (TRUE == vscp_transport_lowerWrite(&VSCP_TRANSPORT_INST.txQueueStorage[index]))
+            {
+                vscp_transport_txQueueRemove(priority);
+
+                VSCP_TRANSPORT_INST.txRetryCnt = 0;
+                VSCP_TRANSPORT_INST.txBackoff  = VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN;
+            }
+            else
+            {
+                isRefused = TRUE;
+
+                ++VSCP_TRANSPORT_INST.txRetryCnt;
+
+                /* Give up? */
+                if (VSCP_CONFIG_TX_QUEUE_RETRIES < VSCP_TRANSPORT_INST.txRetryCnt)
+                {
+                    vscp_transport_txQueueRemove(priority);
+                    vscp_transport_txQueueCountDrop(priority);
+
+                    if (255 > VSCP_TRANSPORT_INST.txErrorCnt)
+                    {
+                        ++VSCP_TRANSPORT_INST.txErrorCnt;
+                    }
+
+                    VSCP_TRANSPORT_INST.txRetryCnt = 0;
+                    VSCP_TRANSPORT_INST.txBackoff  = VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN;
+                }
+                else
+                {
+                    vscp_timer_start(VSCP_TRANSPORT_INST.txTimerId, VSCP_TRANSPORT_INST.txBackoff);
+
+                    /* Double the backoff time, but limit it. */
+                    if ((VSCP_CONFIG_TX_QUEUE_BACKOFF_MAX / 2) < VSCP_TRANSPORT_INST.txBackoff)
+                    {
+                        VSCP_TRANSPORT_INST.txBackoff = VSCP_CONFIG_TX_QUEUE_BACKOFF_MAX;
+                    }
+                    else
+                    {
+                        VSCP_TRANSPORT_INST.txBackoff *= 2;
+                    }
+                }
+            }
+        }
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+    return;
+}
+
+/**
+ * This function returns whether the transport layer has work to do, which
+ * doesn't wait for a timer. This is the case for a message in the loopback
+ * or a queued message, which is not delayed by a backoff time.
+ *
+ * @return  Work pending or not
+ * @retval  FALSE   Nothing to do
+ * @retval  TRUE    Process pending
+ */
+extern BOOL vscp_transport_isProcessPending(void)
+{
+    BOOL    isPending   = FALSE;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK )
+
+    void *  elem        = NULL;
+
+    if (0 < vscp_util_ringPeekRead(&VSCP_TRANSPORT_INST.loopBackRing, &elem))
+    {
+        isPending = TRUE;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_LOOPBACK ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+    if ((0 < VSCP_TRANSPORT_INST.txQueueCnt) &&
+        (FALSE == vscp_timer_getStatus(VSCP_TRANSPORT_INST.txTimerId)))
+    {
+        isPending = TRUE;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+    if (TRUE == vscp_bridge_isProcessPending())
+    {
+        isPending = TRUE;
+    }
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE ) */
+
+    return isPending;
+}
+
 /**
  * This function returns the number of transmit errors.
  * Note, that calling this function clears the transmit error counter.
@@ -230,13 +532,298 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg)
  */
 extern uint8_t  vscp_transport_getTransmitErrors(void)
 {
-    uint8_t num = vscp_txErrorCnt;
+    uint8_t num = VSCP_TRANSPORT_INST.txErrorCnt;
+
+    VSCP_TRANSPORT_INST.txErrorCnt = 0;
+
+    return num;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+/**
+ * This function returns the number of dropped messages of the given priority.
+ * A message is dropped, if the transmit queue is full or if it couldn't be
+ * sent after all retries.
+ * Note, that calling this function clears the drop counter of the priority.
+ *
+ * @param[in]   priority    Message priority
+ * @return Number of dropped messages
+ */
+extern uint16_t vscp_transport_getTxDrops(VSCP_PRIORITY priority)
+{
+    uint16_t    num = 0;
 
-    vscp_txErrorCnt = 0;
+    if (VSCP_TRANSPORT_PRIORITY_NUM > (uint8_t)priority)
+    {
+        num = VSCP_TRANSPORT_INST.txDropCnt[priority];
+        VSCP_TRANSPORT_INST.txDropCnt[priority] = 0;
+    }
 
     return num;
 }
 
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function reads a Level II message from the transport layer. Its data
+ * is a block of the payload pool, which must be given back via vscp_l2_free().
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_transport_readL2Message(vscp_L2Message * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL == msg)
+    {
+        return FALSE;
+    }
+
+    /* Without a free payload block, the message stays in the driver. */
+    if (FALSE != vscp_l2_alloc(msg))
+    {
+        status = vscp_tp_adapter_readL2Message(msg);
+
+        if ((FALSE == status) ||
+            (VSCP_CONFIG_L2_BLOCK_SIZE < msg->dataSize))
+        {
+            vscp_l2_free(msg);
+            status = FALSE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a Level II message to the transport layer. It is not
+ * queued and isn't looped back.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_transport_writeL2Message(vscp_L2Message const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&                        /* Message shall exists */
+        (VSCP_L2_DATA_SIZE >= msg->dataSize))   /* Number of data bytes is limited */
+    {
+        status = vscp_tp_adapter_writeL2Message(msg);
+    }
+
+    /* Count every transmit error */
+    if (FALSE == status)
+    {
+        if (255 > VSCP_TRANSPORT_INST.txErrorCnt)
+        {
+            ++VSCP_TRANSPORT_INST.txErrorCnt;
+        }
+    }
+
+    return status;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
+
+/**
+ * Borrow a received message from the lower layer, which is the bridge or the
+ * transport layer adapter.
+ *
+ * @param[in]   storage Message storage, used if no frame buffer is lent
+ * @return  Received message or NULL if no message is available
+ */
+static vscp_RxMessage const * vscp_transport_lowerBorrow(vscp_RxMessage * const storage)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+    return vscp_bridge_borrowMessage(storage);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+    return vscp_tp_adapter_borrowMessage(storage);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+}
+
+/**
+ * Give a borrowed message back to the lower layer.
+ *
+ * @param[in]   msg Borrowed message
+ */
+static void vscp_transport_lowerRelease(vscp_RxMessage const * const msg)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+    vscp_bridge_releaseMessage(msg);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+    vscp_tp_adapter_releaseMessage(msg);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+
+    return;
+}
+
+/**
+ * Write a message to the lower layer.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ */
+static BOOL vscp_transport_lowerWrite(vscp_TxMessage const * const msg)
+{
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+    return vscp_bridge_writeMessage(msg);
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+    return vscp_tp_adapter_writeMessage(msg);
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+/**
+ * Send a message or append it to the transmit queue. The message is sent
+ * directly only, if no other message is waiting, to keep the order.
+ * Queued messages are sent, retried and dropped by vscp_transport_process().
+ *
+ * @param[in]   msg Message
+ * @return If the message was sent or queued, it will return TRUE otherwise FALSE.
+ */
+static BOOL vscp_transport_txQueueWrite(vscp_TxMessage const * const msg)
+{
+    BOOL    status      = FALSE;
+    uint8_t priority    = 0;
+
+    if (NULL == msg)
+    {
+        return FALSE;
+    }
+
+    priority = vscp_transport_txQueueGetPriority(msg);
+
+    if ((0 == VSCP_TRANSPORT_INST.txQueueCnt) &&
+        (FALSE == vscp_timer_getStatus(VSCP_TRANSPORT_INST.txTimerId)))
+    {
+        status = vscp_transport_lowerWrite(msg);
+    }
+
+    if (FALSE == status)
+    {
+        if (VSCP_TRANSPORT_TX_QUEUE_END == VSCP_TRANSPORT_INST.txQueueFree)
+        {
+            vscp_transport_txQueueCountDrop(priority);
+        }
+        else
+        {
+            uint8_t index   = VSCP_TRANSPORT_INST.txQueueFree;
+
+            VSCP_TRANSPORT_INST.txQueueFree          = VSCP_TRANSPORT_INST.txQueueNext[index];
+            VSCP_TRANSPORT_INST.txQueueStorage[index] = *msg;
+            VSCP_TRANSPORT_INST.txQueueNext[index]   = VSCP_TRANSPORT_TX_QUEUE_END;
+
+            if (VSCP_TRANSPORT_TX_QUEUE_END == VSCP_TRANSPORT_INST.txQueueTail[priority])
+            {
+                VSCP_TRANSPORT_INST.txQueueHead[priority] = index;
+            }
+            else
+            {
+                VSCP_TRANSPORT_INST.txQueueNext[VSCP_TRANSPORT_INST.txQueueTail[priority]] = index;
+            }
+            VSCP_TRANSPORT_INST.txQueueTail[priority] = index;
+
+            ++VSCP_TRANSPORT_INST.txQueueCnt;
+
+            /* The queue is drained by vscp_transport_process(). */
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Get the priority of a message, limited to the lowest priority.
+ *
+ * @param[in]   msg Message
+ * @return Priority
+ */
+static uint8_t vscp_transport_txQueueGetPriority(vscp_TxMessage const * const msg)
+{
+    uint8_t priority    = (uint8_t)msg->priority;
+
+    if (VSCP_TRANSPORT_PRIORITY_NUM <= priority)
+    {
+        priority = VSCP_PRIORITY_7_LOW;
+    }
+
+    return priority;
+}
+
+/**
+ * Get the highest priority, which has queued messages.
+ * The transmit queue must not be empty.
+ *
+ * @return Priority
+ */
+static uint8_t vscp_transport_txQueueHeadPriority(void)
+{
+    uint8_t priority    = 0;
+
+    while(((VSCP_TRANSPORT_PRIORITY_NUM - 1) > priority) &&
+          (VSCP_TRANSPORT_TX_QUEUE_END == VSCP_TRANSPORT_INST.txQueueHead[priority]))
+    {
+        ++priority;
+    }
+
+    return priority;
+}
+
+/**
+ * Remove the oldest message of the given priority from the transmit queue.
+ *
+ * @param[in]   priority    Priority
+ */
+static void vscp_transport_txQueueRemove(uint8_t priority)
+{
+    uint8_t index   = VSCP_TRANSPORT_INST.txQueueHead[priority];
+
+    if (VSCP_TRANSPORT_TX_QUEUE_END != index)
+    {
+        VSCP_TRANSPORT_INST.txQueueHead[priority] = VSCP_TRANSPORT_INST.txQueueNext[index];
+
+        if (VSCP_TRANSPORT_TX_QUEUE_END == VSCP_TRANSPORT_INST.txQueueHead[priority])
+        {
+            VSCP_TRANSPORT_INST.txQueueTail[priority] = VSCP_TRANSPORT_TX_QUEUE_END;
+        }
+
+        VSCP_TRANSPORT_INST.txQueueNext[index] = VSCP_TRANSPORT_INST.txQueueFree;
+        VSCP_TRANSPORT_INST.txQueueFree        = index;
+
+        --VSCP_TRANSPORT_INST.txQueueCnt;
+    }
+
+    return;
+}
+
+/**
+ * Count a dropped message of the given priority.
+ *
+ * @param[in]   priority    Priority
+ */
+static void vscp_transport_txQueueCountDrop(uint8_t priority)
+{
+    if (0xFFFF > VSCP_TRANSPORT_INST.txDropCnt[priority])
+    {
+        ++VSCP_TRANSPORT_INST.txDropCnt[priority];
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
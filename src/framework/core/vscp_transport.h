@@ -46,12 +46,17 @@ This module handles the transport of the VSCP.
  * buffer mechanism.
  *
  * In case of transmitting a message, the core can write several messages to
- * the transport layer, in one processing cycle. If the transport layer can't
- * send a message, in some cases the core will get into trouble, because right
- * now now fall-back mechanism exists.
+ * the transport layer, in one processing cycle. If the transmit queue is
+ * enabled, a message which can't be sent immediately is queued. The queue is
+ * ordered by message priority and then FIFO. It is drained in every process
+ * cycle, as long as the lower layer accepts messages. If the lower layer
+ * refuses a message, the next try is delayed with a exponential backoff. After
+ * the configured number of retries, the message is dropped.
+ * The lower layer shall never wait in its write function.
  *
  * Supported compile switches:
  * - VSCP_CONFIG_ENABLE_LOOPBACK
+ * - VSCP_CONFIG_TX_QUEUE
  *
  * @{
  */
@@ -69,6 +74,7 @@ This module handles the transport of the VSCP.
 *******************************************************************************/
 #include <stdint.h>
 #include "vscp_types.h"
+#include "vscp_config.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -105,25 +111,52 @@ extern "C"
 extern void vscp_transport_init(void);
 
 /**
- * This function reads a message from the transport layer.
+ * This function borrows a received message from the transport layer.
+ * If the lower layer lends its own frame buffer, a pointer to it is returned
+ * without copying. Otherwise the message is read into the given storage.
+ * Every borrowed message must be given back via vscp_transport_releaseMessage().
  *
- * @param[out]  msg Message storage
- * @return  Message received or not
- * @retval  FALSE   No message received
- * @retval  TRUE    Message received
+ * @param[in]   storage Message storage, used if no frame buffer is lent
+ * @return  Received message or NULL if no message is available
+ */
+extern vscp_RxMessage const * vscp_transport_borrowMessage(vscp_RxMessage * const storage);
+
+/**
+ * This function gives a borrowed message back to the transport layer.
+ *
+ * @param[in]   msg Borrowed message
  */
-extern BOOL vscp_transport_readMessage(vscp_RxMessage * const msg);
+extern void vscp_transport_releaseMessage(vscp_RxMessage const * const msg);
 
 /**
  * This function writes a message to the transport layer.
+ * If the transmit queue is enabled, the message is sent or queued. It never
+ * waits for the lower layer.
  *
  * @param[in]   msg Message storage
  * @return  Message sent or not
- * @retval  FALSE   Couldn't send message
- * @retval  TRUE    Message successful sent
+ * @retval  FALSE   Couldn't send or queue message
+ * @retval  TRUE    Message successful sent or queued
  */
 extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg);
 
+/**
+ * This function processes the transport layer. It sends queued messages, as
+ * long as the lower layer accepts them. Call it once per process cycle.
+ */
+extern void vscp_transport_process(void);
+
+/**
+ * This function returns whether the transport layer has work to do, which
+ * doesn't wait for a timer. This is the case for a message in the loopback
+ * or a queued message, which is not delayed by a backoff time.
+ *
+ * @return  Work pending or not
+ * @retval  FALSE   Nothing to do
+ * @retval  TRUE    Process pending
+ */
+extern BOOL vscp_transport_isProcessPending(void);
+
 /**
  * This function returns the number of transmit errors.
  * Note, that calling this function clears the transmit error counter.
@@ -132,6 +165,47 @@ extern BOOL vscp_transport_writeMessage(vscp_TxMessage const * const msg);
  */
 extern uint8_t  vscp_transport_getTransmitErrors(void);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+/**
+ * This function returns the number of dropped messages of the given priority.
+ * A message is dropped, if the transmit queue is full or if it couldn't be
+ * sent after all retries.
+ * Note, that calling this function clears the drop counter of the priority.
+ *
+ * @param[in]   priority    Message priority
+ * @return Number of dropped messages
+ */
+extern uint16_t vscp_transport_getTxDrops(VSCP_PRIORITY priority);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function reads a Level II message from the transport layer. Its data
+ * is a block of the payload pool, which must be given back via vscp_l2_free().
+ *
+ * @param[out]  msg Message storage
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_transport_readL2Message(vscp_L2Message * const msg);
+
+/**
+ * This function writes a Level II message to the transport layer. It is not
+ * queued and isn't looped back.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_transport_writeL2Message(vscp_L2Message const * const msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #ifdef __cplusplus
 }
 #endif
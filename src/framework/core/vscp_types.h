@@ -71,6 +71,9 @@ extern "C"
 /** Maximum number of data bytes per message. */
 #define VSCP_L1_DATA_SIZE                   (8)
 
+/** Maximum number of data bytes per Level II message. */
+#define VSCP_L2_DATA_SIZE                   (512)
+
 /** Reserved nickname id for the segment master. */
 #define VSCP_NICKNAME_SEGMENT_MASTER        (0x00)
 
@@ -320,6 +323,32 @@ typedef vscp_Message vscp_RxMessage;
 /** This type defines a VSCP transmit message. */
 typedef vscp_Message vscp_TxMessage;
 
+/**
+ * This type defines a VSCP Level II message. The data isn't part of the
+ * message, it is usually a block of the Level II payload pool.
+ */
+typedef struct
+{
+    VSCP_PRIORITY   priority;                   /**< Message priority */
+    uint16_t        vscpClass;                  /**< VSCP class */
+    uint16_t        vscpType;                   /**< VSCP type */
+    uint8_t         guid[VSCP_GUID_SIZE];       /**< GUID of the originating node, MSB first */
+    uint16_t        dataSize;                   /**< Number used of data bytes */
+    uint8_t *       data;                       /**< Data */
+
+} vscp_L2Message;
+
+/**
+ * This type defines a acceptance filter in the layout of the 29-bit CAN
+ * identifier. A message passes, if (id & mask) == filter.
+ */
+typedef struct
+{
+    uint32_t    mask;   /**< Mask, a set bit is compared */
+    uint32_t    filter; /**< Filter */
+
+} vscp_AcceptanceFilter;
+
 /** This type defines the different information lamp states. */
 typedef enum
 {
@@ -41,6 +41,7 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_util.h"
+#include <string.h>
 
 #include "vscp_class_l1.h"
 #include "vscp_type_protocol.h"
@@ -261,7 +262,7 @@ extern uint8_t vscp_util_cyclicBufferRead(vscp_util_CyclicBuffer * const cbuffer
             }
 
             cbuffer->readIndex  = nextReadIndex;
-            src                 = &src[cbuffer->elemSize];
+            src                 = &((uint8_t*)cbuffer->storage)[cbuffer->readIndex * cbuffer->elemSize];
             dst                 = &dst[cbuffer->elemSize];
             ++read;
         }
@@ -306,7 +307,7 @@ extern uint8_t vscp_util_cyclicBufferWrite(vscp_util_CyclicBuffer * const cbuffe
             cbuffer->writeIndex = nextWriteIndex;
             nextWriteIndex      = (nextWriteIndex + 1) % cbuffer->num;
             src                 = &src[cbuffer->elemSize];
-            dst                 = &dst[cbuffer->elemSize];
+            dst                 = &((uint8_t*)cbuffer->storage)[cbuffer->writeIndex * cbuffer->elemSize];
             ++written;
         }
     }
@@ -314,6 +315,346 @@ extern uint8_t vscp_util_cyclicBufferWrite(vscp_util_CyclicBuffer * const cbuffe
     return written;
 }
 
+/**
+ * This function initializes a ring buffer. The number of elements is the
+ * greatest power of two, which fits into the storage, but max.
+ * VSCP_UTIL_RING_NUM_MAX. All elements can be used.
+ *
+ * @param[in,out]   ring        Ring buffer context
+ * @param[in]       storage     Storage of all elements in the ring buffer
+ * @param[in]       size        Storage size in byte
+ * @param[in]       elemSize    Size of a single element in byte
+ */
+extern void vscp_util_ringInit(vscp_util_Ring * const ring, void * const storage, uint16_t size, uint8_t elemSize)
+{
+    if (NULL != ring)
+    {
+        uint16_t    num     = 0;
+        uint8_t     ringNum = VSCP_UTIL_RING_NUM_MAX;
+
+        if (0 < elemSize)
+        {
+            num = size / elemSize;
+        }
+
+        /* Round down to a power of two. */
+        while((0 < ringNum) && (num < ringNum))
+        {
+            ringNum >>= 1;
+        }
+
+        ring->storage       = (0 < ringNum) ? (uint8_t*)storage : NULL;
+        ring->elemSize      = elemSize;
+        ring->mask          = (0 < ringNum) ? (ringNum - 1) : 0;
+        ring->readIndex     = 0;
+        ring->writeIndex    = 0;
+    }
+
+    return;
+}
+
+/**
+ * This function returns the number of elements in a ring buffer.
+ * It can be called by the producer and the consumer.
+ *
+ * @param[in]   ring    Ring buffer context
+ * @return Number of elements
+ */
+extern uint8_t vscp_util_ringGetCount(vscp_util_Ring const * const ring)
+{
+    uint8_t count   = 0;
+
+    if (NULL != ring)
+    {
+        count = (uint8_t)(ring->writeIndex - ring->readIndex);
+    }
+
+    return count;
+}
+
+/**
+ * This function reads one or more elements from a ring buffer.
+ * Only the consumer shall call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[out]      elem    Element buffer (one or more elements)
+ * @param[in]       maxNum  Max. number of elements to read
+ * @return Number of read elements
+ */
+extern uint8_t vscp_util_ringRead(vscp_util_Ring * const ring, void * const elem, uint8_t maxNum)
+{
+    uint8_t read    = 0;
+
+    if ((NULL != ring) &&
+        (NULL != ring->storage) &&
+        (NULL != elem))
+    {
+        uint8_t readIndex   = ring->readIndex;
+        uint8_t count       = (uint8_t)(ring->writeIndex - readIndex);
+        uint8_t pos         = readIndex & ring->mask;
+        uint8_t first       = 0;
+
+        /* Read the elements only after the producer completed them. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        read = (maxNum < count) ? maxNum : count;
+
+        /* Number of elements until the end of the storage */
+        first = (uint8_t)(ring->mask + 1 - pos);
+
+        if (read < first)
+        {
+            first = read;
+        }
+
+        memcpy(elem, &ring->storage[(uint16_t)pos * ring->elemSize], (uint16_t)first * ring->elemSize);
+        memcpy(&((uint8_t*)elem)[(uint16_t)first * ring->elemSize], &ring->storage[0], (uint16_t)(read - first) * ring->elemSize);
+
+        /* Free the elements only after they are copied. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        ring->readIndex = readIndex + read;
+    }
+
+    return read;
+}
+
+/**
+ * This function writes one or more elements to a ring buffer.
+ * Only the producer shall call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[in]       elem    Element buffer (one or more elements)
+ * @param[in]       maxNum  Max. number of elements to write
+ * @return Number of written elements
+ */
+extern uint8_t vscp_util_ringWrite(vscp_util_Ring * const ring, void const * const elem, uint8_t maxNum)
+{
+    uint8_t written = 0;
+
+    if ((NULL != ring) &&
+        (NULL != ring->storage) &&
+        (NULL != elem))
+    {
+        uint8_t writeIndex  = ring->writeIndex;
+        uint8_t free        = (uint8_t)(ring->mask + 1 - (uint8_t)(writeIndex - ring->readIndex));
+        uint8_t pos         = writeIndex & ring->mask;
+        uint8_t first       = 0;
+
+        /* Overwrite the elements only after the consumer freed them. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        written = (maxNum < free) ? maxNum : free;
+
+        /* Number of elements until the end of the storage */
+        first = (uint8_t)(ring->mask + 1 - pos);
+
+        if (written < first)
+        {
+            first = written;
+        }
+
+        memcpy(&ring->storage[(uint16_t)pos * ring->elemSize], elem, (uint16_t)first * ring->elemSize);
+        memcpy(&ring->storage[0], &((uint8_t const *)elem)[(uint16_t)first * ring->elemSize], (uint16_t)(written - first) * ring->elemSize);
+
+        /* Publish the elements only after they are copied. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        ring->writeIndex = writeIndex + written;
+    }
+
+    return written;
+}
+
+/**
+ * This function provides in-place access to the oldest elements of a ring
+ * buffer, without copying them. They stay in the ring buffer, until they are
+ * removed with vscp_util_ringCommitRead(). Only the consumer shall call it.
+ *
+ * @param[in]   ring    Ring buffer context
+ * @param[out]  elem    Pointer to the oldest element or NULL
+ * @return Number of elements, which are located one after another at elem
+ */
+extern uint8_t vscp_util_ringPeekRead(vscp_util_Ring const * const ring, void ** const elem)
+{
+    uint8_t num = 0;
+
+    if (NULL == elem)
+    {
+        return 0;
+    }
+
+    *elem = NULL;
+
+    if ((NULL != ring) &&
+        (NULL != ring->storage))
+    {
+        uint8_t readIndex   = ring->readIndex;
+        uint8_t count       = (uint8_t)(ring->writeIndex - readIndex);
+        uint8_t pos         = readIndex & ring->mask;
+
+        /* Access the elements only after the producer completed them. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        num = (uint8_t)(ring->mask + 1 - pos);
+
+        if (count < num)
+        {
+            num = count;
+        }
+
+        if (0 < num)
+        {
+            *elem = &ring->storage[(uint16_t)pos * ring->elemSize];
+        }
+    }
+
+    return num;
+}
+
+/**
+ * This function removes the oldest elements from a ring buffer, e.g. after
+ * they were accessed via vscp_util_ringPeekRead(). Only the consumer shall
+ * call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[in]       num     Number of elements to remove
+ */
+extern void vscp_util_ringCommitRead(vscp_util_Ring * const ring, uint8_t num)
+{
+    if (NULL != ring)
+    {
+        uint8_t readIndex   = ring->readIndex;
+        uint8_t count       = (uint8_t)(ring->writeIndex - readIndex);
+
+        if (count < num)
+        {
+            num = count;
+        }
+
+        /* Free the elements only after they are accessed. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        ring->readIndex = readIndex + num;
+    }
+
+    return;
+}
+
+/**
+ * This function provides in-place access to the free elements of a ring
+ * buffer. They are added to the ring buffer with vscp_util_ringCommitWrite().
+ * Only the producer shall call it.
+ *
+ * @param[in]   ring    Ring buffer context
+ * @param[out]  elem    Pointer to the first free element or NULL
+ * @return Number of free elements, which are located one after another at elem
+ */
+extern uint8_t vscp_util_ringPeekWrite(vscp_util_Ring const * const ring, void ** const elem)
+{
+    uint8_t num = 0;
+
+    if (NULL == elem)
+    {
+        return 0;
+    }
+
+    *elem = NULL;
+
+    if ((NULL != ring) &&
+        (NULL != ring->storage))
+    {
+        uint8_t writeIndex  = ring->writeIndex;
+        uint8_t free        = (uint8_t)(ring->mask + 1 - (uint8_t)(writeIndex - ring->readIndex));
+        uint8_t pos         = writeIndex & ring->mask;
+
+        /* Overwrite the elements only after the consumer freed them. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        num = (uint8_t)(ring->mask + 1 - pos);
+
+        if (free < num)
+        {
+            num = free;
+        }
+
+        if (0 < num)
+        {
+            *elem = &ring->storage[(uint16_t)pos * ring->elemSize];
+        }
+    }
+
+    return num;
+}
+
+/**
+ * This function adds the elements, which were written via
+ * vscp_util_ringPeekWrite(), to a ring buffer. Only the producer shall call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[in]       num     Number of elements to add
+ */
+extern void vscp_util_ringCommitWrite(vscp_util_Ring * const ring, uint8_t num)
+{
+    if (NULL != ring)
+    {
+        uint8_t writeIndex  = ring->writeIndex;
+        uint8_t free        = (uint8_t)(ring->mask + 1 - (uint8_t)(writeIndex - ring->readIndex));
+
+        if (free < num)
+        {
+            num = free;
+        }
+
+        /* Publish the elements only after they are written. */
+        VSCP_UTIL_MEMORY_BARRIER();
+
+        ring->writeIndex = writeIndex + num;
+    }
+
+    return;
+}
+
+/**
+ * This function calculates the CRC-16-CCITT (polynom 0x1021) of the given data.
+ * The calculation can be continued over several calls, by passing the
+ * previous result. The first call shall pass VSCP_UTIL_CRC16_INIT.
+ *
+ * @param[in]   crc     Previous CRC or VSCP_UTIL_CRC16_INIT
+ * @param[in]   data    Data
+ * @param[in]   size    Data size in byte
+ * @return CRC
+ */
+extern uint16_t vscp_util_crc16(uint16_t crc, uint8_t const * const data, uint16_t size)
+{
+    uint16_t    index   = 0;
+    uint8_t     bit     = 0;
+
+    if (NULL == data)
+    {
+        return crc;
+    }
+
+    for(index = 0; index < size; ++index)
+    {
+        crc ^= ((uint16_t)data[index]) << 8;
+
+        for(bit = 0; bit < 8; ++bit)
+        {
+            if (0 != (crc & 0x8000))
+            {
+                crc = (crc << 1) ^ 0x1021;
+            }
+            else
+            {
+                crc <<= 1;
+            }
+        }
+    }
+
+    return crc;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
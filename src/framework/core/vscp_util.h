@@ -70,6 +70,12 @@ extern "C"
     CONSTANTS
 *******************************************************************************/
 
+/** Initial value of a CRC-16-CCITT calculation */
+#define VSCP_UTIL_CRC16_INIT                    ((uint16_t)0xFFFF)
+
+/** Max. number of elements in a ring buffer */
+#define VSCP_UTIL_RING_NUM_MAX                  128
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -89,6 +95,35 @@ extern "C"
 /** LSB of a word */
 #define VSCP_UTIL_WORD_LSB(__word)              ((uint8_t)(((__word) >> 0) & 0xff))
 
+/** Is the value a power of two? */
+#define VSCP_UTIL_IS_POWER_OF_TWO(__value)      ((0 < (__value)) && (0 == ((__value) & ((__value) - 1))))
+
+#ifndef VSCP_UTIL_MEMORY_BARRIER
+
+#if defined(__AVR__)
+
+/** Memory barrier between the producer and the consumer of a ring buffer.
+ * A single core needs only a compiler barrier, because a interrupt sees all
+ * memory accesses in program order.
+ */
+#define VSCP_UTIL_MEMORY_BARRIER()              __asm__ __volatile__ ("" ::: "memory")
+
+#elif defined(__GNUC__)
+
+/** Memory barrier between the producer and the consumer of a ring buffer. */
+#define VSCP_UTIL_MEMORY_BARRIER()              __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#else
+
+/** Memory barrier between the producer and the consumer of a ring buffer.
+ * Define it for your compiler, if the producer is a interrupt or a thread.
+ */
+#define VSCP_UTIL_MEMORY_BARRIER()
+
+#endif
+
+#endif  /* VSCP_UTIL_MEMORY_BARRIER */
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -104,6 +139,22 @@ typedef struct
 
 } vscp_util_CyclicBuffer;
 
+/**
+ * This type defines a ring buffer context for a single producer and a single
+ * consumer, e.g. a interrupt service routine and the main loop. The number of
+ * elements is a power of two. The read and write indices run freely and are
+ * written only by the consumer respectively the producer.
+ */
+typedef struct
+{
+    uint8_t *           storage;    /**< Storage of elements */
+    uint8_t             elemSize;   /**< Element size */
+    uint8_t             mask;       /**< Number of elements in the storage - 1 */
+    volatile uint8_t    readIndex;  /**< Read index, written by the consumer only */
+    volatile uint8_t    writeIndex; /**< Write index, written by the producer only */
+
+} vscp_util_Ring;
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -161,6 +212,102 @@ extern uint8_t vscp_util_cyclicBufferRead(vscp_util_CyclicBuffer * const cbuffer
  */
 extern uint8_t vscp_util_cyclicBufferWrite(vscp_util_CyclicBuffer * const cbuffer, void const * const elem, uint8_t maxNum);
 
+/**
+ * This function initializes a ring buffer. The number of elements is the
+ * greatest power of two, which fits into the storage, but max.
+ * VSCP_UTIL_RING_NUM_MAX. All elements can be used.
+ *
+ * @param[in,out]   ring        Ring buffer context
+ * @param[in]       storage     Storage of all elements in the ring buffer
+ * @param[in]       size        Storage size in byte
+ * @param[in]       elemSize    Size of a single element in byte
+ */
+extern void vscp_util_ringInit(vscp_util_Ring * const ring, void * const storage, uint16_t size, uint8_t elemSize);
+
+/**
+ * This function returns the number of elements in a ring buffer.
+ * It can be called by the producer and the consumer.
+ *
+ * @param[in]   ring    Ring buffer context
+ * @return Number of elements
+ */
+extern uint8_t vscp_util_ringGetCount(vscp_util_Ring const * const ring);
+
+/**
+ * This function reads one or more elements from a ring buffer.
+ * Only the consumer shall call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[out]      elem    Element buffer (one or more elements)
+ * @param[in]       maxNum  Max. number of elements to read
+ * @return Number of read elements
+ */
+extern uint8_t vscp_util_ringRead(vscp_util_Ring * const ring, void * const elem, uint8_t maxNum);
+
+/**
+ * This function writes one or more elements to a ring buffer.
+ * Only the producer shall call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[in]       elem    Element buffer (one or more elements)
+ * @param[in]       maxNum  Max. number of elements to write
+ * @return Number of written elements
+ */
+extern uint8_t vscp_util_ringWrite(vscp_util_Ring * const ring, void const * const elem, uint8_t maxNum);
+
+/**
+ * This function provides in-place access to the oldest elements of a ring
+ * buffer, without copying them. They stay in the ring buffer, until they are
+ * removed with vscp_util_ringCommitRead(). Only the consumer shall call it.
+ *
+ * @param[in]   ring    Ring buffer context
+ * @param[out]  elem    Pointer to the oldest element or NULL
+ * @return Number of elements, which are located one after another at elem
+ */
+extern uint8_t vscp_util_ringPeekRead(vscp_util_Ring const * const ring, void ** const elem);
+
+/**
+ * This function removes the oldest elements from a ring buffer, e.g. after
+ * they were accessed via vscp_util_ringPeekRead(). Only the consumer shall
+ * call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[in]       num     Number of elements to remove
+ */
+extern void vscp_util_ringCommitRead(vscp_util_Ring * const ring, uint8_t num);
+
+/**
+ * This function provides in-place access to the free elements of a ring
+ * buffer. They are added to the ring buffer with vscp_util_ringCommitWrite().
+ * Only the producer shall call it.
+ *
+ * @param[in]   ring    Ring buffer context
+ * @param[out]  elem    Pointer to the first free element or NULL
+ * @return Number of free elements, which are located one after another at elem
+ */
+extern uint8_t vscp_util_ringPeekWrite(vscp_util_Ring const * const ring, void ** const elem);
+
+/**
+ * This function adds the elements, which were written via
+ * vscp_util_ringPeekWrite(), to a ring buffer. Only the producer shall call it.
+ *
+ * @param[in,out]   ring    Ring buffer context
+ * @param[in]       num     Number of elements to add
+ */
+extern void vscp_util_ringCommitWrite(vscp_util_Ring * const ring, uint8_t num);
+
+/**
+ * This function calculates the CRC-16-CCITT (polynom 0x1021) of the given data.
+ * The calculation can be continued over several calls, by passing the
+ * previous result. The first call shall pass VSCP_UTIL_CRC16_INIT.
+ *
+ * @param[in]   crc     Previous CRC or VSCP_UTIL_CRC16_INIT
+ * @param[in]   data    Data
+ * @param[in]   size    Data size in byte
+ * @return CRC
+ */
+extern uint16_t vscp_util_crc16(uint16_t crc, uint8_t const * const data, uint16_t size);
+
 #ifdef __cplusplus
 }
 #endif
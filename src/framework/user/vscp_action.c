@@ -41,6 +41,7 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_action.h"
+#include "../core/vscp_instance.h"
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM ) || VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION )
 
@@ -56,10 +57,21 @@
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_ACTION_INST        (vscp_action_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Data of a framework instance */
+typedef struct
+{
+    /** Action execution function */
+    vscp_action_Execute executeFunc;
+
+} vscp_action_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
@@ -68,8 +80,8 @@
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Action execution function */
-static vscp_action_Execute  vscp_action_executeFunc = NULL;
+/** Data of all framework instances */
+static vscp_action_Instance    vscp_action_instances[VSCP_INSTANCE_NUM];
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -98,9 +110,9 @@ extern void vscp_action_init(void)
  */
 extern void vscp_action_execute(uint8_t action, uint8_t par, vscp_RxMessage const * const msg)
 {
-    if (NULL != vscp_action_executeFunc)
+    if (NULL != VSCP_ACTION_INST.executeFunc)
     {
-        vscp_action_executeFunc(action, par, msg);
+        VSCP_ACTION_INST.executeFunc(action, par, msg);
     }
 
     return;
@@ -113,7 +125,7 @@ extern void vscp_action_execute(uint8_t action, uint8_t par, vscp_RxMessage cons
  */
 extern void vscp_action_set(vscp_action_Execute func)
 {
-    vscp_action_executeFunc = func;
+    VSCP_ACTION_INST.executeFunc = func;
     return;
 }
 
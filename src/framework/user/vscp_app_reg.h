@@ -53,6 +53,7 @@ This module contains the access to the application specific registers.
     INCLUDES
 *******************************************************************************/
 #include <stdint.h>
+#include "../core/vscp_reg_map.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -71,6 +72,18 @@ extern "C"
     MACROS
 *******************************************************************************/
 
+/**
+ * Application register ranges, which are added to the register map. Every
+ * range is a VSCP_REG_MAP_RAM(), VSCP_REG_MAP_PS() or VSCP_REG_MAP_FUNC()
+ * initializer, followed by a comma. A RAM or PS range is copied as a whole
+ * by a page read. All other application registers are accessed with
+ * vscp_app_reg_readRegister() and vscp_app_reg_writeRegister().
+ *
+ * Example:
+ * VSCP_REG_MAP_RAM(0, 0x00, 16, VSCP_REG_MAP_ACCESS_RW | VSCP_REG_MAP_ACCESS_PROTECTED, app_getRegisters, NULL),
+ */
+#define VSCP_APP_REG_MAP_RANGES
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -90,8 +90,12 @@ extern "C"
 
 #define VSCP_CONFIG_ENABLE_DM_EXTENSION         VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_DM_RAM_INDEX                VSCP_CONFIG_BASE_ENABLED
+
 #define VSCP_CONFIG_ENABLE_DM_NEXT_GENERATION   VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_DM_NG_RULE_CACHE            VSCP_CONFIG_BASE_ENABLED
+
 #define VSCP_CONFIG_ENABLE_LOOPBACK             VSCP_CONFIG_BASE_DISABLED
 
 #define VSCP_CONFIG_ENABLE_SEGMENT_TIME_CALLOUT VSCP_CONFIG_BASE_DISABLED
@@ -100,6 +104,28 @@ extern "C"
 
 #define VSCP_CONFIG_ENABLE_CUSTOM_HEARTBEAT     VSCP_CONFIG_BASE_DISABLED
 
+#define VSCP_CONFIG_TIMER_DEADLINE              VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_PS_CACHE                    VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_PS_JOURNAL                  VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_TX_QUEUE                    VSCP_CONFIG_BASE_ENABLED
+
+#define VSCP_CONFIG_RX_FILTER                   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_EVENT_INTEREST              VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_EMBEDDED_MDF                VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_FW_UPDATE                   VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_MULTI_INSTANCE              VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_BRIDGE                      VSCP_CONFIG_BASE_DISABLED
+
+#define VSCP_CONFIG_LEVEL2                      VSCP_CONFIG_BASE_DISABLED
+
 */
 
 /*******************************************************************************
@@ -130,8 +156,72 @@ extern "C"
 
 #define VSCP_CONFIG_LOOPBACK_STORAGE_NUM        4
 
+#define VSCP_CONFIG_RX_QUEUE_STORAGE_NUM        4
+
+#define VSCP_CONFIG_TIMER_APP_NUM               0
+
 #define VSCP_CONFIG_START_NODE_PROBE_NICKNAME   1
 
+#define VSCP_CONFIG_REG_RSP_STORAGE_NUM         4
+
+#define VSCP_CONFIG_REG_RSP_FRAMES_PER_CYCLE    8
+
+#define VSCP_CONFIG_SEGMENT_TX_NUM              2
+
+#define VSCP_CONFIG_SEGMENT_TX_SIZE             32
+
+#define VSCP_CONFIG_SEGMENT_TX_FRAMES_PER_CYCLE 8
+
+#define VSCP_CONFIG_SEGMENT_RX_NUM              2
+
+#define VSCP_CONFIG_SEGMENT_RX_SIZE             16
+
+#define VSCP_CONFIG_PS_CACHE_LINES              4
+
+#define VSCP_CONFIG_PS_CACHE_FLUSH_TIMEOUT      ((uint16_t)1000)
+
+#define VSCP_CONFIG_PS_JOURNAL_SLOTS            8
+
+#define VSCP_CONFIG_TX_QUEUE_STORAGE_NUM        4
+
+#define VSCP_CONFIG_TX_QUEUE_RETRIES            8
+
+#define VSCP_CONFIG_TX_QUEUE_BACKOFF_MIN        ((uint16_t)2)
+
+#define VSCP_CONFIG_TX_QUEUE_BACKOFF_MAX        ((uint16_t)128)
+
+#define VSCP_CONFIG_RX_FILTER_NUM               4
+
+#define VSCP_CONFIG_RX_FILTER_APP_NUM           4
+
+#define VSCP_CONFIG_EVENT_INTEREST_APP_NUM      4
+
+#define VSCP_CONFIG_EMBEDDED_MDF_WINDOW_SIZE    64
+
+#define VSCP_CONFIG_FW_UPDATE_BLOCK_SIZE        128
+
+#define VSCP_CONFIG_FW_UPDATE_BLOCKS            2
+
+#define VSCP_CONFIG_INSTANCE_NUM                2
+
+#define VSCP_CONFIG_BRIDGE_PORT_NUM             2
+
+#define VSCP_CONFIG_BRIDGE_ROUTES               8
+
+#define VSCP_CONFIG_BRIDGE_PAGE                 4
+
+#define VSCP_CONFIG_BRIDGE_TX_QUEUE_NUM         4
+
+#define VSCP_CONFIG_BRIDGE_RX_QUEUE_NUM         4
+
+#define VSCP_CONFIG_BRIDGE_CACHE_NUM            8
+
+#define VSCP_CONFIG_BRIDGE_ECHO_NUM             8
+
+#define VSCP_CONFIG_L2_BLOCK_SIZE               512
+
+#define VSCP_CONFIG_L2_BLOCK_NUM                2
+
 */
 
 /*******************************************************************************
@@ -0,0 +1,175 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP firmware access driver
+@file   vscp_fw_access.c
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+@see vscp_fw_access.h
+
+*******************************************************************************/
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include "vscp_fw_access.h"
+#include "../core/vscp_instance.h"
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/** Data of the selected framework instance */
+#define VSCP_FW_ACCESS_INST     (vscp_fw_access_instances[VSCP_INSTANCE])
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Program callback */
+    vscp_fw_access_Program  programFunc;
+
+    /** Activate callback */
+    vscp_fw_access_Activate activateFunc;
+
+    /** Number of blocks, which can be programmed */
+    uint32_t                blockNum;
+
+} vscp_fw_access_Instance;
+
+/*******************************************************************************
+    PROTOTYPES
+*******************************************************************************/
+
+/*******************************************************************************
+    LOCAL VARIABLES
+*******************************************************************************/
+
+/** Data of all framework instances */
+static vscp_fw_access_Instance vscp_fw_access_instances[VSCP_INSTANCE_NUM];
+
+/*******************************************************************************
+    GLOBAL VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    GLOBAL FUNCTIONS
+*******************************************************************************/
+
+/**
+ * This function sets the firmware access callbacks.
+ *
+ * @param[in]   program     Program callback
+ * @param[in]   activate    Activate callback
+ * @param[in]   blockNum    Number of blocks, which can be programmed
+ */
+extern void vscp_fw_access_set(vscp_fw_access_Program program, vscp_fw_access_Activate activate, uint32_t blockNum)
+{
+    VSCP_FW_ACCESS_INST.programFunc  = program;
+    VSCP_FW_ACCESS_INST.activateFunc = activate;
+    VSCP_FW_ACCESS_INST.blockNum     = blockNum;
+
+    return;
+}
+
+/**
+ * This function returns the number of blocks, which can be programmed.
+ *
+ * @return Number of blocks. If no program callback is set, it returns 0.
+ */
+extern uint32_t vscp_fw_access_getBlockNum(void)
+{
+    uint32_t    blockNum    = 0;
+
+    if (NULL != VSCP_FW_ACCESS_INST.programFunc)
+    {
+        blockNum = VSCP_FW_ACCESS_INST.blockNum;
+    }
+
+    return blockNum;
+}
+
+/**
+ * This function programs a block of the new firmware.
+ *
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block size in byte
+ * @return Status
+ */
+extern VSCP_FW_ACCESS_RET vscp_fw_access_program(uint32_t block, uint8_t const * const data, uint16_t size)
+{
+    VSCP_FW_ACCESS_RET  ret = VSCP_FW_ACCESS_RET_ERROR;
+
+    if ((NULL != VSCP_FW_ACCESS_INST.programFunc) &&
+        (VSCP_FW_ACCESS_INST.blockNum > block))
+    {
+        ret = VSCP_FW_ACCESS_INST.programFunc(block, data, size);
+    }
+
+    return ret;
+}
+
+/**
+ * This function requests to switch to the new firmware.
+ *
+ * @return If the new firmware can be activated, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_access_activate(void)
+{
+    BOOL    status  = FALSE;
+
+    if (NULL != VSCP_FW_ACCESS_INST.activateFunc)
+    {
+        status = VSCP_FW_ACCESS_INST.activateFunc();
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+    LOCAL FUNCTIONS
+*******************************************************************************/
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
@@ -0,0 +1,168 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP firmware access driver
+@file   vscp_fw_access.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the access driver to the memory, where a new firmware is
+stored during a firmware update.
+
+*******************************************************************************/
+/** @defgroup vscp_fw_access Firmware access driver
+ * The firmware update uses the access driver to program the received blocks,
+ * e.g. in a second flash area, and to activate the new firmware at the end.
+ *
+ * Because this is device specific, the application sets the callbacks. If
+ * no program callback is set, a firmware update is refused.
+ *
+ * Programming a block may take longer than a process cycle. In this case the
+ * program callback returns VSCP_FW_ACCESS_RET_BUSY and it is called with the
+ * same block again in the next process cycle, until it is finished.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_FW_ACCESS_H__
+#define __VSCP_FW_ACCESS_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "../core/vscp_types.h"
+#include "../core/vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/** Firmware access driver return values */
+typedef enum
+{
+    VSCP_FW_ACCESS_RET_OK = 0,  /**< Successful */
+    VSCP_FW_ACCESS_RET_BUSY,    /**< Operation in progress, call again */
+    VSCP_FW_ACCESS_RET_ERROR    /**< Operation failed */
+
+} VSCP_FW_ACCESS_RET;
+
+/**
+ * Program callback, which programs a block of the new firmware.
+ *
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block size in byte
+ * @return Status
+ */
+typedef VSCP_FW_ACCESS_RET (*vscp_fw_access_Program)(uint32_t block, uint8_t const * const data, uint16_t size);
+
+/**
+ * Activate callback, which requests to switch to the new firmware.
+ * It requests it and doesn't expect that it will be immediately, because the
+ * acknowledge has to be sent before.
+ *
+ * @return If the new firmware can be activated, it will return TRUE otherwise FALSE.
+ */
+typedef BOOL (*vscp_fw_access_Activate)(void);
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE )
+
+/**
+ * This function sets the firmware access callbacks.
+ *
+ * @param[in]   program     Program callback
+ * @param[in]   activate    Activate callback
+ * @param[in]   blockNum    Number of blocks, which can be programmed
+ */
+extern void vscp_fw_access_set(vscp_fw_access_Program program, vscp_fw_access_Activate activate, uint32_t blockNum);
+
+/**
+ * This function returns the number of blocks, which can be programmed.
+ *
+ * @return Number of blocks. If no program callback is set, it returns 0.
+ */
+extern uint32_t vscp_fw_access_getBlockNum(void);
+
+/**
+ * This function programs a block of the new firmware.
+ *
+ * @param[in]   block   Block number
+ * @param[in]   data    Block data
+ * @param[in]   size    Block size in byte
+ * @return Status
+ */
+extern VSCP_FW_ACCESS_RET vscp_fw_access_program(uint32_t block, uint8_t const * const data, uint16_t size);
+
+/**
+ * This function requests to switch to the new firmware.
+ *
+ * @return If the new firmware can be activated, it will return TRUE otherwise FALSE.
+ */
+extern BOOL vscp_fw_access_activate(void);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_FW_UPDATE ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_FW_ACCESS_H__ */
+
+/** @} */
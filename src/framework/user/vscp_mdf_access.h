@@ -0,0 +1,119 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  VSCP embedded MDF access driver
+@file   vscp_mdf_access.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This module contains the access driver for the embedded module description
+file (MDF).
+
+*******************************************************************************/
+/** @defgroup vscp_mdf_access Embedded MDF access driver
+ * The embedded MDF is stored compressed in the program memory. This driver
+ * provides read access to the compressed MDF, which is decompressed by the
+ * core.
+ *
+ * The compressed MDF is generated with extras/mdf/mdf_embed.py into
+ * vscp_mdf_data.h. Because the program memory access is device specific, it
+ * has to be implemented by the user.
+ * @{
+ */
+
+/*
+ * Don't forget to set JAVADOC_AUTOBRIEF to YES in the doxygen file to generate
+ * a correct module description.
+ */
+
+#ifndef __VSCP_MDF_ACCESS_H__
+#define __VSCP_MDF_ACCESS_H__
+
+/*******************************************************************************
+    INCLUDES
+*******************************************************************************/
+#include <stdint.h>
+#include "../core/vscp_config.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+    COMPILER SWITCHES
+*******************************************************************************/
+
+/*******************************************************************************
+    CONSTANTS
+*******************************************************************************/
+
+/*******************************************************************************
+    MACROS
+*******************************************************************************/
+
+/*******************************************************************************
+    TYPES AND STRUCTURES
+*******************************************************************************/
+
+/*******************************************************************************
+    VARIABLES
+*******************************************************************************/
+
+/*******************************************************************************
+    FUNCTIONS
+*******************************************************************************/
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF )
+
+/**
+ * Get the size of the compressed MDF.
+ *
+ * @return  Size in byte
+ */
+extern uint16_t vscp_mdf_access_getSize(void);
+
+/**
+ * Read a single byte from the compressed MDF.
+ *
+ * @param[in]   addr    Address in the compressed MDF
+ * @return  Value
+ */
+extern uint8_t  vscp_mdf_access_read8(uint16_t addr);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_EMBEDDED_MDF ) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __VSCP_MDF_ACCESS_H__ */
+
+/** @} */
@@ -0,0 +1,317 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 - 2025 Andreas Merkle
+ * http://www.blue-andi.de
+ * vscp@blue-andi.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+@brief  Embedded module description file (MDF)
+@file   vscp_mdf_data.h
+@author Andreas Merkle, http://www.blue-andi.de
+
+@section desc Description
+This file is generated by extras/mdf/mdf_embed.py. Don't edit it.
+
+Compressed MDF, generated from mdf_template.xml.
+Uncompressed size: 6771 bytes, compressed size: 4197 bytes.
+
+*******************************************************************************/
+
+#ifndef __VSCP_MDF_DATA_H__
+#define __VSCP_MDF_DATA_H__
+
+/** Size of the compressed MDF in bytes */
+#define VSCP_MDF_DATA_SIZE  4197
+
+/** Compressed MDF */
+static const uint8_t vscp_mdf_data[VSCP_MDF_DATA_SIZE] PROGMEM =
+{
+    0x06, 0x1A, 0x73, 0xFF, 0xEF, 0xBB, 0xBF, 0x3C, 0x3F, 0x78, 0x6D, 0x6C, 0xFF, 0x20, 0x76, 0x65,
+    0x72, 0x73, 0x69, 0x6F, 0x6E, 0xFF, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x20, 0x65, 0xFF, 0x6E,
+    0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x3D, 0xFF, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x20,
+    0xFF, 0x3F, 0x3E, 0x0D, 0x0A, 0x0D, 0x0A, 0x3C, 0x21, 0xFB, 0x2D, 0x2D, 0x07, 0x01, 0x54, 0x68,
+    0x65, 0x20, 0x4D, 0xFF, 0x49, 0x54, 0x20, 0x4C, 0x69, 0x63, 0x65, 0x6E, 0xAF, 0x73, 0x65, 0x20,
+    0x28, 0x0C, 0x00, 0x29, 0x18, 0x01, 0x43, 0xFF, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
+    0xFF, 0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0xF7, 0x34, 0x20, 0x2D, 0x06, 0x00, 0x32,
+    0x35, 0x20, 0x41, 0xFF, 0x6E, 0x64, 0x72, 0x65, 0x61, 0x73, 0x20, 0x4D, 0xFF, 0x65, 0x72, 0x6B,
+    0x6C, 0x65, 0x0D, 0x0A, 0x68, 0xFF, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0xFF, 0x77,
+    0x2E, 0x62, 0x6C, 0x75, 0x65, 0x2D, 0x61, 0xDF, 0x6E, 0x64, 0x69, 0x2E, 0x64, 0x18, 0x00, 0x76,
+    0x73, 0xF7, 0x63, 0x70, 0x40, 0x12, 0x0B, 0x0D, 0x0A, 0x50, 0x65, 0xFF, 0x72, 0x6D, 0x69, 0x73,
+    0x73, 0x69, 0x6F, 0x6E, 0xFF, 0x20, 0x69, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 0xFF, 0x62, 0x79,
+    0x20, 0x67, 0x72, 0x61, 0x6E, 0x74, 0xFF, 0x65, 0x64, 0x2C, 0x20, 0x66, 0x72, 0x65, 0x65, 0xFF,
+    0x20, 0x6F, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0xFF, 0x67, 0x65, 0x2C, 0x20, 0x74, 0x6F, 0x20,
+    0x61, 0x7F, 0x6E, 0x79, 0x20, 0x70, 0x65, 0x72, 0x73, 0x30, 0x00, 0xFF, 0x6F, 0x62, 0x74, 0x61,
+    0x69, 0x6E, 0x69, 0x6E, 0xFF, 0x67, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x70, 0x79, 0xFB, 0x0D, 0x0A,
+    0x2A, 0x00, 0x74, 0x68, 0x69, 0x73, 0x20, 0xFF, 0x73, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+    0xFE, 0x2D, 0x00, 0x64, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0xFF, 0x69, 0x61, 0x74, 0x65, 0x64,
+    0x20, 0x64, 0x6F, 0xFF, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0xFD, 0x69, 0x3F, 0x00,
+    0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x7F, 0x28, 0x74, 0x68, 0x65, 0x20, 0x22, 0x53, 0x31, 0x04,
+    0xFF, 0x22, 0x29, 0x2C, 0x20, 0x74, 0x6F, 0x20, 0x64, 0xFF, 0x65, 0x61, 0x6C, 0x0D, 0x0A, 0x69,
+    0x6E, 0x20, 0xFC, 0x1C, 0x01, 0x1B, 0x05, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0xFF, 0x75, 0x74,
+    0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0xFF, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0xFF,
+    0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0xFD, 0x67, 0x1E, 0x06, 0x6C, 0x69, 0x6D, 0x69,
+    0x74, 0x61, 0xFC, 0x1D, 0x01, 0x3E, 0x02, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0xFF, 0x0D, 0x0A,
+    0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0xFF, 0x2C, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x2C, 0x20, 0xDF,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x07, 0x01, 0x65, 0x72, 0xFD, 0x67, 0x14, 0x00, 0x70, 0x75, 0x62,
+    0x6C, 0x69, 0x73, 0xFF, 0x68, 0x2C, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0xAF, 0x69, 0x62, 0x75,
+    0x74, 0x14, 0x00, 0x73, 0x14, 0x01, 0x63, 0xFB, 0x65, 0x6E, 0x35, 0x01, 0x61, 0x6E, 0x64, 0x2F,
+    0x6F, 0xFF, 0x72, 0x20, 0x73, 0x65, 0x6C, 0x6C, 0x0D, 0x0A, 0xFF, 0x63, 0x6F, 0x70, 0x69, 0x65,
+    0x73, 0x20, 0x6F, 0xFF, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0xDF, 0x66, 0x74, 0x77,
+    0x61, 0x72, 0x24, 0x03, 0x20, 0x74, 0xFF, 0x6F, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74, 0xDE,
+    0x06, 0x01, 0x73, 0x6F, 0x6E, 0x73, 0x11, 0x01, 0x77, 0x68, 0xFB, 0x6F, 0x6D, 0x2B, 0x0A, 0x20,
+    0x69, 0x73, 0x0D, 0x0A, 0xFF, 0x66, 0x75, 0x72, 0x6E, 0x69, 0x73, 0x68, 0x65, 0xFE, 0x34, 0x02,
+    0x64, 0x6F, 0x20, 0x73, 0x6F, 0x2C, 0x20, 0x7F, 0x73, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x11,
+    0x01, 0xFE, 0x2F, 0x01, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0xFF, 0x6E, 0x67, 0x20, 0x63,
+    0x6F, 0x6E, 0x64, 0x69, 0xFF, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x0D, 0x0A, 0xF7, 0x0D, 0x0A,
+    0x54, 0x1C, 0x00, 0x61, 0x62, 0x6F, 0x76, 0xFD, 0x65, 0x18, 0x00, 0x70, 0x79, 0x72, 0x69, 0x67,
+    0x68, 0x7F, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x16, 0x00, 0xFB, 0x6E, 0x64, 0x3B, 0x00,
+    0x69, 0x73, 0x20, 0x70, 0x65, 0x9F, 0x72, 0x6D, 0x69, 0x73, 0x73, 0x33, 0x00, 0x1A, 0x05, 0x73,
+    0xFF, 0x68, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0xFF, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64,
+    0x65, 0x64, 0xFA, 0x08, 0x00, 0x20, 0x12, 0x00, 0x0D, 0x0A, 0x63, 0x6F, 0x70, 0xFF, 0x69, 0x65,
+    0x73, 0x20, 0x6F, 0x72, 0x20, 0x73, 0xFF, 0x75, 0x62, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x69, 0x7F,
+    0x61, 0x6C, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x3E, 0x00, 0xFE, 0x17, 0x00, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x53, 0xFF, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0xFF, 0x0D, 0x0A, 0x0D,
+    0x0A, 0x54, 0x48, 0x45, 0x20, 0xFF, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0xFF, 0x20,
+    0x49, 0x53, 0x20, 0x50, 0x52, 0x4F, 0x56, 0xFF, 0x49, 0x44, 0x45, 0x44, 0x20, 0x22, 0x41, 0x53,
+    0xFE, 0x0F, 0x00, 0x22, 0x2C, 0x20, 0x57, 0x49, 0x54, 0x48, 0xEF, 0x4F, 0x55, 0x54, 0x20, 0x21,
+    0x00, 0x52, 0x41, 0x4E, 0xFF, 0x54, 0x59, 0x20, 0x4F, 0x46, 0x20, 0x41, 0x4E, 0xFF, 0x59, 0x20,
+    0x4B, 0x49, 0x4E, 0x44, 0x2C, 0x20, 0xFF, 0x45, 0x58, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0xFF,
+    0x4F, 0x52, 0x0D, 0x0A, 0x49, 0x4D, 0x50, 0x4C, 0xFB, 0x49, 0x45, 0x14, 0x00, 0x49, 0x4E, 0x43,
+    0x4C, 0x55, 0xBF, 0x44, 0x49, 0x4E, 0x47, 0x20, 0x42, 0x38, 0x00, 0x4E, 0xFF, 0x4F, 0x54, 0x20,
+    0x4C, 0x49, 0x4D, 0x49, 0x54, 0xFF, 0x45, 0x44, 0x20, 0x54, 0x4F, 0x20, 0x54, 0x48, 0xFF, 0x45,
+    0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4E, 0xF7, 0x54, 0x49, 0x45, 0x38, 0x00, 0x46, 0x20, 0x4D,
+    0x45, 0xF7, 0x52, 0x43, 0x48, 0x0E, 0x00, 0x41, 0x42, 0x49, 0x4C, 0xFF, 0x49, 0x54, 0x59, 0x2C,
+    0x0D, 0x0A, 0x46, 0x49, 0xFF, 0x54, 0x4E, 0x45, 0x53, 0x53, 0x20, 0x46, 0x4F, 0xFF, 0x52, 0x20,
+    0x41, 0x20, 0x50, 0x41, 0x52, 0x54, 0xFF, 0x49, 0x43, 0x55, 0x4C, 0x41, 0x52, 0x20, 0x50, 0xFF,
+    0x55, 0x52, 0x50, 0x4F, 0x53, 0x45, 0x20, 0x41, 0xFF, 0x4E, 0x44, 0x20, 0x4E, 0x4F, 0x4E, 0x49,
+    0x4E, 0xFF, 0x46, 0x52, 0x49, 0x4E, 0x47, 0x45, 0x4D, 0x45, 0xBF, 0x4E, 0x54, 0x2E, 0x20, 0x49,
+    0x4E, 0x13, 0x00, 0x20, 0xFB, 0x45, 0x56, 0x0C, 0x00, 0x20, 0x53, 0x48, 0x41, 0x4C, 0xFF, 0x4C,
+    0x20, 0x54, 0x48, 0x45, 0x0D, 0x0A, 0x41, 0xFF, 0x55, 0x54, 0x48, 0x4F, 0x52, 0x53, 0x20, 0x4F,
+    0xFF, 0x52, 0x20, 0x43, 0x4F, 0x50, 0x59, 0x52, 0x49, 0xFF, 0x47, 0x48, 0x54, 0x20, 0x48, 0x4F,
+    0x4C, 0x44, 0xFD, 0x45, 0x14, 0x00, 0x42, 0x45, 0x20, 0x4C, 0x49, 0x41, 0xDF, 0x42, 0x4C, 0x45,
+    0x20, 0x46, 0x1F, 0x00, 0x41, 0x4E, 0xFF, 0x59, 0x20, 0x43, 0x4C, 0x41, 0x49, 0x4D, 0x2C, 0x7F,
+    0x20, 0x44, 0x41, 0x4D, 0x41, 0x47, 0x45, 0x35, 0x02, 0x7F, 0x4F, 0x54, 0x48, 0x45, 0x52, 0x0D,
+    0x0A, 0x27, 0x01, 0xFF, 0x49, 0x4C, 0x49, 0x54, 0x59, 0x2C, 0x20, 0x57, 0xBB, 0x48, 0x45, 0x13,
+    0x01, 0x20, 0x49, 0x4E, 0x32, 0x00, 0x20, 0xFF, 0x41, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x20, 0x4F,
+    0x7F, 0x46, 0x20, 0x43, 0x4F, 0x4E, 0x54, 0x52, 0x0E, 0x00, 0xBF, 0x2C, 0x20, 0x54, 0x4F, 0x52,
+    0x54, 0x3B, 0x06, 0x57, 0xFF, 0x49, 0x53, 0x45, 0x2C, 0x20, 0x41, 0x52, 0x49, 0xFF, 0x53, 0x49,
+    0x4E, 0x47, 0x20, 0x46, 0x52, 0x4F, 0xBF, 0x4D, 0x2C, 0x0D, 0x0A, 0x4F, 0x55, 0x20, 0x00, 0x46,
+    0xF6, 0x23, 0x01, 0x49, 0x4E, 0x38, 0x01, 0x4E, 0x45, 0x43, 0x54, 0xFF, 0x49, 0x4F, 0x4E, 0x20,
+    0x57, 0x49, 0x54, 0x48, 0xFD, 0x20, 0x35, 0x00, 0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x67, 0x41,
+    0x52, 0x45, 0x22, 0x01, 0x0F, 0x01, 0x55, 0x53, 0x0A, 0x02, 0xFD, 0x4F, 0x0B, 0x00, 0x52, 0x20,
+    0x44, 0x45, 0x41, 0x4C, 0xCF, 0x49, 0x4E, 0x47, 0x53, 0x3C, 0x01, 0x10, 0x00, 0x0D, 0x0A, 0x7E,
+    0x2D, 0x05, 0x2E, 0x0D, 0x0A, 0x0D, 0x0A, 0x2A, 0x00, 0x4C, 0xFF, 0x0D, 0x0A, 0x4D, 0x6F, 0x64,
+    0x75, 0x6C, 0x65, 0xFF, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x7F, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x66, 0x69, 0x10, 0x00, 0xFF, 0x28, 0x4D, 0x44, 0x46, 0x29, 0x20, 0x74, 0x65, 0xFF,
+    0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x0D, 0x0A, 0xF7, 0x0D, 0x0A, 0x2A, 0x00, 0x4C, 0x0D, 0x0A,
+    0x2D, 0x2D, 0xFF, 0x3E, 0x0D, 0x0A, 0x0D, 0x0A, 0x3C, 0x76, 0x73, 0xFF, 0x63, 0x70, 0x20, 0x78,
+    0x6D, 0x6C, 0x6E, 0x73, 0xFF, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0xFF, 0x2F, 0x77,
+    0x77, 0x77, 0x2E, 0x62, 0x6C, 0x75, 0xFF, 0x65, 0x2D, 0x61, 0x6E, 0x64, 0x69, 0x2E, 0x64, 0xEB,
+    0x65, 0x2F, 0x23, 0x01, 0x2F, 0x23, 0x00, 0x2D, 0x73, 0x63, 0xFF, 0x68, 0x65, 0x6D, 0x61, 0x2F,
+    0x6D, 0x64, 0x66, 0xDF, 0x2F, 0x31, 0x2E, 0x30, 0x22, 0x37, 0x03, 0x3A, 0x78, 0xFB, 0x73, 0x69,
+    0x3B, 0x0A, 0x77, 0x33, 0x2E, 0x6F, 0x72, 0xFF, 0x67, 0x2F, 0x32, 0x30, 0x30, 0x31, 0x2F, 0x58,
+    0xF7, 0x4D, 0x4C, 0x53, 0x34, 0x02, 0x2D, 0x69, 0x6E, 0x73, 0xDF, 0x74, 0x61, 0x6E, 0x63, 0x65,
+    0x35, 0x00, 0x73, 0x69, 0xFB, 0x3A, 0x73, 0x14, 0x02, 0x4C, 0x6F, 0x63, 0x61, 0x74, 0xF7, 0x69,
+    0x6F, 0x6E, 0x3E, 0x0A, 0x62, 0x6C, 0x75, 0x65, 0xFF, 0x2D, 0x61, 0x6E, 0x64, 0x69, 0x2E, 0x64,
+    0x65, 0xFF, 0x2F, 0x76, 0x73, 0x63, 0x70, 0x2F, 0x78, 0x6D, 0xFB, 0x6C, 0x2D, 0x30, 0x03, 0x2F,
+    0x6D, 0x64, 0x66, 0x2F, 0xCF, 0x31, 0x2E, 0x30, 0x20, 0x2F, 0x2C, 0x07, 0x01, 0x2E, 0x78, 0xFF,
+    0x73, 0x64, 0x22, 0x3E, 0x0D, 0x0A, 0x0D, 0x0A, 0xFD, 0x20, 0x00, 0x00, 0x3C, 0x6D, 0x6F, 0x64,
+    0x75, 0x6C, 0xF9, 0x65, 0x0F, 0x06, 0x13, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0x3E, 0xFF, 0x41, 0x72,
+    0x64, 0x75, 0x69, 0x6E, 0x6F, 0x20, 0x7F, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x3C, 0x2F, 0x13, 0x02,
+    0xFC, 0x23, 0x08, 0x37, 0x00, 0x65, 0x6C, 0x3E, 0x41, 0x3C, 0x2F, 0xFC, 0x08, 0x03, 0x19, 0x08,
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0xFF, 0x6E, 0x3E, 0x30, 0x2E, 0x31, 0x2E, 0x30, 0x3C, 0xF9,
+    0x2F, 0x0E, 0x05, 0x21, 0x08, 0x63, 0x68, 0x61, 0x6E, 0x67, 0xFF, 0x65, 0x64, 0x3E, 0x32, 0x30,
+    0x31, 0x35, 0x2D, 0x7F, 0x31, 0x31, 0x2D, 0x31, 0x36, 0x3C, 0x2F, 0x13, 0x05, 0xFE, 0x26, 0x08,
+    0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0xED, 0x74, 0x3D, 0x00, 0x20, 0x6C, 0x1D, 0x00, 0x3D,
+    0x22, 0x65, 0xFF, 0x6E, 0x22, 0x3E, 0x54, 0x68, 0x65, 0x20, 0x61, 0xFF, 0x72, 0x64, 0x75, 0x69,
+    0x6E, 0x6F, 0x20, 0x62, 0xFD, 0x6F, 0x09, 0x00, 0x20, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0xDE, 0x2C,
+    0x08, 0x3E, 0x0D, 0x0A, 0x20, 0x00, 0x04, 0x3C, 0x69, 0xFF, 0x6E, 0x66, 0x6F, 0x75, 0x72, 0x6C,
+    0x3E, 0x3C, 0xED, 0x2F, 0x09, 0x05, 0x0D, 0x0A, 0x1E, 0x08, 0x21, 0x2D, 0x2D, 0xFF, 0x20, 0x4D,
+    0x61, 0x78, 0x20, 0x70, 0x61, 0x63, 0xFF, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x73, 0x69, 0x7A, 0xFF,
+    0x65, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0xFF, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x72, 0x65,
+    0x63, 0xFF, 0x65, 0x69, 0x76, 0x65, 0x20, 0x2D, 0x2D, 0x3E, 0x7E, 0x35, 0x08, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2B, 0x01, 0x6F, 0x3E, 0x38, 0x3C, 0x2F, 0x0D, 0x08, 0x0D, 0x0A, 0x25, 0x08,
+    0xFF, 0x21, 0x2D, 0x2D, 0x20, 0x4D, 0x61, 0x6E, 0x75, 0xFF, 0x66, 0x61, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x72, 0x2F, 0x20, 0x2D, 0x2D, 0x3E, 0x1E, 0x08, 0x6D, 0x1A, 0x08, 0x17, 0x08, 0xFE, 0x1B,
+    0x02, 0x6E, 0x61, 0x6D, 0x65, 0x3E, 0x50, 0x65, 0xFD, 0x74, 0x34, 0x00, 0x50, 0x61, 0x72, 0x6B,
+    0x65, 0x72, 0xF3, 0x3C, 0x2F, 0x12, 0x02, 0x26, 0x0C, 0x61, 0x64, 0x64, 0x72, 0xE7, 0x65, 0x73,
+    0x73, 0x16, 0x0C, 0x1A, 0x02, 0x73, 0x74, 0x72, 0xFF, 0x65, 0x65, 0x74, 0x3E, 0x43, 0x68, 0x72,
+    0x79, 0xBF, 0x73, 0x74, 0x69, 0x65, 0x20, 0x53, 0x0F, 0x02, 0x20, 0x9F, 0x31, 0x38, 0x37, 0x3C,
+    0x2F, 0x1B, 0x04, 0x35, 0x10, 0x63, 0xFF, 0x69, 0x74, 0x79, 0x3E, 0x4D, 0x61, 0x6E, 0x68, 0x7F,
+    0x61, 0x74, 0x74, 0x61, 0x6E, 0x3C, 0x2F, 0x0F, 0x02, 0xFE, 0x27, 0x10, 0x70, 0x6F, 0x73, 0x74,
+    0x63, 0x6F, 0x64, 0xCF, 0x65, 0x3E, 0x3C, 0x2F, 0x0A, 0x06, 0x26, 0x10, 0x63, 0x6F, 0xFF, 0x75,
+    0x6E, 0x74, 0x72, 0x79, 0x3E, 0x55, 0x53, 0xE7, 0x41, 0x3C, 0x2F, 0x0C, 0x05, 0x27, 0x0B, 0x3C,
+    0x2F, 0x61, 0xBF, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x17, 0x0D, 0x74, 0xFF, 0x65, 0x6C, 0x65,
+    0x70, 0x68, 0x6F, 0x6E, 0x65, 0xFC, 0x18, 0x0C, 0x1C, 0x02, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x3F, 0x3E, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x0B, 0x04, 0x25, 0x10, 0xFF, 0x64, 0x65, 0x73, 0x63,
+    0x72, 0x69, 0x70, 0x74, 0xFF, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3F, 0x3D, 0x22,
+    0x65, 0x6E, 0x22, 0x20, 0x35, 0x03, 0x1B, 0x08, 0xFE, 0x3A, 0x0C, 0x3C, 0x2F, 0x74, 0x65, 0x6C,
+    0x65, 0x70, 0xEF, 0x68, 0x6F, 0x6E, 0x65, 0x19, 0x0D, 0x65, 0x6D, 0x61, 0xF3, 0x69, 0x6C, 0x14,
+    0x0C, 0x18, 0x02, 0x61, 0x64, 0x64, 0x72, 0xFF, 0x65, 0x73, 0x73, 0x3E, 0x2E, 0x2E, 0x2E, 0x3C,
+    0xF9, 0x2F, 0x0C, 0x05, 0x27, 0x10, 0x64, 0x65, 0x73, 0x63, 0x72, 0xFF, 0x69, 0x70, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x6C, 0xFF, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0xFF, 0x3E, 0x53,
+    0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0xFF, 0x20, 0x65, 0x6D, 0x61, 0x69, 0x6C, 0x3C, 0x2F, 0x2E,
+    0x24, 0x08, 0x3E, 0x0D, 0x0A, 0x3F, 0x0A, 0x2F, 0x22, 0x02, 0x15, 0x0D, 0xE7, 0x77, 0x65, 0x62,
+    0x12, 0x0C, 0x16, 0x02, 0x61, 0x64, 0x64, 0xFF, 0x72, 0x65, 0x73, 0x73, 0x3E, 0x68, 0x74, 0x74,
+    0x3F, 0x70, 0x3A, 0x2F, 0x2F, 0x3C, 0x2F, 0x10, 0x05, 0x2B, 0x10, 0xFF, 0x64, 0x65, 0x73, 0x63,
+    0x72, 0x69, 0x70, 0x74, 0xFF, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0xFF, 0x3D, 0x22,
+    0x65, 0x6E, 0x22, 0x3E, 0x4D, 0x61, 0x7F, 0x69, 0x6E, 0x20, 0x77, 0x65, 0x62, 0x20, 0x39, 0x04,
+    0x7B, 0x3C, 0x2F, 0x27, 0x08, 0x3E, 0x0D, 0x0A, 0x20, 0x00, 0x08, 0xF3, 0x3C, 0x2F, 0x28, 0x00,
+    0x13, 0x08, 0x3C, 0x2F, 0x6D, 0x61, 0xFF, 0x6E, 0x75, 0x66, 0x61, 0x63, 0x74, 0x75, 0x72, 0xF3,
+    0x65, 0x72, 0x18, 0x00, 0x1A, 0x08, 0x21, 0x2D, 0x2D, 0x20, 0xFF, 0x42, 0x6F, 0x6F, 0x74, 0x20,
+    0x6C, 0x6F, 0x61, 0xFF, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0xFF, 0x72, 0x6D, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x17, 0x2D, 0x2D, 0x3E, 0x29, 0x08, 0x62, 0x25, 0x00, 0x0F, 0x08,
+    0x13, 0x02, 0xFF, 0x61, 0x6C, 0x67, 0x6F, 0x72, 0x69, 0x74, 0x68, 0x7F, 0x6D, 0x3E, 0x32, 0x35,
+    0x35, 0x3C, 0x2F, 0x0E, 0x07, 0xFE, 0x27, 0x0C, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x69, 0x3F,
+    0x7A, 0x65, 0x3E, 0x30, 0x3C, 0x2F, 0x0C, 0x07, 0x25, 0x11, 0x1F, 0x63, 0x6F, 0x75, 0x6E, 0x74,
+    0x26, 0x06, 0x0D, 0x03, 0x27, 0x07, 0xE6, 0x16, 0x00, 0x6F, 0x6F, 0x10, 0x01, 0x12, 0x08, 0x21,
+    0x2D, 0x2D, 0xFF, 0x20, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0xFF, 0x72, 0x20, 0x73, 0x70,
+    0x61, 0x63, 0x65, 0x20, 0x2B, 0x2D, 0x2D, 0x33, 0x09, 0x72, 0x1C, 0x04, 0x73, 0x37, 0x0A, 0x3B,
+    0x06, 0xFD, 0x2A, 0x00, 0x06, 0x20, 0x50, 0x61, 0x67, 0x65, 0x20, 0x9D, 0x30, 0x11, 0x09, 0x2D,
+    0x2D, 0x3E, 0x32, 0x0B, 0x0D, 0x0B, 0x3C, 0xF7, 0x21, 0x2D, 0x2D, 0x2E, 0x09, 0x50, 0x61, 0x67,
+    0x65, 0x3B, 0x20, 0x31, 0x11, 0x09, 0x2D, 0x2D, 0x3E, 0x32, 0x0B, 0x0D, 0x0B, 0xFF, 0x3C, 0x21,
+    0x2D, 0x2D, 0x20, 0x55, 0x73, 0x65, 0xFF, 0x64, 0x20, 0x62, 0x79, 0x20, 0x64, 0x65, 0x63, 0xFF,
+    0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0xFF, 0x74, 0x72, 0x69, 0x78, 0x20, 0x28, 0x73,
+    0x74, 0xFF, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x29, 0x20, 0xE7, 0x2D, 0x2D, 0x3E, 0x38, 0x0B,
+    0x0D, 0x0B, 0x3C, 0x21, 0x2D, 0xF7, 0x2D, 0x20, 0x2A, 0x00, 0x06, 0x20, 0x50, 0x61, 0x67, 0x77,
+    0x65, 0x20, 0x32, 0x11, 0x09, 0x2D, 0x2D, 0x3E, 0x32, 0x0B, 0xFE, 0x0D, 0x0B, 0x3C, 0x21, 0x2D,
+    0x2D, 0x20, 0x49, 0x66, 0xFF, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0xFF, 0x2C, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0xFF, 0x79, 0x20, 0x64, 0x65, 0x63, 0x69, 0x73, 0x69, 0xFF,
+    0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x72, 0x69, 0xFF, 0x78, 0x20, 0x4E, 0x47, 0x20, 0x2D, 0x2D,
+    0x3E, 0xFC, 0x3C, 0x0B, 0x0D, 0x07, 0x3C, 0x2F, 0x72, 0x65, 0x67, 0x69, 0x9F, 0x73, 0x74, 0x65,
+    0x72, 0x73, 0x23, 0x00, 0x17, 0x08, 0x61, 0xFF, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x69,
+    0xF3, 0x6F, 0x6E, 0x19, 0x0B, 0x1D, 0x02, 0x21, 0x2D, 0x2D, 0x20, 0xFD, 0x2A, 0x00, 0x06, 0x20,
+    0x50, 0x61, 0x67, 0x65, 0x20, 0x2D, 0x30, 0x11, 0x09, 0x2D, 0x2D, 0x34, 0x23, 0x31, 0x34, 0x0E,
+    0x32, 0x09, 0xFE, 0x0D, 0x0B, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x55, 0x73, 0xFF, 0x65, 0x64, 0x20,
+    0x62, 0x79, 0x20, 0x64, 0x65, 0xFF, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0xFF, 0x61,
+    0x74, 0x72, 0x69, 0x78, 0x20, 0x28, 0x73, 0xFF, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x29,
+    0xCF, 0x20, 0x2D, 0x2D, 0x3E, 0x38, 0x0B, 0x0D, 0x0B, 0x3C, 0x21, 0xEF, 0x2D, 0x2D, 0x20, 0x2A,
+    0x00, 0x06, 0x20, 0x50, 0x61, 0xEF, 0x67, 0x65, 0x20, 0x32, 0x11, 0x09, 0x2D, 0x2D, 0x3E, 0xFC,
+    0x32, 0x0B, 0x0D, 0x0B, 0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x49, 0xFF, 0x66, 0x20, 0x65, 0x6E, 0x61,
+    0x62, 0x6C, 0x65, 0xFF, 0x64, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0xFF, 0x62, 0x79, 0x20,
+    0x64, 0x65, 0x63, 0x69, 0x73, 0xFF, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x72, 0xFF, 0x69,
+    0x78, 0x20, 0x4E, 0x47, 0x20, 0x2D, 0x2D, 0xF9, 0x3E, 0x3C, 0x0B, 0x0D, 0x07, 0x3C, 0x2F, 0x61,
+    0x62, 0x73, 0x5F, 0x74, 0x72, 0x61, 0x63, 0x74, 0x32, 0x00, 0x73, 0x26, 0x00, 0x3E, 0x1A, 0x08,
+    0x61, 0x6C, 0x61, 0x72, 0x6D, 0x12, 0x0A, 0x16, 0x02, 0xFF, 0x62, 0x69, 0x74, 0x20, 0x70, 0x6F,
+    0x73, 0x3D, 0xCF, 0x22, 0x37, 0x22, 0x3E, 0x1A, 0x0B, 0x1E, 0x02, 0x6E, 0x61, 0xFF, 0x6D, 0x65,
+    0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0xFF, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x4E, 0x6F, 0x74, 0x7F,
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x3C, 0x2F, 0x18, 0x01, 0xFE, 0x30, 0x11, 0x64, 0x65, 0x73, 0x63,
+    0x72, 0x69, 0x70, 0xEF, 0x74, 0x69, 0x6F, 0x6E, 0x37, 0x10, 0x2E, 0x3C, 0x2F, 0x7C, 0x20, 0x08,
+    0x3F, 0x0C, 0x3C, 0x2F, 0x62, 0x69, 0x74, 0x13, 0x00, 0xFC, 0x15, 0x0C, 0x14, 0x00, 0x20, 0x70,
+    0x6F, 0x73, 0x3D, 0x22, 0xF3, 0x36, 0x22, 0x30, 0x0C, 0x1E, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0xFF,
+    0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0xFF, 0x6E, 0x22, 0x3E, 0x4E, 0x6F, 0x74, 0x20,
+    0x75, 0x9F, 0x73, 0x65, 0x64, 0x3C, 0x2F, 0x18, 0x01, 0x30, 0x11, 0x64, 0xFF, 0x65, 0x73, 0x63,
+    0x72, 0x69, 0x70, 0x74, 0x69, 0x3B, 0x6F, 0x6E, 0x37, 0x10, 0x2E, 0x3C, 0x2F, 0x20, 0x08, 0x3F,
+    0x0C, 0x1F, 0x3C, 0x2F, 0x62, 0x69, 0x74, 0x13, 0x00, 0x15, 0x0C, 0x14, 0x00, 0xFF, 0x20, 0x70,
+    0x6F, 0x73, 0x3D, 0x22, 0x35, 0x22, 0xFC, 0x30, 0x0C, 0x1E, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x6C, 0xFF, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0xFF, 0x3E, 0x4E, 0x6F, 0x74, 0x20,
+    0x75, 0x73, 0x65, 0xE7, 0x64, 0x3C, 0x2F, 0x18, 0x01, 0x30, 0x11, 0x64, 0x65, 0x73, 0xFF, 0x63,
+    0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0xCE, 0x37, 0x10, 0x2E, 0x3C, 0x2F, 0x20, 0x08, 0x3F,
+    0x0C, 0x3C, 0x2F, 0xC7, 0x62, 0x69, 0x74, 0x13, 0x00, 0x15, 0x0C, 0x14, 0x00, 0x20, 0x70, 0x3F,
+    0x6F, 0x73, 0x3D, 0x22, 0x34, 0x22, 0x30, 0x0C, 0x1E, 0x02, 0xFF, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x6C, 0x61, 0x6E, 0xFF, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x4E, 0xFF, 0x6F, 0x74, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x3C, 0xF9, 0x2F, 0x18, 0x01, 0x30, 0x11, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0xBF, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x37, 0x10, 0x2E, 0xF3, 0x3C, 0x2F, 0x20, 0x08, 0x3F,
+    0x0C, 0x3C, 0x2F, 0x62, 0x69, 0xF1, 0x74, 0x13, 0x00, 0x15, 0x0C, 0x14, 0x00, 0x20, 0x70, 0x6F,
+    0x73, 0xCF, 0x3D, 0x22, 0x33, 0x22, 0x30, 0x0C, 0x1E, 0x02, 0x6E, 0x61, 0xFF, 0x6D, 0x65, 0x20,
+    0x6C, 0x61, 0x6E, 0x67, 0x3D, 0xFF, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x4E, 0x6F, 0x74, 0x7F, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x3C, 0x2F, 0x18, 0x01, 0xFE, 0x30, 0x11, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0xEF, 0x74, 0x69, 0x6F, 0x6E, 0x37, 0x10, 0x2E, 0x3C, 0x2F, 0x7C, 0x20, 0x08, 0x3F,
+    0x0C, 0x3C, 0x2F, 0x62, 0x69, 0x74, 0x13, 0x00, 0xFC, 0x15, 0x0C, 0x14, 0x00, 0x20, 0x70, 0x6F,
+    0x73, 0x3D, 0x22, 0xF3, 0x32, 0x22, 0x30, 0x0C, 0x1E, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0xFF, 0x20,
+    0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0xFF, 0x6E, 0x22, 0x3E, 0x4E, 0x6F, 0x74, 0x20, 0x75,
+    0x9F, 0x73, 0x65, 0x64, 0x3C, 0x2F, 0x18, 0x01, 0x30, 0x11, 0x64, 0xFF, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x69, 0x3B, 0x6F, 0x6E, 0x37, 0x10, 0x2E, 0x3C, 0x2F, 0x20, 0x08, 0x3F, 0x0C,
+    0x1F, 0x3C, 0x2F, 0x62, 0x69, 0x74, 0x13, 0x00, 0x15, 0x0C, 0x14, 0x00, 0xFF, 0x20, 0x70, 0x6F,
+    0x73, 0x3D, 0x22, 0x31, 0x22, 0xFC, 0x30, 0x0C, 0x1E, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6C,
+    0xFF, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0xFF, 0x3E, 0x4E, 0x6F, 0x74, 0x20, 0x75,
+    0x73, 0x65, 0xE7, 0x64, 0x3C, 0x2F, 0x18, 0x01, 0x30, 0x11, 0x64, 0x65, 0x73, 0xFF, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0xCE, 0x37, 0x10, 0x2E, 0x3C, 0x2F, 0x20, 0x08, 0x3F, 0x0C,
+    0x3C, 0x2F, 0xC7, 0x62, 0x69, 0x74, 0x13, 0x00, 0x15, 0x0C, 0x14, 0x00, 0x20, 0x70, 0x3F, 0x6F,
+    0x73, 0x3D, 0x22, 0x30, 0x22, 0x30, 0x0C, 0x1E, 0x02, 0xFF, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6C,
+    0x61, 0x6E, 0xFF, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x4E, 0xFF, 0x6F, 0x74, 0x20, 0x75,
+    0x73, 0x65, 0x64, 0x3C, 0xF9, 0x2F, 0x18, 0x01, 0x30, 0x11, 0x64, 0x65, 0x73, 0x63, 0x72, 0xBF,
+    0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x37, 0x10, 0x2E, 0xF3, 0x3C, 0x2F, 0x20, 0x08, 0x3F, 0x0C,
+    0x3C, 0x2F, 0x62, 0x69, 0xF9, 0x74, 0x13, 0x00, 0x15, 0x07, 0x3C, 0x2F, 0x61, 0x6C, 0x61, 0xFB,
+    0x72, 0x6D, 0x13, 0x0B, 0x21, 0x2D, 0x2D, 0x20, 0x44, 0xFF, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F,
+    0x6E, 0x20, 0xFF, 0x6D, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x2D, 0x8B, 0x2D, 0x3E, 0x21, 0x08,
+    0x64, 0x15, 0x03, 0x36, 0x0A, 0x18, 0x02, 0x6C, 0xFF, 0x65, 0x76, 0x65, 0x6C, 0x3E, 0x31, 0x3C,
+    0x2F, 0xFC, 0x08, 0x03, 0x1D, 0x0C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0xFF, 0x70, 0x61, 0x67,
+    0x65, 0x3D, 0x22, 0x31, 0x22, 0xFF, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0xFF, 0x22,
+    0x30, 0x22, 0x20, 0x69, 0x6E, 0x64, 0x65, 0xFF, 0x78, 0x65, 0x64, 0x3D, 0x22, 0x66, 0x61, 0x6C,
+    0xDF, 0x73, 0x65, 0x22, 0x20, 0x2F, 0x3A, 0x0D, 0x72, 0x6F, 0xFF, 0x77, 0x63, 0x6E, 0x74, 0x3E,
+    0x31, 0x30, 0x3C, 0xED, 0x2F, 0x0A, 0x04, 0x0D, 0x0A, 0x22, 0x0C, 0x61, 0x63, 0x74, 0xFF, 0x69,
+    0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x64, 0x65, 0xFF, 0x3D, 0x22, 0x30, 0x78, 0x30, 0x30, 0x22, 0x3E,
+    0xFC, 0x21, 0x0B, 0x25, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6C, 0xFF, 0x61, 0x6E, 0x67, 0x3D,
+    0x22, 0x65, 0x6E, 0x22, 0xFF, 0x3E, 0x4E, 0x6F, 0x20, 0x6F, 0x70, 0x65, 0x72, 0xCD, 0x61, 0x3A,
+    0x01, 0x3C, 0x2F, 0x1C, 0x01, 0x34, 0x11, 0x64, 0x65, 0x9F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x24,
+    0x01, 0x3B, 0x08, 0x54, 0xBF, 0x68, 0x69, 0x73, 0x20, 0x61, 0x63, 0x15, 0x02, 0x64, 0xFF, 0x6F,
+    0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x68, 0xBF, 0x69, 0x6E, 0x67, 0x2E, 0x3C, 0x2F, 0x30, 0x08,
+    0x3E, 0xF7, 0x0D, 0x0A, 0x20, 0x00, 0x0C, 0x3C, 0x70, 0x61, 0x72, 0xF3, 0x61, 0x6D, 0x18, 0x10,
+    0x1C, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0xE7, 0x3E, 0x3C, 0x2F, 0x06, 0x02, 0x22, 0x14, 0x64, 0x65,
+    0x73, 0xFF, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0xFF, 0x20, 0x6C, 0x61, 0x6E, 0x67,
+    0x3D, 0x22, 0x65, 0xE3, 0x6E, 0x22, 0x33, 0x00, 0x17, 0x08, 0x3A, 0x16, 0x61, 0x74, 0x61, 0xFF,
+    0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0xE7, 0x22, 0x31, 0x22, 0x26, 0x14, 0x2A, 0x02,
+    0x6E, 0x61, 0x6D, 0xCF, 0x65, 0x3E, 0x3C, 0x2F, 0x06, 0x02, 0x26, 0x18, 0x64, 0x65, 0xFF, 0x73,
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0xFF, 0x6E, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22,
+    0x87, 0x65, 0x6E, 0x22, 0x37, 0x00, 0x17, 0x08, 0x3E, 0x14, 0x23, 0x00, 0x61, 0xFB, 0x74, 0x61,
+    0x1C, 0x10, 0x3C, 0x2F, 0x70, 0x61, 0x72, 0xFB, 0x61, 0x6D, 0x19, 0x0C, 0x3C, 0x2F, 0x61, 0x63,
+    0x74, 0xE7, 0x69, 0x6F, 0x6E, 0x16, 0x00, 0x18, 0x07, 0x3C, 0x2F, 0x64, 0xBF, 0x6D, 0x61, 0x74,
+    0x72, 0x69, 0x78, 0x15, 0x0B, 0x65, 0x9F, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x13, 0x0A, 0x17, 0x07,
+    0x20, 0xFF, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x32, 0xFF, 0x30, 0x22, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x3D, 0xCF, 0x22, 0x39, 0x22, 0x3E, 0x28, 0x0B, 0x2C, 0x02, 0x6E, 0x61, 0xFF, 0x6D,
+    0x65, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0xFF, 0x22, 0x65, 0x6E, 0x22, 0x3E, 0x4E, 0x6F, 0x64,
+    0xFF, 0x65, 0x20, 0x68, 0x65, 0x61, 0x72, 0x74, 0x62, 0x9F, 0x65, 0x61, 0x74, 0x3C, 0x2F, 0x1E,
+    0x01, 0x36, 0x11, 0x64, 0xFF, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0xFB, 0x6F, 0x6E,
+    0x3D, 0x08, 0x54, 0x68, 0x65, 0x20, 0x6E, 0xFF, 0x6F, 0x64, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x64,
+    0x7F, 0x73, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x0B, 0x00, 0xFF, 0x63, 0x6F, 0x6E, 0x64, 0x20,
+    0x61, 0x20, 0x68, 0xFF, 0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0xF7, 0x2E, 0x3C, 0x2F,
+    0x3F, 0x08, 0x3E, 0x0D, 0x0A, 0x20, 0xFE, 0x00, 0x0C, 0x3C, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69,
+    0x3F, 0x74, 0x79, 0x3E, 0x37, 0x3C, 0x2F, 0x0B, 0x06, 0x27, 0x10, 0xFF, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x6F, 0x66, 0x66, 0x7F, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x30, 0x22, 0x22, 0x10, 0xFE, 0x26,
+    0x02, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6C, 0x61, 0xFF, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22,
+    0x3E, 0xFF, 0x4E, 0x6F, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0xF3, 0x3C, 0x2F, 0x18, 0x01, 0x34,
+    0x15, 0x64, 0x65, 0x73, 0x63, 0x7F, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3B, 0x12, 0xEE,
+    0x1F, 0x08, 0x3E, 0x0D, 0x0A, 0x3E, 0x0E, 0x2F, 0x64, 0x61, 0xF3, 0x74, 0x61, 0x18, 0x11, 0x17,
+    0x01, 0x20, 0x6F, 0x66, 0x66, 0xFF, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x31, 0x22, 0x20, 0xFC, 0x23,
+    0x10, 0x27, 0x02, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6C, 0xFF, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65,
+    0x6E, 0x22, 0x7F, 0x3E, 0x5A, 0x6F, 0x6E, 0x65, 0x3C, 0x2F, 0x14, 0x01, 0xFE, 0x30, 0x15, 0x64,
+    0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0xEF, 0x74, 0x69, 0x6F, 0x6E, 0x37, 0x0C, 0x20, 0x6F, 0x66,
+    0xFF, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x6F, 0x64, 0xEF, 0x65, 0x2E, 0x3C, 0x2F, 0x28, 0x08,
+    0x3E, 0x0D, 0x0A, 0x39, 0x20, 0x00, 0x0C, 0x1F, 0x00, 0x61, 0x74, 0x61, 0x18, 0x11, 0x17, 0x01,
+    0xFF, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0xCF, 0x22, 0x32, 0x22, 0x20, 0x23, 0x10,
+    0x27, 0x02, 0x6E, 0x61, 0xFF, 0x6D, 0x65, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0xFF, 0x22, 0x65,
+    0x6E, 0x22, 0x3E, 0x53, 0x75, 0x62, 0x7F, 0x2D, 0x7A, 0x6F, 0x6E, 0x65, 0x3C, 0x2F, 0x18, 0x01,
+    0xFE, 0x34, 0x15, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0xEF, 0x74, 0x69, 0x6F, 0x6E, 0x3B,
+    0x10, 0x20, 0x6F, 0x66, 0xFF, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x6F, 0x64, 0xEF, 0x65, 0x2E,
+    0x3C, 0x2F, 0x2C, 0x08, 0x3E, 0x0D, 0x0A, 0xB9, 0x20, 0x00, 0x0C, 0x1F, 0x00, 0x61, 0x74, 0x61,
+    0x18, 0x0C, 0x3C, 0x3F, 0x2F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x15, 0x00, 0x17, 0x07, 0xFA, 0x13,
+    0x04, 0x73, 0x14, 0x0B, 0x73, 0x65, 0x74, 0x75, 0x70, 0xE6, 0x3D, 0x08, 0x3C, 0x2F, 0x11, 0x0D,
+    0x09, 0x03, 0x3C, 0x2F, 0x6D, 0xDF, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x3D, 0x02, 0x3C, 0x2F, 0x07,
+    0x76, 0x73, 0x63, 0x23, 0x01
+};
+
+#endif  /* __VSCP_MDF_DATA_H__ */
@@ -41,7 +41,9 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_portable.h"
+#include "../core/vscp_instance.h"
 #include "../core/vscp_core.h"
+#include "../core/vscp_util.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -51,14 +53,59 @@
     CONSTANTS
 *******************************************************************************/
 
+/* The cyclic buffer handles its storage size with 8 bit. */
+VSCP_UTIL_COMPILE_TIME_ASSERT(256 > (VSCP_CONFIG_RX_QUEUE_STORAGE_NUM * sizeof(vscp_RxMessage)));
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_PORTABLE_INST      (vscp_portable_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Data of a framework instance */
+typedef struct
+{
+    /** State of the status lamp. */
+    VSCP_LAMP_STATE         statusLampState;
+
+    /** Cyclic buffer instance for received messages. */
+    vscp_util_CyclicBuffer  rxQueue;
+
+    /** Message storage of the receive cyclic buffer. */
+    vscp_RxMessage          rxQueueStorage[VSCP_CONFIG_RX_QUEUE_STORAGE_NUM];
+
+    /** Number of received messages, which were dropped because the queue was full. */
+    uint8_t                 rxOverflowCnt;
+
+    /** Max. number of messages, which were in the queue at the same time. */
+    uint8_t                 rxQueuePeak;
+
+    /** Receive filter: Class mask */
+    uint16_t                rxClassMask;
+
+    /** Receive filter: Class filter */
+    uint16_t                rxClassFilter;
+
+    /** Receive filter: Type mask */
+    uint8_t                 rxTypeMask;
+
+    /** Receive filter: Type filter */
+    uint8_t                 rxTypeFilter;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+    /** Level II event callback */
+    vscp_portable_L2Event   l2EventFunc;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
+} vscp_portable_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
@@ -67,14 +114,8 @@
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** State of the status lamp. */
-static VSCP_LAMP_STATE  vscp_portable_statusLampState   = VSCP_LAMP_STATE_OFF;
-
-/** Receive message storage */
-static vscp_RxMessage   vscp_portable_rxMsg;
-
-/** Flag which notify about a received message */
-static BOOL             vscp_portable_isReceived        = FALSE;
+/** Data of all framework instances */
+static vscp_portable_Instance  vscp_portable_instances[VSCP_INSTANCE_NUM];
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -89,6 +130,15 @@ static BOOL             vscp_portable_isReceived        = FALSE;
  */
 extern void vscp_portable_init(void)
 {
+    /* Initialize the cyclic buffer for the received messages */
+    vscp_util_cyclicBufferInit( &VSCP_PORTABLE_INST.rxQueue,
+                                VSCP_PORTABLE_INST.rxQueueStorage,
+                                sizeof(VSCP_PORTABLE_INST.rxQueueStorage),
+                                sizeof(vscp_RxMessage));
+
+    VSCP_PORTABLE_INST.rxOverflowCnt = 0;
+    VSCP_PORTABLE_INST.rxQueuePeak   = 0;
+
     /* Implement your code here ... */
 
     return;
@@ -111,7 +161,7 @@ extern void vscp_portable_restoreFactoryDefaultSettings(void)
  */
 extern void vscp_portable_setLampState(VSCP_LAMP_STATE state)
 {
-    vscp_portable_statusLampState = state;
+    VSCP_PORTABLE_INST.statusLampState = state;
     return;
 }
 
@@ -122,7 +172,7 @@ extern void vscp_portable_setLampState(VSCP_LAMP_STATE state)
  */
 extern VSCP_LAMP_STATE vscp_portable_getLampState(void)
 {
-    return vscp_portable_statusLampState;
+    return VSCP_PORTABLE_INST.statusLampState;
 }
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_IDLE_CALLOUT )
@@ -203,11 +253,73 @@ extern void vscp_portable_bootLoaderRequest(void)
  */
 extern void vscp_portable_provideEvent(vscp_RxMessage const * const msg)
 {
-    vscp_portable_rxMsg         = *msg;
-    vscp_portable_isReceived    = TRUE;
+    uint8_t level   = 0;
+
+    if (NULL == msg)
+    {
+        return;
+    }
+
+    /* Not of interest for the application? */
+    if ((VSCP_PORTABLE_INST.rxClassFilter != (VSCP_PORTABLE_INST.rxClassMask & msg->vscpClass)) ||
+        (VSCP_PORTABLE_INST.rxTypeFilter != (VSCP_PORTABLE_INST.rxTypeMask & msg->vscpType)))
+    {
+        return;
+    }
+
+    if (0 == vscp_util_cyclicBufferWrite(&VSCP_PORTABLE_INST.rxQueue, msg, 1))
+    {
+        if (255 > VSCP_PORTABLE_INST.rxOverflowCnt)
+        {
+            ++VSCP_PORTABLE_INST.rxOverflowCnt;
+        }
+    }
+    else
+    {
+        level = (VSCP_PORTABLE_INST.rxQueue.writeIndex + VSCP_PORTABLE_INST.rxQueue.num - VSCP_PORTABLE_INST.rxQueue.readIndex) % VSCP_PORTABLE_INST.rxQueue.num;
+
+        if (VSCP_PORTABLE_INST.rxQueuePeak < level)
+        {
+            VSCP_PORTABLE_INST.rxQueuePeak = level;
+        }
+    }
+
     return;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function sets the callback, which gets the received Level II events.
+ *
+ * @param[in]   func    Level II event callback
+ */
+extern void vscp_portable_setL2EventFunc(vscp_portable_L2Event func)
+{
+    VSCP_PORTABLE_INST.l2EventFunc = func;
+
+    return;
+}
+
+/**
+ * This function provides received Level II events, which are no Level I
+ * events. The Level I events are provided via vscp_portable_provideEvent().
+ *
+ * @param[in]   msg Message
+ */
+extern void vscp_portable_provideL2Event(vscp_L2Message const * const msg)
+{
+    if ((NULL != msg) &&
+        (NULL != VSCP_PORTABLE_INST.l2EventFunc))
+    {
+        VSCP_PORTABLE_INST.l2EventFunc(msg);
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION )
 
 /**
@@ -303,17 +415,82 @@ extern BOOL vscp_portable_read(vscp_RxMessage * const msg)
 
     if (NULL != msg)
     {
-        if (TRUE == vscp_portable_isReceived)
+        if (0 < vscp_util_cyclicBufferRead(&VSCP_PORTABLE_INST.rxQueue, msg, 1))
         {
-            *msg                        = vscp_portable_rxMsg;
-            status                      = TRUE;
-            vscp_portable_isReceived    = FALSE;
+            status = TRUE;
         }
     }
     
     return status;
 }
 
+/**
+ * This function reads several received VSCP messages at once.
+ *
+ * @param[out]  msgs    Message buffer
+ * @param[in]   maxNum  Max. number of messages, which fit into the buffer
+ * @return Number of read messages
+ */
+extern uint8_t  vscp_portable_readMultiple(vscp_RxMessage * const msgs, uint8_t maxNum)
+{
+    return vscp_util_cyclicBufferRead(&VSCP_PORTABLE_INST.rxQueue, msgs, maxNum);
+}
+
+/**
+ * This function sets the receive filter. Only received VSCP messages which pass
+ * the filter are stored in the receive queue. A mask of 0 accepts every class
+ * respectively type, which is the default.
+ *
+ * A message passes, if (class & classMask) == classFilter and
+ * (type & typeMask) == typeFilter.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ */
+extern void vscp_portable_setRxFilter(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter)
+{
+    VSCP_PORTABLE_INST.rxClassMask   = classMask;
+    VSCP_PORTABLE_INST.rxClassFilter = classFilter & classMask;
+    VSCP_PORTABLE_INST.rxTypeMask    = typeMask;
+    VSCP_PORTABLE_INST.rxTypeFilter  = typeFilter & typeMask;
+
+    return;
+}
+
+/**
+ * This function returns the number of received messages, which were dropped
+ * because the receive queue was full.
+ * Note, that calling this function clears the overflow counter.
+ *
+ * @return Number of dropped messages
+ */
+extern uint8_t  vscp_portable_getRxOverflows(void)
+{
+    uint8_t num = VSCP_PORTABLE_INST.rxOverflowCnt;
+
+    VSCP_PORTABLE_INST.rxOverflowCnt = 0;
+
+    return num;
+}
+
+/**
+ * This function returns the max. number of messages, which were in the receive
+ * queue at the same time. Use it to dimension VSCP_CONFIG_RX_QUEUE_STORAGE_NUM.
+ * Note, that calling this function clears the value.
+ *
+ * @return Max. number of queued messages
+ */
+extern uint8_t  vscp_portable_getRxQueuePeak(void)
+{
+    uint8_t num = VSCP_PORTABLE_INST.rxQueuePeak;
+
+    VSCP_PORTABLE_INST.rxQueuePeak = 0;
+
+    return num;
+}
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
@@ -88,6 +88,12 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/**
+ * Level II event callback. The message and its data are only valid during
+ * the call.
+ */
+typedef void (*vscp_portable_L2Event)(vscp_L2Message const * const msg);
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -171,6 +177,25 @@ extern void vscp_portable_bootLoaderRequest(void);
  */
 extern void vscp_portable_provideEvent(vscp_RxMessage const * const msg);
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function sets the callback, which gets the received Level II events.
+ *
+ * @param[in]   func    Level II event callback
+ */
+extern void vscp_portable_setL2EventFunc(vscp_portable_L2Event func);
+
+/**
+ * This function provides received Level II events, which are no Level I
+ * events. The Level I events are provided via vscp_portable_provideEvent().
+ *
+ * @param[in]   msg Message
+ */
+extern void vscp_portable_provideL2Event(vscp_L2Message const * const msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PROTOCOL_EVENT_NOTIFICATION )
 
 /**
@@ -238,6 +263,48 @@ extern BOOL vscp_portable_sendNodeHeartbeatEvent();
  */
 extern BOOL vscp_portable_read(vscp_RxMessage * const msg);
 
+/**
+ * This function reads several received VSCP messages at once.
+ *
+ * @param[out]  msgs    Message buffer
+ * @param[in]   maxNum  Max. number of messages, which fit into the buffer
+ * @return Number of read messages
+ */
+extern uint8_t  vscp_portable_readMultiple(vscp_RxMessage * const msgs, uint8_t maxNum);
+
+/**
+ * This function sets the receive filter. Only received VSCP messages which pass
+ * the filter are stored in the receive queue. A mask of 0 accepts every class
+ * respectively type, which is the default.
+ *
+ * A message passes, if (class & classMask) == classFilter and
+ * (type & typeMask) == typeFilter.
+ *
+ * @param[in]   classMask   Class mask
+ * @param[in]   classFilter Class filter
+ * @param[in]   typeMask    Type mask
+ * @param[in]   typeFilter  Type filter
+ */
+extern void vscp_portable_setRxFilter(uint16_t classMask, uint16_t classFilter, uint8_t typeMask, uint8_t typeFilter);
+
+/**
+ * This function returns the number of received messages, which were dropped
+ * because the receive queue was full.
+ * Note, that calling this function clears the overflow counter.
+ *
+ * @return Number of dropped messages
+ */
+extern uint8_t  vscp_portable_getRxOverflows(void);
+
+/**
+ * This function returns the max. number of messages, which were in the receive
+ * queue at the same time. Use it to dimension VSCP_CONFIG_RX_QUEUE_STORAGE_NUM.
+ * Note, that calling this function clears the value.
+ *
+ * @return Max. number of queued messages
+ */
+extern uint8_t  vscp_portable_getRxQueuePeak(void);
+
 #ifdef __cplusplus
 }
 #endif
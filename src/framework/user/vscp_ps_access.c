@@ -41,6 +41,8 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_ps_access.h"
+#include "../core/vscp_instance.h"
+#include "../core/vscp_ps.h"
 #include "avr/eeprom.h"
 
 #include <stdlib.h>
@@ -53,10 +55,32 @@
     CONSTANTS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Size of the persistent memory of a single framework instance. The instances
+ * are stored one after another. If the application stores data behind the
+ * framework data, adapt it accordingly.
+ */
+#define VSCP_PS_ACCESS_INSTANCE_SIZE    VSCP_PS_ADDR_NEXT
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_MULTI_INSTANCE )
+
+/** Get the address of the selected framework instance. */
+#define VSCP_PS_ACCESS_ADDR(__addr)     ((__addr) + VSCP_INSTANCE * VSCP_PS_ACCESS_INSTANCE_SIZE)
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
+/** Get the address of the selected framework instance. */
+#define VSCP_PS_ACCESS_ADDR(__addr)     (__addr)
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_MULTI_INSTANCE ) */
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
@@ -97,7 +121,7 @@ extern void vscp_ps_access_init(void)
  */
 extern uint8_t  vscp_ps_access_read8(uint16_t addr)
 {
-    return eeprom_read_byte((const uint8_t*)addr);
+    return eeprom_read_byte((const uint8_t*)(uintptr_t)VSCP_PS_ACCESS_ADDR(addr));
 }
 
 /**
@@ -108,7 +132,7 @@ extern uint8_t  vscp_ps_access_read8(uint16_t addr)
  */
 extern void vscp_ps_access_write8(uint16_t addr, uint8_t value)
 {
-    eeprom_write_byte((uint8_t*)addr, value);
+    eeprom_write_byte((uint8_t*)(uintptr_t)VSCP_PS_ACCESS_ADDR(addr), value);
 
     return;
 }
@@ -41,6 +41,7 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_timer.h"
+#include "../core/vscp_instance.h"
 #include "../core/vscp_util.h"
 #include "../core/vscp_config.h"
 #include <string.h>
@@ -55,24 +56,85 @@
 
 #if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_HEARTBEAT_NODE )
 
-/** Number of provided timers */
-#define VSCP_TIMER_NUM  5
+/** Number of timers, used by the core */
+#define VSCP_TIMER_CORE_NUM 4
 
 #else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
-/** Number of provided timers */
-#define VSCP_TIMER_NUM  4
+/** Number of timers, used by the core */
+#define VSCP_TIMER_CORE_NUM 3
 
 #endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_HEARTBEAT_NODE ) */
 
+/** Number of timers, used by the multi-frame stream reassembly */
+#define VSCP_TIMER_SEGMENT_NUM  VSCP_CONFIG_SEGMENT_RX_NUM
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_PS_CACHE )
+
+/** Number of timers, used by the persistent memory cache */
+#define VSCP_TIMER_PS_NUM   1
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+/** Number of timers, used by the persistent memory cache */
+#define VSCP_TIMER_PS_NUM   0
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_PS_CACHE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TX_QUEUE )
+
+/** Number of timers, used by the transport layer */
+#define VSCP_TIMER_TP_NUM   1
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+/** Number of timers, used by the transport layer */
+#define VSCP_TIMER_TP_NUM   0
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TX_QUEUE ) */
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_BRIDGE )
+
+/** Number of timers, used by the bridge */
+#define VSCP_TIMER_BRIDGE_NUM   1
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+
+/** Number of timers, used by the bridge */
+#define VSCP_TIMER_BRIDGE_NUM   0
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_BRIDGE ) */
+
+/** Number of provided timers */
+#define VSCP_TIMER_NUM  (VSCP_TIMER_CORE_NUM + VSCP_TIMER_SEGMENT_NUM + VSCP_TIMER_PS_NUM + VSCP_TIMER_TP_NUM + VSCP_TIMER_BRIDGE_NUM + VSCP_CONFIG_TIMER_APP_NUM)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_TIMER_INST         (vscp_timer_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+/** This type defines a timer context with all its internal parameters. */
+typedef struct
+{
+    uint8_t             id;         /**< Timer id (0xFF means this timer is available) */
+    BOOL                isRunning;  /**< Timer is running */
+    uint32_t            deadline;   /**< Absolute deadline in ms */
+    uint16_t            period;     /**< Period in ms of a periodic timer, 0 for a one-shot timer */
+    vscp_timer_Callback callback;   /**< Expiry callback (optional) */
+    BOOL                isLazy;     /**< Lazy timer, which doesn't keep the node awake */
+
+} vscp_timer_Timer;
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
 /** This type defines a timer context with all its internal parameters. */
 typedef struct
 {
@@ -81,16 +143,43 @@ typedef struct
 
 } vscp_timer_Timer;
 
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+/** Data of a framework instance */
+typedef struct
+{
+    /** Timers */
+    vscp_timer_Timer    timers[VSCP_TIMER_NUM];
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+    /** Any timer is running, which needs vscp_timer_process(). */
+    BOOL                isProcessPending;
+
+    /** Earliest deadline of all timers, which need vscp_timer_process(). */
+    uint32_t            processDeadline;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+} vscp_timer_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+static inline BOOL vscp_timer_isExpired(vscp_timer_Timer const * const timer, uint32_t now);
+static void vscp_timer_scheduleCallback(vscp_timer_Timer const * const timer);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
 /*******************************************************************************
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Timers */
-static vscp_timer_Timer vscp_timer_context[VSCP_TIMER_NUM];
+/** Data of all framework instances */
+static vscp_timer_Instance     vscp_timer_instances[VSCP_INSTANCE_NUM];
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -108,12 +197,18 @@ extern void vscp_timer_init(void)
     uint8_t index   = 0;
     
     /* Reset all timers */
-    memset(vscp_timer_context, 0, sizeof(vscp_timer_context));
+    memset(VSCP_TIMER_INST.timers, 0, sizeof(VSCP_TIMER_INST.timers));
     
     for(index = 0; index < VSCP_TIMER_NUM; ++index)
     {
-        vscp_timer_context[index].id = VSCP_TIMER_ID_INVALID;
+        VSCP_TIMER_INST.timers[index].id = VSCP_TIMER_ID_INVALID;
     }
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+    VSCP_TIMER_INST.isProcessPending = FALSE;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
     
     return;
 }
@@ -134,11 +229,11 @@ extern uint8_t  vscp_timer_create(void)
     for(index = 0; index < VSCP_TIMER_NUM; ++index)
     {
         /* Is the timer available? */
-        if (VSCP_TIMER_ID_INVALID == vscp_timer_context[index].id)
+        if (VSCP_TIMER_ID_INVALID == VSCP_TIMER_INST.timers[index].id)
         {
             /* Mark the timer as used */
-            vscp_timer_context[index].id    = index;
-            timerId                         = vscp_timer_context[index].id;
+            VSCP_TIMER_INST.timers[index].id = index;
+            timerId                          = VSCP_TIMER_INST.timers[index].id;
             
             break;
         }
@@ -147,6 +242,8 @@ extern uint8_t  vscp_timer_create(void)
     return timerId;
 }
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
 /**
  * This function starts the timer of the given id.
  * If the timer is already running, it will be restart with the new value.
@@ -156,9 +253,78 @@ extern uint8_t  vscp_timer_create(void)
  */
 extern void vscp_timer_start(uint8_t id, uint16_t value)
 {
-    if (VSCP_UTIL_ARRAY_NUM(vscp_timer_context) > id)
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
     {
-        vscp_timer_context[id].value = value;
+        vscp_timer_Timer * const    timer   = &VSCP_TIMER_INST.timers[id];
+
+        timer->deadline     = millis() + value;
+        timer->period       = 0;
+        timer->isRunning    = (0 < value) ? TRUE : FALSE;
+
+        vscp_timer_scheduleCallback(timer);
+    }
+
+    return;
+}
+
+/**
+ * This function starts the timer of the given id as periodic timer.
+ * After every expiry, it restarts automatically with the same period,
+ * without accumulating any delay.
+ * If the timer is already running, it will be restart with the new period.
+ *
+ * @param[in]   id      Timer id
+ * @param[in]   period  Period in ms
+ */
+extern void vscp_timer_startPeriodic(uint8_t id, uint16_t period)
+{
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        vscp_timer_Timer * const    timer   = &VSCP_TIMER_INST.timers[id];
+
+        timer->deadline     = millis() + period;
+        timer->period       = period;
+        timer->isRunning    = (0 < period) ? TRUE : FALSE;
+
+        vscp_timer_scheduleCallback(timer);
+    }
+
+    return;
+}
+
+/**
+ * This function sets a callback, which is called by vscp_timer_process()
+ * after the timer expired. A one-shot timer with callback stops after the
+ * callback was called.
+ *
+ * @param[in]   id          Timer id
+ * @param[in]   callback    Callback function (NULL to remove it)
+ */
+extern void vscp_timer_setCallback(uint8_t id, vscp_timer_Callback callback)
+{
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        VSCP_TIMER_INST.timers[id].callback = callback;
+
+        vscp_timer_scheduleCallback(&VSCP_TIMER_INST.timers[id]);
+    }
+
+    return;
+}
+
+/**
+ * This function marks a timer as lazy. A lazy timer doesn't keep the node
+ * awake, it is not considered by vscp_timer_getTimeToExpiry(). Its expiry is
+ * handled, when the node wakes up for another reason.
+ *
+ * @param[in]   id      Timer id
+ * @param[in]   isLazy  Lazy timer (TRUE) or not (FALSE)
+ */
+extern void vscp_timer_setLazy(uint8_t id, BOOL isLazy)
+{
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        VSCP_TIMER_INST.timers[id].isLazy = isLazy;
     }
 
     return;
@@ -171,9 +337,9 @@ extern void vscp_timer_start(uint8_t id, uint16_t value)
  */
 extern void vscp_timer_stop(uint8_t id)
 {
-    if (VSCP_UTIL_ARRAY_NUM(vscp_timer_context) > id)
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
     {
-        vscp_timer_context[id].value = 0;
+        VSCP_TIMER_INST.timers[id].isRunning = FALSE;
     }
 
     return;
@@ -191,9 +357,206 @@ extern BOOL vscp_timer_getStatus(uint8_t id)
 {
     BOOL    status  = FALSE;
     
-    if (VSCP_UTIL_ARRAY_NUM(vscp_timer_context) > id)
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        vscp_timer_Timer * const    timer   = &VSCP_TIMER_INST.timers[id];
+
+        if (TRUE == timer->isRunning)
+        {
+            if (FALSE == vscp_timer_isExpired(timer, millis()))
+            {
+                status = TRUE;
+            }
+            /* Expiry is handled by vscp_timer_process(), if there is a callback. */
+            else if (NULL == timer->callback)
+            {
+                /* Periodic timer? */
+                if (0 < timer->period)
+                {
+                    timer->deadline += timer->period;
+                }
+                else
+                {
+                    timer->isRunning = FALSE;
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * This function process all timers and has to be called cyclic.
+ *
+ * The timers don't depend on this function and the period is ignored. It
+ * only calls the callbacks of expired timers, restarts their periodic timers
+ * and stops expired one-shot timers. A periodic timer without callback is
+ * restarted by vscp_timer_getStatus() only, otherwise its expiry would never
+ * be seen there.
+ *
+ * @param[in]   period  Period in ticks of calling this function.
+ */
+extern void vscp_timer_process(uint16_t period)
+{
+    uint8_t     index   = 0;
+    uint32_t    now     = millis();
+
+    (void)period;
+
+    /* Nothing to do yet? */
+    if ((FALSE == VSCP_TIMER_INST.isProcessPending) ||
+        (0 > (int32_t)(now - VSCP_TIMER_INST.processDeadline)))
     {
-        if (0 < vscp_timer_context[id].value)
+        return;
+    }
+
+    VSCP_TIMER_INST.isProcessPending = FALSE;
+
+    /* Process all timers */
+    for(index = 0; index < VSCP_TIMER_NUM; ++index)
+    {
+        vscp_timer_Timer * const    timer   = &VSCP_TIMER_INST.timers[index];
+
+        if ((VSCP_TIMER_ID_INVALID == timer->id) ||
+            (FALSE == timer->isRunning) ||
+            ((NULL == timer->callback) && (0 < timer->period)))
+        {
+            continue;
+        }
+
+        /* After a sleep, a periodic timer catches up on all missed periods. */
+        while((TRUE == timer->isRunning) &&
+              (TRUE == vscp_timer_isExpired(timer, now)))
+        {
+            /* Periodic timer? */
+            if (0 < timer->period)
+            {
+                timer->deadline += timer->period;
+            }
+            else
+            {
+                timer->isRunning = FALSE;
+            }
+
+            if (NULL != timer->callback)
+            {
+                timer->callback(timer->id);
+            }
+        }
+
+        /* The callback may have changed the timer. */
+        vscp_timer_scheduleCallback(timer);
+    }
+
+    return;
+}
+
+/**
+ * This function returns the time until the earliest running timer expires.
+ * It is used to find out, how long the node can sleep. Lazy timers are not
+ * considered.
+ *
+ * @return Time in ms, 0 if a timer expired already or VSCP_TIMER_NO_EXPIRY if no timer is running.
+ */
+extern uint32_t vscp_timer_getTimeToExpiry(void)
+{
+    uint32_t    timeToExpiry    = VSCP_TIMER_NO_EXPIRY;
+    uint32_t    now             = millis();
+    uint8_t     index           = 0;
+
+    for(index = 0; (index < VSCP_TIMER_NUM) && (0 < timeToExpiry); ++index)
+    {
+        vscp_timer_Timer const * const  timer   = &VSCP_TIMER_INST.timers[index];
+
+        if ((VSCP_TIMER_ID_INVALID != timer->id) &&
+            (TRUE == timer->isRunning) &&
+            (FALSE == timer->isLazy))
+        {
+            if (TRUE == vscp_timer_isExpired(timer, now))
+            {
+                timeToExpiry = 0;
+            }
+            else if ((timer->deadline - now) < timeToExpiry)
+            {
+                timeToExpiry = timer->deadline - now;
+            }
+        }
+    }
+
+    return timeToExpiry;
+}
+
+/**
+ * This function advances all timers by the given time. Use it after a sleep,
+ * in which the platform millisecond counter stood still. Periodic timers
+ * catch up on all missed periods in the next vscp_timer_process() call.
+ *
+ * @param[in]   elapsed Elapsed time in ms
+ */
+extern void vscp_timer_advance(uint32_t elapsed)
+{
+    uint8_t index   = 0;
+
+    for(index = 0; index < VSCP_TIMER_NUM; ++index)
+    {
+        VSCP_TIMER_INST.timers[index].deadline -= elapsed;
+    }
+
+    VSCP_TIMER_INST.processDeadline -= elapsed;
+
+    return;
+}
+
+#else   /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
+/**
+ * This function starts the timer of the given id.
+ * If the timer is already running, it will be restart with the new value.
+ *
+ * @param[in]   id      Timer id
+ * @param[in]   value   Time in ms
+ */
+extern void vscp_timer_start(uint8_t id, uint16_t value)
+{
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        VSCP_TIMER_INST.timers[id].value = value;
+    }
+
+    return;
+}
+
+/**
+ * This function stops a timer with the given id.
+ *
+ * @param[in]   id  Timer id
+ */
+extern void vscp_timer_stop(uint8_t id)
+{
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        VSCP_TIMER_INST.timers[id].value = 0;
+    }
+
+    return;
+}
+
+/**
+ * This function get the status of a timer.
+ *
+ * @param[in]   id  Timer id
+ * @return  Timer status
+ * @retval  FALSE   Timer is stopped or timeout
+ * @retval  TRUE    Timer is running
+ */
+extern BOOL vscp_timer_getStatus(uint8_t id)
+{
+    BOOL    status  = FALSE;
+    
+    if (VSCP_UTIL_ARRAY_NUM(VSCP_TIMER_INST.timers) > id)
+    {
+        if (0 < VSCP_TIMER_INST.timers[id].value)
         {
             status = TRUE;
         }
@@ -215,15 +578,15 @@ extern void vscp_timer_process(uint16_t period)
     for(index = 0; index < VSCP_TIMER_NUM; ++index)
     {
         /* Is the timer enabled? */
-        if (VSCP_TIMER_ID_INVALID != vscp_timer_context[index].id)
+        if (VSCP_TIMER_ID_INVALID != VSCP_TIMER_INST.timers[index].id)
         {
-            if (period <= vscp_timer_context[index].value)
+            if (period <= VSCP_TIMER_INST.timers[index].value)
             {
-                vscp_timer_context[index].value -= period;
+                VSCP_TIMER_INST.timers[index].value -= period;
             }
             else
             {
-                vscp_timer_context[index].value = 0;
+                VSCP_TIMER_INST.timers[index].value = 0;
             }
         }
     }
@@ -231,7 +594,98 @@ extern void vscp_timer_process(uint16_t period)
     return;
 }
 
+/**
+ * This function returns the time until the earliest running timer expires.
+ * It is used to find out, how long the node can sleep.
+ *
+ * @return Time in ticks, 0 if a timer expired already or VSCP_TIMER_NO_EXPIRY if no timer is running.
+ */
+extern uint32_t vscp_timer_getTimeToExpiry(void)
+{
+    uint32_t    timeToExpiry    = VSCP_TIMER_NO_EXPIRY;
+    uint8_t     index           = 0;
+
+    for(index = 0; index < VSCP_TIMER_NUM; ++index)
+    {
+        if ((VSCP_TIMER_ID_INVALID != VSCP_TIMER_INST.timers[index].id) &&
+            (0 < VSCP_TIMER_INST.timers[index].value) &&
+            (VSCP_TIMER_INST.timers[index].value < timeToExpiry))
+        {
+            timeToExpiry = VSCP_TIMER_INST.timers[index].value;
+        }
+    }
+
+    return timeToExpiry;
+}
+
+/**
+ * This function advances all timers by the given time. Use it after a sleep,
+ * in which vscp_timer_process() was not called.
+ *
+ * @param[in]   elapsed Elapsed time in ticks
+ */
+extern void vscp_timer_advance(uint32_t elapsed)
+{
+    /* The period of a single process call is limited. */
+    while(UINT16_MAX < elapsed)
+    {
+        vscp_timer_process(UINT16_MAX);
+        elapsed -= UINT16_MAX;
+    }
+
+    vscp_timer_process((uint16_t)elapsed);
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_DISABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+/**
+ * This function checks whether the deadline of a timer is reached.
+ * The comparison is wrap around safe.
+ *
+ * @param[in]   timer   Timer
+ * @param[in]   now     Current time in ms
+ * @return  Expired or not
+ * @retval  FALSE   Not expired
+ * @retval  TRUE    Expired
+ */
+static inline BOOL vscp_timer_isExpired(vscp_timer_Timer const * const timer, uint32_t now)
+{
+    return (0 <= (int32_t)(now - timer->deadline)) ? TRUE : FALSE;
+}
+
+/**
+ * This function considers the timer for the next vscp_timer_process() run,
+ * in case it is running. There a expired timer gets its callback, is
+ * restarted or is stopped. Stopping a expired one-shot timer doesn't change
+ * its status, but vscp_timer_getTimeToExpiry() ignores it afterwards.
+ * A periodic timer without callback is not considered, because only
+ * vscp_timer_getStatus() restarts it.
+ *
+ * @param[in]   timer   Timer
+ */
+static void vscp_timer_scheduleCallback(vscp_timer_Timer const * const timer)
+{
+    if ((TRUE == timer->isRunning) &&
+        ((NULL != timer->callback) || (0 == timer->period)))
+    {
+        if ((FALSE == VSCP_TIMER_INST.isProcessPending) ||
+            (0 > (int32_t)(timer->deadline - VSCP_TIMER_INST.processDeadline)))
+        {
+            VSCP_TIMER_INST.processDeadline = timer->deadline;
+        }
+
+        VSCP_TIMER_INST.isProcessPending = TRUE;
+    }
+
+    return;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
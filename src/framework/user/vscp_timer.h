@@ -58,6 +58,7 @@ This module implements the VSCP timers.
 *******************************************************************************/
 #include <stdint.h>
 #include "../core/vscp_types.h"
+#include "../core/vscp_config.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -75,6 +76,9 @@ extern "C"
 /** Invalid timer id */
 #define VSCP_TIMER_ID_INVALID   (0xFF)
 
+/** No timer is running, see vscp_timer_getTimeToExpiry(). */
+#define VSCP_TIMER_NO_EXPIRY    ((uint32_t)0xFFFFFFFF)
+
 /*******************************************************************************
     MACROS
 *******************************************************************************/
@@ -83,6 +87,17 @@ extern "C"
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+/**
+ * This type defines the timer expiry callback.
+ *
+ * @param[in]   id  Timer id
+ */
+typedef void (*vscp_timer_Callback)(uint8_t id);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -134,10 +149,73 @@ extern BOOL vscp_timer_getStatus(uint8_t id);
 /**
  * This function process all timers and has to be called cyclic.
  *
+ * If VSCP_CONFIG_TIMER_DEADLINE is enabled, the timers don't depend on this
+ * function and the period is ignored. It only calls the callbacks of expired
+ * timers and restarts the periodic timers. Call it as often as possible then.
+ *
  * @param[in]   period  Period in ticks of calling this function.
  */
 extern void vscp_timer_process(uint16_t period);
 
+/**
+ * This function returns the time until the earliest running timer expires.
+ * It is used to find out, how long the node can sleep. Lazy timers are not
+ * considered.
+ *
+ * If VSCP_CONFIG_TIMER_DEADLINE is disabled, the time is in ticks of
+ * vscp_timer_process().
+ *
+ * @return Time in ms, 0 if a timer expired already or VSCP_TIMER_NO_EXPIRY if no timer is running.
+ */
+extern uint32_t vscp_timer_getTimeToExpiry(void);
+
+/**
+ * This function advances all timers by the given time. Use it after a sleep,
+ * in which the platform millisecond counter stood still. Periodic timers
+ * catch up on all missed periods in the next vscp_timer_process() call.
+ *
+ * If VSCP_CONFIG_TIMER_DEADLINE is disabled, the time is in ticks of
+ * vscp_timer_process().
+ *
+ * @param[in]   elapsed Elapsed time in ms
+ */
+extern void vscp_timer_advance(uint32_t elapsed);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE )
+
+/**
+ * This function starts the timer of the given id as periodic timer.
+ * After every expiry, it restarts automatically with the same period,
+ * without accumulating any delay.
+ * If the timer is already running, it will be restart with the new period.
+ *
+ * @param[in]   id      Timer id
+ * @param[in]   period  Period in ms
+ */
+extern void vscp_timer_startPeriodic(uint8_t id, uint16_t period);
+
+/**
+ * This function sets a callback, which is called by vscp_timer_process()
+ * after the timer expired. A one-shot timer with callback stops after the
+ * callback was called.
+ *
+ * @param[in]   id          Timer id
+ * @param[in]   callback    Callback function (NULL to remove it)
+ */
+extern void vscp_timer_setCallback(uint8_t id, vscp_timer_Callback callback);
+
+/**
+ * This function marks a timer as lazy. A lazy timer doesn't keep the node
+ * awake, it is not considered by vscp_timer_getTimeToExpiry(). Its expiry is
+ * handled, when the node wakes up for another reason.
+ *
+ * @param[in]   id      Timer id
+ * @param[in]   isLazy  Lazy timer (TRUE) or not (FALSE)
+ */
+extern void vscp_timer_setLazy(uint8_t id, BOOL isLazy);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_TIMER_DEADLINE ) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,7 @@
     INCLUDES
 *******************************************************************************/
 #include "vscp_tp_adapter.h"
+#include "../core/vscp_instance.h"
 
 /*******************************************************************************
     COMPILER SWITCHES
@@ -54,10 +55,46 @@
     MACROS
 *******************************************************************************/
 
+/** Data of the selected framework instance */
+#define VSCP_TP_ADAPTER_INST    (vscp_tp_adapter_instances[VSCP_INSTANCE])
+
 /*******************************************************************************
     TYPES AND STRUCTURES
 *******************************************************************************/
 
+/** Data of a framework instance */
+typedef struct
+{
+    /** Receive callback */
+    vscp_tp_adapter_Read        readFunc;
+
+    /** Transmit callback */
+    vscp_tp_adapter_Write       writeFunc;
+
+    /** Borrow callback */
+    vscp_tp_adapter_Borrow      borrowFunc;
+
+    /** Release callback */
+    vscp_tp_adapter_Release     releaseFunc;
+
+    /** Acceptance filter callback */
+    vscp_tp_adapter_SetFilter   filterFunc;
+
+    /** Frame, which is currently lent by the driver. */
+    vscp_RxMessage const *      borrowed;
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+    /** Level II receive callback */
+    vscp_tp_adapter_ReadL2      readL2Func;
+
+    /** Level II transmit callback */
+    vscp_tp_adapter_WriteL2     writeL2Func;
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
+} vscp_tp_adapter_Instance;
+
 /*******************************************************************************
     PROTOTYPES
 *******************************************************************************/
@@ -66,11 +103,8 @@
     LOCAL VARIABLES
 *******************************************************************************/
 
-/** Receive callback */
-static vscp_tp_adapter_Read     vscp_tp_adapter_readFunc    = NULL;
-
-/** Transmit callback */
-static vscp_tp_adapter_Write    vscp_tp_adapter_writeFunc   = NULL;
+/** Data of all framework instances */
+static vscp_tp_adapter_Instance vscp_tp_adapter_instances[VSCP_INSTANCE_NUM];
 
 /*******************************************************************************
     GLOBAL VARIABLES
@@ -85,8 +119,8 @@ static vscp_tp_adapter_Write    vscp_tp_adapter_writeFunc   = NULL;
  */
 extern void vscp_tp_adapter_init(void)
 {
-    /* Nothing to do */
-    
+    VSCP_TP_ADAPTER_INST.borrowed = NULL;
+
     return;
 }
 
@@ -98,8 +132,35 @@ extern void vscp_tp_adapter_init(void)
  */
 extern void vscp_tp_adapter_set(vscp_tp_adapter_Read read, vscp_tp_adapter_Write write)
 {
-    vscp_tp_adapter_readFunc    = read;
-    vscp_tp_adapter_writeFunc   = write;
+    VSCP_TP_ADAPTER_INST.readFunc  = read;
+    VSCP_TP_ADAPTER_INST.writeFunc = write;
+
+    return;
+}
+
+/**
+ * This function set the zero-copy receive callbacks. If a borrow callback is
+ * set, it is used instead of the receive callback.
+ *
+ * @param[in]   borrow  Borrow callback
+ * @param[in]   release Release callback
+ */
+extern void vscp_tp_adapter_setBorrowed(vscp_tp_adapter_Borrow borrow, vscp_tp_adapter_Release release)
+{
+    VSCP_TP_ADAPTER_INST.borrowFunc  = borrow;
+    VSCP_TP_ADAPTER_INST.releaseFunc = release;
+
+    return;
+}
+
+/**
+ * This function set the acceptance filter callback.
+ *
+ * @param[in]   setFilter   Acceptance filter callback
+ */
+extern void vscp_tp_adapter_setFilterFunc(vscp_tp_adapter_SetFilter setFilter)
+{
+    VSCP_TP_ADAPTER_INST.filterFunc = setFilter;
 
     return;
 }
@@ -118,15 +179,68 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg)
 
     if (NULL != msg)
     {
-        if (NULL != vscp_tp_adapter_readFunc)
+        if (NULL != VSCP_TP_ADAPTER_INST.readFunc)
         {
-            status = vscp_tp_adapter_readFunc(msg);
+            status = VSCP_TP_ADAPTER_INST.readFunc(msg);
         }
     }
 
     return status;
 }
 
+/**
+ * This function borrows a received message from the transport layer.
+ * If the driver lends its own frame buffer, a pointer to it is returned.
+ * Otherwise the message is read into the given storage.
+ * Every borrowed message must be given back via vscp_tp_adapter_releaseMessage().
+ *
+ * @param[in]   storage Message storage, used if the driver doesn't lend its frame buffer
+ * @return  Received message or NULL if no message is available
+ */
+extern vscp_RxMessage const * vscp_tp_adapter_borrowMessage(vscp_RxMessage * const storage)
+{
+    vscp_RxMessage const *  msg = NULL;
+
+    /* Only one frame can be lent at a time. */
+    if (NULL == VSCP_TP_ADAPTER_INST.borrowed)
+    {
+        if (NULL != VSCP_TP_ADAPTER_INST.borrowFunc)
+        {
+            msg = VSCP_TP_ADAPTER_INST.borrowFunc();
+
+            VSCP_TP_ADAPTER_INST.borrowed = msg;
+        }
+        else if (TRUE == vscp_tp_adapter_readMessage(storage))
+        {
+            msg = storage;
+        }
+    }
+
+    return msg;
+}
+
+/**
+ * This function gives a borrowed message back to the transport layer.
+ *
+ * @param[in]   msg Borrowed message
+ */
+extern void vscp_tp_adapter_releaseMessage(vscp_RxMessage const * const msg)
+{
+    /* Only a frame of the driver is given back, but not the local storage. */
+    if ((NULL != msg) &&
+        (VSCP_TP_ADAPTER_INST.borrowed == msg))
+    {
+        if (NULL != VSCP_TP_ADAPTER_INST.releaseFunc)
+        {
+            VSCP_TP_ADAPTER_INST.releaseFunc(msg);
+        }
+
+        VSCP_TP_ADAPTER_INST.borrowed = NULL;
+    }
+
+    return;
+}
+
 /**
  * This function writes a message to the transport layer.
  *
@@ -142,15 +256,92 @@ extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg)
     if ((NULL != msg) &&                        /* Message shall exists */
         (VSCP_L1_DATA_SIZE >= msg->dataSize))   /* Number of data bytes is limited */
     {
-        if (NULL != vscp_tp_adapter_writeFunc)
+        if (NULL != VSCP_TP_ADAPTER_INST.writeFunc)
         {
-            status = vscp_tp_adapter_writeFunc(msg);
+            status = VSCP_TP_ADAPTER_INST.writeFunc(msg);
         }
     }
 
     return status;
 }
 
+/**
+ * This function configures the receive acceptance filters of the transport
+ * layer. Without a acceptance filter callback, it does nothing.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of acceptance filters
+ */
+extern void vscp_tp_adapter_setAcceptanceFilter(vscp_AcceptanceFilter const * const filters, uint8_t num)
+{
+    if (NULL != VSCP_TP_ADAPTER_INST.filterFunc)
+    {
+        VSCP_TP_ADAPTER_INST.filterFunc(filters, num);
+    }
+
+    return;
+}
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function set the Level II transport layer callbacks.
+ *
+ * @param[in]   read    Level II receive callback
+ * @param[in]   write   Level II transmit callback
+ */
+extern void vscp_tp_adapter_setL2(vscp_tp_adapter_ReadL2 read, vscp_tp_adapter_WriteL2 write)
+{
+    VSCP_TP_ADAPTER_INST.readL2Func  = read;
+    VSCP_TP_ADAPTER_INST.writeL2Func = write;
+
+    return;
+}
+
+/**
+ * This function reads a Level II message from the transport layer.
+ *
+ * @param[in,out]   msg Message storage, with a payload block as data
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_tp_adapter_readL2Message(vscp_L2Message * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&
+        (NULL != VSCP_TP_ADAPTER_INST.readL2Func))
+    {
+        status = VSCP_TP_ADAPTER_INST.readL2Func(msg);
+    }
+
+    return status;
+}
+
+/**
+ * This function writes a Level II message to the transport layer.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_tp_adapter_writeL2Message(vscp_L2Message const * const msg)
+{
+    BOOL    status  = FALSE;
+
+    if ((NULL != msg) &&
+        (NULL != VSCP_TP_ADAPTER_INST.writeL2Func))
+    {
+        status = VSCP_TP_ADAPTER_INST.writeL2Func(msg);
+    }
+
+    return status;
+}
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 /*******************************************************************************
     LOCAL FUNCTIONS
 *******************************************************************************/
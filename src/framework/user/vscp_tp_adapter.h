@@ -66,6 +66,7 @@ the transport layer of VSCP.
 *******************************************************************************/
 #include <stdint.h>
 #include "../core/vscp_types.h"
+#include "../core/vscp_config.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -94,6 +95,32 @@ typedef BOOL (*vscp_tp_adapter_Read)(vscp_RxMessage * const msg);
 /** Transmit callback */
 typedef BOOL (*vscp_tp_adapter_Write)(vscp_TxMessage const * const msg);
 
+/**
+ * Borrow callback, which lends a received frame of the driver.
+ * It returns NULL if no frame is available. The frame must stay valid and
+ * unchanged until it is given back via the release callback.
+ */
+typedef vscp_RxMessage const * (*vscp_tp_adapter_Borrow)(void);
+
+/** Release callback, which gives a borrowed frame back to the driver. */
+typedef void (*vscp_tp_adapter_Release)(vscp_RxMessage const * const msg);
+
+/**
+ * Acceptance filter callback, which configures the receive filters of the
+ * driver. A frame shall be received, if it passes at least one filter.
+ * If no filter is given, all frames shall be received.
+ */
+typedef void (*vscp_tp_adapter_SetFilter)(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+/**
+ * Level II receive callback. The data of the message points to a payload
+ * block, which can take up to VSCP_CONFIG_L2_BLOCK_SIZE bytes.
+ */
+typedef BOOL (*vscp_tp_adapter_ReadL2)(vscp_L2Message * const msg);
+
+/** Level II transmit callback */
+typedef BOOL (*vscp_tp_adapter_WriteL2)(vscp_L2Message const * const msg);
+
 /*******************************************************************************
     VARIABLES
 *******************************************************************************/
@@ -115,6 +142,22 @@ extern void vscp_tp_adapter_init(void);
  */
 extern void vscp_tp_adapter_set(vscp_tp_adapter_Read read, vscp_tp_adapter_Write write);
 
+/**
+ * This function set the zero-copy receive callbacks. If a borrow callback is
+ * set, it is used instead of the receive callback.
+ *
+ * @param[in]   borrow  Borrow callback
+ * @param[in]   release Release callback
+ */
+extern void vscp_tp_adapter_setBorrowed(vscp_tp_adapter_Borrow borrow, vscp_tp_adapter_Release release);
+
+/**
+ * This function set the acceptance filter callback.
+ *
+ * @param[in]   setFilter   Acceptance filter callback
+ */
+extern void vscp_tp_adapter_setFilterFunc(vscp_tp_adapter_SetFilter setFilter);
+
 /**
  * This function reads a message from the transport layer.
  *
@@ -125,6 +168,24 @@ extern void vscp_tp_adapter_set(vscp_tp_adapter_Read read, vscp_tp_adapter_Write
  */
 extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg);
 
+/**
+ * This function borrows a received message from the transport layer.
+ * If the driver lends its own frame buffer, a pointer to it is returned.
+ * Otherwise the message is read into the given storage.
+ * Every borrowed message must be given back via vscp_tp_adapter_releaseMessage().
+ *
+ * @param[in]   storage Message storage, used if the driver doesn't lend its frame buffer
+ * @return  Received message or NULL if no message is available
+ */
+extern vscp_RxMessage const * vscp_tp_adapter_borrowMessage(vscp_RxMessage * const storage);
+
+/**
+ * This function gives a borrowed message back to the transport layer.
+ *
+ * @param[in]   msg Borrowed message
+ */
+extern void vscp_tp_adapter_releaseMessage(vscp_RxMessage const * const msg);
+
 /**
  * This function writes a message to the transport layer.
  *
@@ -135,6 +196,47 @@ extern BOOL vscp_tp_adapter_readMessage(vscp_RxMessage * const msg);
  */
 extern BOOL vscp_tp_adapter_writeMessage(vscp_TxMessage const * const msg);
 
+/**
+ * This function configures the receive acceptance filters of the transport
+ * layer. Without a acceptance filter callback, it does nothing.
+ *
+ * @param[in]   filters Acceptance filters
+ * @param[in]   num     Number of acceptance filters
+ */
+extern void vscp_tp_adapter_setAcceptanceFilter(vscp_AcceptanceFilter const * const filters, uint8_t num);
+
+#if VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 )
+
+/**
+ * This function set the Level II transport layer callbacks.
+ *
+ * @param[in]   read    Level II receive callback
+ * @param[in]   write   Level II transmit callback
+ */
+extern void vscp_tp_adapter_setL2(vscp_tp_adapter_ReadL2 read, vscp_tp_adapter_WriteL2 write);
+
+/**
+ * This function reads a Level II message from the transport layer.
+ *
+ * @param[in,out]   msg Message storage, with a payload block as data
+ * @return  Message received or not
+ * @retval  FALSE   No message received
+ * @retval  TRUE    Message received
+ */
+extern BOOL vscp_tp_adapter_readL2Message(vscp_L2Message * const msg);
+
+/**
+ * This function writes a Level II message to the transport layer.
+ *
+ * @param[in]   msg Message
+ * @return  Message sent or not
+ * @retval  FALSE   Couldn't send message
+ * @retval  TRUE    Message successful sent
+ */
+extern BOOL vscp_tp_adapter_writeL2Message(vscp_L2Message const * const msg);
+
+#endif  /* VSCP_CONFIG_BASE_IS_ENABLED( VSCP_CONFIG_LEVEL2 ) */
+
 #ifdef __cplusplus
 }
 #endif